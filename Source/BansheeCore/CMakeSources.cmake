@@ -133,6 +133,9 @@ set(BS_BANSHEECORE_INC_RENDERAPI
 	"Include/BsGpuParam.h"
 	"Include/BsGpuBuffer.h"
 	"Include/BsEventQuery.h"
+	"Include/BsGpuReadback.h"
+	"Include/BsOcclusionBuffer.h"
+	"Include/BsRenderGraph.h"
 	"Include/BsDepthStencilState.h"
 	"Include/BsBlendState.h"
 	"Include/BsRenderAPI.h"
@@ -187,6 +190,8 @@ set(BS_BANSHEECORE_INC_RESOURCES
 	"Include/BsTransientMesh.h"
 	"Include/BsTextureManager.h"
 	"Include/BsTexture.h"
+	"Include/BsTextureStreaming.h"
+	"Include/BsTextureStreamingManager.h"
 	"Include/BsResources.h"
 	"Include/BsResourceManifest.h"
 	"Include/BsResourceHandle.h"
@@ -361,6 +366,8 @@ set(BS_BANSHEECORE_SRC_RESOURCES
 	"Source/BsResources.cpp"
 	"Source/BsTexture.cpp"
 	"Source/BsTextureManager.cpp"
+	"Source/BsTextureStreaming.cpp"
+	"Source/BsTextureStreamingManager.cpp"
 	"Source/BsTransientMesh.cpp"
 	"Source/BsVertexDataDesc.cpp"
 	"Source/BsResourceMetaData.cpp"
@@ -405,6 +412,9 @@ set(BS_BANSHEECORE_SRC_RENDERAPI
 	"Source/BsBlendState.cpp"
 	"Source/BsDepthStencilState.cpp"
 	"Source/BsEventQuery.cpp"
+	"Source/BsGpuReadback.cpp"
+	"Source/BsOcclusionBuffer.cpp"
+	"Source/BsRenderGraph.cpp"
 	"Source/BsGpuBuffer.cpp"
 	"Source/BsGpuParam.cpp"
 	"Source/BsGpuParamBlockBuffer.cpp"
@@ -156,7 +156,7 @@ namespace bs
 		RTTITypeBase* getRTTI() const override;
 
 	protected:
-		CCharacterController() {} // Serialization only
+		CCharacterController() { mUpdateFlags = CUF_NoUpdate; } // Serialization only
      };
 
 	 /** @} */
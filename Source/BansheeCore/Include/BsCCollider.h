@@ -185,7 +185,7 @@ namespace bs
 		RTTITypeBase* getRTTI() const override;
 
 	protected:
-		CCollider() {} // Serialization only
+		CCollider() { mUpdateFlags = CUF_NoUpdate; } // Serialization only
      };
 
 	 /** @} */
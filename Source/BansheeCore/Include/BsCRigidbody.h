@@ -259,7 +259,7 @@ namespace bs
 		RTTITypeBase* getRTTI() const override;
 
 	protected:
-		CRigidbody() {} // Serialization only
+		CRigidbody() { mUpdateFlags = CUF_NoUpdate; } // Serialization only
 	};
 
 	/** @} */
@@ -12,6 +12,19 @@ namespace bs
 	 *  @{
 	 */
 
+	/** Flags that control how and if the scene manager calls Component::update(). */
+	enum ComponentUpdateFlags
+	{
+		CUF_None = 0x00, /**< Component is updated once per frame, sequentially with other components. */
+		CUF_NoUpdate = 0x01, /**< Component doesn't implement update() and will not be placed in any update list. */
+		/**
+		 * Component's update() only touches the component's own state and may be called in parallel with other 
+		 * components of the same type. Such update() must not create, destroy, enable or disable components or scene 
+		 * objects.
+		 */
+		CUF_ThreadSafe = 0x02
+	};
+
 	/** Components represent primary logic elements in the scene. They are attached to scene objects. */
 	class BS_CORE_EXPORT Component : public GameObject
 	{
@@ -68,10 +81,14 @@ namespace bs
 		 */
 		virtual void _instantiate() {}
 
+		/** Returns flags that control how and if the scene manager calls update() on this component. */
+		ComponentUpdateFlags _getUpdateFlags() const { return mUpdateFlags; }
+
 		/** @} */
 	protected:
 		friend class SceneObject;
 		friend class SceneObjectRTTI;
+		friend class CoreSceneManager;
 
 		Component(const HSceneObject& parent);
 		virtual ~Component();
@@ -97,6 +114,12 @@ namespace bs
 		/** Checks whether the component wants to received the specified transform changed message. */
 		bool supportsNotify(TransformChangedFlags flags) const { return (mNotifyFlags & flags) != 0; }
 
+		/**
+		 * Sets flags that control how and if the scene manager calls update() on this component. Should be called from
+		 * the component constructor. Changes made while the component is enabled only apply once it is re-enabled.
+		 */
+		void setUpdateFlags(ComponentUpdateFlags flags) { mUpdateFlags = flags; }
+
 		/**
 		 * Destroys this component.
 		 *
@@ -113,10 +136,14 @@ namespace bs
 	protected:
 		HComponent mThisHandle;
 		TransformChangedFlags mNotifyFlags;
+		ComponentUpdateFlags mUpdateFlags;
 
 	private:
 		HSceneObject mParent;
 
+		UINT32 mUpdateListIdx;
+		UINT32 mUpdateIdx;
+
 		/************************************************************************/
 		/* 								RTTI		                     		*/
 		/************************************************************************/
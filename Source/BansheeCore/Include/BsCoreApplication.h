@@ -26,6 +26,18 @@ namespace bs
 
 		Vector<String> importers; /**< A list of importer plugins to load. */
 
+		/**
+		 * If true, more detailed mip levels of large textures loaded from disk will be streamed in only when the renderer
+		 * needs them. Ignored if the render API doesn't support RSC_TEXTURE_STREAMING. See TextureStreamingManager.
+		 */
+		bool textureStreaming = false;
+
+		/**
+		 * If true, messages are logged asynchronously, so threads logging many messages don't wait on each other. See
+		 * Debug::startAsyncLogging().
+		 */
+		bool asyncLogging = false;
+
 		/** Optional callback function to be called every frame while the application is running. */
 		std::function<void()> updateCallback; 
 	};
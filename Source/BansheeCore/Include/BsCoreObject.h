@@ -151,6 +151,8 @@ namespace bs
 		UINT32 mCoreDirtyFlags;
 		UINT64 mInternalID; // ID == 0 is not a valid ID
 		std::weak_ptr<CoreObject> mThis;
+		CoreObject* mNextDirty; // Next object in CoreObjectManager's lock-free dirty list
+		std::atomic<bool> mInDirtyList; // True while the object is in CoreObjectManager's dirty list
 
 		/**
 		 * Queues object initialization command on the core thread. The command is added to the primary core thread queue 
@@ -12,6 +12,19 @@ namespace bs
 	 *  @{
 	 */
 
+	/** Statistics about a single CoreObjectManager::syncToCore() call. */
+	struct CoreObjectSyncStats
+	{
+		/** Number of objects marked as dirty, including objects dependant on dirty objects. */
+		UINT32 numDirtyObjects = 0;
+
+		/** Number of objects whose data was serialized for the core thread. */
+		UINT32 numSyncedObjects = 0;
+
+		/** Number of worker thread tasks the serialization was split into. Zero if it was done on the calling thread. */
+		UINT32 numSyncTasks = 0;
+	};
+
 	// TODO Low priority - Add debug option that would remember a call stack for each resource initialization,
 	// so when we fail to release one we know which one it is.
 	
@@ -30,16 +43,18 @@ namespace bs
 		struct CoreStoredSyncObjData
 		{
 			CoreStoredSyncObjData()
-				:internalId(0)
+				:internalId(0), allocator(nullptr)
 			{ }
 
-			CoreStoredSyncObjData(const SPtr<CoreObjectCore> destObj, UINT64 internalId, const CoreSyncData& syncData)
-				:destinationObj(destObj), syncData(syncData), internalId(internalId)
+			CoreStoredSyncObjData(const SPtr<CoreObjectCore> destObj, UINT64 internalId, const CoreSyncData& syncData,
+				FrameAlloc* allocator)
+				:destinationObj(destObj), syncData(syncData), internalId(internalId), allocator(allocator)
 			{ }
 
 			SPtr<CoreObjectCore> destinationObj;
 			CoreSyncData syncData;
 			UINT64 internalId;
+			FrameAlloc* allocator;
 		};
 
 		/**
@@ -48,8 +63,8 @@ namespace bs
 		 */
 		struct CoreStoredSyncData
 		{
-			FrameAlloc* alloc = nullptr;
 			Vector<CoreStoredSyncObjData> entries;
+			Vector<FrameAlloc*> workerAllocs;
 		};
 
 		/** Contains information about a dirty CoreObject that requires syncing to the core thread. */	
@@ -69,7 +84,10 @@ namespace bs
 		/** Unregisters a CoreObject notifying the manager the object is destroyed. */
 		void unregisterObject(CoreObject* object);
 
-		/**	Notifies the system that a CoreObject is dirty and needs to be synced with the core thread. */
+		/**
+		 * Notifies the system that a CoreObject is dirty and needs to be synced with the core thread. Objects already
+		 * waiting to be synced are ignored. Lock-free.
+		 */
 		void notifyCoreDirty(CoreObject* object);
 
 		/**	Notifies the system that CoreObject dependencies are dirty and should be updated. */
@@ -93,7 +111,17 @@ namespace bs
 		 */
 		void syncToCore(CoreObject* object);
 
+		/**
+		 * Returns statistics about the last call to syncToCore().
+		 *
+		 * @note	Sim thread only.
+		 */
+		const CoreObjectSyncStats& getSyncStats() const { return mSyncStats; }
+
 	private:
+		/** Minimum number of objects serialized by a single worker thread task during syncToCore(). */
+		static const UINT32 MIN_OBJECTS_PER_SYNC_TASK = 64;
+
 		/**
 		 * Stores all syncable data from dirty core objects into memory allocated by the provided allocator. Additional 
 		 * meta-data is stored internally to be used by call to syncUpload().
@@ -113,6 +141,33 @@ namespace bs
 		 */
 		void syncUpload();
 
+		/**
+		 * Serializes data of objects collected by syncDownload() into the provided sync data entries. Objects are
+		 * serialized in order of their dependency level, and objects within the same level are split between worker
+		 * threads if there are enough of them and the task scheduler is running.
+		 *
+		 * @param[in]	syncData	Sync data whose entries to populate. Must have an entry for each collected object.
+		 * @param[in]	allocator	Allocator to use for serializing on the calling thread.
+		 *
+		 * @note	Sim thread only. Must be called with the objects mutex locked.
+		 */
+		void serializeSyncData(CoreStoredSyncData& syncData, FrameAlloc* allocator);
+
+		/**
+		 * Moves all objects from the lock-free dirty list into the dirty object map.
+		 *
+		 * @note	Must be called with the objects mutex locked.
+		 */
+		void drainDirtyList();
+
+		/**
+		 * Returns a frame allocator that can be used by a worker thread for serializing sync data. Allocators are returned
+		 * to the pool once the core thread applies the data allocated with them.
+		 *
+		 * @note	Must be called with the objects mutex locked.
+		 */
+		FrameAlloc* getWorkerAlloc();
+
 		/**
 		 * Updates the cached list of dependencies and dependants for the specified object.
 		 * 			
@@ -129,6 +184,14 @@ namespace bs
 
 		Vector<CoreStoredSyncObjData> mDestroyedSyncData;
 		List<CoreStoredSyncData> mCoreSyncData;
+		Vector<FrameAlloc*> mFreeWorkerAllocs;
+
+		std::atomic<CoreObject*> mDirtyListHead;
+
+		Vector<CoreObject*> mSyncObjects; // Transient
+		Vector<UINT32> mSyncLevels; // Transient
+		Vector<UINT32> mSyncOrder; // Transient
+		CoreObjectSyncStats mSyncStats;
 
 		Mutex mObjectsMutex;
 	};
@@ -219,8 +219,8 @@
 
 namespace bs 
 {
-	static const StringID RenderAPIAny = "AnyRenderAPI";
-	static const StringID RendererAny = "AnyRenderer";
+	static const StringID RenderAPIAny = "AnyRenderAPI"_sid;
+	static const StringID RendererAny = "AnyRenderer"_sid;
 
     class Color;
     class GpuProgram;
@@ -297,6 +297,8 @@ namespace bs
 	class EventQuery;
 	class TimerQuery;
 	class OcclusionQuery;
+	class OcclusionBuffer;
+	struct OccluderGeometry;
 	class FrameAlloc;
 	class FolderMonitor;
 	class VideoMode;
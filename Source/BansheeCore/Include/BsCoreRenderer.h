@@ -19,31 +19,31 @@ namespace bs
 	 * Available parameter block semantics that allow the renderer to identify the use of a GPU program parameter block 
 	 * specified in a shader.
 	 */
-	static StringID RBS_Static = "Static";
-	static StringID RBS_PerCamera = "PerCamera";
-	static StringID RBS_PerFrame = "PerFrame";
-	static StringID RBS_PerObject = "PerObject";
-	static StringID RBS_PerCall = "PerCall";
+	static StringID RBS_Static = "Static"_sid;
+	static StringID RBS_PerCamera = "PerCamera"_sid;
+	static StringID RBS_PerFrame = "PerFrame"_sid;
+	static StringID RBS_PerObject = "PerObject"_sid;
+	static StringID RBS_PerCall = "PerCall"_sid;
 
 	/**
 	 * Available parameter semantics that allow the renderer to identify the use of a GPU parameter specified in a shader.
 	 */
-	static StringID RPS_WorldViewProjTfrm = "WVP";
-	static StringID RPS_ViewProjTfrm = "VP";
-	static StringID RPS_ProjTfrm = "P";
-	static StringID RPS_ViewTfrm = "V";
-	static StringID RPS_WorldTfrm = "W";
-	static StringID RPS_InvWorldTfrm = "IW";
-	static StringID RPS_WorldNoScaleTfrm = "WNoScale";
-	static StringID RPS_InvWorldNoScaleTfrm = "IWNoScale";
-	static StringID RPS_WorldDeterminantSign = "WorldDeterminantSign";
-	static StringID RPS_Diffuse = "Diffuse";
-	static StringID RPS_ViewDir = "ViewDir";
+	static StringID RPS_WorldViewProjTfrm = "WVP"_sid;
+	static StringID RPS_ViewProjTfrm = "VP"_sid;
+	static StringID RPS_ProjTfrm = "P"_sid;
+	static StringID RPS_ViewTfrm = "V"_sid;
+	static StringID RPS_WorldTfrm = "W"_sid;
+	static StringID RPS_InvWorldTfrm = "IW"_sid;
+	static StringID RPS_WorldNoScaleTfrm = "WNoScale"_sid;
+	static StringID RPS_InvWorldNoScaleTfrm = "IWNoScale"_sid;
+	static StringID RPS_WorldDeterminantSign = "WorldDeterminantSign"_sid;
+	static StringID RPS_Diffuse = "Diffuse"_sid;
+	static StringID RPS_ViewDir = "ViewDir"_sid;
 
 	/** Technique tags. */
-	static StringID RTag_Skinned = "Skinned";
-	static StringID RTag_Morph = "Morph";
-	static StringID RTag_SkinnedMorph = "SkinnedMorph";
+	static StringID RTag_Skinned = "Skinned"_sid;
+	static StringID RTag_Morph = "Morph"_sid;
+	static StringID RTag_SkinnedMorph = "SkinnedMorph"_sid;
 
 	/**	Set of options that can be used for controlling the renderer. */	
 	struct BS_CORE_EXPORT CoreRendererOptions
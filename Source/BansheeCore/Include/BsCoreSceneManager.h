@@ -28,6 +28,11 @@ namespace bs
 	/**
 	 * Manages all objects in the scene and provides various query methods for finding objects. This is just the base class
 	 * with basic query functionality. You should override it with your own version.
+	 *
+	 * @note
+	 * Components are updated from per-type lists that are maintained as components are enabled and disabled, rather
+	 * than by walking the scene hierarchy. Components of different types are therefore updated in the order their type
+	 * was first seen. Components of the same type are updated in no particular order.
 	 */
 	class BS_CORE_EXPORT CoreSceneManager : public Module<CoreSceneManager>
 	{
@@ -75,6 +80,29 @@ namespace bs
 		/** Called every frame. Calls update methods on all scene objects and their components. */
 		virtual void _update();
 
+		/**
+		 * Notifies the scene manager that a component was enabled and should start receiving update() calls. Does nothing
+		 * if the component is already registered or doesn't require updates.
+		 */
+		void _notifyComponentActivated(Component* component);
+
+		/**
+		 * Notifies the scene manager that a component was disabled or is about to be destroyed, and should stop receiving
+		 * update() calls. Does nothing if the component isn't registered.
+		 */
+		void _notifyComponentDeactivated(Component* component);
+
+		/** Returns the number of components that currently receive update() calls. */
+		UINT32 _getNumUpdatingComponents() const { return mNumUpdatingComponents; }
+
+		/**
+		 * Registers a callback that updates all enabled components of the specified RTTI type with a single call, instead
+		 * of update() being called on each of them. The callback receives the type's update list. Entries of components
+		 * disabled while the callback executes are set to null, and the list is not otherwise modified until the callback
+		 * returns. Provide a null callback to restore per-component updates.
+		 */
+		void _setBatchUpdateCallback(UINT32 typeId, const std::function<void(Component**, UINT32)>& callback);
+
 		/** Updates dirty transforms on any core objects that may be tied with scene objects. */
 		virtual void _updateCoreObjectTransforms() { }
 
@@ -97,6 +125,27 @@ namespace bs
 		/**	Callback that is triggered when the main render target size is changed. */
 		void onMainRenderTargetResized();
 
+		/** Contains all enabled components of a single type that require update() calls. */
+		struct ComponentUpdateList
+		{
+			Vector<Component*> components;
+			UINT32 typeId;
+			bool threadSafe;
+			bool needsCompaction;
+		};
+
+		/**
+		 * Calls update() on all components in the update list with the specified index, or forwards the list to the batch
+		 * update callback of its type. If the list is thread safe the work might be split over multiple worker threads.
+		 */
+		void updateComponents(UINT32 listIdx);
+
+		/** Adds the component to the update list for its type, creating the list if one doesn't exist. */
+		void addToUpdateList(Component* component);
+
+		/** Removes empty entries left in an update list by components deactivated while the list was being updated. */
+		void compactUpdateList(UINT32 listIdx);
+
 	protected:
 		HSceneObject mRootNode;
 
@@ -105,6 +154,13 @@ namespace bs
 
 		SPtr<RenderTarget> mMainRT;
 		HEvent mMainRTResizedConn;
+
+		Vector<ComponentUpdateList> mUpdateLists;
+		UnorderedMap<UINT64, UINT32> mUpdateListLookup;
+		UnorderedMap<UINT32, std::function<void(Component**, UINT32)>> mBatchUpdateCallbacks;
+		Vector<Component*> mPendingActivations;
+		UINT32 mNumUpdatingComponents;
+		bool mIsUpdatingComponents;
 	};
 
 	/**
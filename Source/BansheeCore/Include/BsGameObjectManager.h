@@ -32,6 +32,10 @@ namespace bs
 	/**
 	 * Tracks GameObject creation and destructions. Also resolves GameObject references from GameObject handles.
 	 *
+	 * Objects are stored in a slot map. Each instance ID encodes the index of the slot the object was registered in,
+	 * along with the slot's generation at that time, so lookups don't require a search. Slots get reused once their
+	 * object is destroyed, and their generation gets incremented so old IDs never resolve to the new object.
+	 *
 	 * @note	Sim thread only.
 	 */
 	class BS_CORE_EXPORT GameObjectManager : public Module<GameObjectManager>
@@ -43,6 +47,20 @@ namespace bs
 			GameObjectHandleBase handle;
 		};
 
+		/** Entry in the object slot map. */
+		struct ObjectSlot
+		{
+			ObjectSlot()
+				:instanceId(0), generation(0), nextFreeSlot(INVALID_SLOT), queuedForDestroy(false)
+			{ }
+
+			SPtr<GameObjectHandleData> handleData;
+			UINT64 instanceId; /**< ID of the object in the slot, or 0 if the slot is free. */
+			UINT32 generation; /**< Incremented every time the slot is freed. */
+			UINT32 nextFreeSlot; /**< Next slot in the free list, if this slot is free. */
+			bool queuedForDestroy;
+		};
+
 	public:
 		GameObjectManager();
 		~GameObjectManager();
@@ -91,6 +109,15 @@ namespace bs
 		/**	Destroys any GameObjects that were queued for destruction. */
 		void destroyQueuedObjects();
 
+		/** Returns the number of currently registered GameObjects. */
+		UINT32 getNumObjects() const { return mNumObjects; }
+
+		/** 
+		 * Pre-allocates storage for the provided number of GameObjects, avoiding re-allocations when registering many 
+		 * objects at once (for example when loading a large scene). 
+		 */
+		void reserve(UINT32 numObjects);
+
 		/**	Triggered when a game object is being destroyed. */
 		Event<void(const HGameObject&)> onDestroyed;
 
@@ -137,14 +164,32 @@ namespace bs
 		UINT32 getDeserializationFlags() const { return mGODeserializationMode; }
 
 	private:
-		UINT64 mNextAvailableID; // 0 is not a valid ID
-		Map<UINT64, GameObjectHandleBase> mObjects;
-		Map<UINT64, GameObjectHandleBase> mQueuedForDestroy;
+		/** Returns a free slot for a new object, and assigns a new instance ID to it. */
+		UINT32 allocateSlot();
+
+		/** Releases a slot of a destroyed object so it can be reused. */
+		void freeSlot(UINT32 slotIdx);
+
+		/** Returns the index of the slot the object with the provided ID is stored in, or INVALID_SLOT if not found. */
+		UINT32 findSlot(UINT64 id) const;
+
+		/** Returns the index of the slot that an instance ID was originally assigned to. */
+		static UINT32 getSlotIndex(UINT64 id) { return (UINT32)(id & 0xFFFFFFFF) - 1; }
+
+		static const UINT32 INVALID_SLOT = (UINT32)-1;
+
+		Vector<ObjectSlot> mSlots;
+		UINT32 mFirstFreeSlot;
+		UINT32 mNumObjects;
+
+		// Objects whose IDs were changed through remapId() no longer match their slot index, so they are looked up here
+		UnorderedMap<UINT64, UINT32> mRemappedIds;
+		Vector<GameObjectHandleBase> mQueuedForDestroy;
 
 		GameObject* mActiveDeserializedObject;
 		bool mIsDeserializationActive;
-		Map<UINT64, UINT64> mIdMapping;
-		Map<UINT64, SPtr<GameObjectHandleData>> mUnresolvedHandleData;
+		UnorderedMap<UINT64, UINT64> mIdMapping;
+		UnorderedMap<UINT64, SPtr<GameObjectHandleData>> mUnresolvedHandleData;
 		Vector<UnresolvedHandle> mUnresolvedHandles;
 		Vector<std::function<void()>> mEndCallbacks;
 		UINT32 mGODeserializationMode;
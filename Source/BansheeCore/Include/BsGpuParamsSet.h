@@ -102,6 +102,24 @@ namespace bs
 			StageParamInfo stages[GPT_COUNT];
 		};
 
+		/** Types of parameter mappings a material parameter can be referenced by. */
+		enum class ParamRefType
+		{
+			Data, Texture, LoadStoreTexture, Buffer, SamplerState
+		};
+
+		/**
+		 * Reference to a single data or object parameter mapping, allowing the mappings to be looked up from a material
+		 * parameter index.
+		 */
+		struct ParamRef
+		{
+			ParamRefType type;
+			UINT32 passIdx; /**< Unused for data parameters. */
+			UINT32 stageIdx; /**< Unused for data parameters. */
+			UINT32 infoIdx; /**< Index into mDataParamInfos, or into the relevant array of the stage. */
+		};
+
 	public:
 		TGpuParamsSet() {}
 		TGpuParamsSet(const SPtr<TechniqueType>& technique, const ShaderType& shader,
@@ -173,11 +191,26 @@ namespace bs
 	private:
 		template<bool Core2> friend class TMaterial;
 
+		/** Builds the mapping from material parameter indices to the parameter mappings that reference them. */
+		void buildParamRefs(UINT32 numMaterialParams);
+
+		/** Writes the value of a data parameter into its parameter block buffer, if the buffer allows updates. */
+		void updateDataParam(const MaterialParamsType& params, const DataParamInfo& paramInfo);
+
+		/** Assigns the value of an object parameter to the GPU parameters of a single pass. */
+		void updateObjectParam(const MaterialParamsType& params, GpuParamsType& gpuParams, ParamRefType type,
+			const ObjectParamInfo& paramInfo);
+
 		Vector<SPtr<GpuParamsType>> mPassParams;
 		Vector<BlockInfo> mBlocks;
 		Vector<DataParamInfo> mDataParamInfos;
 		PassParamInfo* mPassParamInfos;
 
+		Vector<ParamRef> mParamRefs;
+		Vector<UINT32> mParamRefOffsets; // Per material parameter, range into mParamRefs, with one extra entry at the end
+		Vector<UINT32> mDirtyParams; // Transient
+		Vector<bool> mDirtyPasses; // Transient
+
 		UINT64 mParamVersion;
 		UINT8* mData;
 	};
@@ -0,0 +1,114 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsModule.h"
+#include "BsEvent.h"
+
+namespace bs
+{
+	/** @addtogroup RenderAPI
+	 *  @{
+	 */
+
+	/** Callback triggered when data read back from the GPU becomes available. */
+	typedef std::function<void(const SPtr<PixelData>&)> TextureReadbackCallback;
+
+	/**
+	 * Reads data from GPU resources without stalling either the simulation or the core thread. Each read is copied into
+	 * a CPU readable staging texture and followed by a fence. Once the GPU passes the fence the staging texture is read
+	 * and the data is delivered on the simulation thread.
+	 *
+	 * @note	Sim thread unless noted otherwise.
+	 */
+	class BS_CORE_EXPORT GpuReadbackManager : public Module<GpuReadbackManager>
+	{
+		/** Information about a read that was issued to the GPU but has not yet completed. */
+		struct PendingRead
+		{
+			SPtr<TextureCore> source;
+			SPtr<TextureCore> staging;
+			UINT32 face;
+			UINT32 mipLevel;
+			SPtr<EventQuery> query;
+			HEvent onTriggeredConn;
+			TextureReadbackCallback callback;
+		};
+
+		/** Information about a read whose data is ready to be delivered. */
+		struct CompletedRead
+		{
+			SPtr<PixelData> data;
+			TextureReadbackCallback callback;
+		};
+
+	public:
+		GpuReadbackManager();
+
+		/**
+		 * Queues a read of a single face and mip level of the texture. The read is performed after all rendering 
+		 * commands queued before this call.
+		 *
+		 * @param[in]	texture		Texture to read from.
+		 * @param[in]	callback	Callback to trigger with the read data once it's available. Triggered during a later
+		 *							call to _update().
+		 * @param[in]	face		Texture face to read from.
+		 * @param[in]	mipLevel	Mip level to read from.
+		 */
+		void readTexture(const SPtr<Texture>& texture, const TextureReadbackCallback& callback, UINT32 face = 0, 
+			UINT32 mipLevel = 0);
+
+		/**
+		 * @copydoc readTexture 
+		 *
+		 * @note	Core thread. Callback is still triggered on the simulation thread.
+		 */
+		void readTextureCore(const SPtr<TextureCore>& texture, const TextureReadbackCallback& callback, UINT32 face = 0,
+			UINT32 mipLevel = 0);
+
+		/** Returns the number of reads that have been queued, but whose callbacks haven't been triggered yet. */
+		UINT32 getNumPendingReads() const { return mNumPendingReads; }
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** Triggers callbacks for all reads that completed since the last call. Should be called once per frame. */
+		void _update();
+
+		/** @} */
+	private:
+		/** @copydoc Module::onShutDown */
+		void onShutDown() override;
+
+		/** Triggered on the core thread when the GPU passes the fence issued after the read with the provided id. */
+		void readCompleted(UINT32 readId);
+
+		/** 
+		 * Finds a free staging texture that can hold the provided mip level of the texture, or creates a new one. Returns
+		 * null if the texture cannot be copied into a staging texture.
+		 */
+		SPtr<TextureCore> allocStagingTexture(const TextureProperties& props, UINT32 mipLevel);
+
+		/** Returns the staging texture for reuse by later reads. */
+		void freeStagingTexture(const SPtr<TextureCore>& texture);
+
+		/** Releases all core thread objects and drops any pending reads. */
+		void destroyCore();
+
+		static const UINT32 MAX_FREE_STAGING_TEXTURES;
+
+		// Core thread
+		UnorderedMap<UINT32, PendingRead> mPendingReads;
+		Vector<SPtr<TextureCore>> mFreeStagingTextures;
+		UINT32 mNextReadId = 0;
+
+		// Shared
+		Vector<CompletedRead> mCompletedReads;
+		std::atomic<UINT32> mNumPendingReads;
+		Mutex mMutex;
+	};
+
+	/** @} */
+}
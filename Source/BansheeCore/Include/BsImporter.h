@@ -137,6 +137,12 @@ namespace bs
 		/** Alternative to importAll() which doesn't create resource handles, but instead returns raw resource pointers. */
 		Vector<SubResourceRaw> _importAllRaw(const Path& inputFilePath, SPtr<const ImportOptions> importOptions = nullptr);
 
+		/**
+		 * Checks can the file at the provided path be imported using _importAllRaw() from a worker thread, concurrently
+		 * with other imports. Must be called from the thread that owns the importer, before the concurrent import starts.
+		 */
+		bool _supportsConcurrentImport(const Path& inputFilePath) const;
+
 		/** @} */
 	private:
 		/** 
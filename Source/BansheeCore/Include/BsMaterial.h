@@ -164,49 +164,49 @@ namespace bs
 		 *
 		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
 		 */
-		void setFloat(const String& name, float value, UINT32 arrayIdx = 0)	{ return getParamFloat(name).set(value, arrayIdx); }
+		void setFloat(const StringID& name, float value, UINT32 arrayIdx = 0)	{ return getParamFloat(name).set(value, arrayIdx); }
 
 		/**   
 		 * Assigns a color to the shader parameter with the specified name. 
 		 *
 		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
 		 */
-		void setColor(const String& name, const Color& value, UINT32 arrayIdx = 0) { return getParamColor(name).set(value, arrayIdx); }
+		void setColor(const StringID& name, const Color& value, UINT32 arrayIdx = 0) { return getParamColor(name).set(value, arrayIdx); }
 
 		/**   
 		 * Assigns a 2D vector to the shader parameter with the specified name. 
 		 *
 		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
 		 */
-		void setVec2(const String& name, const Vector2& value, UINT32 arrayIdx = 0)	{ return getParamVec2(name).set(value, arrayIdx); }
+		void setVec2(const StringID& name, const Vector2& value, UINT32 arrayIdx = 0)	{ return getParamVec2(name).set(value, arrayIdx); }
 
 		/**   
 		 * Assigns a 3D vector to the shader parameter with the specified name. 
 		 *
 		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
 		 */
-		void setVec3(const String& name, const Vector3& value, UINT32 arrayIdx = 0)	{ return getParamVec3(name).set(value, arrayIdx); }
+		void setVec3(const StringID& name, const Vector3& value, UINT32 arrayIdx = 0)	{ return getParamVec3(name).set(value, arrayIdx); }
 
 		/**   
 		 * Assigns a 4D vector to the shader parameter with the specified name. 
 		 *
 		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
 		 */
-		void setVec4(const String& name, const Vector4& value, UINT32 arrayIdx = 0)	{ return getParamVec4(name).set(value, arrayIdx); }
+		void setVec4(const StringID& name, const Vector4& value, UINT32 arrayIdx = 0)	{ return getParamVec4(name).set(value, arrayIdx); }
 
 		/**   
 		 * Assigns a 3x3 matrix to the shader parameter with the specified name. 
 		 *
 		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
 		 */
-		void setMat3(const String& name, const Matrix3& value, UINT32 arrayIdx = 0)	{ return getParamMat3(name).set(value, arrayIdx); }
+		void setMat3(const StringID& name, const Matrix3& value, UINT32 arrayIdx = 0)	{ return getParamMat3(name).set(value, arrayIdx); }
 
 		/**   
 		 * Assigns a 4x4 matrix to the shader parameter with the specified name. 
 		 *
 		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
 		 */
-		void setMat4(const String& name, const Matrix4& value, UINT32 arrayIdx = 0)	{ return getParamMat4(name).set(value, arrayIdx); }
+		void setMat4(const StringID& name, const Matrix4& value, UINT32 arrayIdx = 0)	{ return getParamMat4(name).set(value, arrayIdx); }
 
 		/**   
 		 * Assigns a structure to the shader parameter with the specified name.
@@ -215,84 +215,84 @@ namespace bs
 		 *
 		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
 		 */
-		void setStructData(const String& name, void* value, UINT32 size, UINT32 arrayIdx = 0) { return getParamStruct(name).set(value, size, arrayIdx); }
+		void setStructData(const StringID& name, void* value, UINT32 size, UINT32 arrayIdx = 0) { return getParamStruct(name).set(value, size, arrayIdx); }
 
 		/** Assigns a texture to the shader parameter with the specified name. */
-		void setTexture(const String& name, const TextureType& value) { return getParamTexture(name).set(value); }
+		void setTexture(const StringID& name, const TextureType& value) { return getParamTexture(name).set(value); }
 
 		/** Assigns a texture to be used for random load/store operations to the shader parameter with the specified name. */
-		void setLoadStoreTexture(const String& name, const TextureType& value, const TextureSurface& surface)
+		void setLoadStoreTexture(const StringID& name, const TextureType& value, const TextureSurface& surface)
 		{ 
 			return getParamLoadStoreTexture(name).set(value, surface); 
 		}
 
 		/** Assigns a buffer to the shader parameter with the specified name. */
-		void setBuffer(const String& name, const BufferType& value) { return getParamBuffer(name).set(value); }
+		void setBuffer(const StringID& name, const BufferType& value) { return getParamBuffer(name).set(value); }
 
 		/** Assigns a sampler state to the shader parameter with the specified name. */
-		void setSamplerState(const String& name, const SamplerStateType& value) { return getParamSamplerState(name).set(value); }
+		void setSamplerState(const StringID& name, const SamplerStateType& value) { return getParamSamplerState(name).set(value); }
 
 		/**
 		 * Returns a float value assigned with the parameter with the specified name.
 		 *
 		 * Optionally if the parameter is an array you may provide an array index you which to retrieve.
 		 */
-		float getFloat(const String& name, UINT32 arrayIdx = 0) const { return getParamFloat(name).get(arrayIdx); }
+		float getFloat(const StringID& name, UINT32 arrayIdx = 0) const { return getParamFloat(name).get(arrayIdx); }
 
 		/**
 		 * Returns a color assigned with the parameter with the specified name.
 		 *
 		 * Optionally if the parameter is an array you may provide an array index you which to retrieve.
 		 */
-		Color getColor(const String& name, UINT32 arrayIdx = 0) const { return getParamColor(name).get(arrayIdx); }
+		Color getColor(const StringID& name, UINT32 arrayIdx = 0) const { return getParamColor(name).get(arrayIdx); }
 
 		/**
 		 * Returns a 2D vector assigned with the parameter with the specified name.
 		 *
 		 * Optionally if the parameter is an array you may provide an array index you which to retrieve.
 		 */
-		Vector2 getVec2(const String& name, UINT32 arrayIdx = 0) const { return getParamVec2(name).get(arrayIdx); }
+		Vector2 getVec2(const StringID& name, UINT32 arrayIdx = 0) const { return getParamVec2(name).get(arrayIdx); }
 
 		/**
 		 * Returns a 3D vector assigned with the parameter with the specified name.
 		 *
 		 * Optionally if the parameter is an array you may provide an array index you which to retrieve.
 		 */
-		Vector3 getVec3(const String& name, UINT32 arrayIdx = 0) const { return getParamVec3(name).get(arrayIdx); }
+		Vector3 getVec3(const StringID& name, UINT32 arrayIdx = 0) const { return getParamVec3(name).get(arrayIdx); }
 
 		/**
 		 * Returns a 4D vector assigned with the parameter with the specified name.
 		 *
 		 * Optionally if the parameter is an array you may provide an array index you which to retrieve.
 		 */
-		Vector4 getVec4(const String& name, UINT32 arrayIdx = 0) const { return getParamVec4(name).get(arrayIdx); }
+		Vector4 getVec4(const StringID& name, UINT32 arrayIdx = 0) const { return getParamVec4(name).get(arrayIdx); }
 
 		/**
 		 * Returns a 3x3 matrix assigned with the parameter with the specified name.
 		 *
 		 * Optionally if the parameter is an array you may provide an array index you which to retrieve.
 		 */
-		Matrix3 getMat3(const String& name, UINT32 arrayIdx = 0) const { return getParamMat3(name).get(arrayIdx); }
+		Matrix3 getMat3(const StringID& name, UINT32 arrayIdx = 0) const { return getParamMat3(name).get(arrayIdx); }
 
 		/**
 		 * Returns a 4x4 matrix assigned with the parameter with the specified name.
 		 *
 		 * Optionally if the parameter is an array you may provide an array index you which to retrieve.
 		 */
-		Matrix4 getMat4(const String& name, UINT32 arrayIdx = 0) const { return getParamMat4(name).get(arrayIdx); }
+		Matrix4 getMat4(const StringID& name, UINT32 arrayIdx = 0) const { return getParamMat4(name).get(arrayIdx); }
 
 		/** Returns a texture assigned with the parameter with the specified name. */
-		TextureType getTexture(const String& name) const { return getParamTexture(name).get(); }
+		TextureType getTexture(const StringID& name) const { return getParamTexture(name).get(); }
 
 		/** Returns a sampler state assigned with the parameter with the specified name. */
-		SamplerStateType getSamplerState(const String& name) const	{ return getParamSamplerState(name).get(); }
+		SamplerStateType getSamplerState(const StringID& name) const	{ return getParamSamplerState(name).get(); }
 
 		/**
 		 * Returns a buffer representing a structure assigned to the parameter with the specified name.
 		 *
 		 * Optionally if the parameter is an array you may provide an array index you which to retrieve.
 		 */
-		MaterialBase::StructData getStructData(const String& name, UINT32 arrayIdx = 0) const
+		MaterialBase::StructData getStructData(const StringID& name, UINT32 arrayIdx = 0) const
 		{
 			TMaterialParamStruct<Core> structParam = getParamStruct(name);
 
@@ -312,7 +312,7 @@ namespace bs
 		 * @note			
 		 * If material shader changes this handle will be invalidated.
 		 */
-		TMaterialDataParam<float, Core> getParamFloat(const String& name) const
+		TMaterialDataParam<float, Core> getParamFloat(const StringID& name) const
 		{
 			TMaterialDataParam<float, Core> gpuParam;
 			getParam(name, gpuParam);
@@ -330,7 +330,7 @@ namespace bs
 		 * @note
 		 * If material shader changes this handle will be invalidated.
 		 */
-		TMaterialDataParam<Color, Core> getParamColor(const String& name) const
+		TMaterialDataParam<Color, Core> getParamColor(const StringID& name) const
 		{
 			TMaterialDataParam<Color, Core> gpuParam;
 			getParam(name, gpuParam);
@@ -348,7 +348,7 @@ namespace bs
 		 * @note	
 		 * If material shader changes this handle will be invalidated.
 		 */
-		TMaterialDataParam<Vector2, Core> getParamVec2(const String& name) const
+		TMaterialDataParam<Vector2, Core> getParamVec2(const StringID& name) const
 		{
 			TMaterialDataParam<Vector2, Core> gpuParam;
 			getParam(name, gpuParam);
@@ -366,7 +366,7 @@ namespace bs
 		 * @note			
 		 * If material shader changes this handle will be invalidated.
 		 */
-		TMaterialDataParam<Vector3, Core> getParamVec3(const String& name) const
+		TMaterialDataParam<Vector3, Core> getParamVec3(const StringID& name) const
 		{
 			TMaterialDataParam<Vector3, Core> gpuParam;
 			getParam(name, gpuParam);
@@ -384,7 +384,7 @@ namespace bs
 		 * @note	
 		 * If material shader changes this handle will be invalidated.
 		 */
-		TMaterialDataParam<Vector4, Core> getParamVec4(const String& name) const
+		TMaterialDataParam<Vector4, Core> getParamVec4(const StringID& name) const
 		{
 			TMaterialDataParam<Vector4, Core> gpuParam;
 			getParam(name, gpuParam);
@@ -402,7 +402,7 @@ namespace bs
 		 * @note	
 		 * If material shader changes this handle will be invalidated.
 		 */
-		TMaterialDataParam<Matrix3, Core> getParamMat3(const String& name) const
+		TMaterialDataParam<Matrix3, Core> getParamMat3(const StringID& name) const
 		{
 			TMaterialDataParam<Matrix3, Core> gpuParam;
 			getParam(name, gpuParam);
@@ -420,7 +420,7 @@ namespace bs
 		 * @note	
 		 * If material shader changes this handle will be invalidated.
 		 */
-		TMaterialDataParam<Matrix4, Core> getParamMat4(const String& name) const
+		TMaterialDataParam<Matrix4, Core> getParamMat4(const StringID& name) const
 		{
 			TMaterialDataParam<Matrix4, Core> gpuParam;
 			getParam(name, gpuParam);
@@ -438,7 +438,7 @@ namespace bs
 		 * @note			
 		 * If material shader changes this handle will be invalidated.
 		 */
-		TMaterialParamStruct<Core> getParamStruct(const String& name) const;
+		TMaterialParamStruct<Core> getParamStruct(const StringID& name) const;
 
 		/**
 		 * Returns a texture GPU parameter. This parameter may be used for more efficiently getting/setting GPU parameter 
@@ -450,7 +450,7 @@ namespace bs
 		 * @note
 		 * If material shader changes this handle will be invalidated.
 		 */
-		TMaterialParamTexture<Core> getParamTexture(const String& name) const;
+		TMaterialParamTexture<Core> getParamTexture(const StringID& name) const;
 
 		/**
 		 * Returns a GPU parameter for binding a load/store texture. This parameter may be used for more efficiently 
@@ -462,7 +462,7 @@ namespace bs
 		 * @note			
 		 * If material shader changes this handle will be invalidated.
 		 */
-		TMaterialParamLoadStoreTexture<Core> getParamLoadStoreTexture(const String& name) const;
+		TMaterialParamLoadStoreTexture<Core> getParamLoadStoreTexture(const StringID& name) const;
 
 		/**
 		 * Returns a buffer GPU parameter. This parameter may be used for more efficiently getting/setting GPU parameter 
@@ -474,7 +474,7 @@ namespace bs
 		 * @note
 		 * If material shader changes this handle will be invalidated.
 		 */
-		TMaterialParamBuffer<Core> getParamBuffer(const String& name) const;
+		TMaterialParamBuffer<Core> getParamBuffer(const StringID& name) const;
 
 		/**
 		 * Returns a sampler state GPU parameter. This parameter may be used for more efficiently getting/setting GPU 
@@ -486,7 +486,7 @@ namespace bs
 		 * @note			
 		 * If material shader changes this handle will be invalidated.
 		 */
-		TMaterialParamSampState<Core> getParamSamplerState(const String& name) const;
+		TMaterialParamSampState<Core> getParamSamplerState(const StringID& name) const;
 
 		/**
 		 * Allows you to retrieve a handle to a parameter that you can then use for quickly setting and retrieving parameter
@@ -497,7 +497,7 @@ namespace bs
 		 * of that.
 		 */
 		template <typename T>
-		void getParam(const String& name, TMaterialDataParam<T, Core>& output) const;
+		void getParam(const StringID& name, TMaterialDataParam<T, Core>& output) const;
 
 		/**
 		 * @name Internal
@@ -519,7 +519,7 @@ namespace bs
 		 * @note	Provided parameter must exist, no checking is done.
 		 */
 		template <typename T>
-		void setParamValue(const String& name, UINT8* buffer, UINT32 numElements);
+		void setParamValue(const StringID& name, UINT8* buffer, UINT32 numElements);
 
 		/**
 		 * Initializes the material by using the compatible techniques from the currently set shader. Shader must contain 
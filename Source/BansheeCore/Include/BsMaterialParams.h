@@ -71,20 +71,19 @@ namespace bs
 		 * @tparam		T			Native type of the parameter.
 		 */
 		template <typename T>
-		void getDataParam(const String& name, UINT32 arrayIdx, T& output) const
+		void getDataParam(const StringID& name, UINT32 arrayIdx, T& output) const
 		{
-			GpuParamDataType dataType = TGpuDataParamInfo<T>::TypeId;
+			GpuParamDataType dataType = (GpuParamDataType)TGpuDataParamInfo<T>::TypeId;
 
 			const ParamData* param = nullptr;
 			auto result = getParamData(name, ParamType::Data, dataType, arrayIdx, &param);
 			if (result != GetParamResult::Success)
+			{
+				reportGetParamError(result, name, arrayIdx);
 				return;
+			}
 
-			const GpuParamDataTypeInfo& typeInfo = GpuParams::PARAM_SIZES.lookup[dataType];
-			UINT32 paramTypeSize = typeInfo.numColumns * typeInfo.numRows * typeInfo.baseTypeSize;
-			output = *(T*)(mDataParamsBuffer[param->index + arrayIdx * paramTypeSize]);
-
-			memcpy(output, &mDataParamsBuffer[param->index + arrayIdx * paramTypeSize], sizeof(paramTypeSize));
+			getDataParam(*param, arrayIdx, output);
 		}
 
 		/**
@@ -98,19 +97,19 @@ namespace bs
 		 * @tparam		T			Native type of the parameter.
 		 */
 		template <typename T>
-		void setDataParam(const String& name, UINT32 arrayIdx, const T& input) const
+		void setDataParam(const StringID& name, UINT32 arrayIdx, const T& input) const
 		{
-			GpuParamDataType dataType = TGpuDataParamInfo<T>::TypeId;
+			GpuParamDataType dataType = (GpuParamDataType)TGpuDataParamInfo<T>::TypeId;
 
 			const ParamData* param = nullptr;
 			auto result = getParamData(name, ParamType::Data, dataType, arrayIdx, &param);
 			if (result != GetParamResult::Success)
+			{
+				reportGetParamError(result, name, arrayIdx);
 				return;
+			}
 
-			const GpuParamDataTypeInfo& typeInfo = GpuParams::PARAM_SIZES.lookup[dataType];
-			UINT32 paramTypeSize = typeInfo.numColumns * typeInfo.numRows * typeInfo.baseTypeSize;
-
-			memcpy(&mDataParamsBuffer[param->index + arrayIdx * paramTypeSize], input, sizeof(paramTypeSize));
+			setDataParam(*param, arrayIdx, input);
 		}
 
 		/** 
@@ -120,7 +119,7 @@ namespace bs
 		 * @param[in]	name		Name of the shader parameter.
 		 * @return					Index of the parameter, or -1 if not found.
 		 */
-		UINT32 getParamIndex(const String& name) const;
+		UINT32 getParamIndex(const StringID& name) const;
 
 		/** 
 		 * Returns an index of the parameter with the specified name. Index can be used in a call to getParamData(UINT32) to
@@ -135,7 +134,7 @@ namespace bs
 		 * @param[out]	output		Index of the requested parameter, only valid if success is returned.
 		 * @return					Success or error state of the request.
 		 */
-		GetParamResult getParamIndex(const String& name, ParamType type, GpuParamDataType dataType, UINT32 arrayIdx,
+		GetParamResult getParamIndex(const StringID& name, ParamType type, GpuParamDataType dataType, UINT32 arrayIdx,
 			UINT32& output) const;
 
 		/**
@@ -153,7 +152,7 @@ namespace bs
 		 *							some other error was reported.
 		 * @return					Success or error state of the request.
 		 */
-		GetParamResult getParamData(const String& name, ParamType type, GpuParamDataType dataType, UINT32 arrayIdx,
+		GetParamResult getParamData(const StringID& name, ParamType type, GpuParamDataType dataType, UINT32 arrayIdx,
 			const ParamData** output) const;
 
 		/**
@@ -171,10 +170,10 @@ namespace bs
 		 * @param[in]	name		Name of the shader parameter for which the error occurred.
 		 * @param[in]	arrayIdx	Array index for which the error occurred.
 		 */
-		void reportGetParamError(GetParamResult errorCode, const String& name, UINT32 arrayIdx) const;
+		void reportGetParamError(GetParamResult errorCode, const StringID& name, UINT32 arrayIdx) const;
 
 		/**
-		 * Equivalent to getDataParam(const String&, UINT32, T&) except it uses the internal parameter reference
+		 * Equivalent to getDataParam(const StringID&, UINT32, T&) except it uses the internal parameter reference
 		 * directly, avoiding the name lookup. Caller must guarantee the parameter reference is valid and belongs to this
 		 * object.
 		 */
@@ -191,7 +190,7 @@ namespace bs
 		}
 
 		/**
-		 * Equivalent to setDataParam(const String&, UINT32, T&) except it uses the internal parameter reference
+		 * Equivalent to setDataParam(const StringID&, UINT32, T&) except it uses the internal parameter reference
 		 * directly, avoiding the name lookup. Caller must guarantee the parameter reference is valid and belongs to this
 		 * object.
 		 */
@@ -206,7 +205,7 @@ namespace bs
 			assert(sizeof(input) == paramTypeSize);
 			memcpy(&mDataParamsBuffer[param.index + arrayIdx * paramTypeSize], &input, paramTypeSize);
 
-			param.version = ++mParamVersion;
+			markParamDirty(param);
 		}
 
 		/** Returns pointer to the internal data buffer for a data parameter at the specified index. */
@@ -218,10 +217,90 @@ namespace bs
 		/** Returns a counter that gets incremented whenever a parameter gets updated. */
 		UINT64 getParamVersion() const { return mParamVersion; }
 
+		/**
+		 * Retrieves indices of all parameters modified since the specified version, as reported by getParamVersion().
+		 * Each parameter is reported at most once.
+		 *
+		 * @param[in]	sinceVersion	Version after which to report the modified parameters.
+		 * @param[out]	output			Indices of the modified parameters, usable with getParamData(UINT32). Indices are
+		 *								appended to the existing contents.
+		 * @return						True if all modified parameters were reported. False if more parameters were
+		 *								modified than can be tracked, in which case the caller must check all parameters
+		 *								by comparing their versions.
+		 */
+		bool getDirtyParams(UINT64 sinceVersion, Vector<UINT32>& output) const;
+
 	protected:
+		/** Record of a single parameter modification, stored in the dirty parameter ring buffer. */
+		struct DirtyParam
+		{
+			UINT32 paramIdx;
+			UINT64 version;
+		};
+
+		/** Entry in the open-addressing parameter lookup table. */
+		struct ParamLookupEntry
+		{
+			StringID name;
+			UINT32 paramIdx;
+		};
+
+		/** Registers a parameter with the specified name in the lookup table, growing the table if needed. */
+		void addParamLookup(const StringID& name, UINT32 paramIdx);
+
+		/** Finds the index of the parameter with the specified name in the lookup table. Returns -1 if not found. */
+		UINT32 findParamLookup(const StringID& name) const
+		{
+			if (mParamLookup.empty() || name.empty())
+				return (UINT32)-1;
+
+			UINT32 mask = (UINT32)mParamLookup.size() - 1;
+			UINT32 slot = getLookupSlot(name);
+			while (true)
+			{
+				const ParamLookupEntry& entry = mParamLookup[slot];
+				if (entry.name == name)
+					return entry.paramIdx;
+
+				if (entry.name.empty())
+					return (UINT32)-1;
+
+				slot = (slot + 1) & mask;
+			}
+		}
+
+		/** Returns the lookup table slot at which to start probing for the parameter with the specified name. */
+		UINT32 getLookupSlot(const StringID& name) const
+		{
+			// Fibonacci hashing, so that sequential string ids spread over the entire table
+			return (name.id() * 2654435769U) >> mParamLookupShift;
+		}
+
+		/** Assigns a new version to the parameter and records the modification. */
+		void markParamDirty(const ParamData& param) const
+		{
+			param.version = ++mParamVersion;
+			recordDirtyParam(param);
+		}
+
+		/**
+		 * Records the modification of a parameter in the dirty parameter ring buffer. Parameter's version must be
+		 * assigned before calling.
+		 */
+		void recordDirtyParam(const ParamData& param) const
+		{
+			DirtyParam& entry = mDirtyParams[mNumDirtyParams % DIRTY_PARAM_RING_SIZE];
+			entry.paramIdx = (UINT32)(&param - mParams.data());
+			entry.version = param.version;
+
+			mNumDirtyParams++;
+		}
+
 		const static UINT32 STATIC_BUFFER_SIZE = 256;
+		const static UINT32 DIRTY_PARAM_RING_SIZE = 32;
 
-		UnorderedMap<String, UINT32> mParamLookup;
+		Vector<ParamLookupEntry> mParamLookup; // Linear probing, power of two size, at most half full
+		UINT32 mParamLookupShift = 32;
 		Vector<ParamData> mParams;
 
 		UINT8* mDataParamsBuffer = nullptr;
@@ -233,6 +312,8 @@ namespace bs
 		UINT32 mNumSamplerParams = 0;
 
 		mutable UINT64 mParamVersion = 1;
+		mutable DirtyParam mDirtyParams[DIRTY_PARAM_RING_SIZE];
+		mutable UINT64 mNumDirtyParams = 0;
 		mutable StaticAlloc<STATIC_BUFFER_SIZE, STATIC_BUFFER_SIZE> mAlloc;
 	};
 
@@ -368,7 +449,7 @@ namespace bs
 		 * @param[in]	size		Size of the buffer into which to write the value. Must match parameter struct's size.
 		 * @param[in]	arrayIdx	If the parameter is an array, index of the entry to access.
 		 */
-		void getStructData(const String& name, void* value, UINT32 size, UINT32 arrayIdx) const;
+		void getStructData(const StringID& name, void* value, UINT32 size, UINT32 arrayIdx) const;
 
 		/**
 		 * Sets the value of a shader structure parameter with the specified name at the specified array index. If the
@@ -379,7 +460,7 @@ namespace bs
 		 * @param[in]	size		Size of the buffer from which to retrieve the value. Must match parameter struct's size.
 		 * @param[in]	arrayIdx	If the parameter is an array, index of the entry to access.
 		 */
-		void setStructData(const String& name, const void* value, UINT32 size, UINT32 arrayIdx);
+		void setStructData(const StringID& name, const void* value, UINT32 size, UINT32 arrayIdx);
 
 		/**
 		 * Returns the value of a shader texture parameter with the specified name. If the parameter name or type is not
@@ -388,7 +469,7 @@ namespace bs
 		 * @param[in]	name		Name of the shader parameter.
 		 * @param[out]	value		Output value of the parameter.
 		 */
-		void getTexture(const String& name, TextureType& value) const;
+		void getTexture(const StringID& name, TextureType& value) const;
 
 		/**
 		 * Sets the value of a shader texture parameter with the specified name. If the parameter name or type is not
@@ -397,7 +478,7 @@ namespace bs
 		 * @param[in]	name		Name of the shader parameter.
 		 * @param[in]	value		New value of the parameter.
 		 */
-		void setTexture(const String& name, const TextureType& value);
+		void setTexture(const StringID& name, const TextureType& value);
 
 		/**
 		 * Returns the value of a shader load/store texture parameter with the specified name. If the parameter name or
@@ -407,7 +488,7 @@ namespace bs
 		 * @param[out]	value		Output value of the parameter.
 		 * @param[out]	surface		Surface describing which part of the texture is being accessed.
 		 */
-		void getLoadStoreTexture(const String& name, TextureType& value, TextureSurface& surface) const;
+		void getLoadStoreTexture(const StringID& name, TextureType& value, TextureSurface& surface) const;
 
 		/**
 		 * Sets the value of a shader load/store texture parameter with the specified name. If the parameter name or
@@ -417,7 +498,7 @@ namespace bs
 		 * @param[in]	value		New value of the parameter.
 		 * @param[in]	surface		Surface describing which part of the texture is being accessed.
 		 */
-		void setLoadStoreTexture(const String& name, const TextureType& value, const TextureSurface& surface);
+		void setLoadStoreTexture(const StringID& name, const TextureType& value, const TextureSurface& surface);
 
 		/**
 		 * Returns the value of a shader buffer parameter with the specified name. If the parameter name or type is not
@@ -426,7 +507,7 @@ namespace bs
 		 * @param[in]	name		Name of the shader parameter.
 		 * @param[out]	value		Output value of the parameter.
 		 */
-		void getBuffer(const String& name, BufferType& value) const;
+		void getBuffer(const StringID& name, BufferType& value) const;
 
 		/**
 		 * Sets the value of a shader buffer parameter with the specified name. If the parameter name or type is not
@@ -435,7 +516,7 @@ namespace bs
 		 * @param[in]	name		Name of the shader parameter.
 		 * @param[in]	value		New value of the parameter.
 		 */
-		void setBuffer(const String& name, const BufferType& value);
+		void setBuffer(const StringID& name, const BufferType& value);
 
 		/**
 		 * Sets the value of a shader sampler state parameter with the specified name. If the parameter name or type is not
@@ -444,7 +525,7 @@ namespace bs
 		 * @param[in]	name		Name of the shader parameter.
 		 * @param[out]	value		Output value of the parameter.
 		 */
-		void getSamplerState(const String& name, SamplerType& value) const;
+		void getSamplerState(const StringID& name, SamplerType& value) const;
 
 		/**
 		 * Sets the value of a shader sampler state parameter with the specified name. If the parameter name or type is not
@@ -453,7 +534,7 @@ namespace bs
 		 * @param[in]	name		Name of the shader parameter.
 		 * @param[in]	value		New value of the parameter.
 		 */
-		void setSamplerState(const String& name, const SamplerType& value);
+		void setSamplerState(const StringID& name, const SamplerType& value);
 
 		/**
 		 * Equivalent to getStructData(const String&, UINT32, void*, UINT32) except it uses the internal parameter reference
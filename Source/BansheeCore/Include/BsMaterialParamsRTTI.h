@@ -105,7 +105,7 @@ namespace bs
 			UINT32 paramIdx = (UINT32)obj->mParams.size();
 			obj->mParams.push_back(param.data);
 
-			obj->mParamLookup[param.name] = paramIdx;
+			obj->addParamLookup(param.name, paramIdx);
 		}
 
 		UINT32 getParamDataArraySize(MaterialParams* obj)
@@ -207,8 +207,10 @@ namespace bs
 			Vector<MaterialParam> matParams;
 			for (auto& entry : paramsObj->mParamLookup)
 			{
-				UINT32 paramIdx = entry.second;
-				matParams.push_back({ entry.first, paramsObj->mParams[paramIdx] });
+				if (entry.name.empty())
+					continue;
+
+				matParams.push_back({ entry.name.cstr(), paramsObj->mParams[entry.paramIdx] });
 			}
 
 			paramsObj->mRTTIData = matParams;
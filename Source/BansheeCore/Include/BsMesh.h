@@ -39,6 +39,20 @@ namespace bs
 		 */
 		Vector<SubMesh> subMeshes;
 
+		/**
+		 * Optional sub-meshes used for rendering lower levels of detail of the mesh. Stored level by level, starting with
+		 * the first reduced level (level 0 is always described by @p subMeshes). Each level must contain the same number
+		 * of entries as @p subMeshes, and they all reference the same vertex buffer.
+		 */
+		Vector<SubMesh> lodSubMeshes;
+
+		/**
+		 * Screen size thresholds used for selecting levels of detail, one for each level stored in @p lodSubMeshes. Screen
+		 * size is the projected size of the mesh bounds relative to the viewport height. A level is used once the screen
+		 * size drops below its threshold. Must be in decreasing order.
+		 */
+		Vector<float> lodScreenSizes;
+
 		/** Optimizes performance depending on planned usage of the mesh. */
 		INT32 usage = MU_STATIC; 
 
@@ -125,6 +139,9 @@ namespace bs
 		/** Returns an object containing all shapes used for morph animation, if any are available. */
 		SPtr<MorphShapes> getMorphShapes() const { return mMorphShapes; }
 
+		/** Returns the usage flags (MeshUsage) the mesh was created with. */
+		int getUsage() const { return mUsage; }
+
 		/** Retrieves a core implementation of a mesh usable only from the core thread. */
 		SPtr<MeshCore> getCore() const;
 
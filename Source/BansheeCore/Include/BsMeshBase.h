@@ -51,7 +51,42 @@ namespace bs
 		/**	Returns bounds of the geometry contained in the vertex buffers for all sub-meshes. */
 		const Bounds& getBounds() const { return mBounds; }
 
+		/** Returns the number of levels of detail available for the mesh. Level 0 is the full detail mesh. */
+		UINT32 getNumLODs() const { return (UINT32)mLODScreenSizes.size() + 1; }
+
+		/**
+		 * Retrieves a sub-mesh used for rendering a certain portion of this mesh at the specified level of detail. Level 0
+		 * returns the same sub-meshes as getSubMesh().
+		 */
+		const SubMesh& getLODSubMesh(UINT32 lod, UINT32 subMeshIdx = 0) const;
+
+		/**
+		 * Returns the screen size below which the specified level of detail should be used, as a fraction of the
+		 * viewport height. Level 0 always returns infinity.
+		 */
+		float getLODScreenSize(UINT32 lod) const;
+
+		/** 
+		 * Finds the level of detail that should be used when the mesh bounds cover the provided fraction of the viewport
+		 * height.
+		 */
+		UINT32 getLOD(float screenSize) const;
+
+		/**
+		 * Finds the level of detail that should be used when the mesh bounds cover the provided fraction of the viewport
+		 * height, while the mesh was previously rendered using @p prevLOD. The level only changes once the screen size
+		 * moves past a level's threshold by more than @p hysteresis (a fraction of the threshold), to avoid popping back
+		 * and forth between levels.
+		 */
+		UINT32 getLOD(float screenSize, UINT32 prevLOD, float hysteresis) const;
+
 	protected:
+		/** 
+		 * Assigns sub-meshes and screen size thresholds used for levels of detail. Ignored if the number of sub-meshes
+		 * doesn't match the number of levels.
+		 */
+		void setLODs(const Vector<SubMesh>& lodSubMeshes, const Vector<float>& lodScreenSizes);
+
 		friend class MeshBase;
 		friend class MeshCoreBase;
 		friend class Mesh;
@@ -61,6 +96,8 @@ namespace bs
 		friend class MeshBaseRTTI;
 
 		Vector<SubMesh> mSubMeshes;
+		Vector<SubMesh> mLODSubMeshes;
+		Vector<float> mLODScreenSizes;
 		UINT32 mNumVertices;
 		UINT32 mNumIndices;
 		Bounds mBounds;
@@ -24,6 +24,16 @@ namespace bs
 		UINT32 getNumSubmeshes(MeshBase* obj) { return (UINT32)obj->mProperties.mSubMeshes.size(); }
 		void setNumSubmeshes(MeshBase* obj, UINT32 numElements) { obj->mProperties.mSubMeshes.resize(numElements); }
 
+		SubMesh& getLODSubMesh(MeshBase* obj, UINT32 arrayIdx) { return obj->mProperties.mLODSubMeshes[arrayIdx]; }
+		void setLODSubMesh(MeshBase* obj, UINT32 arrayIdx, SubMesh& value) { obj->mProperties.mLODSubMeshes[arrayIdx] = value; }
+		UINT32 getNumLODSubmeshes(MeshBase* obj) { return (UINT32)obj->mProperties.mLODSubMeshes.size(); }
+		void setNumLODSubmeshes(MeshBase* obj, UINT32 numElements) { obj->mProperties.mLODSubMeshes.resize(numElements); }
+
+		float& getLODScreenSize(MeshBase* obj, UINT32 arrayIdx) { return obj->mProperties.mLODScreenSizes[arrayIdx]; }
+		void setLODScreenSize(MeshBase* obj, UINT32 arrayIdx, float& value) { obj->mProperties.mLODScreenSizes[arrayIdx] = value; }
+		UINT32 getNumLODScreenSizes(MeshBase* obj) { return (UINT32)obj->mProperties.mLODScreenSizes.size(); }
+		void setNumLODScreenSizes(MeshBase* obj, UINT32 numElements) { obj->mProperties.mLODScreenSizes.resize(numElements); }
+
 		UINT32& getNumVertices(MeshBase* obj) { return obj->mProperties.mNumVertices; }
 		void setNumVertices(MeshBase* obj, UINT32& value) { obj->mProperties.mNumVertices = value; }
 
@@ -38,6 +48,10 @@ namespace bs
 
 			addPlainArrayField("mSubMeshes", 2, &MeshBaseRTTI::getSubMesh, 
 				&MeshBaseRTTI::getNumSubmeshes, &MeshBaseRTTI::setSubMesh, &MeshBaseRTTI::setNumSubmeshes);
+			addPlainArrayField("mLODSubMeshes", 3, &MeshBaseRTTI::getLODSubMesh, 
+				&MeshBaseRTTI::getNumLODSubmeshes, &MeshBaseRTTI::setLODSubMesh, &MeshBaseRTTI::setNumLODSubmeshes);
+			addPlainArrayField("mLODScreenSizes", 4, &MeshBaseRTTI::getLODScreenSize, 
+				&MeshBaseRTTI::getNumLODScreenSizes, &MeshBaseRTTI::setLODScreenSize, &MeshBaseRTTI::setNumLODScreenSizes);
 		}
 
 		SPtr<IReflectable> newRTTIObject() override
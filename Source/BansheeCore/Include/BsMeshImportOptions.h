@@ -162,6 +162,34 @@ namespace bs
 		 */
 		bool getImportRootMotion() const { return mImportRootMotion; }
 
+		/**
+		 * Sets the number of levels of detail to generate for the mesh, including the full detail level. Lower levels are
+		 * generated by simplifying the mesh, and are picked at runtime depending on the mesh's size on screen. Set to 1
+		 * to disable level of detail generation.
+		 */
+		void setNumLODs(UINT32 numLODs) { mNumLODs = std::max(numLODs, 1U); }
+
+		/** Returns the number of levels of detail to generate for the mesh. @see setNumLODs */
+		UINT32 getNumLODs() const { return mNumLODs; }
+
+		/** 
+		 * Sets the fraction of triangles each level of detail keeps compared to the previous level, in range (0, 1). 
+		 * Only relevant if more than one level of detail is generated.
+		 */
+		void setLODReduction(float reduction) { mLODReduction = reduction; }
+
+		/** Returns the fraction of triangles each level of detail keeps compared to the previous level. */
+		float getLODReduction() const { return mLODReduction; }
+
+		/** 
+		 * Enables or disables mesh optimization. When enabled triangles are reordered for better vertex cache utilization
+		 * and reduced overdraw, and vertices are reordered for better fetch locality. Doesn't change the look of the mesh.
+		 */
+		void setOptimizeMesh(bool enabled) { mOptimizeMesh = enabled; }
+
+		/** Checks is mesh optimization enabled. @see setOptimizeMesh */
+		bool getOptimizeMesh() const { return mOptimizeMesh; }
+
 		/** Creates a new import options object that allows you to customize how are meshes imported. */
 		static SPtr<MeshImportOptions> create();
 
@@ -175,6 +203,9 @@ namespace bs
 		bool mReduceKeyFrames;
 		bool mImportRootMotion;
 		float mImportScale;
+		UINT32 mNumLODs;
+		float mLODReduction;
+		bool mOptimizeMesh;
 		CollisionMeshType mCollisionMeshType;
 		Vector<AnimationSplitInfo> mAnimationSplits;
 		Vector<ImportedAnimationEvents> mAnimationEvents;
@@ -30,6 +30,9 @@ namespace bs
 			BS_RTTI_MEMBER_PLAIN(mReduceKeyFrames, 9)
 			BS_RTTI_MEMBER_REFL_ARRAY(mAnimationEvents, 10)
 			BS_RTTI_MEMBER_PLAIN(mImportRootMotion, 11)
+			BS_RTTI_MEMBER_PLAIN(mNumLODs, 12)
+			BS_RTTI_MEMBER_PLAIN(mLODReduction, 13)
+			BS_RTTI_MEMBER_PLAIN(mOptimizeMesh, 14)
 		BS_END_RTTI_MEMBERS
 	public:
 		MeshImportOptionsRTTI()
@@ -24,6 +24,22 @@ namespace bs
 		UINT32 packed;
 	};
 
+	/** Information about the effects of MeshUtility::optimize(). */
+	struct MeshOptimizationStats
+	{
+		/** 
+		 * Average number of post-transform vertex cache misses per triangle before optimization. Ranges from 0.5 (best
+		 * case for regular grids) to 3 (every vertex transformed three times).
+		 */
+		float acmrBefore = 0.0f;
+
+		/** Average number of post-transform vertex cache misses per triangle after optimization. */
+		float acmrAfter = 0.0f;
+
+		/** False if the mesh was left untouched, because it was empty or its indices referenced non-existent vertices. */
+		bool optimized = false;
+	};
+
 	/** Performs various operations on mesh geometry. */
 	class BS_CORE_EXPORT MeshUtility
 	{
@@ -173,6 +189,114 @@ namespace bs
 		 * @param[in]	stride			Distance between two entries in the @p source buffer, in bytes.
 		 */
 		static void unpackNormals(UINT8* source, Vector4* destination, UINT32 count, UINT32 stride);
+
+		/**
+		 * Reduces the number of triangles in a triangle list by collapsing edges with the lowest quadric error. Vertices are
+		 * never moved or created, the simplified triangles reference a subset of the original vertices. Vertices on open
+		 * borders are kept in place, and vertices split due to attribute discontinuities (e.g. UV seams) are only
+		 * collapsed along the discontinuity.
+		 *
+		 * @param[in]	vertices			Set of vertices containing vertex positions.
+		 * @param[in]	indices				Set of indices containing indexes into vertex array for each triangle.
+		 * @param[in]	numVertices			Number of vertices in the @p vertices array.
+		 * @param[in]	numIndices			Number of indices in the @p indices array. Must be a multiple of three.
+		 * @param[in]	targetNumIndices	Number of indices the simplified mesh should contain. The result might contain
+		 *									more indices if the mesh cannot be simplified further.
+		 * @param[out]	outIndices			Pre-allocated buffer that will contain the simplified indices. Must be able to
+		 *									hold @p numIndices indices.
+		 * @param[in]	indexSize			Size of a single index in the indices arrays, in bytes.
+		 * @return							Number of indices written to @p outIndices.
+		 */
+		static UINT32 simplify(Vector3* vertices, UINT8* indices, UINT32 numVertices, UINT32 numIndices, 
+			UINT32 targetNumIndices, UINT8* outIndices, UINT32 indexSize = 4);
+
+		/**
+		 * Generates a chain of progressively simplified levels of detail for the provided mesh. Simplified levels share
+		 * the vertex buffer with the original mesh and their indices are appended after the original indices.
+		 *
+		 * @param[in]	meshData		Mesh data containing the full detail mesh.
+		 * @param[in]	subMeshes		Sub-meshes of the full detail mesh. Sub-meshes that are not triangle lists are
+		 *								copied to the lower levels as is.
+		 * @param[in]	numLODs			Total number of levels of detail to generate, including the full detail level.
+		 * @param[in]	reduction		Fraction of triangles to keep with each subsequent level, in range (0, 1).
+		 * @param[out]	lodSubMeshes	Sub-meshes for each generated level (excluding the full detail level), stored level
+		 *								by level. See MESH_DESC::lodSubMeshes.
+		 * @param[out]	lodScreenSizes	Screen size thresholds for each generated level. See MESH_DESC::lodScreenSizes.
+		 * @return						Mesh data containing the original vertices and indices, followed by indices of 
+		 *								all generated levels. Returns the provided mesh data if no levels were generated.
+		 */
+		static SPtr<MeshData> generateLODs(const SPtr<MeshData>& meshData, const Vector<SubMesh>& subMeshes, 
+			UINT32 numLODs, float reduction, Vector<SubMesh>& lodSubMeshes, Vector<float>& lodScreenSizes);
+
+		/**
+		 * Reorders triangles in a triangle list so that vertices are more likely to be found in the GPU post-transform 
+		 * vertex cache, using Tom Forsyth's linear-speed vertex cache optimization algorithm.
+		 *
+		 * @param[in, out]	indices		Set of indices containing indexes into vertex array for each triangle. Reordered
+		 *								indices are written back into the same buffer.
+		 * @param[in]		numIndices	Number of indices in the @p indices array. Must be a multiple of three.
+		 * @param[in]		numVertices	Number of vertices referenced by the indices. All indices must be smaller than this.
+		 * @param[in]		indexSize	Size of a single index in the indices array, in bytes.
+		 */
+		static void optimizeVertexCache(UINT8* indices, UINT32 numIndices, UINT32 numVertices, UINT32 indexSize = 4);
+
+		/**
+		 * Reorders clusters of triangles so that triangles facing outwards from the center of the mesh are drawn first,
+		 * reducing overdraw. Should be called after optimizeVertexCache(), as triangle order within clusters is preserved.
+		 *
+		 * @param[in]		vertices	Set of vertices containing vertex positions.
+		 * @param[in, out]	indices		Set of indices containing indexes into vertex array for each triangle. Reordered
+		 *								indices are written back into the same buffer.
+		 * @param[in]		numIndices	Number of indices in the @p indices array. Must be a multiple of three.
+		 * @param[in]		numVertices	Number of vertices in the @p vertices array. All indices must be smaller than this.
+		 * @param[in]		threshold	Maximum allowed increase in vertex cache miss ratio, relative to the input order.
+		 *								If the reordering would exceed it, the indices are left untouched.
+		 * @param[in]		indexSize	Size of a single index in the indices array, in bytes.
+		 */
+		static void optimizeOverdraw(Vector3* vertices, UINT8* indices, UINT32 numIndices, UINT32 numVertices, 
+			float threshold = 1.05f, UINT32 indexSize = 4);
+
+		/**
+		 * Calculates a vertex remap table that orders vertices in the order they are first referenced by the indices, 
+		 * improving memory locality of vertex fetches. Indices are updated to reference the remapped vertices. Vertices
+		 * not referenced by any index are placed at the end.
+		 *
+		 * @param[in, out]	indices			Set of indices containing indexes into vertex array for each triangle.
+		 * @param[in]		numIndices		Number of indices in the @p indices array.
+		 * @param[in]		numVertices		Number of vertices referenced by the indices.
+		 * @param[out]		vertexRemap		Pre-allocated buffer of @p numVertices entries, that will contain the new index
+		 *									of each of the original vertices.
+		 * @param[in]		indexSize		Size of a single index in the indices array, in bytes.
+		 */
+		static void optimizeVertexFetch(UINT8* indices, UINT32 numIndices, UINT32 numVertices, UINT32* vertexRemap,
+			UINT32 indexSize = 4);
+
+		/**
+		 * Calculates the average number of vertex cache misses per triangle (ACMR) for a triangle list, by simulating a 
+		 * FIFO post-transform vertex cache.
+		 *
+		 * @param[in]	indices		Set of indices containing indexes into vertex array for each triangle.
+		 * @param[in]	numIndices	Number of indices in the @p indices array. Must be a multiple of three.
+		 * @param[in]	numVertices	Number of vertices referenced by the indices.
+		 * @param[in]	cacheSize	Number of entries in the simulated cache.
+		 * @param[in]	indexSize	Size of a single index in the indices array, in bytes.
+		 */
+		static float calculateACMR(UINT8* indices, UINT32 numIndices, UINT32 numVertices, UINT32 cacheSize = 16,
+			UINT32 indexSize = 4);
+
+		/**
+		 * Optimizes the mesh for rendering by reordering triangles in each sub-mesh for vertex cache efficiency and reduced
+		 * overdraw, followed by reordering vertices for fetch locality. Sub-meshes that aren't triangle lists are only
+		 * affected by the vertex reordering. Meshes with indices referencing non-existent vertices are left untouched.
+		 *
+		 * @param[in, out]	meshData	Mesh data to optimize in-place.
+		 * @param[in]		subMeshes	Sub-meshes to optimize. Index ranges should not overlap.
+		 * @param[out]		vertexRemap	Optional table that will be filled with the new index of each of the original 
+		 *								vertices. Required for remapping any external per-vertex data (e.g. morph shapes).
+		 * @return						Vertex cache efficiency before and after the optimization.
+		 */
+		static MeshOptimizationStats optimize(const SPtr<MeshData>& meshData, const Vector<SubMesh>& subMeshes, 
+			Vector<UINT32>* vertexRemap = nullptr);
 	};
 
 	/** @} */
@@ -0,0 +1,143 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsMatrix4.h"
+#include "BsVector3.h"
+#include "BsAABox.h"
+
+namespace bs
+{
+	/** @addtogroup Renderer-Internal
+	 *  @{
+	 */
+
+	/** Simplified triangle geometry of an object, used when rasterizing the object as an occluder. */
+	struct BS_CORE_EXPORT OccluderGeometry
+	{
+		/** Vertex positions, in the object's local space. */
+		Vector<Vector3> positions;
+
+		/** Indices into the @p positions array, three per triangle. */
+		Vector<UINT32> indices;
+
+		/**
+		 * Extracts occluder geometry from the provided mesh data. Returns null if the mesh data doesn't contain positions
+		 * or triangles.
+		 */
+		static SPtr<OccluderGeometry> create(MeshData& meshData);
+	};
+
+	/**
+	 * Low resolution depth buffer rasterized on the CPU from a set of occluder meshes, that can be used for conservatively
+	 * determining if an object is hidden behind the occluders.
+	 *
+	 * Usage: call clear(), followed by addOccluder() for each occluder and then rasterize(). After that isVisible() may be
+	 * called any number of times, from any thread.
+	 */
+	class BS_CORE_EXPORT OcclusionBuffer
+	{
+	public:
+		/**
+		 * Creates a new occlusion buffer.
+		 *
+		 * @param[in]	width	Width of the buffer in pixels. Rounded up to a multiple of four.
+		 * @param[in]	height	Height of the buffer in pixels.
+		 */
+		OcclusionBuffer(UINT32 width = 256, UINT32 height = 128);
+
+		/**
+		 * Removes all occluders from the buffer and sets up the transform used for the following occluders and visibility
+		 * tests.
+		 *
+		 * @param[in]	viewProj	View-projection matrix of the camera the buffer is rendered from.
+		 */
+		void clear(const Matrix4& viewProj);
+
+		/**
+		 * Transforms the occluder's triangles into the buffer's screen space and queues them for rasterization.
+		 * Triangles crossing the camera's near plane are ignored.
+		 *
+		 * @param[in]	geometry	Triangles of the occluder, in local space.
+		 * @param[in]	worldTfrm	Transform from the occluder's local space to world space.
+		 */
+		void addOccluder(const OccluderGeometry& geometry, const Matrix4& worldTfrm);
+
+		/**
+		 * Rasterizes all queued occluder triangles and builds the hierarchical depth buffer. Work is split between worker
+		 * threads if the task scheduler is running.
+		 */
+		void rasterize();
+
+		/**
+		 * Checks if an object with the provided world space bounds could be visible, or if it's guaranteed to be fully
+		 * hidden by the occluders. Objects off-screen or crossing the near plane are always considered visible.
+		 */
+		bool isVisible(const AABox& bounds) const;
+
+		/**
+		 * Checks visibility of multiple objects at once. Work is split between worker threads if the task scheduler is
+		 * running.
+		 *
+		 * @param[in]	bounds		World space bounds of the objects to test.
+		 * @param[out]	visible		Output array that will receive visibility of each object. Resized as needed.
+		 */
+		void isVisible(const Vector<AABox>& bounds, Vector<bool>& visible) const;
+
+		/** Returns the number of occluder triangles queued since the last call to clear(). */
+		UINT32 getNumTriangles() const { return (UINT32)mTriangles.size(); }
+
+		/** Returns the width of the buffer, in pixels. */
+		UINT32 getWidth() const { return mWidth; }
+
+		/** Returns the height of the buffer, in pixels. */
+		UINT32 getHeight() const { return mHeight; }
+
+		/**
+		 * Returns the rasterized device depth at the specified pixel, or the maximum float value if no occluder covers the
+		 * pixel. Row 0 is at the top of the screen.
+		 */
+		float getDepth(UINT32 x, UINT32 y) const { return mDepth[y * mWidth + x]; }
+
+	private:
+		/** Occluder triangle in screen space, with x/y in pixels and z containing device depth. */
+		struct Triangle
+		{
+			Vector3 v[3];
+			float minY;
+			float maxY;
+		};
+
+		/** Single level of the hierarchical depth buffer, storing the farthest depth of the pixels it covers. */
+		struct DepthLevel
+		{
+			UINT32 width;
+			UINT32 height;
+			Vector<float> depth;
+		};
+
+		/** Rasterizes all queued triangles into the rows in range [@p startRow, @p endRow). */
+		void rasterizeRows(UINT32 startRow, UINT32 endRow);
+
+		/**
+		 * Rasterizes a single triangle into the rows in range [@p startRow, @p endRow). Only pixels fully covered by the
+		 * triangle are written, using the farthest depth of the triangle within the pixel, so the rasterized occluder
+		 * never occludes more than the real one.
+		 */
+		void rasterizeTriangle(const Triangle& triangle, UINT32 startRow, UINT32 endRow);
+
+		/** Builds all levels of the hierarchical depth buffer from the rasterized depth. */
+		void buildHiZ();
+
+		UINT32 mWidth;
+		UINT32 mHeight;
+		Matrix4 mViewProj;
+
+		Vector<Triangle> mTriangles;
+		Vector<float> mDepth;
+		Vector<DepthLevel> mHiZ;
+	};
+
+	/** @} */
+}
@@ -38,6 +38,9 @@ namespace bs
 
 		UINT32 numObjectsCreated; /**< How many GPU objects were created. */
 		UINT32 numObjectsDestroyed; /**< How many GPU objects were destroyed. */
+
+		UINT32 numFrustumCulled; /**< How many renderable objects were culled because they were outside the frustum. */
+		UINT32 numOcclusionCulled; /**< How many renderable objects were culled because they were hidden by occluders. */
 	};
 
 	/** Profiler report containing information about GPU sampling data from a single frame. */
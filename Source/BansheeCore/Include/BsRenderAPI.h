@@ -22,6 +22,17 @@ namespace bs
 
 	class RenderAPIInfo;
 
+	/** Describes a graphics pipeline state along with the state it will be used with when rendering. */
+	struct PIPELINE_PERMUTATION_DESC
+	{
+		SPtr<GraphicsPipelineStateCore> pipeline; /**< Pipeline state that will be bound. */
+		SPtr<RenderTargetCore> target; /**< Render target that will be rendered to. */
+		SPtr<VertexDeclarationCore> vertexDeclaration; /**< Layout of the vertex buffers that will be bound. */
+		DrawOperationType drawOp = DOT_TRIANGLE_LIST; /**< Type of primitives that will be drawn. */
+		bool readOnlyDepthStencil = false; /**< True if the depth-stencil surface will be bound as read-only. */
+		UINT32 deviceIdx = 0; /**< Index of the GPU the render target was created on. */
+	};
+
 	/**
 	 * Provides access to RenderAPICore from the simulation thread. All the commands get queued on the core thread queue 
 	 * for the calling thread.
@@ -519,6 +530,16 @@ namespace bs
 		 */
 		virtual void submitCommandBuffer(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask = 0xFFFFFFFF) = 0;
 
+		/**
+		 * Starts creating the API objects required for rendering with the provided pipeline permutations on worker
+		 * threads, so they don't need to be created when a permutation is first used for rendering. Should be called at
+		 * load time for permutations that are known to be used. Does nothing on render APIs that fully create pipeline
+		 * objects when the pipeline state is created.
+		 *
+		 * @note	Core thread only.
+		 */
+		virtual void prewarmPipelines(const Vector<PIPELINE_PERMUTATION_DESC>& permutations) { }
+
 		/**
 		 * Gets the capabilities of a specific GPU.
 		 * 
@@ -38,6 +38,7 @@ namespace bs
 		RSC_GEOMETRY_PROGRAM			= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 3), /**< Supports hardware geometry programs. */
 		RSC_TESSELLATION_PROGRAM		= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 4), /**< Supports hardware tessellation programs. */
 		RSC_COMPUTE_PROGRAM				= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 5), /**< Supports hardware compute programs. */
+		RSC_TEXTURE_STREAMING			= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 7), /**< Supports changing the most detailed mip level of a texture after creation, as required by texture streaming. */
 	};
 
 	/** Holds data about render system driver version. */
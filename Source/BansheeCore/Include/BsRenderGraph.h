@@ -0,0 +1,221 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsTexture.h"
+
+namespace bs
+{
+	/** @addtogroup Renderer-Internal
+	 *  @{
+	 */
+
+	/** Provides physical textures for the transient textures of a RenderGraph. */
+	class BS_CORE_EXPORT RenderGraphAllocator
+	{
+	public:
+		virtual ~RenderGraphAllocator() { }
+
+		/**
+		 * Allocates a texture matching the provided description.
+		 *
+		 * @param[in]	desc			Description of the texture to allocate.
+		 * @param[out]	texture			Allocated texture.
+		 * @param[out]	renderTexture	Render texture wrapping the allocated texture, if the texture is a render target
+		 *								or a depth stencil surface.
+		 */
+		virtual void allocate(const TEXTURE_DESC& desc, SPtr<TextureCore>& texture,
+			SPtr<RenderTextureCore>& renderTexture) = 0;
+
+		/** Releases a texture previously returned by allocate(). */
+		virtual void release(const SPtr<TextureCore>& texture) = 0;
+	};
+
+	/** Statistics about a compiled RenderGraph. */
+	struct RenderGraphStats
+	{
+		/** Number of passes that will be executed. */
+		UINT32 numPasses = 0;
+
+		/** Number of passes that were removed because none of their outputs are used. */
+		UINT32 numCulledPasses = 0;
+
+		/** Number of transient textures used by the executed passes. */
+		UINT32 numTransientTextures = 0;
+
+		/** Number of physical textures required for the transient textures, after aliasing. */
+		UINT32 numPhysicalTextures = 0;
+
+		/** Memory required by all transient textures if each received its own physical texture, in bytes. */
+		UINT64 transientMemory = 0;
+
+		/** Memory required by the physical textures after aliasing, in bytes. */
+		UINT64 physicalMemory = 0;
+	};
+
+	/**
+	 * Declarative description of a set of rendering passes and the textures they read and write. Once all passes are
+	 * added the graph is compiled, which removes passes whose outputs are never used, orders the passes according to
+	 * their dependencies, and lets transient textures with non-overlapping lifetimes share the same physical texture.
+	 *
+	 * Usage: create textures with createTexture() or importTexture(), add passes with addPass() and declare their
+	 * inputs and outputs with read() and write(). Then call compile() followed by execute(). Compilation doesn't touch the
+	 * GPU and may be performed on any thread.
+	 *
+	 * Textures created by the graph are transient and only valid during execution of the passes that use them, while
+	 * imported textures are owned externally. Passes writing to imported textures, or passes marked with
+	 * setHasSideEffects(), are never culled.
+	 *
+	 * A pass reading a texture always executes after all passes writing to that texture. Passes writing to the same
+	 * texture execute in the order they were added in.
+	 */
+	class BS_CORE_EXPORT RenderGraph
+	{
+	public:
+		/** Callback executing a single pass. Receives the graph which can be used for retrieving the textures. */
+		typedef std::function<void(const RenderGraph&)> ExecuteCallback;
+
+		/**
+		 * Registers a new transient texture.
+		 *
+		 * @param[in]	name	Name of the texture, used for debugging purposes.
+		 * @param[in]	desc	Description of the texture. Physical texture will be allocated according to it.
+		 * @return				Identifier of the texture.
+		 */
+		UINT32 createTexture(const String& name, const TEXTURE_DESC& desc);
+
+		/**
+		 * Registers an externally owned texture.
+		 *
+		 * @param[in]	name			Name of the texture, used for debugging purposes.
+		 * @param[in]	texture			Texture to register.
+		 * @param[in]	renderTexture	Optional render texture wrapping @p texture.
+		 * @return						Identifier of the texture.
+		 */
+		UINT32 importTexture(const String& name, const SPtr<TextureCore>& texture,
+			const SPtr<RenderTextureCore>& renderTexture = nullptr);
+
+		/**
+		 * Registers a new pass.
+		 *
+		 * @param[in]	name		Name of the pass, used for debugging purposes.
+		 * @param[in]	execute		Callback to trigger when executing the pass.
+		 * @return					Identifier of the pass.
+		 */
+		UINT32 addPass(const String& name, const ExecuteCallback& execute);
+
+		/** Declares that the pass reads from the texture. */
+		void read(UINT32 pass, UINT32 texture);
+
+		/** Declares that the pass writes to the texture. */
+		void write(UINT32 pass, UINT32 texture);
+
+		/** Marks the pass as having effects outside of the graph, ensuring it never gets culled. */
+		void setHasSideEffects(UINT32 pass);
+
+		/**
+		 * Culls unused passes, determines the pass execution order and assigns physical textures to the transient
+		 * textures.
+		 *
+		 * @return	True if the graph was compiled successfully. False if it contains a dependency cycle, or if a transient
+		 *			texture is read without any pass writing to it, in which case an error is logged.
+		 */
+		bool compile();
+
+		/**
+		 * Executes the passes in the order determined by compile(). Physical textures are allocated from the provided
+		 * allocator before the first pass using them, and returned to it after the last. Must be called after a
+		 * successful compile().
+		 */
+		void execute(RenderGraphAllocator& allocator);
+
+		/** Removes all passes and textures from the graph. */
+		void clear();
+
+		/** Returns the identifiers of the passes that will be executed, in execution order. Valid after compile(). */
+		const Vector<UINT32>& getExecutionOrder() const { return mOrder; }
+
+		/** Checks if the pass was culled during compile(). */
+		bool isPassCulled(UINT32 pass) const { return mPasses[pass].culled; }
+
+		/**
+		 * Returns the index of the physical texture assigned to a transient texture, or -1 if the texture is not used by
+		 * any executed pass or is imported. Transient textures sharing the same index are aliased. Valid after compile().
+		 */
+		UINT32 getPhysicalTextureIdx(UINT32 texture) const { return mTextures[texture].physicalIdx; }
+
+		/** Returns statistics about the graph. Valid after compile(). */
+		const RenderGraphStats& getStats() const { return mStats; }
+
+		/** Returns the texture with the specified identifier. Transient textures are only valid during execute(). */
+		SPtr<TextureCore> getTexture(UINT32 texture) const;
+
+		/**
+		 * Returns the render texture wrapping the texture with the specified identifier, if any. Transient textures are
+		 * only valid during execute().
+		 */
+		SPtr<RenderTextureCore> getRenderTexture(UINT32 texture) const;
+
+		/** Returns the approximate amount of memory a texture matching the description requires, in bytes. */
+		static UINT64 getMemorySize(const TEXTURE_DESC& desc);
+
+	private:
+		/** Information about a texture used by the graph. */
+		struct TextureData
+		{
+			String name;
+			TEXTURE_DESC desc;
+			bool imported;
+			SPtr<TextureCore> texture;
+			SPtr<RenderTextureCore> renderTexture;
+
+			Vector<UINT32> writers;
+			UINT32 firstUse;
+			UINT32 lastUse;
+			UINT32 physicalIdx;
+		};
+
+		/** Information about a pass in the graph. */
+		struct PassData
+		{
+			String name;
+			ExecuteCallback execute;
+			Vector<UINT32> reads;
+			Vector<UINT32> writes;
+			bool hasSideEffects;
+			bool culled;
+		};
+
+		/** Physical texture shared by one or more transient textures with non-overlapping lifetimes. */
+		struct PhysicalTexture
+		{
+			TEXTURE_DESC desc;
+			UINT32 firstUse;
+			UINT32 lastUse;
+			SPtr<TextureCore> texture;
+			SPtr<RenderTextureCore> renderTexture;
+		};
+
+		/** Marks passes whose outputs are never used as culled. */
+		void cullPasses();
+
+		/** Sorts the passes that weren't culled according to their dependencies. Returns false if a cycle exists. */
+		bool sortPasses();
+
+		/** Calculates lifetimes of transient textures and assigns physical textures to them. */
+		void assignPhysicalTextures();
+
+		/** Checks if physical textures created from the provided descriptions can be used interchangeably. */
+		static bool isCompatible(const TEXTURE_DESC& a, const TEXTURE_DESC& b);
+
+		Vector<TextureData> mTextures;
+		Vector<PassData> mPasses;
+		Vector<PhysicalTexture> mPhysicalTextures;
+		Vector<UINT32> mOrder;
+		RenderGraphStats mStats;
+		bool mCompiled = false;
+	};
+
+	/** @} */
+}
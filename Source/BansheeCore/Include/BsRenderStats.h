@@ -29,7 +29,7 @@ namespace bs
 		RenderStatsData()
 		: numDrawCalls(0), numComputeCalls(0), numRenderTargetChanges(0), numPresents(0), numClears(0)
 		, numVertices(0), numPrimitives(0), numPipelineStateChanges(0), numGpuParamBinds(0), numVertexBufferBinds(0)
-		, numIndexBufferBinds(0)
+		, numIndexBufferBinds(0), numFrustumCulled(0), numOcclusionCulled(0)
 		{ }
 
 		UINT64 numDrawCalls;
@@ -52,6 +52,9 @@ namespace bs
 
 		UINT64 numObjectsCreated; 
 		UINT64 numObjectsDestroyed;
+
+		UINT64 numFrustumCulled;
+		UINT64 numOcclusionCulled;
 	};
 
 	/**
@@ -86,6 +89,12 @@ namespace bs
 		/** Increments primitive draw counter indicating how many primitives were sent to the pipeline. */
 		void addNumPrimitives(UINT32 count) { mData.numPrimitives += count; }
 
+		/** Increments the counter of renderable objects skipped because they were outside of the view frustum. */
+		void addNumFrustumCulled(UINT32 count) { mData.numFrustumCulled += count; }
+
+		/** Increments the counter of renderable objects skipped because they were hidden behind occluders. */
+		void addNumOcclusionCulled(UINT32 count) { mData.numOcclusionCulled += count; }
+
 		/** Increments pipeline state change counter indicating how many times was a pipeline state bound. */
 		void incNumPipelineStateChanges() { mData.numPipelineStateChanges++; }
 
@@ -242,6 +242,15 @@ namespace bs
 		 */
 		SPtr<ResourceManifest> getResourceManifest(const String& name) const;
 
+		/**
+		 * Registers a pack file containing resources, identified by their UUIDs. Resources contained in a registered pack
+		 * will be loaded from the pack instead of from their individual files. Packs registered later take priority.
+		 */
+		void registerPackFile(const SPtr<PackFile>& packFile);
+
+		/**	Unregisters a pack file previously registered with registerPackFile(). */
+		void unregisterPackFile(const SPtr<PackFile>& packFile);
+
 		/** Attempts to retrieve file path from the provided UUID. Returns true if successful, false otherwise. */
 		bool getFilePathFromUUID(const String& uuid, Path& filePath) const;
 
@@ -304,14 +313,33 @@ namespace bs
 		 */
 		HResource loadInternal(const String& UUID, const Path& filePath, bool synchronous, ResourceLoadFlags loadFlags);
 
-		/** Performs actually reading and deserializing of the resource file. Called from various worker threads. */
-		SPtr<Resource> loadFromDiskAndDeserialize(const Path& filePath, bool loadWithSaveData);
+		/**
+		 * Performs actually reading and deserializing of the resource file. If @p openStream is provided the resource is
+		 * read from it, and it must be positioned right after the saved resource data. Otherwise the resource is read
+		 * from the pack if one is provided, or from the provided file path. Called from various worker threads.
+		 */
+		SPtr<Resource> loadFromDiskAndDeserialize(const String& UUID, const Path& filePath,
+			const SPtr<PackFile>& packFile, const SPtr<DataStream>& openStream, bool loadWithSaveData);
+
+		/**
+		 * Opens the stream containing the serialized resource, either from the provided pack file or if one isn't
+		 * provided, from the provided file path. Logs an error and returns null if the stream cannot be opened, e.g. if
+		 * the pack file entry fails to decompress.
+		 */
+		SPtr<DataStream> openResourceStream(const String& UUID, const Path& filePath, const SPtr<PackFile>& packFile);
+
+		/** Returns a registered pack file containing the resource with the provided UUID, or null if none do. */
+		SPtr<PackFile> findPackFile(const String& UUID) const;
 
 		/**	Triggered when individual resource has finished loading. */
 		void loadComplete(HResource& resource);
 
-		/**	Callback triggered when the task manager is ready to process the loading task. */
-		void loadCallback(const Path& filePath, HResource& resource, bool loadWithSaveData);
+		/**	
+		 * Callback triggered when the task manager is ready to process the loading task. See 
+		 * loadFromDiskAndDeserialize() for the meaning of the parameters.
+		 */
+		void loadCallback(const Path& filePath, const SPtr<PackFile>& packFile, const SPtr<DataStream>& openStream,
+			HResource& resource, bool loadWithSaveData);
 
 		/**	Destroys a resource, freeing its memory. */
 		void destroy(ResourceHandleBase& resource);
@@ -319,9 +347,11 @@ namespace bs
 	private:
 		Vector<SPtr<ResourceManifest>> mResourceManifests;
 		SPtr<ResourceManifest> mDefaultResourceManifest;
+		Vector<SPtr<PackFile>> mPackFiles;
 
 		Mutex mInProgressResourcesMutex;
 		Mutex mLoadedResourceMutex;
+		mutable Mutex mPackFilesMutex;
 
 		UnorderedMap<String, WeakResourceHandle<Resource>> mHandles;
 		UnorderedMap<String, LoadedResourceData> mLoadedResources;
@@ -522,7 +522,7 @@ namespace bs
 				newComponent->onInitialized();
 
 				if (getActive())
-					newComponent->onEnabled();
+					enableComponent(newComponent.get());
 			}
 
 			return newComponent;
@@ -648,6 +648,18 @@ namespace bs
 		/**	Adds the component to the internal component array. */
 		void addComponentInternal(const SPtr<Component> component);
 
+		/** Triggers Component::onEnabled() and registers the component for per-frame updates with the scene manager. */
+		static void enableComponent(Component* component);
+
+		/** Removes the component from the scene manager's per-frame updates and triggers Component::onDisabled(). */
+		static void disableComponent(Component* component);
+
+		/**
+		 * Removes components of this object and all its descendants from the scene manager's per-frame updates, without
+		 * triggering any events. Used when the hierarchy is queued for destruction.
+		 */
+		void stopUpdatingHierarchy();
+
 		Vector<HComponent> mComponents;
 
 		/************************************************************************/
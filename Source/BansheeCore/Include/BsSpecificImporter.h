@@ -64,6 +64,12 @@ namespace bs
 		 */
 		virtual Vector<SubResourceRaw> importAll(const Path& filePath, SPtr<const ImportOptions> importOptions);
 
+		/**
+		 * Checks can the importer import multiple files at once from different threads. Importers relying on shared
+		 * state (for example a single SDK instance) must return false.
+		 */
+		virtual bool isThreadSafe() const { return false; }
+
 		/**
 		 * Creates import options specific for this importer. Import options are provided when calling import() in order 
 		 * to customize the import, and provide additional information.
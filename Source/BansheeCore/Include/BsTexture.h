@@ -216,6 +216,13 @@ namespace bs
 		/**	Returns properties that contain information about the texture. */
 		const TextureProperties& getProperties() const { return mProperties; }
 
+		/**
+		 * Returns the most detailed mip level that is available for sampling. This is always zero, unless the texture's
+		 * mip levels are being streamed in by the TextureStreamingManager. Only the mip levels starting with this one
+		 * have GPU memory allocated.
+		 */
+		UINT32 getResidentMip() const { return mResidentMip; }
+
 		/**	Retrieves a core implementation of a texture usable only from the core thread. */
 		SPtr<TextureCore> getCore() const;
 
@@ -259,6 +266,36 @@ namespace bs
 		static SPtr<Texture> _createPtr(const SPtr<PixelData>& pixelData, int usage = TU_DEFAULT, 
 			bool hwGammaCorrection = false);
 
+		/**
+		 * Changes the most detailed mip level that is available for sampling. GPU memory for more detailed mip levels is
+		 * released, and allocated for newly resident mip levels. Only valid for textures that are being streamed.
+		 *
+		 * @param[in]	mip			Most detailed mip level to make available for sampling.
+		 * @param[in]	mipData		Data for the mip levels that weren't previously resident, as returned by
+		 *							_readMipLevels(@p mip, getResidentMip()). Can be empty if @p mip is not more detailed
+		 *							than getResidentMip().
+		 */
+		void _setResidentMip(UINT32 mip, const Vector<SPtr<PixelData>>& mipData = Vector<SPtr<PixelData>>());
+
+		/**
+		 * Reads mip levels from the file the texture was loaded from, converting them to the texture's format if needed.
+		 * Only valid for textures that are being streamed.
+		 *
+		 * @param[in]	mostDetailedMip		Most detailed mip level to read.
+		 * @param[in]	leastDetailedMip	Mip level at which to stop reading. This level is not read.
+		 * @return							Data for each face of each read mip level, starting with the faces of the
+		 *									most detailed level.
+		 *
+		 * @note	Thread safe.
+		 */
+		Vector<SPtr<PixelData>> _readMipLevels(UINT32 mostDetailedMip, UINT32 leastDetailedMip) const;
+
+		/** Returns true if the texture's mip levels can be streamed in from the file it was loaded from. */
+		bool _isStreamed() const { return !mStreamPath.isEmpty(); }
+
+		/** Returns an identifier of the texture in the texture streaming system, or -1 if not streamed. */
+		UINT32 _getStreamingId() const { return mStreamingId; }
+
 		/** @} */
 
     protected:
@@ -286,11 +323,32 @@ namespace bs
 		/**	Updates the cached CPU buffers with new data. */
 		void updateCPUBuffers(UINT32 subresourceIdx, const PixelData& data);
 
+		/**
+		 * Reads mip levels from the texture's serialized data. See _readMipLevels().
+		 *
+		 * @param[in]	stream				Stream to read the serialized data from.
+		 * @param[in]	offset				Offset in the stream at which the serialized mip data starts.
+		 * @param[in]	mostDetailedMip		Most detailed mip level to read.
+		 * @param[in]	leastDetailedMip	Mip level at which to stop reading. This level is not read.
+		 */
+		Vector<SPtr<PixelData>> readMipLevels(const SPtr<DataStream>& stream, UINT64 offset, UINT32 mostDetailedMip,
+			UINT32 leastDetailedMip) const;
+
+		/** Assigns an identifier of the texture in the texture streaming system, to both this and the core object. */
+		void setStreamingId(UINT32 id);
+
 	protected:
 		Vector<SPtr<PixelData>> mCPUSubresourceData;
 		TextureProperties mProperties;
 		mutable SPtr<PixelData> mInitData;
 
+		Path mStreamPath;
+		UINT64 mStreamOffset = 0;
+		UINT32 mStreamSize = 0;
+		PixelFormat mStreamFormat = PF_UNKNOWN;
+		UINT32 mResidentMip = 0;
+		UINT32 mStreamingId = (UINT32)-1;
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
@@ -393,6 +451,29 @@ namespace bs
 		/**	Returns properties that contain information about the texture. */
 		const TextureProperties& getProperties() const { return mProperties; }
 
+		/**
+		 * Restricts sampling of the texture to mip levels starting with the provided mip level. Used for textures whose
+		 * more detailed mip levels are not yet loaded, or were evicted.
+		 */
+		void setMostDetailedMip(UINT32 mip);
+
+		/** Returns the most detailed mip level sampling is restricted to, as set by setMostDetailedMip(). */
+		UINT32 getMostDetailedMip() const { return mMostDetailedMip; }
+
+		/**
+		 * Changes which mip levels have GPU memory allocated. Mip levels more detailed than the provided level are
+		 * released, and can no longer be sampled, read or written. Levels that are allocated again have undefined contents
+		 * until written. Contents of the levels allocated both before and after the change are preserved. Only supported
+		 * for 2D textures with a single face that aren't used as render or load-store targets.
+		 */
+		void setAllocatedMip(UINT32 mip);
+
+		/** Returns the most detailed mip level that has GPU memory allocated, as set by setAllocatedMip(). */
+		UINT32 getAllocatedMip() const { return mAllocatedMip; }
+
+		/** Returns an identifier of the texture in the texture streaming system, or -1 if not streamed. */
+		UINT32 _getStreamingId() const { return mStreamingId; }
+
 		/************************************************************************/
 		/* 								STATICS		                     		*/
 		/************************************************************************/
@@ -439,6 +520,8 @@ namespace bs
 		/** Returns a plain normal map texture with normal pointing up (in Y direction). */
 		static SPtr<TextureCore> NORMAL;
 	protected:
+		friend class Texture;
+
 		/** @copydoc lock */
 		virtual PixelData lockImpl(GpuLockOptions options, UINT32 mipLevel = 0, UINT32 face = 0, UINT32 deviceIdx = 0,
 			UINT32 queueIdx = 0) = 0;
@@ -458,6 +541,16 @@ namespace bs
 		virtual void writeDataImpl(const PixelData& src, UINT32 mipLevel = 0, UINT32 face = 0, 
 			bool discardWholeBuffer = false, UINT32 queueIdx = 0) = 0;
 
+		/** @copydoc setMostDetailedMip */
+		virtual void setMostDetailedMipImpl(UINT32 mip) { }
+
+		/**
+		 * Reallocates the texture so only the mip levels starting with getAllocatedMip() use GPU memory.
+		 *
+		 * @param[in]	prevMip		Most detailed mip level that was allocated before the change.
+		 */
+		virtual void setAllocatedMipImpl(UINT32 prevMip) { }
+
 		/************************************************************************/
 		/* 								TEXTURE VIEW                      		*/
 		/************************************************************************/
@@ -485,6 +578,9 @@ namespace bs
 		UnorderedMap<TEXTURE_VIEW_DESC, TextureViewReference*, TextureView::HashFunction, TextureView::EqualFunction> mTextureViews;
 		TextureProperties mProperties;
 		SPtr<PixelData> mInitData;
+		UINT32 mMostDetailedMip = 0;
+		UINT32 mAllocatedMip = 0;
+		UINT32 mStreamingId = (UINT32)-1;
 	};
 
 	/** @} */
@@ -10,6 +10,9 @@
 #include "BsRenderAPI.h"
 #include "BsTextureManager.h"
 #include "BsPixelData.h"
+#include "BsDataStream.h"
+#include "BsTextureStreaming.h"
+#include "BsTextureStreamingManager.h"
 
 namespace bs
 {
@@ -20,6 +23,14 @@ namespace bs
 
 	class BS_CORE_EXPORT TextureRTTI : public RTTIType<Texture, Resource, TextureRTTI>
 	{
+		/** Data kept while a texture is being deserialized. */
+		struct DeserializationData
+		{
+			Vector<SPtr<PixelData>> pixelData;
+			SPtr<DataStream> mipData;
+			UINT64 mipDataOffset = 0;
+		};
+
 	private:
 		BS_BEGIN_RTTI_MEMBERS
 			BS_RTTI_MEMBER_PLAIN(mSize, 0)
@@ -65,21 +76,83 @@ namespace bs
 
 		void setPixelData(Texture* obj, UINT32 idx, SPtr<PixelData> data)
 		{
-			Vector<SPtr<PixelData>>* pixelData = any_cast<Vector<SPtr<PixelData>>*>(obj->mRTTIData);
+			DeserializationData* deserializationData = any_cast<DeserializationData*>(obj->mRTTIData);
 
-			(*pixelData)[idx] = data;
+			deserializationData->pixelData[idx] = data;
 		}
 
 		UINT32 getPixelDataArraySize(Texture* obj)
 		{
-			return obj->mProperties.getNumFaces() * (obj->mProperties.getNumMipmaps() + 1);
+			// Pixel data is now saved in the mip data block, and this field is only kept for loading older textures
+			return 0;
 		}
 
 		void setPixelDataArraySize(Texture* obj, UINT32 size)
 		{
-			Vector<SPtr<PixelData>>* pixelData = any_cast<Vector<SPtr<PixelData>>*>(obj->mRTTIData);
+			DeserializationData* deserializationData = any_cast<DeserializationData*>(obj->mRTTIData);
+
+			deserializationData->pixelData.resize(size);
+		}
+
+		SPtr<DataStream> getMipData(Texture* obj, UINT32& size)
+		{
+			const TextureProperties& props = obj->mProperties;
+			UINT32 numFaces = props.getNumFaces();
+
+			size = (UINT32)TextureStreaming::calculateMipChainSize(props, 0);
+			UINT8* data = (UINT8*)bs_alloc(size);
+
+			// Streamed mip levels that aren't resident aren't available on the GPU
+			Vector<SPtr<PixelData>> unloadedData;
+			if (obj->_isStreamed())
+				unloadedData = obj->_readMipLevels(0, obj->mResidentMip);
+
+			// Mip levels are stored starting with the least detailed one, so that a streamed texture can read the levels
+			// it keeps resident at all times with a single sequential read
+			UINT8* dst = data;
+			for (INT32 i = (INT32)props.getNumMipmaps(); i >= 0; i--)
+			{
+				for (UINT32 j = 0; j < numFaces; j++)
+				{
+					SPtr<PixelData> pixelData;
+					if ((UINT32)i * numFaces + j < (UINT32)unloadedData.size())
+						pixelData = unloadedData[i * numFaces + j];
+					else
+					{
+						pixelData = props.allocBuffer(j, (UINT32)i);
+
+						obj->readData(pixelData, j, (UINT32)i);
+						gCoreThread().submit(true);
+					}
+
+					UINT32 dataSize = pixelData->getConsecutiveSize();
+					memcpy(dst, pixelData->getData(), dataSize);
+					dst += dataSize;
+				}
+			}
+
+			return bs_shared_ptr_new<MemoryDataStream>(data, size);
+		}
 
-			pixelData->resize(size);
+		void setMipData(Texture* obj, const SPtr<DataStream>& val, UINT32 size)
+		{
+			// Making sure that the texture cannot modify the source stream, which is still used by the deserializer. The
+			// stream is only used until deserialization ends, so its data doesn't need to be copied.
+			DeserializationData* deserializationData = any_cast<DeserializationData*>(obj->mRTTIData);
+			deserializationData->mipData = val->clone(false);
+			deserializationData->mipDataOffset = val->tell();
+
+			obj->mStreamSize = size;
+
+			// If the data is read directly from a file (including uncompressed pack file entries) only its location is
+			// kept, and the file is opened again whenever more mip levels need to be streamed in
+			Path path;
+			size_t fileOffset;
+			if (val->getSourceFile(path, fileOffset))
+			{
+				obj->mStreamPath = path;
+				obj->mStreamOffset = fileOffset + val->tell();
+			}
 		}
 
 	public:
@@ -90,13 +163,15 @@ namespace bs
 
 			addReflectablePtrArrayField("mPixelData", 12, &TextureRTTI::getPixelData, &TextureRTTI::getPixelDataArraySize, 
 				&TextureRTTI::setPixelData, &TextureRTTI::setPixelDataArraySize, RTTI_Flag_SkipInReferenceSearch);
+
+			addDataBlockField("mMipData", 13, &TextureRTTI::getMipData, &TextureRTTI::setMipData, 0);
 		}
 
 		void onDeserializationStarted(IReflectable* obj, const UnorderedMap<String, UINT64>& params) override
 		{
 			Texture* texture = static_cast<Texture*>(obj);
 
-			texture->mRTTIData = bs_new<Vector<SPtr<PixelData>>>();
+			texture->mRTTIData = bs_new<DeserializationData>();
 		}
 
 		void onDeserializationEnded(IReflectable* obj, const UnorderedMap<String, UINT64>& params) override
@@ -114,7 +189,8 @@ namespace bs
 			PixelFormat validFormat = TextureManager::instance().getNativeFormat(
 				texProps.getTextureType(), texProps.getFormat(), texProps.getUsage(), texProps.isHardwareGammaEnabled());
 
-			Vector<SPtr<PixelData>>* pixelData = any_cast<Vector<SPtr<PixelData>>*>(texture->mRTTIData);
+			DeserializationData* deserializationData = any_cast<DeserializationData*>(texture->mRTTIData);
+			Vector<SPtr<PixelData>>* pixelData = &deserializationData->pixelData;
 			if (originalFormat != validFormat)
 			{
 				texProps.mDesc.format = validFormat;
@@ -129,10 +205,52 @@ namespace bs
 				}
 			}
 
+			// Only the mip levels that are always kept resident are allocated for streamed textures
+			SPtr<DataStream> mipData = deserializationData->mipData;
+			bool isStreamed = mipData != nullptr && texture->_isStreamed() && TextureStreamingManager::isStarted() &&
+				TextureStreamingManager::isStreamable(texProps);
+			if (isStreamed)
+				texture->mResidentMip = TextureStreamingManager::instance().getMinResidentMip(texProps);
+
 			// A bit clumsy initializing with already set values, but I feel its better than complicating things and storing the values
 			// in mRTTIData.
 			texture->initialize();
 
+			if (mipData != nullptr)
+			{
+				// Mip levels are read from the data block directly, and converted to the valid format as they are read
+				texture->mStreamFormat = originalFormat;
+
+				UINT32 numMips = texProps.getNumMipmaps() + 1;
+				UINT32 numFaces = texProps.getNumFaces();
+				if (isStreamed)
+				{
+					UINT32 residentMip = texture->mResidentMip;
+					Vector<SPtr<PixelData>> mipLevels = texture->readMipLevels(mipData, 
+						deserializationData->mipDataOffset, residentMip, numMips);
+
+					for (size_t i = 0; i < mipLevels.size(); i++)
+					{
+						texture->writeData(mipLevels[i], (UINT32)i % numFaces, residentMip + (UINT32)i / numFaces, 
+							false);
+					}
+
+					SPtr<Texture> texturePtr = std::static_pointer_cast<Texture>(texture->getThisPtr());
+					UINT32 streamingId = TextureStreamingManager::instance()._registerTexture(texturePtr);
+					texture->setStreamingId(streamingId);
+				}
+				else
+				{
+					Vector<SPtr<PixelData>> mipLevels = texture->readMipLevels(mipData, 
+						deserializationData->mipDataOffset, 0, numMips);
+
+					for (size_t i = 0; i < mipLevels.size(); i++)
+						texture->writeData(mipLevels[i], (UINT32)i % numFaces, (UINT32)i / numFaces, false);
+
+					texture->mStreamPath = Path::BLANK;
+				}
+			}
+
 			for(size_t i = 0; i < pixelData->size(); i++)
 			{
 				UINT32 face = (size_t)Math::floor(i / (float)(texProps.getNumMipmaps() + 1));
@@ -141,7 +259,7 @@ namespace bs
 				texture->writeData(pixelData->at(i), face, mipmap, false);
 			}
 
-			bs_delete(pixelData);
+			bs_delete(deserializationData);
 			texture->mRTTIData = nullptr;	
 		}
 
@@ -0,0 +1,168 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsTexture.h"
+
+namespace bs
+{
+	/** @addtogroup Resources-Internal
+	 *  @{
+	 */
+
+	/** Settings that control texture streaming. */
+	struct TEXTURE_STREAMING_DESC
+	{
+		/** Maximum amount of GPU memory, in bytes, that the mip levels of streamed textures are allowed to use. */
+		UINT64 memoryBudget = 512 * 1024 * 1024;
+
+		/**
+		 * Maximum amount of mip data, in bytes, to stream in during a single frame. At least one texture is always
+		 * streamed in per frame, regardless of its size.
+		 */
+		UINT64 maxLoadPerFrame = 16 * 1024 * 1024;
+
+		/** Number of frames a texture must go without being requested before its detailed mip levels are evicted. */
+		UINT32 evictionDelay = 120;
+
+		/**
+		 * Mip levels whose width and height are both equal or smaller than this value are always kept resident, so there
+		 * is always something to render with.
+		 */
+		UINT32 minResidentSize = 128;
+	};
+
+	/** Information about residency of a single streamed texture. */
+	struct TextureResidencyStats
+	{
+		/** Number of mip levels in the texture, including the top level. */
+		UINT32 numMips = 0;
+
+		/** Most detailed mip level that is currently resident, or being streamed in. */
+		UINT32 residentMip = 0;
+
+		/** Most detailed mip level that was requested in the most recent request. */
+		UINT32 requestedMip = 0;
+
+		/**
+		 * Most detailed mip level the texture should have resident, after the memory budget has been accounted for.
+		 * Differs from the resident mip level while the load is delayed by the per frame load limit.
+		 */
+		UINT32 targetMip = 0;
+
+		/** Number of bytes used by the resident mip levels. */
+		UINT64 residentBytes = 0;
+
+		/** Frame during which the texture was last requested. */
+		UINT64 lastRequestFrame = 0;
+	};
+
+	/** Describes a change in residency of a streamed texture, as determined by TextureStreaming::update(). */
+	struct TextureResidencyChange
+	{
+		/** Identifier of the texture, as returned by TextureStreaming::registerTexture(). */
+		UINT32 id;
+
+		/** Most detailed mip level the texture should have resident. */
+		UINT32 mostDetailedMip;
+	};
+
+	/**
+	 * Determines which mip levels of streamed textures should be resident in memory. Textures request mip levels based on
+	 * their texel density on the screen, and keep them until they haven't been requested for a number of frames. The
+	 * requests are satisfied within a memory budget, and if the budget is exceeded detail is first dropped from textures
+	 * that were requested least recently. Loads are limited per frame, starting with the most recently requested textures.
+	 *
+	 * This class only makes residency decisions and does not perform any loading itself, which makes it usable without
+	 * a render API.
+	 */
+	class BS_CORE_EXPORT TextureStreaming
+	{
+		/** Information about a single registered texture. */
+		struct Entry
+		{
+			Vector<UINT64> mipChainSizes;
+			UINT32 minResidentMip = 0;
+			UINT32 residentMip = 0;
+			UINT32 requestedMip = 0;
+			UINT32 pendingRequestMip = 0;
+			UINT32 targetMip = 0;
+			UINT64 lastRequestFrame = 0;
+			bool hasPendingRequest = false;
+			bool active = false;
+		};
+
+	public:
+		TextureStreaming(const TEXTURE_STREAMING_DESC& desc = TEXTURE_STREAMING_DESC());
+
+		/**
+		 * Registers a new texture to be streamed.
+		 *
+		 * @param[in]	props			Properties of the texture.
+		 * @param[in]	residentMip		Most detailed mip level that is resident at the time of registration.
+		 * @return						Identifier that can be used for referencing the texture in other calls.
+		 */
+		UINT32 registerTexture(const TextureProperties& props, UINT32 residentMip);
+
+		/** Unregisters a texture previously registered with registerTexture(). */
+		void unregisterTexture(UINT32 id);
+
+		/**
+		 * Requests mip levels for a texture, based on how many texels of its top mip level would map to a single pixel on
+		 * the screen. Can be called multiple times per frame, in which case the most detailed request is used.
+		 */
+		void requestTexelDensity(UINT32 id, float texelsPerPixel);
+
+		/**
+		 * Processes all requests since the last call and determines how the residency of textures should change. Returned
+		 * changes are assumed to be applied by the caller before the next call. Should be called once per frame.
+		 *
+		 * @param[out]	changes		Textures whose resident mip levels should be changed.
+		 */
+		void update(Vector<TextureResidencyChange>& changes);
+
+		/** Returns residency information about the texture with the specified identifier. */
+		TextureResidencyStats getStats(UINT32 id) const;
+
+		/** Returns the number of bytes used by all the resident mip levels of all registered textures. */
+		UINT64 getResidentBytes() const { return mResidentBytes; }
+
+		/** Returns the number of currently registered textures. */
+		UINT32 getNumTextures() const { return mNumActiveEntries; }
+
+		/** Returns the settings that control streaming. */
+		const TEXTURE_STREAMING_DESC& getDesc() const { return mDesc; }
+
+		/** Changes the settings that control streaming. Changes will be applied on next call to update(). */
+		void setDesc(const TEXTURE_STREAMING_DESC& desc) { mDesc = desc; }
+
+		/**
+		 * Returns the most detailed mip level required to render a texture without minification artifacts, when the
+		 * specified number of its top mip level texels map to a single pixel.
+		 */
+		static UINT32 calculateRequiredMip(float texelsPerPixel, UINT32 numMips);
+
+		/**
+		 * Returns the most detailed mip level whose width and height are both equal or smaller than the provided size.
+		 * Mip levels at and below this level are always kept resident.
+		 */
+		static UINT32 calculateMinResidentMip(const TextureProperties& props, UINT32 minResidentSize);
+
+		/** Returns the number of bytes required to store all faces of the mip chain starting at the specified mip level. */
+		static UINT64 calculateMipChainSize(const TextureProperties& props, UINT32 mostDetailedMip);
+
+	private:
+		/** Returns the number of bytes required by the entry if the specified mip level is its most detailed mip level. */
+		static UINT64 getSize(const Entry& entry, UINT32 mip) { return entry.mipChainSizes[mip]; }
+
+		TEXTURE_STREAMING_DESC mDesc;
+		Vector<Entry> mEntries;
+		Vector<UINT32> mFreeEntries;
+		UINT32 mNumActiveEntries = 0;
+		UINT64 mResidentBytes = 0;
+		UINT64 mFrameIdx = 0;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,127 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsModule.h"
+#include "BsTextureStreaming.h"
+
+namespace bs
+{
+	/** @addtogroup Resources
+	 *  @{
+	 */
+
+	/**
+	 * Streams in more detailed mip levels of large textures as they are needed, based on their texel density on the
+	 * screen as reported by the renderer. Mip levels are read on worker threads, and made available for sampling once
+	 * read. Mip levels that haven't been needed for a while, or that don't fit within the memory budget, are released
+	 * from GPU memory. Only applies to textures loaded from disk (or from uncompressed pack file entries) after the module
+	 * was started.
+	 *
+	 * @note	Sim thread unless noted otherwise.
+	 */
+	class BS_CORE_EXPORT TextureStreamingManager : public Module<TextureStreamingManager>
+	{
+	public:
+		TextureStreamingManager(const TEXTURE_STREAMING_DESC& desc = TEXTURE_STREAMING_DESC());
+
+		/** Returns residency information about the provided texture. Returns default values if texture isn't streamed. */
+		TextureResidencyStats getStats(const HTexture& texture) const;
+
+		/** Returns the number of bytes used by all the resident mip levels of all streamed textures. */
+		UINT64 getResidentBytes() const;
+
+		/** Returns the number of textures being streamed. */
+		UINT32 getNumTextures() const;
+
+		/** Returns the settings that control streaming. */
+		TEXTURE_STREAMING_DESC getDesc() const;
+
+		/** Changes the settings that control streaming. */
+		void setDesc(const TEXTURE_STREAMING_DESC& desc);
+
+		/**
+		 * Returns the most detailed mip level that is always kept resident for a streamed texture with the provided
+		 * properties.
+		 */
+		UINT32 getMinResidentMip(const TextureProperties& props) const;
+
+		/**
+		 * Checks if a texture with the provided properties can be streamed. Only static 2D textures with mip levels can be
+		 * streamed.
+		 */
+		static bool isStreamable(const TextureProperties& props);
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/**
+		 * Registers a texture whose mip levels should be streamed in from its serialized data. The texture's current
+		 * resident mip level is used as the starting point.
+		 *
+		 * @return	Identifier of the texture in the streaming system.
+		 *
+		 * @note	Thread safe.
+		 */
+		UINT32 _registerTexture(const SPtr<Texture>& texture);
+
+		/**
+		 * Notifies the manager how many texels of the top mip level of the texture map to a single pixel on the screen.
+		 * If notified multiple times during a single frame the lowest density (most detailed request) is used.
+		 *
+		 * @note	Thread safe.
+		 */
+		void _notifyTexelDensity(UINT32 streamingId, float texelsPerPixel);
+
+		/**
+		 * Same as _notifyTexelDensity(), but for multiple textures at once. Each entry contains the texture's streaming
+		 * identifier, followed by its texel density.
+		 *
+		 * @note	Thread safe.
+		 */
+		void _notifyTexelDensities(const Vector<std::pair<UINT32, float>>& densities);
+
+		/**
+		 * Processes density notifications received since the last call, applies mip levels whose reads have finished,
+		 * starts reading newly required mip levels and evicts mip levels that are no longer needed.
+		 */
+		void _update();
+
+		/** @} */
+	private:
+		/** Mip levels of a texture being read on a worker thread. */
+		struct PendingLoad
+		{
+			SPtr<Texture> texture;
+			SPtr<Task> task;
+			SPtr<Vector<SPtr<PixelData>>> mipData;
+			UINT32 mostDetailedMip;
+
+			/** Most detailed mip level requested while the read was in progress, applied once the read finishes. */
+			UINT32 nextMip;
+		};
+
+		/** @copydoc Module::onShutDown */
+		void onShutDown() override;
+
+		/**
+		 * Makes the mip levels starting with the provided level available for sampling. If more detailed levels are
+		 * needed a read is started on a worker thread, and the levels are applied by a later call to _update() once it
+		 * finishes.
+		 */
+		void setResidentMip(UINT32 streamingId, const SPtr<Texture>& texture, UINT32 mip);
+
+		TextureStreaming mStreaming;
+		UnorderedMap<UINT32, std::weak_ptr<Texture>> mTextures;
+		UnorderedMap<UINT32, float> mDensityRequests;
+		UnorderedMap<UINT32, PendingLoad> mPendingLoads;
+		Vector<TextureResidencyChange> mChanges;
+
+		mutable Mutex mMutex;
+		Mutex mRequestMutex;
+	};
+
+	/** @} */
+}
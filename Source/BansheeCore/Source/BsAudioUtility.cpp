@@ -2,6 +2,13 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsAudioUtility.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define BS_AUDIO_SSE2 1
+	#include <emmintrin.h>
+#else
+	#define BS_AUDIO_SSE2 0
+#endif
+
 namespace bs
 {
 	void convertToMono8(const INT8* input, UINT8* output, UINT32 numSamples, UINT32 numChannels)
@@ -15,7 +22,7 @@ namespace bs
 				++input;
 			}
 
-			*output = sum / numChannels;
+			*output = sum / (INT32)numChannels;
 			++output;
 		}
 	}
@@ -31,11 +38,41 @@ namespace bs
 				++input;
 			}
 
-			*output = sum / numChannels;
+			*output = sum / (INT32)numChannels;
 			++output;
 		}
 	}
 
+#if BS_AUDIO_SSE2
+	/** 
+	 * Downmixes 16-bit stereo samples into mono. Returns the number of processed samples, the rest need to be handled by
+	 * the generic path. 
+	 */
+	UINT32 convertStereoToMono16SSE2(const INT16* input, INT16* output, UINT32 numSamples)
+	{
+		const __m128i ones = _mm_set1_epi16(1);
+
+		UINT32 numBatchSamples = numSamples & ~7U;
+		for (UINT32 i = 0; i < numBatchSamples; i += 8)
+		{
+			__m128i a = _mm_loadu_si128((const __m128i*)(input + i * 2));
+			__m128i b = _mm_loadu_si128((const __m128i*)(input + i * 2 + 8));
+
+			// Adds left and right channels of each sample, as 32-bit integers
+			__m128i sumA = _mm_madd_epi16(a, ones);
+			__m128i sumB = _mm_madd_epi16(b, ones);
+
+			// Divide by two, rounding towards zero in order to match integer division
+			sumA = _mm_srai_epi32(_mm_add_epi32(sumA, _mm_srli_epi32(sumA, 31)), 1);
+			sumB = _mm_srai_epi32(_mm_add_epi32(sumB, _mm_srli_epi32(sumB, 31)), 1);
+
+			_mm_storeu_si128((__m128i*)(output + i), _mm_packs_epi32(sumA, sumB));
+		}
+
+		return numBatchSamples;
+	}
+#endif
+
 	void convert32To24Bits(const INT32 input, UINT8* output)
 	{
 		UINT32 valToEncode = *(UINT32*)&input;
@@ -79,7 +116,26 @@ namespace bs
 
 	void convert8To32Bits(const INT8* input, INT32* output, UINT32 numSamples)
 	{
-		for (UINT32 i = 0; i < numSamples; i++)
+		UINT32 i = 0;
+
+#if BS_AUDIO_SSE2
+		const __m128i zero = _mm_setzero_si128();
+		for (; i + 16 <= numSamples; i += 16)
+		{
+			__m128i val = _mm_loadu_si128((const __m128i*)(input + i));
+
+			// Interleaving with zeroes places each sample in the top byte of its 32-bit lane
+			__m128i lo = _mm_unpacklo_epi8(zero, val);
+			__m128i hi = _mm_unpackhi_epi8(zero, val);
+
+			_mm_storeu_si128((__m128i*)(output + i + 0), _mm_unpacklo_epi16(zero, lo));
+			_mm_storeu_si128((__m128i*)(output + i + 4), _mm_unpackhi_epi16(zero, lo));
+			_mm_storeu_si128((__m128i*)(output + i + 8), _mm_unpacklo_epi16(zero, hi));
+			_mm_storeu_si128((__m128i*)(output + i + 12), _mm_unpackhi_epi16(zero, hi));
+		}
+#endif
+
+		for (; i < numSamples; i++)
 		{
 			INT8 val = input[i];
 			output[i] = val << 24;
@@ -88,17 +144,53 @@ namespace bs
 
 	void convert16To32Bits(const INT16* input, INT32* output, UINT32 numSamples)
 	{
-		for (UINT32 i = 0; i < numSamples; i++)
+		UINT32 i = 0;
+
+#if BS_AUDIO_SSE2
+		const __m128i zero = _mm_setzero_si128();
+		for (; i + 8 <= numSamples; i += 8)
+		{
+			__m128i val = _mm_loadu_si128((const __m128i*)(input + i));
+
+			_mm_storeu_si128((__m128i*)(output + i + 0), _mm_unpacklo_epi16(zero, val));
+			_mm_storeu_si128((__m128i*)(output + i + 4), _mm_unpackhi_epi16(zero, val));
+		}
+#endif
+
+		for (; i < numSamples; i++)
 			output[i] = input[i] << 16;
 	}
 
+#if BS_AUDIO_SSE2
+	/** 
+	 * Expands four packed 24-bit samples into four 32-bit samples (with the 24-bit value in the upper bits). Reads 16 
+	 * bytes starting at @p input, so the caller must ensure at least 4 bytes past the last sample are readable.
+	 */
+	__m128i load24BitSamplesSSE2(const UINT8* input)
+	{
+		__m128i val = _mm_loadu_si128((const __m128i*)input);
+
+		// Move each sample into the lowest 32-bit lane of its own register, then gather the lowest lanes together
+		__m128i s01 = _mm_unpacklo_epi32(val, _mm_srli_si128(val, 3));
+		__m128i s23 = _mm_unpacklo_epi32(_mm_srli_si128(val, 6), _mm_srli_si128(val, 9));
+
+		// Shifting left drops the extra byte picked up from the next sample
+		return _mm_slli_epi32(_mm_unpacklo_epi64(s01, s23), 8);
+	}
+#endif
+
 	void convert24To32Bits(const UINT8* input, INT32* output, UINT32 numSamples)
 	{
-		for (UINT32 i = 0; i < numSamples; i++)
-		{
-			output[i] = AudioUtility::convert24To32Bits(input);
-			input += 3;
-		}
+		UINT32 i = 0;
+
+#if BS_AUDIO_SSE2
+		// Each load reads 4 bytes past the four samples it converts, so stop while 2 more samples remain
+		for (; i + 6 <= numSamples; i += 4)
+			_mm_storeu_si128((__m128i*)(output + i), load24BitSamplesSSE2(input + i * 3));
+#endif
+
+		for (; i < numSamples; i++)
+			output[i] = AudioUtility::convert24To32Bits(input + i * 3);
 	}
 
 	void convert32To8Bits(const INT32* input, UINT8* output, UINT32 numSamples)
@@ -109,7 +201,20 @@ namespace bs
 
 	void convert32To16Bits(const INT32* input, INT16* output, UINT32 numSamples)
 	{
-		for (UINT32 i = 0; i < numSamples; i++)
+		UINT32 i = 0;
+
+#if BS_AUDIO_SSE2
+		for (; i + 8 <= numSamples; i += 8)
+		{
+			__m128i a = _mm_srai_epi32(_mm_loadu_si128((const __m128i*)(input + i + 0)), 16);
+			__m128i b = _mm_srai_epi32(_mm_loadu_si128((const __m128i*)(input + i + 4)), 16);
+
+			// Values are guaranteed to be in 16-bit range after the shift, so saturation never triggers
+			_mm_storeu_si128((__m128i*)(output + i), _mm_packs_epi32(a, b));
+		}
+#endif
+
+		for (; i < numSamples; i++)
 			output[i] = (INT16)(input[i] >> 16);
 	}
 
@@ -122,6 +227,58 @@ namespace bs
 		}
 	}
 
+#if BS_AUDIO_SSE2
+	/** 
+	 * Converts integer samples to floating point samples in [-1, 1] range. Returns the number of processed samples, the
+	 * rest need to be handled by the scalar path.
+	 */
+	UINT32 convertToFloatSSE2(const UINT8* input, UINT32 inBitDepth, float* output, UINT32 numSamples)
+	{
+		UINT32 i = 0;
+		if (inBitDepth == 16)
+		{
+			const __m128 scale = _mm_set1_ps(1.0f / 32767.0f);
+			const INT16* input16 = (const INT16*)input;
+
+			for (; i + 8 <= numSamples; i += 8)
+			{
+				__m128i val = _mm_loadu_si128((const __m128i*)(input16 + i));
+
+				// Sign extend to 32-bit by moving each sample to the top half and shifting back
+				__m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(val, val), 16);
+				__m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(val, val), 16);
+
+				_mm_storeu_ps(output + i + 0, _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+				_mm_storeu_ps(output + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+			}
+		}
+		else if (inBitDepth == 24)
+		{
+			const __m128 scale = _mm_set1_ps(1.0f / 2147483647.0f);
+
+			// Each load reads 4 bytes past the four samples it converts, so stop while 2 more samples remain
+			for (; i + 6 <= numSamples; i += 4)
+			{
+				__m128i val = load24BitSamplesSSE2(input + i * 3);
+				_mm_storeu_ps(output + i, _mm_mul_ps(_mm_cvtepi32_ps(val), scale));
+			}
+		}
+		else if (inBitDepth == 32)
+		{
+			const __m128 scale = _mm_set1_ps(1.0f / 2147483647.0f);
+			const INT32* input32 = (const INT32*)input;
+
+			for (; i + 4 <= numSamples; i += 4)
+			{
+				__m128i val = _mm_loadu_si128((const __m128i*)(input32 + i));
+				_mm_storeu_ps(output + i, _mm_mul_ps(_mm_cvtepi32_ps(val), scale));
+			}
+		}
+
+		return i;
+	}
+#endif
+
 	void AudioUtility::convertToMono(const UINT8* input, UINT8* output, UINT32 bitDepth, UINT32 numSamples, UINT32 numChannels)
 	{
 		switch (bitDepth)
@@ -130,8 +287,18 @@ namespace bs
 			convertToMono8((INT8*)input, output, numSamples, numChannels);
 			break;
 		case 16:
-			convertToMono16((INT16*)input, (INT16*)output, numSamples, numChannels);
+		{
+			UINT32 numProcessed = 0;
+
+#if BS_AUDIO_SSE2
+			if (numChannels == 2)
+				numProcessed = convertStereoToMono16SSE2((INT16*)input, (INT16*)output, numSamples);
+#endif
+
+			convertToMono16((INT16*)input + numProcessed * numChannels, (INT16*)output + numProcessed, 
+				numSamples - numProcessed, numChannels);
 			break;
+		}
 		case 24:
 			convertToMono24(input, output, numSamples, numChannels);
 			break;
@@ -204,6 +371,15 @@ namespace bs
 
 	void AudioUtility::convertToFloat(const UINT8* input, UINT32 inBitDepth, float* output, UINT32 numSamples)
 	{
+		UINT32 numProcessed = 0;
+
+#if BS_AUDIO_SSE2
+		numProcessed = convertToFloatSSE2(input, inBitDepth, output, numSamples);
+		input += numProcessed * (inBitDepth / 8);
+		output += numProcessed;
+		numSamples -= numProcessed;
+#endif
+
 		if (inBitDepth == 8)
 		{
 			for (UINT32 i = 0; i < numSamples; i++)
@@ -15,6 +15,7 @@ namespace bs
 		setName("CharacterController");
 
 		mNotifyFlags = TCF_Transform;
+		mUpdateFlags = CUF_NoUpdate;
 	}
 
 	CharacterCollisionFlags CCharacterController::move(const Vector3& displacement)
@@ -16,6 +16,7 @@ namespace bs
 		setName("Collider");
 
 		mNotifyFlags = (TransformChangedFlags)(TCF_Parent | TCF_Transform);
+		mUpdateFlags = CUF_NoUpdate;
 	}
 
 	void CCollider::setIsTrigger(bool value)
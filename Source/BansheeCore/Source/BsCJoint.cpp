@@ -18,6 +18,8 @@ namespace bs
 
 		mRotations[0] = Quaternion::IDENTITY;
 		mRotations[1] = Quaternion::IDENTITY;
+
+		mUpdateFlags = CUF_NoUpdate;
 	}
 
 	CJoint::CJoint(const HSceneObject& parent, JOINT_DESC& desc)
@@ -32,6 +34,7 @@ namespace bs
 		mRotations[1] = Quaternion::IDENTITY;
 
 		mNotifyFlags = (TransformChangedFlags)(TCF_Parent | TCF_Transform);
+		mUpdateFlags = CUF_NoUpdate;
 	}
 
 	HRigidbody CJoint::getBody(JointBody body) const
@@ -16,6 +16,7 @@ namespace bs
 		setName("Rigidbody");
 
 		mNotifyFlags = (TransformChangedFlags)(TCF_Parent | TCF_Transform);
+		mUpdateFlags = CUF_NoUpdate;
 	}
 
 	void CRigidbody::move(const Vector3& position)
@@ -7,11 +7,12 @@
 namespace bs
 {
 	Component::Component()
-		:mNotifyFlags(TCF_None)
+		:mNotifyFlags(TCF_None), mUpdateFlags(CUF_None), mUpdateListIdx((UINT32)-1), mUpdateIdx((UINT32)-1)
 	{ }
 
 	Component::Component(const HSceneObject& parent)
-		:mNotifyFlags(TCF_None), mParent(parent)
+		:mNotifyFlags(TCF_None), mUpdateFlags(CUF_None), mParent(parent), mUpdateListIdx((UINT32)-1)
+		, mUpdateIdx((UINT32)-1)
 	{
 		setName("Component");
 	}
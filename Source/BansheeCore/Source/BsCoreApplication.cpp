@@ -35,6 +35,7 @@
 #include "BsProfilingManager.h"
 #include "BsProfilerCPU.h"
 #include "BsProfilerGPU.h"
+#include "BsGpuReadback.h"
 #include "BsQueryManager.h"
 #include "BsThreadPool.h"
 #include "BsTaskScheduler.h"
@@ -48,6 +49,7 @@
 #include "BsAudioManager.h"
 #include "BsAudio.h"
 #include "BsAnimationManager.h"
+#include "BsTextureStreamingManager.h"
 #include "BsParamBlocks.h"
 
 namespace bs
@@ -66,6 +68,7 @@ namespace bs
 		FontManager::shutDown();
 		MaterialManager::shutDown();
 		MeshManager::shutDown();
+		GpuReadbackManager::shutDown();
 		ProfilerGPU::shutDown();
 
 		CoreSceneManager::shutDown();
@@ -74,6 +77,10 @@ namespace bs
 
 		ParamBlockManager::shutDown();
 		StringTableManager::shutDown();
+
+		if (TextureStreamingManager::isStarted())
+			TextureStreamingManager::shutDown();
+
 		Resources::shutDown();
 		ResourceListenerManager::shutDown();
 		GameObjectManager::shutDown();
@@ -115,6 +122,8 @@ namespace bs
 
 		MemStack::endThread();
 		Platform::_shutDown();
+
+		gDebug().stopAsyncLogging();
 	}
 
 	void CoreApplication::onStartUp()
@@ -124,6 +133,9 @@ namespace bs
 		Platform::_startUp();
 		MemStack::beginThread();
 
+		if (mStartUpDesc.asyncLogging)
+			gDebug().startAsyncLogging();
+
 		ShaderManager::startUp(getShaderIncludeHandler());
 		MessageHandler::startUp();
 		ProfilerCPU::startUp();
@@ -159,6 +171,7 @@ namespace bs
 		startUpRenderer();
 
 		ProfilerGPU::startUp();
+		GpuReadbackManager::startUp();
 		MeshManager::startUp();
 		MaterialManager::startUp();
 		FontManager::startUp();
@@ -167,6 +180,14 @@ namespace bs
 		PhysicsManager::startUp(mStartUpDesc.physics, isEditor());
 		AnimationManager::startUp();
 
+		if (mStartUpDesc.textureStreaming)
+		{
+			if (RenderAPICore::instance().getCapabilities(0).hasCapability(RSC_TEXTURE_STREAMING))
+				TextureStreamingManager::startUp();
+			else
+				LOGWRN("Texture streaming was requested but isn't supported by the active render API. Disabling it.");
+		}
+
 		for (auto& importerName : mStartUpDesc.importers)
 			loadPlugin(importerName);
 
@@ -220,6 +241,7 @@ namespace bs
 			RenderWindowManager::instance()._update(); 
 			gInput()._triggerCallbacks();
 			gDebug()._triggerCallbacks();
+			GpuReadbackManager::instance()._update();
 			AnimationManager::instance().preUpdate();
 
 			preUpdate();
@@ -241,6 +263,11 @@ namespace bs
 			// Send out resource events in case any were loaded/destroyed/modified
 			ResourceListenerManager::instance().update();
 
+			if (TextureStreamingManager::isStarted())
+			{
+				PROFILE_CALL(TextureStreamingManager::instance()._update(), "TextureStreaming");
+			}
+
 			gCoreSceneManager()._updateCoreObjectTransforms();
 			PROFILE_CALL(RendererManager::instance().getActive()->renderAll(), "Render");
 
@@ -7,11 +7,12 @@
 #include "BsMath.h"
 #include "BsFrameAlloc.h"
 #include "BsCoreThread.h"
+#include "BsTaskScheduler.h"
 
 namespace bs
 {
 	CoreObjectManager::CoreObjectManager()
-		:mNextAvailableID(1)
+		:mNextAvailableID(1), mDirtyListHead(nullptr)
 	{
 
 	} 
@@ -31,6 +32,18 @@ namespace bs
 				"engine objects before shutdown.");
 		}
 #endif
+
+		for (auto& syncData : mCoreSyncData)
+		{
+			for (auto& workerAlloc : syncData.workerAllocs)
+				mFreeWorkerAllocs.push_back(workerAlloc);
+		}
+
+		for (auto& workerAlloc : mFreeWorkerAllocs)
+		{
+			workerAlloc->setOwnerThread(BS_THREAD_CURRENT_ID);
+			bs_delete(workerAlloc);
+		}
 	}
 
 	UINT64 CoreObjectManager::registerObject(CoreObject* object)
@@ -54,6 +67,10 @@ namespace bs
 		// If dirty, we generate sync data before it is destroyed
 		{
 			Lock lock(mObjectsMutex);
+
+			// Make sure the object isn't referenced by the dirty list after it's destroyed
+			drainDirtyList();
+
 			bool isDirty = object->isCoreDirty() || (mDirtyObjects.find(internalId) != mDirtyObjects.end());
 
 			if (isDirty)
@@ -61,9 +78,10 @@ namespace bs
 				SPtr<CoreObjectCore> coreObject = object->getCore();
 				if (coreObject != nullptr)
 				{
-					CoreSyncData objSyncData = object->syncToCore(gCoreThread().getFrameAlloc());
+					FrameAlloc* allocator = gCoreThread().getFrameAlloc();
+					CoreSyncData objSyncData = object->syncToCore(allocator);
 				
-					mDestroyedSyncData.push_back(CoreStoredSyncObjData(coreObject, internalId, objSyncData));
+					mDestroyedSyncData.push_back(CoreStoredSyncObjData(coreObject, internalId, objSyncData, allocator));
 
 					DirtyObjectData& dirtyObjData = mDirtyObjects[internalId];
 					dirtyObjData.syncDataId = (INT32)mDestroyedSyncData.size() - 1;
@@ -113,11 +131,18 @@ namespace bs
 
 	void CoreObjectManager::notifyCoreDirty(CoreObject* object)
 	{
-		UINT64 id = object->getInternalID();
-
-		Lock lock(mObjectsMutex);
+		// Objects can be marked clean and dirty again before the list is drained, or marked dirty from multiple threads
+		// at once, so make sure the object is only pushed once. Pushing it twice would create a cycle in the list.
+		if (object->mInDirtyList.exchange(true, std::memory_order_acquire))
+			return;
 
-		mDirtyObjects[id] = { object, -1 };
+		// Push the object to the front of the dirty list
+		CoreObject* head = mDirtyListHead.load(std::memory_order_relaxed);
+		do
+		{
+			object->mNextDirty = head;
+		} while (!mDirtyListHead.compare_exchange_weak(head, object, std::memory_order_release,
+			std::memory_order_relaxed));
 	}
 
 	void CoreObjectManager::notifyDependenciesDirty(CoreObject* object)
@@ -222,6 +247,9 @@ namespace bs
 
 		Lock lock(mObjectsMutex);
 
+		// Objects synced below are marked clean, so they must not remain in the dirty list
+		drainDirtyList();
+
 		FrameAlloc* allocator = gCoreThread().getFrameAlloc();
 		Vector<IndividualCoreSyncData> syncData;
 
@@ -288,10 +316,10 @@ namespace bs
 	{
 		Lock lock(mObjectsMutex);
 
+		drainDirtyList();
+
 		mCoreSyncData.push_back(CoreStoredSyncData());
 		CoreStoredSyncData& syncData = mCoreSyncData.back();
-
-		syncData.alloc = allocator;
 		
 		// Add all objects dependant on the dirty objects
 		bs_frame_mark();
@@ -324,18 +352,35 @@ namespace bs
 
 		bs_frame_clear();
 		
-		// Order in which objects are recursed in matters, ones with lower ID will have been created before
-		// ones with higher ones and should be updated first.
-		for (auto& objectData : mDirtyObjects)
+		mSyncStats = CoreObjectSyncStats();
+		mSyncStats.numDirtyObjects = (UINT32)mDirtyObjects.size();
+
+		mSyncObjects.clear();
+		mSyncLevels.clear();
+
+		// Collect objects to sync and determine their dependency level, their data is serialized afterwards. Order in
+		// which objects are recursed in matters, ones with lower ID will have been created before ones with higher ones
+		// and should be updated first.
+		bs_frame_mark();
 		{
-			std::function<void(CoreObject*)> syncObject = [&](CoreObject* curObj)
+			// Maps a visited object to its dependency level plus one, or to zero if it has no data to sync
+			FrameUnorderedMap<CoreObject*, UINT32> visited;
+
+			std::function<UINT32(CoreObject*)> collectObject = [&](CoreObject* curObj) -> UINT32
 			{
 				if (!curObj->isCoreDirty())
-					return; // We already processed it as some other object's dependency
+					return 0; // Clean objects don't need to be synced
 
-				// Sync dependencies before dependants
-				// Note: I don't check for recursion. Possible infinite loop if two objects
-				// are dependent on one another.
+				auto iterFindVisited = visited.find(curObj);
+				if (iterFindVisited != visited.end())
+					return iterFindVisited->second; // We already processed it as some other object's dependency
+
+				// Registered before recursing, so circular dependencies don't recurse infinitely
+				visited[curObj] = 0;
+
+				// Dependencies must be synced before dependants, so the object's level is one higher than the highest
+				// level of its dependencies
+				UINT32 level = 0;
 				
 				UINT64 id = curObj->getInternalID();
 				auto iterFind = mDependencies.find(id);
@@ -344,38 +389,160 @@ namespace bs
 				{
 					const Vector<CoreObject*>& dependencies = iterFind->second;
 					for (auto& dependency : dependencies)
-						syncObject(dependency);
+						level = std::max(level, collectObject(dependency));
 				}
 
 				SPtr<CoreObjectCore> objectCore = curObj->getCore();
 				if (objectCore == nullptr)
 				{
 					curObj->markCoreClean();
-					return;
+					return 0;
 				}
 
-				CoreSyncData objSyncData = curObj->syncToCore(allocator);
-				curObj->markCoreClean();
+				syncData.entries.push_back(CoreStoredSyncObjData(objectCore, id, CoreSyncData(), nullptr));
+				mSyncObjects.push_back(curObj);
+				mSyncLevels.push_back(level);
 
-				syncData.entries.push_back(CoreStoredSyncObjData(objectCore,
-					curObj->getInternalID(), objSyncData));
+				visited[curObj] = level + 1;
+				return level + 1;
 			};
 
-			CoreObject* object = objectData.second.object;
-			if (object != nullptr)
-				syncObject(object);
-			else
+			for (auto& objectData : mDirtyObjects)
 			{
-				// Object was destroyed but we still need to sync its modifications before it was destroyed
-				if (objectData.second.syncDataId != -1)
-					syncData.entries.push_back(mDestroyedSyncData[objectData.second.syncDataId]);
+				CoreObject* object = objectData.second.object;
+				if (object != nullptr)
+					collectObject(object);
+				else
+				{
+					// Object was destroyed but we still need to sync its modifications before it was destroyed
+					if (objectData.second.syncDataId != -1)
+					{
+						syncData.entries.push_back(mDestroyedSyncData[objectData.second.syncDataId]);
+						mSyncObjects.push_back(nullptr);
+						mSyncLevels.push_back(0);
+					}
+				}
 			}
 		}
+		bs_frame_clear();
+
+		serializeSyncData(syncData, allocator);
 
 		mDirtyObjects.clear();
 		mDestroyedSyncData.clear();
 	}
 
+	void CoreObjectManager::serializeSyncData(CoreStoredSyncData& syncData, FrameAlloc* allocator)
+	{
+		UINT32 numEntries = (UINT32)mSyncObjects.size();
+
+		// Sort the entries by level, while keeping their relative order within a level
+		UINT32 numLevels = 0;
+		for (auto& level : mSyncLevels)
+			numLevels = std::max(numLevels, level + 1);
+
+		Vector<UINT32> levelOffsets(numLevels + 1, 0);
+		for (auto& level : mSyncLevels)
+			levelOffsets[level + 1]++;
+
+		for (UINT32 i = 0; i < numLevels; i++)
+			levelOffsets[i + 1] += levelOffsets[i];
+
+		mSyncOrder.resize(numEntries);
+		{
+			Vector<UINT32> writeOffsets = levelOffsets;
+			for (UINT32 i = 0; i < numEntries; i++)
+				mSyncOrder[writeOffsets[mSyncLevels[i]]++] = i;
+		}
+
+		auto serializeRange = [&](UINT32 start, UINT32 end, FrameAlloc* alloc)
+		{
+			for (UINT32 i = start; i < end; i++)
+			{
+				UINT32 entryIdx = mSyncOrder[i];
+
+				// Destroyed objects have their data serialized when they're destroyed
+				CoreObject* object = mSyncObjects[entryIdx];
+				if (object == nullptr)
+					continue;
+
+				CoreStoredSyncObjData& entry = syncData.entries[entryIdx];
+				entry.syncData = object->syncToCore(alloc);
+				entry.allocator = alloc;
+
+				object->markCoreClean();
+			}
+		};
+
+		for (UINT32 level = 0; level < numLevels; level++)
+		{
+			UINT32 levelStart = levelOffsets[level];
+			UINT32 count = levelOffsets[level + 1] - levelStart;
+			if (count == 0)
+				continue;
+
+			// Frame allocators are single-threaded, so every chunk other than the one processed on this thread gets its 
+			// own allocator. Allocators must be retrieved here, as this thread holds the objects mutex.
+			UINT32 numChunks = TaskScheduler::getNumParallelChunks(count, MIN_OBJECTS_PER_SYNC_TASK);
+
+			Vector<FrameAlloc*> chunkAllocs(numChunks);
+			chunkAllocs[0] = allocator;
+			for (UINT32 i = 1; i < numChunks; i++)
+			{
+				chunkAllocs[i] = getWorkerAlloc();
+				syncData.workerAllocs.push_back(chunkAllocs[i]);
+			}
+
+			TaskScheduler::parallelFor("CoreObjectSync", count, MIN_OBJECTS_PER_SYNC_TASK, 
+				[&](UINT32 chunkIdx, UINT32 start, UINT32 end)
+			{
+				FrameAlloc* alloc = chunkAllocs[chunkIdx];
+				if (chunkIdx > 0)
+				{
+					// All data previously allocated with the allocator has been released by the core thread
+					alloc->setOwnerThread(BS_THREAD_CURRENT_ID);
+					alloc->clear();
+				}
+
+				serializeRange(levelStart + start, levelStart + end, alloc);
+			});
+
+			mSyncStats.numSyncTasks += numChunks - 1;
+		}
+
+		for (auto& object : mSyncObjects)
+		{
+			if (object != nullptr)
+				mSyncStats.numSyncedObjects++;
+		}
+	}
+
+	void CoreObjectManager::drainDirtyList()
+	{
+		CoreObject* object = mDirtyListHead.exchange(nullptr, std::memory_order_acquire);
+		while (object != nullptr)
+		{
+			mDirtyObjects[object->getInternalID()] = { object, -1 };
+
+			// Read the next object before releasing this one, as it may be pushed to the list again right away
+			CoreObject* next = object->mNextDirty;
+			object->mInDirtyList.store(false, std::memory_order_release);
+
+			object = next;
+		}
+	}
+
+	FrameAlloc* CoreObjectManager::getWorkerAlloc()
+	{
+		if (mFreeWorkerAllocs.empty())
+			return bs_new<FrameAlloc>();
+
+		FrameAlloc* alloc = mFreeWorkerAllocs.back();
+		mFreeWorkerAllocs.pop_back();
+
+		return alloc;
+	}
+
 	void CoreObjectManager::syncUpload()
 	{
 		Lock lock(mObjectsMutex);
@@ -394,9 +561,13 @@ namespace bs
 			UINT8* data = objSyncData.syncData.getBuffer();
 
 			if (data != nullptr)
-				syncData.alloc->dealloc(data);
+				objSyncData.allocator->dealloc(data);
 		}
 
+		// All data allocated by the worker allocators is released, so they can be reused
+		for (auto& workerAlloc : syncData.workerAllocs)
+			mFreeWorkerAllocs.push_back(workerAlloc);
+
 		syncData.entries.clear();
 		mCoreSyncData.pop_front();
 	}
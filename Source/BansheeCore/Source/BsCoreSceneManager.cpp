@@ -7,12 +7,23 @@
 #include "BsViewport.h"
 #include "BsGameObjectManager.h"
 #include "BsRenderTarget.h"
+#include "BsTaskScheduler.h"
 
 namespace bs
 {
+	/** Minimum number of components of a thread safe type that will be updated by a single worker task. */
+	static const UINT32 MIN_COMPONENTS_PER_TASK = 256;
+
+	/** Maximum number of worker tasks a single thread safe update list will be split into. */
+	static const UINT32 MAX_UPDATE_TASKS = 16;
+
+	/** Update list index assigned to components whose registration is delayed until the end of the current update. */
+	static const UINT32 PENDING_LIST_IDX = (UINT32)-2;
+
 	std::function<void()> SceneManagerFactory::mFactoryMethod;
 
 	CoreSceneManager::CoreSceneManager()
+		:mNumUpdatingComponents(0), mIsUpdatingComponents(false)
 	{
 		mRootNode = SceneObject::createInternal("SceneRoot");
 	}
@@ -157,29 +168,181 @@ namespace bs
 
 	void CoreSceneManager::_update()
 	{
-		Stack<HSceneObject> todo;
-		todo.push(mRootNode);
+		mIsUpdatingComponents = true;
+
+		for (UINT32 i = 0; i < (UINT32)mUpdateLists.size(); i++)
+			updateComponents(i);
+
+		mIsUpdatingComponents = false;
 
-		while(!todo.empty())
+		for (UINT32 i = 0; i < (UINT32)mUpdateLists.size(); i++)
 		{
-			HSceneObject currentGO = todo.top();
-			todo.pop();
+			if (mUpdateLists[i].needsCompaction)
+				compactUpdateList(i);
+		}
 
-			if (!currentGO->getActive(true))
-				continue;
-			                  
-			const Vector<HComponent>& components = currentGO->getComponents();
+		// Components enabled during the update start receiving updates next frame
+		for (auto& component : mPendingActivations)
+		{
+			if (component != nullptr)
+				addToUpdateList(component);
+		}
+
+		mPendingActivations.clear();
 
-			for(auto iter = components.begin(); iter != components.end(); ++iter)
+		GameObjectManager::instance().destroyQueuedObjects();
+	}
+
+	void CoreSceneManager::_notifyComponentActivated(Component* component)
+	{
+		if ((component->_getUpdateFlags() & CUF_NoUpdate) != 0 || component->mUpdateIdx != (UINT32)-1)
+			return;
+
+		mNumUpdatingComponents++;
+
+		// Update lists must not be modified while they are being iterated over, so delay the addition until the update
+		// is done
+		if (mIsUpdatingComponents)
+		{
+			component->mUpdateListIdx = PENDING_LIST_IDX;
+			component->mUpdateIdx = (UINT32)mPendingActivations.size();
+
+			mPendingActivations.push_back(component);
+			return;
+		}
+
+		addToUpdateList(component);
+	}
+
+	void CoreSceneManager::_notifyComponentDeactivated(Component* component)
+	{
+		if (component->mUpdateIdx == (UINT32)-1)
+			return;
+
+		UINT32 idx = component->mUpdateIdx;
+		if (component->mUpdateListIdx == PENDING_LIST_IDX)
+			mPendingActivations[idx] = nullptr;
+		else
+		{
+			ComponentUpdateList& list = mUpdateLists[component->mUpdateListIdx];
+
+			if (mIsUpdatingComponents)
 			{
-				(*iter)->update();
+				// Entries might be in the middle of being iterated over, so leave a hole and compact after the update
+				list.components[idx] = nullptr;
+				list.needsCompaction = true;
 			}
+			else
+			{
+				Component* last = list.components.back();
+				list.components[idx] = last;
+				last->mUpdateIdx = idx;
 
-			for(UINT32 i = 0; i < currentGO->getNumChildren(); i++)
-				todo.push(currentGO->getChild(i));
+				list.components.pop_back();
+			}
 		}
 
-		GameObjectManager::instance().destroyQueuedObjects();
+		component->mUpdateListIdx = (UINT32)-1;
+		component->mUpdateIdx = (UINT32)-1;
+		mNumUpdatingComponents--;
+	}
+
+	void CoreSceneManager::_setBatchUpdateCallback(UINT32 typeId,
+		const std::function<void(Component**, UINT32)>& callback)
+	{
+		if (callback != nullptr)
+			mBatchUpdateCallbacks[typeId] = callback;
+		else
+			mBatchUpdateCallbacks.erase(typeId);
+	}
+
+	void CoreSceneManager::addToUpdateList(Component* component)
+	{
+		UINT32 typeId = component->getRTTI()->getRTTIId();
+		bool threadSafe = (component->_getUpdateFlags() & CUF_ThreadSafe) != 0;
+
+		UINT64 key = ((UINT64)typeId << 1) | (threadSafe ? 1 : 0);
+
+		UINT32 listIdx;
+		auto iterFind = mUpdateListLookup.find(key);
+		if (iterFind == mUpdateListLookup.end())
+		{
+			listIdx = (UINT32)mUpdateLists.size();
+			mUpdateListLookup[key] = listIdx;
+
+			mUpdateLists.push_back(ComponentUpdateList());
+
+			ComponentUpdateList& newList = mUpdateLists.back();
+			newList.typeId = typeId;
+			newList.threadSafe = threadSafe;
+			newList.needsCompaction = false;
+		}
+		else
+			listIdx = iterFind->second;
+
+		ComponentUpdateList& list = mUpdateLists[listIdx];
+		component->mUpdateListIdx = listIdx;
+		component->mUpdateIdx = (UINT32)list.components.size();
+
+		list.components.push_back(component);
+	}
+
+	void CoreSceneManager::updateComponents(UINT32 listIdx)
+	{
+		// Note: Lists aren't added to or reallocated during the update (see _notifyComponentActivated), so the
+		// component array stays valid even if components enable or disable other components. Disabled entries are
+		// set to null.
+		ComponentUpdateList& list = mUpdateLists[listIdx];
+
+		UINT32 numComponents = (UINT32)list.components.size();
+		if (numComponents == 0)
+			return;
+
+		Component** components = list.components.data();
+
+		auto iterFind = mBatchUpdateCallbacks.find(list.typeId);
+		if (iterFind != mBatchUpdateCallbacks.end())
+		{
+			iterFind->second(components, numComponents);
+			return;
+		}
+
+		auto updateRange = [components](UINT32, UINT32 start, UINT32 end)
+		{
+			for (UINT32 i = start; i < end; i++)
+			{
+				if (components[i] != nullptr)
+					components[i]->update();
+			}
+		};
+
+		if (!list.threadSafe)
+		{
+			updateRange(0, 0, numComponents);
+			return;
+		}
+
+		TaskScheduler::parallelFor("ComponentUpdate", numComponents, MIN_COMPONENTS_PER_TASK, updateRange, 
+			MAX_UPDATE_TASKS);
+	}
+
+	void CoreSceneManager::compactUpdateList(UINT32 listIdx)
+	{
+		ComponentUpdateList& list = mUpdateLists[listIdx];
+
+		UINT32 numValid = 0;
+		for (UINT32 i = 0; i < (UINT32)list.components.size(); i++)
+		{
+			Component* component = list.components[i];
+			if (component == nullptr)
+				continue;
+
+			component->mUpdateIdx = numValid;
+			list.components[numValid++] = component;
+		}
+
+		list.components.resize(numValid);
+		list.needsCompaction = false;
 	}
 
 	void CoreSceneManager::registerNewSO(const HSceneObject& node) 
@@ -6,7 +6,8 @@
 namespace bs
 {
 	GameObjectManager::GameObjectManager()
-		:mNextAvailableID(1), mIsDeserializationActive(false), mGODeserializationMode(GODM_UseNewIds | GODM_BreakExternal)
+		:mFirstFreeSlot(INVALID_SLOT), mNumObjects(0), mActiveDeserializedObject(nullptr), mIsDeserializationActive(false)
+		, mGODeserializationMode(GODM_UseNewIds | GODM_BreakExternal)
 	{
 
 	}
@@ -18,21 +19,19 @@ namespace bs
 
 	GameObjectHandleBase GameObjectManager::getObject(UINT64 id) const
 	{
-		auto iterFind = mObjects.find(id);
-
-		if (iterFind != mObjects.end())
-			return iterFind->second;
+		UINT32 slotIdx = findSlot(id);
+		if (slotIdx != INVALID_SLOT)
+			return GameObjectHandleBase(mSlots[slotIdx].handleData);
 
 		return nullptr;
 	}
 
 	bool GameObjectManager::tryGetObject(UINT64 id, GameObjectHandleBase& object) const
 	{
-		auto iterFind = mObjects.find(id);
-
-		if (iterFind != mObjects.end())
+		UINT32 slotIdx = findSlot(id);
+		if (slotIdx != INVALID_SLOT)
 		{
-			object = iterFind->second;
+			object = GameObjectHandleBase(mSlots[slotIdx].handleData);
 			return true;
 		}
 
@@ -41,7 +40,7 @@ namespace bs
 
 	bool GameObjectManager::objectExists(UINT64 id) const
 	{
-		return mObjects.find(id) != mObjects.end();
+		return findSlot(id) != INVALID_SLOT;
 	}
 
 	void GameObjectManager::remapId(UINT64 oldId, UINT64 newId)
@@ -49,8 +48,20 @@ namespace bs
 		if (oldId == newId)
 			return;
 
-		mObjects[newId] = mObjects[oldId];
-		mObjects.erase(oldId);
+		UINT32 slotIdx = findSlot(oldId);
+		if (slotIdx == INVALID_SLOT)
+			return;
+
+		auto iterFind = mRemappedIds.find(oldId);
+		if (iterFind != mRemappedIds.end() && iterFind->second == slotIdx)
+			mRemappedIds.erase(iterFind);
+
+		mSlots[slotIdx].instanceId = newId;
+
+		if (getSlotIndex(newId) == slotIdx)
+			mRemappedIds.erase(newId);
+		else
+			mRemappedIds[newId] = slotIdx;
 	}
 
 	void GameObjectManager::queueForDestroy(const GameObjectHandleBase& object)
@@ -58,21 +69,45 @@ namespace bs
 		if (object.isDestroyed())
 			return;
 
-		UINT64 instanceId = object->getInstanceId();
-		mQueuedForDestroy[instanceId] = object;
+		UINT32 slotIdx = findSlot(object->getInstanceId());
+		if (slotIdx != INVALID_SLOT)
+		{
+			ObjectSlot& slot = mSlots[slotIdx];
+			if (slot.queuedForDestroy)
+				return;
+
+			slot.queuedForDestroy = true;
+		}
+
+		mQueuedForDestroy.push_back(object);
 	}
 
 	void GameObjectManager::destroyQueuedObjects()
 	{
-		for (auto& objPair : mQueuedForDestroy)
-			objPair.second->destroyInternal(objPair.second, true);
+		// Note: Not using iterators as destruction could queue more objects
+		for (UINT32 i = 0; i < (UINT32)mQueuedForDestroy.size(); i++)
+		{
+			GameObjectHandleBase handle = mQueuedForDestroy[i];
+
+			// Might have been destroyed along with its parent
+			if (!handle.isDestroyed())
+				handle->destroyInternal(handle, true);
+		}
 
 		mQueuedForDestroy.clear();
 	}
 
+	void GameObjectManager::reserve(UINT32 numObjects)
+	{
+		mSlots.reserve(numObjects);
+	}
+
 	GameObjectHandleBase GameObjectManager::registerObject(const SPtr<GameObject>& object, UINT64 originalId)
 	{
-		object->initialize(object, mNextAvailableID);
+		UINT32 slotIdx = allocateSlot();
+		ObjectSlot& slot = mSlots[slotIdx];
+
+		object->initialize(object, slot.instanceId);
 
 		// If deserialization is active we must ensure all handles pointing to the same object share GameObjectHandleData,
 		// so check if any handles referencing this object have been created. See ::registerUnresolvedHandle for
@@ -81,6 +116,8 @@ namespace bs
 		{
 			assert(originalId != 0 && "You must provide an original ID when registering a deserialized game object.");
 
+			mIdMapping[originalId] = slot.instanceId;
+
 			auto iterFind = mUnresolvedHandleData.find(originalId);
 			if (iterFind != mUnresolvedHandleData.end())
 			{
@@ -88,39 +125,100 @@ namespace bs
 				handle.mData = iterFind->second;
 				handle._setHandleData(object);
 
-				mObjects[mNextAvailableID] = handle;
-				mIdMapping[originalId] = mNextAvailableID;
-				mNextAvailableID++;
-
-				return handle;
-			}
-			else
-			{
-				GameObjectHandleBase handle(object);
-
-				mObjects[mNextAvailableID] = handle;
-				mIdMapping[originalId] = mNextAvailableID;
-				mNextAvailableID++;
-
+				slot.handleData = handle.mData;
 				return handle;
 			}
 		}
 
 		GameObjectHandleBase handle(object);
-		mObjects[mNextAvailableID] = handle;
-		mNextAvailableID++;
+		slot.handleData = handle.mData;
 
 		return handle;
 	}
 
 	void GameObjectManager::unregisterObject(GameObjectHandleBase& object)
 	{
-		mObjects.erase(object->getInstanceId());
+		UINT64 instanceId = object->getInstanceId();
+
+		UINT32 slotIdx = findSlot(instanceId);
+		if (slotIdx != INVALID_SLOT && mSlots[slotIdx].handleData->mPtr != object.mData->mPtr)
+		{
+			// Another object was remapped to the same ID, in which case this object can still be found in its original 
+			// slot
+			slotIdx = getSlotIndex(instanceId);
+			if (slotIdx >= (UINT32)mSlots.size() || mSlots[slotIdx].instanceId != instanceId)
+				slotIdx = INVALID_SLOT;
+		}
+
+		if (slotIdx != INVALID_SLOT)
+			freeSlot(slotIdx);
 
 		onDestroyed(object);
 		object.destroy();
 	}
 
+	UINT32 GameObjectManager::allocateSlot()
+	{
+		UINT32 slotIdx;
+		if (mFirstFreeSlot != INVALID_SLOT)
+		{
+			slotIdx = mFirstFreeSlot;
+			mFirstFreeSlot = mSlots[slotIdx].nextFreeSlot;
+		}
+		else
+		{
+			slotIdx = (UINT32)mSlots.size();
+			mSlots.push_back(ObjectSlot());
+		}
+
+		// Lower 32 bits contain the slot index offset by one, so 0 is never a valid ID
+		ObjectSlot& slot = mSlots[slotIdx];
+		slot.instanceId = ((UINT64)slot.generation << 32) | (slotIdx + 1);
+		slot.nextFreeSlot = INVALID_SLOT;
+
+		mNumObjects++;
+		return slotIdx;
+	}
+
+	void GameObjectManager::freeSlot(UINT32 slotIdx)
+	{
+		ObjectSlot& slot = mSlots[slotIdx];
+
+		if (getSlotIndex(slot.instanceId) != slotIdx)
+		{
+			auto iterFind = mRemappedIds.find(slot.instanceId);
+			if (iterFind != mRemappedIds.end() && iterFind->second == slotIdx)
+				mRemappedIds.erase(iterFind);
+		}
+
+		slot.handleData = nullptr;
+		slot.instanceId = 0;
+		slot.generation++;
+		slot.queuedForDestroy = false;
+
+		slot.nextFreeSlot = mFirstFreeSlot;
+		mFirstFreeSlot = slotIdx;
+
+		mNumObjects--;
+	}
+
+	UINT32 GameObjectManager::findSlot(UINT64 id) const
+	{
+		// Remapped IDs take precedence, in case an object was remapped to an ID that still matches another object's slot
+		if (!mRemappedIds.empty())
+		{
+			auto iterFind = mRemappedIds.find(id);
+			if (iterFind != mRemappedIds.end())
+				return iterFind->second;
+		}
+
+		UINT32 slotIdx = getSlotIndex(id);
+		if (slotIdx < (UINT32)mSlots.size() && mSlots[slotIdx].instanceId == id)
+			return slotIdx;
+
+		return INVALID_SLOT;
+	}
+
 	void GameObjectManager::startDeserialization()
 	{
 		assert(!mIsDeserializationActive);
@@ -167,10 +265,10 @@ namespace bs
 
 		if (isInternalReference || (!isInternalReference && (flags & GODM_RestoreExternal) != 0))
 		{
-			auto findIterObj = mObjects.find(instanceId);
+			UINT32 slotIdx = findSlot(instanceId);
 
-			if (findIterObj != mObjects.end())
-				data.handle._resolve(findIterObj->second);
+			if (slotIdx != INVALID_SLOT)
+				data.handle._resolve(GameObjectHandleBase(mSlots[slotIdx].handleData));
 			else
 			{
 				if ((flags & GODM_KeepMissing) == 0)
@@ -205,10 +303,10 @@ namespace bs
 		auto iterFind = mIdMapping.find(originalId);
 		if (iterFind != mIdMapping.end())
 		{
-			auto iterFind2 = mObjects.find(iterFind->second);
-			if (iterFind2 != mObjects.end())
+			UINT32 slotIdx = findSlot(iterFind->second);
+			if (slotIdx != INVALID_SLOT)
 			{
-				object.mData = iterFind2->second.mData;
+				object.mData = mSlots[slotIdx].handleData;
 				foundHandleData = true;
 			}
 		}
@@ -790,6 +790,8 @@ namespace bs
 			bs_frame_free(offsets);
 		}
 		bs_frame_clear();
+
+		buildParamRefs(params->getNumParams());
 	}
 
 	template<bool Core>
@@ -874,185 +876,301 @@ namespace bs
 	}
 
 	template<bool Core>
-	void TGpuParamsSet<Core>::update(const SPtr<MaterialParamsType>& params, bool updateAll)
+	void TGpuParamsSet<Core>::buildParamRefs(UINT32 numMaterialParams)
 	{
-		// Note: Instead of iterating over every single parameter, it might be more efficient for @p params to keep
-		// a ring buffer and a version number. Then we could just iterate over the ring buffer and only access dirty
-		// parameters. If the version number is too high (larger than ring buffer can store), then we force update for all.
+		mParamRefs.clear();
+		mParamRefOffsets.assign(numMaterialParams + 1, 0);
 
-		// Update data params
-		for(auto& paramInfo : mDataParamInfos)
+		auto forEachRef = [&](auto func)
 		{
-			ParamBlockPtrType paramBlock = mBlocks[paramInfo.blockIdx].buffer;
-			if (paramBlock == nullptr || !mBlocks[paramInfo.blockIdx].allowUpdate)
-				continue;
-
-			const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-			if (materialParamInfo->version <= mParamVersion && !updateAll)
-				continue;
-
-			UINT32 arraySize = materialParamInfo->arraySize == 0 ? 1 : materialParamInfo->arraySize;
-			const GpuParamDataTypeInfo& typeInfo = GpuParams::PARAM_SIZES.lookup[(int)materialParamInfo->dataType];
-			UINT32 paramSize = typeInfo.numColumns * typeInfo.numRows * typeInfo.baseTypeSize;
+			for (UINT32 i = 0; i < (UINT32)mDataParamInfos.size(); i++)
+				func(mDataParamInfos[i].paramIdx, ParamRef{ ParamRefType::Data, 0, 0, i });
 
-			UINT8* data = params->getData(materialParamInfo->index);
-
-			bool transposeMatrices = RenderAPICore::instance().getAPIInfo().getGpuProgramHasColumnMajorMatrices();
-			if (transposeMatrices)
+			UINT32 numPasses = (UINT32)mPassParams.size();
+			for (UINT32 i = 0; i < numPasses; i++)
 			{
-				auto writeTransposed = [&](auto& temp)
+				for (UINT32 j = 0; j < NUM_STAGES; j++)
 				{
-					for (UINT32 i = 0; i < arraySize; i++)
-					{
-						UINT32 arrayOffset = i * paramSize;
-						memcpy(&temp, data + arrayOffset, paramSize);
-						temp = temp.transpose();
+					const StageParamInfo& stageInfo = mPassParamInfos[i].stages[j];
 
-						paramBlock->write((paramInfo.offset + arrayOffset) * sizeof(UINT32), &temp, paramSize);
-					}
-				};
+					for (UINT32 k = 0; k < stageInfo.numTextures; k++)
+						func(stageInfo.textures[k].paramIdx, ParamRef{ ParamRefType::Texture, i, j, k });
 
-				switch (materialParamInfo->dataType)
-				{
-				case GPDT_MATRIX_2X2:
-				{
-					MatrixNxM<2, 2> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_2X3:
-				{
-					MatrixNxM<2, 3> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_2X4:
-				{
-					MatrixNxM<2, 4> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_3X2:
-				{
-					MatrixNxM<3, 2> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_3X3:
-				{
-					Matrix3 matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_3X4:
-				{
-					MatrixNxM<3, 4> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_4X2:
-				{
-					MatrixNxM<4, 2> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_4X3:
-				{
-					MatrixNxM<4, 3> matrix;
-					writeTransposed(matrix);
-				}
-					break;
-				case GPDT_MATRIX_4X4:
-				{
-					Matrix4 matrix;
-					writeTransposed(matrix);
+					for (UINT32 k = 0; k < stageInfo.numLoadStoreTextures; k++)
+						func(stageInfo.loadStoreTextures[k].paramIdx, ParamRef{ ParamRefType::LoadStoreTexture, i, j, k });
+
+					for (UINT32 k = 0; k < stageInfo.numBuffers; k++)
+						func(stageInfo.buffers[k].paramIdx, ParamRef{ ParamRefType::Buffer, i, j, k });
+
+					for (UINT32 k = 0; k < stageInfo.numSamplerStates; k++)
+						func(stageInfo.samplerStates[k].paramIdx, ParamRef{ ParamRefType::SamplerState, i, j, k });
 				}
-					break;
-				default:
+			}
+		};
+
+		// Count references per parameter, then convert the counts into offsets and fill out the references
+		forEachRef([&](UINT32 paramIdx, const ParamRef& ref) { mParamRefOffsets[paramIdx + 1]++; });
+
+		for (UINT32 i = 0; i < numMaterialParams; i++)
+			mParamRefOffsets[i + 1] += mParamRefOffsets[i];
+
+		mParamRefs.resize(mParamRefOffsets[numMaterialParams]);
+
+		Vector<UINT32> writeIdx(mParamRefOffsets.begin(), mParamRefOffsets.end() - 1);
+		forEachRef([&](UINT32 paramIdx, const ParamRef& ref) { mParamRefs[writeIdx[paramIdx]++] = ref; });
+	}
+
+	template<bool Core>
+	void TGpuParamsSet<Core>::updateDataParam(const MaterialParamsType& params, const DataParamInfo& paramInfo)
+	{
+		ParamBlockPtrType paramBlock = mBlocks[paramInfo.blockIdx].buffer;
+		if (paramBlock == nullptr || !mBlocks[paramInfo.blockIdx].allowUpdate)
+			return;
+
+		const MaterialParams::ParamData* materialParamInfo = params.getParamData(paramInfo.paramIdx);
+
+		UINT32 arraySize = materialParamInfo->arraySize == 0 ? 1 : materialParamInfo->arraySize;
+		const GpuParamDataTypeInfo& typeInfo = GpuParams::PARAM_SIZES.lookup[(int)materialParamInfo->dataType];
+		UINT32 paramSize = typeInfo.numColumns * typeInfo.numRows * typeInfo.baseTypeSize;
+
+		UINT8* data = params.getData(materialParamInfo->index);
+
+		bool transposeMatrices = RenderAPICore::instance().getAPIInfo().getGpuProgramHasColumnMajorMatrices();
+		if (transposeMatrices)
+		{
+			auto writeTransposed = [&](auto& temp)
+			{
+				for (UINT32 i = 0; i < arraySize; i++)
 				{
-					paramBlock->write(paramInfo.offset * sizeof(UINT32), data, paramSize * arraySize);
-					break;
-				}
+					UINT32 arrayOffset = i * paramSize;
+					memcpy(&temp, data + arrayOffset, paramSize);
+					temp = temp.transpose();
+
+					paramBlock->write((paramInfo.offset + arrayOffset) * sizeof(UINT32), &temp, paramSize);
 				}
+			};
+
+			switch (materialParamInfo->dataType)
+			{
+			case GPDT_MATRIX_2X2:
+			{
+				MatrixNxM<2, 2> matrix;
+				writeTransposed(matrix);
 			}
-			else
+				break;
+			case GPDT_MATRIX_2X3:
+			{
+				MatrixNxM<2, 3> matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			case GPDT_MATRIX_2X4:
+			{
+				MatrixNxM<2, 4> matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			case GPDT_MATRIX_3X2:
+			{
+				MatrixNxM<3, 2> matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			case GPDT_MATRIX_3X3:
+			{
+				Matrix3 matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			case GPDT_MATRIX_3X4:
+			{
+				MatrixNxM<3, 4> matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			case GPDT_MATRIX_4X2:
+			{
+				MatrixNxM<4, 2> matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			case GPDT_MATRIX_4X3:
+			{
+				MatrixNxM<4, 3> matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			case GPDT_MATRIX_4X4:
+			{
+				Matrix4 matrix;
+				writeTransposed(matrix);
+			}
+				break;
+			default:
+			{
 				paramBlock->write(paramInfo.offset * sizeof(UINT32), data, paramSize * arraySize);
+				break;
+			}
+			}
 		}
+		else
+			paramBlock->write(paramInfo.offset * sizeof(UINT32), data, paramSize * arraySize);
+	}
 
-		// Update object params
-		UINT32 numPasses = (UINT32)mPassParams.size();
+	template<bool Core>
+	void TGpuParamsSet<Core>::updateObjectParam(const MaterialParamsType& params, GpuParamsType& gpuParams,
+		ParamRefType type, const ObjectParamInfo& paramInfo)
+	{
+		const MaterialParams::ParamData* materialParamInfo = params.getParamData(paramInfo.paramIdx);
 
-		for(UINT32 i = 0; i < numPasses; i++)
+		switch(type)
 		{
-			SPtr<GpuParamsType> paramPtr = mPassParams[i];
+		case ParamRefType::Texture:
+		{
+			TextureType texture;
+			params.getTexture(*materialParamInfo, texture);
 
-			for(UINT32 j = 0; j < NUM_STAGES; j++)
-			{
-				GpuProgramType progType = (GpuProgramType)j;
-				const StageParamInfo& stageInfo = mPassParamInfos[i].stages[j];
+			gpuParams.setTexture(paramInfo.setIdx, paramInfo.slotIdx, texture);
+		}
+			break;
+		case ParamRefType::LoadStoreTexture:
+		{
+			TextureSurface surface;
+			TextureType texture;
+			params.getLoadStoreTexture(*materialParamInfo, texture, surface);
 
-				for(UINT32 k = 0; k < stageInfo.numTextures; k++)
-				{
-					const ObjectParamInfo& paramInfo = stageInfo.textures[k];
+			gpuParams.setLoadStoreTexture(paramInfo.setIdx, paramInfo.slotIdx, texture, surface);
+		}
+			break;
+		case ParamRefType::Buffer:
+		{
+			BufferType buffer;
+			params.getBuffer(*materialParamInfo, buffer);
 
-					const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-					if (materialParamInfo->version <= mParamVersion && !updateAll)
-						continue;
+			gpuParams.setBuffer(paramInfo.setIdx, paramInfo.slotIdx, buffer);
+		}
+			break;
+		case ParamRefType::SamplerState:
+		{
+			SamplerStateType samplerState;
+			params.getSamplerState(*materialParamInfo, samplerState);
 
-					TextureType texture;
-					params->getTexture(*materialParamInfo, texture);
+			gpuParams.setSamplerState(paramInfo.setIdx, paramInfo.slotIdx, samplerState);
+		}
+			break;
+		default:
+			break;
+		}
+	}
 
-					paramPtr->setTexture(paramInfo.setIdx, paramInfo.slotIdx, texture);
-				}
+	template<bool Core>
+	void TGpuParamsSet<Core>::update(const SPtr<MaterialParamsType>& params, bool updateAll)
+	{
+		UINT64 paramVersion = params->getParamVersion();
+		if (paramVersion == mParamVersion && !updateAll)
+			return;
 
-				for (UINT32 k = 0; k < stageInfo.numLoadStoreTextures; k++)
-				{
-					const ObjectParamInfo& paramInfo = stageInfo.loadStoreTextures[k];
+		UINT32 numPasses = (UINT32)mPassParams.size();
 
-					const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-					if (materialParamInfo->version <= mParamVersion && !updateAll)
+		// Try to only visit the parameters recorded as modified by @p params. If it couldn't keep track of all of them
+		// fall back to checking the version of every parameter.
+		mDirtyParams.clear();
+		if (!updateAll && params->getDirtyParams(mParamVersion, mDirtyParams))
+		{
+			mDirtyPasses.assign(numPasses, false);
+
+			for (auto& paramIdx : mDirtyParams)
+			{
+				UINT32 refStart = mParamRefOffsets[paramIdx];
+				UINT32 refEnd = mParamRefOffsets[paramIdx + 1];
+
+				for (UINT32 i = refStart; i < refEnd; i++)
+				{
+					const ParamRef& ref = mParamRefs[i];
+					if (ref.type == ParamRefType::Data)
+					{
+						updateDataParam(*params, mDataParamInfos[ref.infoIdx]);
 						continue;
+					}
 
-					TextureSurface surface;
-					TextureType texture;
-					params->getLoadStoreTexture(*materialParamInfo, texture, surface);
+					const StageParamInfo& stageInfo = mPassParamInfos[ref.passIdx].stages[ref.stageIdx];
 
-					paramPtr->setLoadStoreTexture(paramInfo.setIdx, paramInfo.slotIdx, texture, surface);
+					const ObjectParamInfo* paramInfo;
+					switch(ref.type)
+					{
+					case ParamRefType::Texture:
+						paramInfo = &stageInfo.textures[ref.infoIdx];
+						break;
+					case ParamRefType::LoadStoreTexture:
+						paramInfo = &stageInfo.loadStoreTextures[ref.infoIdx];
+						break;
+					case ParamRefType::Buffer:
+						paramInfo = &stageInfo.buffers[ref.infoIdx];
+						break;
+					default:
+						paramInfo = &stageInfo.samplerStates[ref.infoIdx];
+						break;
+					}
+
+					updateObjectParam(*params, *mPassParams[ref.passIdx], ref.type, *paramInfo);
+					mDirtyPasses[ref.passIdx] = true;
 				}
+			}
 
-				for (UINT32 k = 0; k < stageInfo.numBuffers; k++)
-				{
-					const ObjectParamInfo& paramInfo = stageInfo.buffers[k];
+			for (UINT32 i = 0; i < numPasses; i++)
+			{
+				if (mDirtyPasses[i])
+					mPassParams[i]->_markCoreDirty();
+			}
 
-					const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-					if (materialParamInfo->version <= mParamVersion && !updateAll)
-						continue;
+			mParamVersion = paramVersion;
+			return;
+		}
+
+		// Update data params
+		for(auto& paramInfo : mDataParamInfos)
+		{
+			const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
+			if (materialParamInfo->version <= mParamVersion && !updateAll)
+				continue;
 
-					BufferType buffer;
-					params->getBuffer(*materialParamInfo, buffer);
+			updateDataParam(*params, paramInfo);
+		}
 
-					paramPtr->setBuffer(paramInfo.setIdx, paramInfo.slotIdx, buffer);
-				}
+		// Update object params
+		for(UINT32 i = 0; i < numPasses; i++)
+		{
+			SPtr<GpuParamsType> paramPtr = mPassParams[i];
 
-				for (UINT32 k = 0; k < stageInfo.numSamplerStates; k++)
+			for(UINT32 j = 0; j < NUM_STAGES; j++)
+			{
+				const StageParamInfo& stageInfo = mPassParamInfos[i].stages[j];
+
+				auto updateObjectParams = [&](const ObjectParamInfo* paramInfos, UINT32 numParams, ParamRefType type)
 				{
-					const ObjectParamInfo& paramInfo = stageInfo.samplerStates[k];
+					for (UINT32 k = 0; k < numParams; k++)
+					{
+						const ObjectParamInfo& paramInfo = paramInfos[k];
 
-					const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
-					if (materialParamInfo->version <= mParamVersion && !updateAll)
-						continue;
+						const MaterialParams::ParamData* materialParamInfo = params->getParamData(paramInfo.paramIdx);
+						if (materialParamInfo->version <= mParamVersion && !updateAll)
+							continue;
 
-					SamplerStateType samplerState;
-					params->getSamplerState(*materialParamInfo, samplerState);
+						updateObjectParam(*params, *paramPtr, type, paramInfo);
+					}
+				};
 
-					paramPtr->setSamplerState(paramInfo.setIdx, paramInfo.slotIdx, samplerState);
-				}
+				updateObjectParams(stageInfo.textures, stageInfo.numTextures, ParamRefType::Texture);
+				updateObjectParams(stageInfo.loadStoreTextures, stageInfo.numLoadStoreTextures,
+					ParamRefType::LoadStoreTexture);
+				updateObjectParams(stageInfo.buffers, stageInfo.numBuffers, ParamRefType::Buffer);
+				updateObjectParams(stageInfo.samplerStates, stageInfo.numSamplerStates, ParamRefType::SamplerState);
 			}
 
 			paramPtr->_markCoreDirty();
 		}
 
-		mParamVersion = params->getParamVersion();
+		mParamVersion = paramVersion;
 	}
 
 	template class TGpuParamsSet <false>;
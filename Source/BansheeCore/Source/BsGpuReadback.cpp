@@ -0,0 +1,162 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsGpuReadback.h"
+#include "BsTexture.h"
+#include "BsEventQuery.h"
+#include "BsCoreThread.h"
+#include "BsPixelUtil.h"
+
+namespace bs
+{
+	const UINT32 GpuReadbackManager::MAX_FREE_STAGING_TEXTURES = 8;
+
+	GpuReadbackManager::GpuReadbackManager()
+		:mNumPendingReads(0)
+	{ }
+
+	void GpuReadbackManager::readTexture(const SPtr<Texture>& texture, const TextureReadbackCallback& callback, 
+		UINT32 face, UINT32 mipLevel)
+	{
+		gCoreThread().queueCommand(std::bind(&GpuReadbackManager::readTextureCore, this, texture->getCore(), callback,
+			face, mipLevel));
+	}
+
+	void GpuReadbackManager::readTextureCore(const SPtr<TextureCore>& texture, const TextureReadbackCallback& callback,
+		UINT32 face, UINT32 mipLevel)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		mNumPendingReads++;
+
+		UINT32 readId = mNextReadId++;
+
+		PendingRead& read = mPendingReads[readId];
+		read.source = texture;
+		read.face = face;
+		read.mipLevel = mipLevel;
+		read.callback = callback;
+
+		// Copy the data now, so the source can be modified by later commands. Textures that can't be copied are read
+		// directly once the GPU is done with them.
+		read.staging = allocStagingTexture(texture->getProperties(), mipLevel);
+		if (read.staging != nullptr)
+		{
+			texture->copy(read.staging, face, mipLevel, 0, 0);
+			read.source = nullptr;
+		}
+
+		read.query = EventQuery::create();
+		read.onTriggeredConn = read.query->onTriggered.connect(std::bind(&GpuReadbackManager::readCompleted, this, readId));
+		read.query->begin();
+	}
+
+	void GpuReadbackManager::_update()
+	{
+		Vector<CompletedRead> completedReads;
+		{
+			Lock lock(mMutex);
+			std::swap(completedReads, mCompletedReads);
+		}
+
+		for (auto& read : completedReads)
+		{
+			mNumPendingReads--;
+
+			if (read.callback != nullptr)
+				read.callback(read.data);
+		}
+	}
+
+	void GpuReadbackManager::readCompleted(UINT32 readId)
+	{
+		auto iterFind = mPendingReads.find(readId);
+		if (iterFind == mPendingReads.end())
+			return;
+
+		PendingRead& read = iterFind->second;
+
+		SPtr<PixelData> data;
+		if (read.staging != nullptr)
+		{
+			data = read.staging->getProperties().allocBuffer(0, 0);
+			read.staging->readData(*data);
+
+			freeStagingTexture(read.staging);
+		}
+		else
+		{
+			data = read.source->getProperties().allocBuffer(read.face, read.mipLevel);
+			read.source->readData(*data, read.mipLevel, read.face);
+		}
+
+		{
+			Lock lock(mMutex);
+			mCompletedReads.push_back({ data, read.callback });
+		}
+
+		// Note: The query itself is released with a delay, so it's safe to release it while its event is being triggered
+		mPendingReads.erase(iterFind);
+	}
+
+	SPtr<TextureCore> GpuReadbackManager::allocStagingTexture(const TextureProperties& props, UINT32 mipLevel)
+	{
+		// Only single surface textures are copied, and multisampled textures only if they can be resolved by the copy
+		if (props.getTextureType() != TEX_TYPE_2D || props.getNumFaces() != 1)
+			return nullptr;
+
+		if (props.getNumSamples() > 1 && PixelUtil::isDepth(props.getFormat()))
+			return nullptr;
+
+		UINT32 mipWidth, mipHeight, mipDepth;
+		PixelUtil::getSizeForMipLevel(props.getWidth(), props.getHeight(), props.getDepth(), mipLevel, mipWidth, mipHeight,
+			mipDepth);
+
+		for (auto iter = mFreeStagingTextures.begin(); iter != mFreeStagingTextures.end(); ++iter)
+		{
+			const TextureProperties& stagingProps = (*iter)->getProperties();
+			if (stagingProps.getWidth() == mipWidth && stagingProps.getHeight() == mipHeight &&
+				stagingProps.getFormat() == props.getFormat() &&
+				stagingProps.isHardwareGammaEnabled() == props.isHardwareGammaEnabled())
+			{
+				SPtr<TextureCore> stagingTexture = *iter;
+				mFreeStagingTextures.erase(iter);
+
+				return stagingTexture;
+			}
+		}
+
+		TEXTURE_DESC desc;
+		desc.type = TEX_TYPE_2D;
+		desc.width = mipWidth;
+		desc.height = mipHeight;
+		desc.format = props.getFormat();
+		desc.hwGamma = props.isHardwareGammaEnabled();
+		desc.usage = TU_CPUREADABLE;
+
+		return TextureCore::create(desc);
+	}
+
+	void GpuReadbackManager::freeStagingTexture(const SPtr<TextureCore>& texture)
+	{
+		// Keep a limited number of most recently used textures around, as reads of the same size tend to repeat
+		if (mFreeStagingTextures.size() >= MAX_FREE_STAGING_TEXTURES)
+			mFreeStagingTextures.erase(mFreeStagingTextures.begin());
+
+		mFreeStagingTextures.push_back(texture);
+	}
+
+	void GpuReadbackManager::onShutDown()
+	{
+		gCoreThread().queueCommand(std::bind(&GpuReadbackManager::destroyCore, this));
+		gCoreThread().submit(true);
+	}
+
+	void GpuReadbackManager::destroyCore()
+	{
+		for (auto& entry : mPendingReads)
+			entry.second.onTriggeredConn.disconnect();
+
+		mPendingReads.clear();
+		mFreeStagingTextures.clear();
+	}
+}
@@ -126,6 +126,26 @@ namespace bs
 		return importer->importAll(inputFilePath, importOptions);
 	}
 
+	bool Importer::_supportsConcurrentImport(const Path& inputFilePath) const
+	{
+		WString ext = inputFilePath.getWExtension();
+		if (ext.empty())
+			return false;
+
+		ext = ext.substr(1, ext.size() - 1); // Remove the .
+		for (auto& importer : mAssetImporters)
+		{
+			if (importer != nullptr && importer->isExtensionSupported(ext))
+			{
+				// Default options are created lazily, make sure that doesn't happen on multiple threads at once
+				importer->getDefaultImportOptions();
+				return importer->isThreadSafe();
+			}
+		}
+
+		return false;
+	}
+
 	void Importer::reimport(HResource& existingResource, const Path& inputFilePath, SPtr<const ImportOptions> importOptions)
 	{
 		if(!FileSystem::isFile(inputFilePath))
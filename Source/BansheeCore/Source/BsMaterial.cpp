@@ -111,7 +111,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	TMaterialParamStruct<Core> TMaterial<Core>::getParamStruct(const String& name) const
+	TMaterialParamStruct<Core> TMaterial<Core>::getParamStruct(const StringID& name) const
 	{
 		throwIfNotInitialized();
 
@@ -119,7 +119,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	TMaterialParamTexture<Core> TMaterial<Core>::getParamTexture(const String& name) const
+	TMaterialParamTexture<Core> TMaterial<Core>::getParamTexture(const StringID& name) const
 	{
 		throwIfNotInitialized();
 
@@ -127,7 +127,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	TMaterialParamLoadStoreTexture<Core> TMaterial<Core>::getParamLoadStoreTexture(const String& name) const
+	TMaterialParamLoadStoreTexture<Core> TMaterial<Core>::getParamLoadStoreTexture(const StringID& name) const
 	{
 		throwIfNotInitialized();
 
@@ -135,7 +135,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	TMaterialParamBuffer<Core> TMaterial<Core>::getParamBuffer(const String& name) const
+	TMaterialParamBuffer<Core> TMaterial<Core>::getParamBuffer(const StringID& name) const
 	{
 		throwIfNotInitialized();
 
@@ -143,7 +143,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	TMaterialParamSampState<Core> TMaterial<Core>::getParamSamplerState(const String& name) const
+	TMaterialParamSampState<Core> TMaterial<Core>::getParamSamplerState(const StringID& name) const
 	{
 		throwIfNotInitialized();
 
@@ -173,7 +173,7 @@ namespace bs
 
 	template <bool Core>
 	template <typename T>
-	void TMaterial<Core>::setParamValue(const String& name, UINT8* buffer, UINT32 numElements)
+	void TMaterial<Core>::setParamValue(const StringID& name, UINT8* buffer, UINT32 numElements)
 	{
 		TMaterialDataParam<T, Core> param;
 		getParam(name, param);
@@ -296,7 +296,7 @@ namespace bs
 
 	template <bool Core>
 	template <typename T>
-	void TMaterial<Core>::getParam(const String& name, TMaterialDataParam<T, Core>& output) const
+	void TMaterial<Core>::getParam(const StringID& name, TMaterialDataParam<T, Core>& output) const
 	{
 		throwIfNotInitialized();
 
@@ -320,43 +320,43 @@ namespace bs
 	template class TMaterial < false > ;
 	template class TMaterial < true > ;
 
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<float, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<int, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Color, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Vector2, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Vector3, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Vector4, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Vector2I, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Vector3I, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Vector4I, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Matrix2, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Matrix2x3, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Matrix2x4, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Matrix3, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Matrix3x2, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Matrix3x4, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Matrix4, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Matrix4x2, false>&) const;
-	template BS_CORE_EXPORT void TMaterial<false>::getParam(const String&, TMaterialDataParam<Matrix4x3, false>&) const;
-
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<float, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<int, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Color, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Vector2, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Vector3, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Vector4, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Vector2I, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Vector3I, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Vector4I, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Matrix2, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Matrix2x3, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Matrix2x4, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Matrix3, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Matrix3x2, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Matrix3x4, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Matrix4, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Matrix4x2, true>&) const;
-	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Matrix4x3, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<float, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<int, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Color, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Vector2, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Vector3, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Vector4, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Vector2I, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Vector3I, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Vector4I, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Matrix2, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Matrix2x3, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Matrix2x4, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Matrix3, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Matrix3x2, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Matrix3x4, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Matrix4, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Matrix4x2, false>&) const;
+	template BS_CORE_EXPORT void TMaterial<false>::getParam(const StringID&, TMaterialDataParam<Matrix4x3, false>&) const;
+
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<float, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<int, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Color, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Vector2, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Vector3, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Vector4, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Vector2I, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Vector3I, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Vector4I, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Matrix2, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Matrix2x3, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Matrix2x4, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Matrix3, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Matrix3x2, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Matrix3x4, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Matrix4, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Matrix4x2, true>&) const;
+	template BS_CORE_EXPORT void TMaterial<true>::getParam(const StringID&, TMaterialDataParam<Matrix4x3, true>&) const;
 
 	MaterialCore::MaterialCore(const SPtr<ShaderCore>& shader)
 	{
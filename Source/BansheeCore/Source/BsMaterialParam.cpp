@@ -9,7 +9,7 @@
 namespace bs
 {
 	template<class T, bool Core>
-	TMaterialDataParam<T, Core>::TMaterialDataParam(const String& name, const MaterialPtrType& material)
+	TMaterialDataParam<T, Core>::TMaterialDataParam(const StringID& name, const MaterialPtrType& material)
 		:mParamIndex(0), mArraySize(0), mMaterial(nullptr)
 	{
 		if(material != nullptr)
@@ -68,7 +68,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	TMaterialParamStruct<Core>::TMaterialParamStruct(const String& name, const MaterialPtrType& material)
+	TMaterialParamStruct<Core>::TMaterialParamStruct(const StringID& name, const MaterialPtrType& material)
 		:mParamIndex(0), mArraySize(0), mMaterial(nullptr)
 	{
 		if (material != nullptr)
@@ -136,7 +136,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	TMaterialParamTexture<Core>::TMaterialParamTexture(const String& name, const MaterialPtrType& material)
+	TMaterialParamTexture<Core>::TMaterialParamTexture(const StringID& name, const MaterialPtrType& material)
 		:mParamIndex(0), mMaterial(nullptr)
 	{
 		if (material != nullptr)
@@ -189,7 +189,7 @@ namespace bs
 	}
 	
 	template<bool Core>
-	TMaterialParamLoadStoreTexture<Core>::TMaterialParamLoadStoreTexture(const String& name, 
+	TMaterialParamLoadStoreTexture<Core>::TMaterialParamLoadStoreTexture(const StringID& name, 
 		const MaterialPtrType& material)
 		:mParamIndex(0), mMaterial(nullptr)
 	{
@@ -240,7 +240,7 @@ namespace bs
 	}
 	
 	template<bool Core>
-	TMaterialParamBuffer<Core>::TMaterialParamBuffer(const String& name, const MaterialPtrType& material)
+	TMaterialParamBuffer<Core>::TMaterialParamBuffer(const StringID& name, const MaterialPtrType& material)
 		:mParamIndex(0), mMaterial(nullptr)
 	{
 		if (material != nullptr)
@@ -288,7 +288,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	TMaterialParamSampState<Core>::TMaterialParamSampState(const String& name, const MaterialPtrType& material)
+	TMaterialParamSampState<Core>::TMaterialParamSampState(const StringID& name, const MaterialPtrType& material)
 		:mParamIndex(0), mMaterial(nullptr)
 	{
 		if (material != nullptr)
@@ -6,6 +6,7 @@
 #include "BsTexture.h"
 #include "BsGpuBuffer.h"
 #include "BsSamplerState.h"
+#include "BsBitwise.h"
 
 namespace bs
 {
@@ -42,7 +43,7 @@ namespace bs
 		{
 			UINT32 paramIdx = (UINT32)mParams.size();
 			mParams.push_back(ParamData());
-			mParamLookup[entry.first] = paramIdx;
+			addParamLookup(entry.first, paramIdx);
 
 			ParamData& dataParam = mParams.back();
 
@@ -63,7 +64,7 @@ namespace bs
 		{
 			UINT32 paramIdx = (UINT32)mParams.size();
 			mParams.push_back(ParamData());
-			mParamLookup[entry.first] = paramIdx;
+			addParamLookup(entry.first, paramIdx);
 
 			ParamData& dataParam = mParams.back();
 
@@ -80,7 +81,7 @@ namespace bs
 		{
 			UINT32 paramIdx = (UINT32)mParams.size();
 			mParams.push_back(ParamData());
-			mParamLookup[entry.first] = paramIdx;
+			addParamLookup(entry.first, paramIdx);
 
 			ParamData& dataParam = mParams.back();
 
@@ -97,7 +98,7 @@ namespace bs
 		{
 			UINT32 paramIdx = (UINT32)mParams.size();
 			mParams.push_back(ParamData());
-			mParamLookup[entry.first] = paramIdx;
+			addParamLookup(entry.first, paramIdx);
 
 			ParamData& dataParam = mParams.back();
 
@@ -118,23 +119,18 @@ namespace bs
 		mAlloc.clear();
 	}
 
-	UINT32 MaterialParamsBase::getParamIndex(const String& name) const
+	UINT32 MaterialParamsBase::getParamIndex(const StringID& name) const
 	{
-		auto iterFind = mParamLookup.find(name);
-		if (iterFind == mParamLookup.end())
-			return (UINT32)-1;
-
-		return iterFind->second;
+		return findParamLookup(name);
 	}
 
-	MaterialParamsBase::GetParamResult MaterialParamsBase::getParamIndex(const String& name, ParamType type,
+	MaterialParamsBase::GetParamResult MaterialParamsBase::getParamIndex(const StringID& name, ParamType type,
 		GpuParamDataType dataType, UINT32 arrayIdx, UINT32& output) const
 	{
-		auto iterFind = mParamLookup.find(name);
-		if (iterFind == mParamLookup.end())
+		UINT32 index = findParamLookup(name);
+		if (index == (UINT32)-1)
 			return GetParamResult::NotFound;
 
-		UINT32 index = iterFind->second;
 		const ParamData& param = mParams[index];
 		
 		if (param.type != type || (type == ParamType::Data && param.dataType != dataType))
@@ -147,14 +143,13 @@ namespace bs
 		return GetParamResult::Success;
 	}
 
-	MaterialParamsBase::GetParamResult MaterialParamsBase::getParamData(const String& name, ParamType type, 
+	MaterialParamsBase::GetParamResult MaterialParamsBase::getParamData(const StringID& name, ParamType type,
 		GpuParamDataType dataType, UINT32 arrayIdx, const ParamData** output) const
 	{
-		auto iterFind = mParamLookup.find(name);
-		if (iterFind == mParamLookup.end())
+		UINT32 index = findParamLookup(name);
+		if (index == (UINT32)-1)
 			return GetParamResult::NotFound;
 
-		UINT32 index = iterFind->second;
 		const ParamData& param = mParams[index];
 		*output = &param;
 
@@ -167,24 +162,84 @@ namespace bs
 		return GetParamResult::Success;
 	}
 
-	void MaterialParamsBase::reportGetParamError(GetParamResult errorCode, const String& name, UINT32 arrayIdx) const
+	void MaterialParamsBase::reportGetParamError(GetParamResult errorCode, const StringID& name, UINT32 arrayIdx) const
 	{
 		switch (errorCode)
 		{
 		case GetParamResult::NotFound:
-			LOGWRN("Material doesn't have a parameter named " + name + ".");
+			LOGWRN("Material doesn't have a parameter named " + String(name.cstr()) + ".");
 			break;
 		case GetParamResult::InvalidType:
-			LOGWRN("Parameter \"" + name + "\" is not of the requested type.");
+			LOGWRN("Parameter \"" + String(name.cstr()) + "\" is not of the requested type.");
 			break;
 		case GetParamResult::IndexOutOfBounds:
-			LOGWRN("Parameter \"" + name + "\" array index " + toString(arrayIdx) + " out of range.");
+			LOGWRN("Parameter \"" + String(name.cstr()) + "\" array index " + toString(arrayIdx) + " out of range.");
 			break;
 		default:
 			break;
 		}
 	}
 
+	void MaterialParamsBase::addParamLookup(const StringID& name, UINT32 paramIdx)
+	{
+		auto insert = [this](const StringID& name, UINT32 paramIdx)
+		{
+			UINT32 mask = (UINT32)mParamLookup.size() - 1;
+			UINT32 slot = getLookupSlot(name);
+			while (!mParamLookup[slot].name.empty() && mParamLookup[slot].name != name)
+				slot = (slot + 1) & mask;
+
+			mParamLookup[slot].name = name;
+			mParamLookup[slot].paramIdx = paramIdx;
+		};
+
+		// Parameter is expected to be already added to mParams
+		UINT32 numParams = (UINT32)mParams.size();
+		if (numParams * 2 > (UINT32)mParamLookup.size())
+		{
+			UINT32 size = std::max(Bitwise::firstPO2From(numParams * 2), 16U);
+
+			Vector<ParamLookupEntry> oldEntries;
+			std::swap(oldEntries, mParamLookup);
+
+			mParamLookup.resize(size, { StringID(), (UINT32)-1 });
+			mParamLookupShift = 32 - Bitwise::mostSignificantBitSet(size);
+
+			for (auto& entry : oldEntries)
+			{
+				if (!entry.name.empty())
+					insert(entry.name, entry.paramIdx);
+			}
+		}
+
+		insert(name, paramIdx);
+	}
+
+	bool MaterialParamsBase::getDirtyParams(UINT64 sinceVersion, Vector<UINT32>& output) const
+	{
+		if (sinceVersion >= mParamVersion)
+			return true;
+
+		// Initial parameter versions aren't recorded
+		if (sinceVersion == 0)
+			return false;
+
+		UINT64 firstRecord = mNumDirtyParams > DIRTY_PARAM_RING_SIZE ? mNumDirtyParams - DIRTY_PARAM_RING_SIZE : 0;
+		for (UINT64 i = mNumDirtyParams; i > firstRecord; i--)
+		{
+			const DirtyParam& entry = mDirtyParams[(i - 1) % DIRTY_PARAM_RING_SIZE];
+			if (entry.version <= sinceVersion)
+				return true;
+
+			// Only report the latest modification of each parameter
+			if (mParams[entry.paramIdx].version == entry.version)
+				output.push_back(entry.paramIdx);
+		}
+
+		// Ran out of records, which is only fine if none were overwritten
+		return firstRecord == 0;
+	}
+
 	RTTITypeBase* MaterialParamStructData::getRTTIStatic()
 	{
 		return MaterialParamStructDataRTTI::instance();
@@ -287,7 +342,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	void TMaterialParams<Core>::getStructData(const String& name, void* value, UINT32 size, UINT32 arrayIdx) const
+	void TMaterialParams<Core>::getStructData(const StringID& name, void* value, UINT32 size, UINT32 arrayIdx) const
 	{
 		const ParamData* param = nullptr;
 		GetParamResult result = getParamData(name, ParamType::Data, GPDT_STRUCT, arrayIdx, &param);
@@ -301,7 +356,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	void TMaterialParams<Core>::setStructData(const String& name, const void* value, UINT32 size, UINT32 arrayIdx)
+	void TMaterialParams<Core>::setStructData(const StringID& name, const void* value, UINT32 size, UINT32 arrayIdx)
 	{
 		const ParamData* param = nullptr;
 		GetParamResult result = getParamData(name, ParamType::Data, GPDT_STRUCT, arrayIdx, &param);
@@ -315,7 +370,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	void TMaterialParams<Core>::getTexture(const String& name, TextureType& value) const
+	void TMaterialParams<Core>::getTexture(const StringID& name, TextureType& value) const
 	{
 		const ParamData* param = nullptr;
 		GetParamResult result = getParamData(name, ParamType::Texture, GPDT_UNKNOWN, 0, &param);
@@ -329,7 +384,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	void TMaterialParams<Core>::setTexture(const String& name, const TextureType& value)
+	void TMaterialParams<Core>::setTexture(const StringID& name, const TextureType& value)
 	{
 		const ParamData* param = nullptr;
 		GetParamResult result = getParamData(name, ParamType::Texture, GPDT_UNKNOWN, 0, &param);
@@ -343,7 +398,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	void TMaterialParams<Core>::getLoadStoreTexture(const String& name, TextureType& value, TextureSurface& surface) const
+	void TMaterialParams<Core>::getLoadStoreTexture(const StringID& name, TextureType& value, TextureSurface& surface) const
 	{
 		const ParamData* param = nullptr;
 		GetParamResult result = getParamData(name, ParamType::Texture, GPDT_UNKNOWN, 0, &param);
@@ -357,7 +412,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	void TMaterialParams<Core>::setLoadStoreTexture(const String& name, const TextureType& value, const TextureSurface& surface)
+	void TMaterialParams<Core>::setLoadStoreTexture(const StringID& name, const TextureType& value, const TextureSurface& surface)
 	{
 		const ParamData* param = nullptr;
 		GetParamResult result = getParamData(name, ParamType::Texture, GPDT_UNKNOWN, 0, &param);
@@ -371,7 +426,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	void TMaterialParams<Core>::getBuffer(const String& name, BufferType& value) const
+	void TMaterialParams<Core>::getBuffer(const StringID& name, BufferType& value) const
 	{
 		const ParamData* param = nullptr;
 		GetParamResult result = getParamData(name, ParamType::Buffer, GPDT_UNKNOWN, 0, &param);
@@ -385,7 +440,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	void TMaterialParams<Core>::setBuffer(const String& name, const BufferType& value)
+	void TMaterialParams<Core>::setBuffer(const StringID& name, const BufferType& value)
 	{
 		const ParamData* param = nullptr;
 		GetParamResult result = getParamData(name, ParamType::Buffer, GPDT_UNKNOWN, 0, &param);
@@ -399,7 +454,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	void TMaterialParams<Core>::getSamplerState(const String& name, SamplerType& value) const
+	void TMaterialParams<Core>::getSamplerState(const StringID& name, SamplerType& value) const
 	{
 		const ParamData* param = nullptr;
 		GetParamResult result = getParamData(name, ParamType::Sampler, GPDT_UNKNOWN, 0, &param);
@@ -413,7 +468,7 @@ namespace bs
 	}
 
 	template<bool Core>
-	void TMaterialParams<Core>::setSamplerState(const String& name, const SamplerType& value)
+	void TMaterialParams<Core>::setSamplerState(const StringID& name, const SamplerType& value)
 	{
 		const ParamData* param = nullptr;
 		GetParamResult result = getParamData(name, ParamType::Sampler, GPDT_UNKNOWN, 0, &param);
@@ -452,7 +507,7 @@ namespace bs
 		}
 
 		memcpy(structParam.data, value, structParam.dataSize);
-		param.version = ++mParamVersion;
+		markParamDirty(param);
 	}
 
 	template<bool Core>
@@ -476,7 +531,7 @@ namespace bs
 		textureParam.value = value;
 		textureParam.isLoadStore = false;
 
-		param.version = ++mParamVersion;
+		markParamDirty(param);
 	}
 
 	template<bool Core>
@@ -490,7 +545,7 @@ namespace bs
 	{
 		mBufferParams[param.index].value = value;
 
-		param.version = ++mParamVersion;
+		markParamDirty(param);
 	}
 
 	template<bool Core>
@@ -509,7 +564,7 @@ namespace bs
 		textureParam.isLoadStore = true;
 		textureParam.surface = surface;
 
-		param.version = ++mParamVersion;
+		markParamDirty(param);
 	}
 
 	template<bool Core>
@@ -529,7 +584,7 @@ namespace bs
 	{
 		mSamplerStateParams[param.index].value = value;
 
-		param.version = ++mParamVersion;
+		markParamDirty(param);
 	}
 
 	template<bool Core>
@@ -619,6 +674,7 @@ namespace bs
 
 			ParamData& param = mParams[paramIdx];
 			param.version = mParamVersion;
+			recordDirtyParam(param);
 
 			UINT32 arraySize = param.arraySize > 1 ? param.arraySize : 1;
 			const GpuParamDataTypeInfo& typeInfo = GpuParams::PARAM_SIZES.lookup[(int)param.type];
@@ -636,6 +692,7 @@ namespace bs
 
 			ParamData& param = mParams[paramIdx];
 			param.version = mParamVersion;
+			recordDirtyParam(param);
 
 			MaterialParamTextureDataCore* sourceTexData = (MaterialParamTextureDataCore*)sourceData;
 			sourceData += sizeof(MaterialParamTextureDataCore);
@@ -651,6 +708,7 @@ namespace bs
 
 			ParamData& param = mParams[paramIdx];
 			param.version = mParamVersion;
+			recordDirtyParam(param);
 
 			MaterialParamBufferDataCore* sourceBufferData = (MaterialParamBufferDataCore*)sourceData;
 			sourceData += sizeof(MaterialParamBufferDataCore);
@@ -666,6 +724,7 @@ namespace bs
 
 			ParamData& param = mParams[paramIdx];
 			param.version = mParamVersion;
+			recordDirtyParam(param);
 
 			MaterialParamSamplerStateDataCore* sourceSamplerStateData = (MaterialParamSamplerStateDataCore*)sourceData;
 			sourceData += sizeof(MaterialParamSamplerStateDataCore);
@@ -20,8 +20,9 @@ namespace bs
 		: MeshCoreBase(desc.numVertices, desc.numIndices, desc.subMeshes), mVertexData(nullptr), mIndexBuffer(nullptr)
 		, mVertexDesc(desc.vertexDesc), mUsage(desc.usage), mIndexType(desc.indexType), mDeviceMask(deviceMask)
 		, mTempInitialMeshData(initialMeshData), mSkeleton(desc.skeleton), mMorphShapes(desc.morphShapes)
-		
-	{ }
+	{
+		mProperties.setLODs(desc.lodSubMeshes, desc.lodScreenSizes);
+	}
 
 	MeshCore::~MeshCore()
 	{
@@ -373,7 +374,7 @@ namespace bs
 		:MeshBase(desc.numVertices, desc.numIndices, desc.subMeshes), mVertexDesc(desc.vertexDesc), mUsage(desc.usage),
 		mIndexType(desc.indexType), mSkeleton(desc.skeleton), mMorphShapes(desc.morphShapes)
 	{
-
+		mProperties.setLODs(desc.lodSubMeshes, desc.lodScreenSizes);
 	}
 
 	Mesh::Mesh(const SPtr<MeshData>& initialMeshData, const MESH_DESC& desc)
@@ -382,7 +383,7 @@ namespace bs
 		mUsage(desc.usage), mIndexType(initialMeshData->getIndexType()), mSkeleton(desc.skeleton), 
 		mMorphShapes(desc.morphShapes)
 	{
-
+		mProperties.setLODs(desc.lodSubMeshes, desc.lodScreenSizes);
 	}
 
 	Mesh::Mesh()
@@ -470,6 +471,8 @@ namespace bs
 		desc.numIndices = mProperties.mNumIndices;
 		desc.vertexDesc = mVertexDesc;
 		desc.subMeshes = mProperties.mSubMeshes;
+		desc.lodSubMeshes = mProperties.mLODSubMeshes;
+		desc.lodScreenSizes = mProperties.mLODScreenSizes;
 		desc.usage = mUsage;
 		desc.indexType = mIndexType;
 		desc.skeleton = mSkeleton;
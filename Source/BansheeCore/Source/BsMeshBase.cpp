@@ -5,6 +5,7 @@
 #include "BsCoreThread.h"
 #include "BsFrameAlloc.h"
 #include "BsDebug.h"
+#include "BsMath.h"
 
 namespace bs
 {
@@ -42,6 +43,66 @@ namespace bs
 		return (UINT32)mSubMeshes.size();
 	}
 
+	const SubMesh& MeshProperties::getLODSubMesh(UINT32 lod, UINT32 subMeshIdx) const
+	{
+		if (lod == 0)
+			return getSubMesh(subMeshIdx);
+
+		UINT32 numSubMeshes = (UINT32)mSubMeshes.size();
+		UINT32 idx = (lod - 1) * numSubMeshes + subMeshIdx;
+		if (subMeshIdx >= numSubMeshes || idx >= mLODSubMeshes.size())
+		{
+			BS_EXCEPT(InvalidParametersException, "Invalid level of detail (" + toString(lod) + ") or sub-mesh index ("
+				+ toString(subMeshIdx) + "). Number of levels available: " + toString(getNumLODs()));
+		}
+
+		return mLODSubMeshes[idx];
+	}
+
+	float MeshProperties::getLODScreenSize(UINT32 lod) const
+	{
+		if (lod == 0 || lod > (UINT32)mLODScreenSizes.size())
+			return std::numeric_limits<float>::infinity();
+
+		return mLODScreenSizes[lod - 1];
+	}
+
+	UINT32 MeshProperties::getLOD(float screenSize) const
+	{
+		UINT32 lod = 0;
+		for (UINT32 i = 0; i < (UINT32)mLODScreenSizes.size(); i++)
+		{
+			if (screenSize >= mLODScreenSizes[i])
+				break;
+
+			lod = i + 1;
+		}
+
+		return lod;
+	}
+
+	UINT32 MeshProperties::getLOD(float screenSize, UINT32 prevLOD, float hysteresis) const
+	{
+		UINT32 minLOD = getLOD(screenSize * (1.0f + hysteresis));
+		UINT32 maxLOD = getLOD(screenSize * (1.0f - hysteresis));
+
+		return Math::clamp(prevLOD, minLOD, maxLOD);
+	}
+
+	void MeshProperties::setLODs(const Vector<SubMesh>& lodSubMeshes, const Vector<float>& lodScreenSizes)
+	{
+		UINT32 numSubMeshes = (UINT32)mSubMeshes.size();
+		if (lodSubMeshes.size() != lodScreenSizes.size() * numSubMeshes)
+		{
+			LOGERR("Number of level of detail sub-meshes doesn't match the number of levels and sub-meshes. Levels "
+				"of detail will be ignored.");
+			return;
+		}
+
+		mLODSubMeshes = lodSubMeshes;
+		mLODScreenSizes = lodScreenSizes;
+	}
+
 	MeshCoreBase::MeshCoreBase(UINT32 numVertices, UINT32 numIndices, const Vector<SubMesh>& subMeshes)
 		:mProperties(numVertices, numIndices, subMeshes)
 	{ }
@@ -28,7 +28,7 @@ namespace bs
 	MeshImportOptions::MeshImportOptions()
 		: mCPUCached(false), mImportNormals(true), mImportTangents(true), mImportBlendShapes(false), mImportSkin(false)
 		, mImportAnimation(false), mReduceKeyFrames(true), mImportRootMotion(false), mImportScale(1.0f)
-		, mCollisionMeshType(CollisionMeshType::None)
+		, mNumLODs(1), mLODReduction(0.5f), mOptimizeMesh(true), mCollisionMeshType(CollisionMeshType::None)
 	{ }
 
 	SPtr<MeshImportOptions> MeshImportOptions::create()
@@ -5,6 +5,11 @@
 #include "BsVector3.h"
 #include "BsVector2.h"
 #include "BsPlane.h"
+#include "BsMeshData.h"
+#include "BsVertexDataDesc.h"
+#include "BsSubMesh.h"
+#include "BsMath.h"
+#include "BsDebug.h"
 
 namespace bs
 {
@@ -724,6 +729,500 @@ namespace bs
 		bs_frame_clear();
 	}
 
+	/** Reads a single index of the provided size from an index buffer. */
+	static UINT32 readIndex(const UINT8* indices, UINT32 idx, UINT32 indexSize)
+	{
+		UINT32 value = 0;
+		memcpy(&value, indices + idx * indexSize, indexSize);
+
+		return value;
+	}
+
+	/** Writes a single index of the provided size into an index buffer. */
+	static void writeIndex(UINT8* indices, UINT32 idx, UINT32 value, UINT32 indexSize)
+	{
+		memcpy(indices + idx * indexSize, &value, indexSize);
+	}
+
+	/** 
+	 * Calculates a score for a vertex used by the vertex cache optimizer. Vertices recently used, and vertices with few
+	 * remaining triangles receive higher scores.
+	 */
+	static float getVertexCacheScore(INT32 cachePosition, UINT32 numRemainingFaces, UINT32 cacheSize)
+	{
+		if (numRemainingFaces == 0)
+			return -1.0f;
+
+		float score = 0.0f;
+		if (cachePosition >= 0)
+		{
+			// Vertices used by the last triangle get a fixed score, so the next triangle doesn't just reuse the same edge
+			if (cachePosition < 3)
+				score = 0.75f;
+			else
+			{
+				float scale = 1.0f / (cacheSize - 3);
+				score = std::pow(1.0f - (cachePosition - 3) * scale, 1.5f);
+			}
+		}
+
+		// Boost vertices with only a few triangles remaining, so that lone triangles don't get left behind
+		score += 2.0f / std::sqrt((float)numRemainingFaces);
+		return score;
+	}
+
+	/** Symmetric 4x4 matrix used for accumulating the squared distance of a point to a set of planes. */
+	struct Quadric
+	{
+		/** Adds a plane with the provided normal and distance to the quadric. */
+		void addPlane(const Vector3& normal, float d, float weight)
+		{
+			a2 += normal.x * normal.x * weight;
+			ab += normal.x * normal.y * weight;
+			ac += normal.x * normal.z * weight;
+			ad += normal.x * d * weight;
+			b2 += normal.y * normal.y * weight;
+			bc += normal.y * normal.z * weight;
+			bd += normal.y * d * weight;
+			c2 += normal.z * normal.z * weight;
+			cd += normal.z * d * weight;
+			d2 += d * d * weight;
+		}
+
+		/** Returns the weighted sum of squared distances of the point to all planes in the quadric. */
+		float evaluate(const Vector3& p) const
+		{
+			float error = a2 * p.x * p.x + 2.0f * ab * p.x * p.y + 2.0f * ac * p.x * p.z + 2.0f * ad * p.x
+				+ b2 * p.y * p.y + 2.0f * bc * p.y * p.z + 2.0f * bd * p.y
+				+ c2 * p.z * p.z + 2.0f * cd * p.z + d2;
+
+			return std::max(error, 0.0f);
+		}
+
+		Quadric& operator+=(const Quadric& rhs)
+		{
+			a2 += rhs.a2; ab += rhs.ab; ac += rhs.ac; ad += rhs.ad;
+			b2 += rhs.b2; bc += rhs.bc; bd += rhs.bd;
+			c2 += rhs.c2; cd += rhs.cd;
+			d2 += rhs.d2;
+
+			return *this;
+		}
+
+		float a2 = 0.0f, ab = 0.0f, ac = 0.0f, ad = 0.0f;
+		float b2 = 0.0f, bc = 0.0f, bd = 0.0f;
+		float c2 = 0.0f, cd = 0.0f;
+		float d2 = 0.0f;
+	};
+
+	/** 
+	 * Simplifies a triangle list using quadric error metric edge collapses. Vertices sharing the same position are 
+	 * grouped, and collapses are performed on the groups so that attribute seams stay intact. 
+	 */
+	class MeshSimplifier
+	{
+	public:
+		MeshSimplifier(Vector3* vertices, UINT8* indices, UINT32 numVertices, UINT32 numIndices, UINT32 indexSize)
+			:mVertices(vertices), mNumVertices(numVertices), mNumFaces(numIndices / 3), mNumLiveFaces(0)
+		{
+			mIndices.resize(mNumFaces * 3);
+			for (UINT32 i = 0; i < mNumFaces * 3; i++)
+			{
+				mIndices[i] = 0;
+				memcpy(&mIndices[i], indices + i * indexSize, indexSize);
+			}
+
+			buildGroups();
+			buildFaces();
+		}
+
+		/** Collapses edges until the number of remaining triangles drops to the provided amount, or no more can be. */
+		void simplify(UINT32 targetNumFaces)
+		{
+			Vector<float> bestCost(mNumGroups);
+			Vector<UINT32> bestTarget(mNumGroups);
+			Vector<UINT32> candidates;
+			Vector<bool> touched(mNumGroups);
+
+			while (mNumLiveFaces > targetNumFaces)
+			{
+				buildGroupFaces();
+
+				// Find the cheapest collapse for each group
+				std::fill(bestCost.begin(), bestCost.end(), std::numeric_limits<float>::max());
+				std::fill(bestTarget.begin(), bestTarget.end(), (UINT32)-1);
+
+				for (UINT32 i = 0; i < mNumFaces; i++)
+				{
+					if (!mFaceLive[i])
+						continue;
+
+					for (UINT32 j = 0; j < 3; j++)
+					{
+						UINT32 groupA = mVertexGroups[mIndices[i * 3 + j]];
+						UINT32 groupB = mVertexGroups[mIndices[i * 3 + (j + 1) % 3]];
+
+						evaluateCollapse(groupA, groupB, bestCost, bestTarget);
+						evaluateCollapse(groupB, groupA, bestCost, bestTarget);
+					}
+				}
+
+				candidates.clear();
+				for (UINT32 i = 0; i < mNumGroups; i++)
+				{
+					if (bestTarget[i] != (UINT32)-1)
+						candidates.push_back(i);
+				}
+
+				std::sort(candidates.begin(), candidates.end(), 
+					[&](UINT32 a, UINT32 b) { return bestCost[a] < bestCost[b]; });
+
+				// Perform collapses in order of increasing error. Groups modified by a collapse are skipped for the rest
+				// of the pass as their costs are no longer valid.
+				std::fill(touched.begin(), touched.end(), false);
+
+				UINT32 numCollapsed = 0;
+				for (auto& groupA : candidates)
+				{
+					if (mNumLiveFaces <= targetNumFaces)
+						break;
+
+					UINT32 groupB = bestTarget[groupA];
+					if (touched[groupA] || touched[groupB])
+						continue;
+
+					if (!collapse(groupA, groupB))
+						continue;
+
+					touched[groupA] = true;
+					touched[groupB] = true;
+					numCollapsed++;
+				}
+
+				if (numCollapsed == 0)
+					break;
+			}
+		}
+
+		/** Writes indices of all remaining triangles to the provided buffer, and returns the number of indices written. */
+		UINT32 writeIndices(UINT8* outIndices, UINT32 indexSize) const
+		{
+			UINT32 numIndices = 0;
+			for (UINT32 i = 0; i < mNumFaces; i++)
+			{
+				if (!mFaceLive[i])
+					continue;
+
+				for (UINT32 j = 0; j < 3; j++)
+				{
+					memcpy(outIndices + numIndices * indexSize, &mIndices[i * 3 + j], indexSize);
+					numIndices++;
+				}
+			}
+
+			return numIndices;
+		}
+
+	private:
+		/** Groups vertices with identical positions, so that vertices split due to differing attributes act as one. */
+		void buildGroups()
+		{
+			Vector<UINT32> sortedVertices(mNumVertices);
+			for (UINT32 i = 0; i < mNumVertices; i++)
+				sortedVertices[i] = i;
+
+			std::sort(sortedVertices.begin(), sortedVertices.end(), 
+				[&](UINT32 a, UINT32 b)
+			{
+				const Vector3& posA = mVertices[a];
+				const Vector3& posB = mVertices[b];
+
+				if (posA.x != posB.x) return posA.x < posB.x;
+				if (posA.y != posB.y) return posA.y < posB.y;
+				return posA.z < posB.z;
+			});
+
+			mVertexGroups.resize(mNumVertices);
+			mGroupVertices.clear();
+			mGroupStarts.clear();
+
+			for (UINT32 i = 0; i < mNumVertices; i++)
+			{
+				UINT32 vertexIdx = sortedVertices[i];
+				if (i == 0 || mVertices[vertexIdx] != mVertices[sortedVertices[i - 1]])
+					mGroupStarts.push_back(i);
+
+				mVertexGroups[vertexIdx] = (UINT32)mGroupStarts.size() - 1;
+				mGroupVertices.push_back(vertexIdx);
+			}
+
+			mNumGroups = (UINT32)mGroupStarts.size();
+			mGroupStarts.push_back(mNumVertices);
+			mGroupPositions.resize(mNumGroups);
+
+			for (UINT32 i = 0; i < mNumGroups; i++)
+				mGroupPositions[i] = mVertices[mGroupVertices[mGroupStarts[i]]];
+		}
+
+		/** 
+		 * Removes degenerate triangles, calculates initial quadrics and locks groups on open borders, which cannot be
+		 * collapsed without changing the mesh silhouette.
+		 */
+		void buildFaces()
+		{
+			mFaceLive.resize(mNumFaces);
+			mQuadrics.resize(mNumGroups);
+			mLocked.assign(mNumGroups, false);
+
+			Vector<UINT64> edges;
+			edges.reserve(mNumFaces * 3);
+
+			for (UINT32 i = 0; i < mNumFaces; i++)
+			{
+				UINT32 groups[3];
+				for (UINT32 j = 0; j < 3; j++)
+				{
+					if (mIndices[i * 3 + j] >= mNumVertices)
+						groups[j] = (UINT32)-1;
+					else
+						groups[j] = mVertexGroups[mIndices[i * 3 + j]];
+				}
+
+				bool isValid = groups[0] != (UINT32)-1 && groups[1] != (UINT32)-1 && groups[2] != (UINT32)-1 &&
+					groups[0] != groups[1] && groups[1] != groups[2] && groups[0] != groups[2];
+
+				mFaceLive[i] = isValid;
+				if (!isValid)
+					continue;
+
+				mNumLiveFaces++;
+
+				const Vector3& p0 = mGroupPositions[groups[0]];
+				const Vector3& p1 = mGroupPositions[groups[1]];
+				const Vector3& p2 = mGroupPositions[groups[2]];
+
+				Vector3 normal = Vector3::cross(p1 - p0, p2 - p0);
+				float length = normal.length();
+				if (length > 0.0f)
+				{
+					normal /= length;
+
+					// Weigh the planes by triangle area so that small triangles don't dominate the error
+					float d = -normal.dot(p0);
+					for (UINT32 j = 0; j < 3; j++)
+						mQuadrics[groups[j]].addPlane(normal, d, length * 0.5f);
+				}
+
+				for (UINT32 j = 0; j < 3; j++)
+				{
+					UINT64 a = groups[j];
+					UINT64 b = groups[(j + 1) % 3];
+					edges.push_back(a < b ? ((a << 32) | b) : ((b << 32) | a));
+				}
+			}
+
+			// Edges referenced by only a single triangle are on an open border
+			std::sort(edges.begin(), edges.end());
+			for (UINT32 i = 0; i < (UINT32)edges.size();)
+			{
+				UINT32 end = i + 1;
+				while (end < (UINT32)edges.size() && edges[end] == edges[i])
+					end++;
+
+				if (end - i == 1)
+				{
+					mLocked[(UINT32)(edges[i] >> 32)] = true;
+					mLocked[(UINT32)(edges[i] & 0xFFFFFFFF)] = true;
+				}
+
+				i = end;
+			}
+		}
+
+		/** Builds a list of live triangles referencing each group. */
+		void buildGroupFaces()
+		{
+			mGroupFaceStarts.assign(mNumGroups + 1, 0);
+			for (UINT32 i = 0; i < mNumFaces; i++)
+			{
+				if (!mFaceLive[i])
+					continue;
+
+				for (UINT32 j = 0; j < 3; j++)
+					mGroupFaceStarts[mVertexGroups[mIndices[i * 3 + j]] + 1]++;
+			}
+
+			for (UINT32 i = 0; i < mNumGroups; i++)
+				mGroupFaceStarts[i + 1] += mGroupFaceStarts[i];
+
+			mGroupFaces.resize(mGroupFaceStarts[mNumGroups]);
+			Vector<UINT32> offsets(mGroupFaceStarts.begin(), mGroupFaceStarts.end() - 1);
+			for (UINT32 i = 0; i < mNumFaces; i++)
+			{
+				if (!mFaceLive[i])
+					continue;
+
+				for (UINT32 j = 0; j < 3; j++)
+					mGroupFaces[offsets[mVertexGroups[mIndices[i * 3 + j]]]++] = i;
+			}
+		}
+
+		/** Records the cost of collapsing group @p from onto group @p to, if it is the cheapest one found so far. */
+		void evaluateCollapse(UINT32 from, UINT32 to, Vector<float>& bestCost, Vector<UINT32>& bestTarget) const
+		{
+			if (mLocked[from])
+				return;
+
+			Quadric quadric = mQuadrics[from];
+			quadric += mQuadrics[to];
+
+			float cost = quadric.evaluate(mGroupPositions[to]);
+			if (cost < bestCost[from])
+			{
+				bestCost[from] = cost;
+				bestTarget[from] = to;
+			}
+		}
+
+		/** 
+		 * Attempts to collapse group @p from onto group @p to. Returns false if the collapse would flip a triangle or
+		 * smear vertex attributes across a seam. 
+		 */
+		bool collapse(UINT32 from, UINT32 to)
+		{
+			// Each vertex in the source group must map to a vertex in the target group it shares an edge with
+			mWedgeMap.clear();
+			for (UINT32 i = mGroupFaceStarts[from]; i < mGroupFaceStarts[from + 1]; i++)
+			{
+				UINT32 faceIdx = mGroupFaces[i];
+				if (!mFaceLive[faceIdx])
+					continue;
+
+				UINT32 fromVertex = (UINT32)-1;
+				UINT32 toVertex = (UINT32)-1;
+				for (UINT32 j = 0; j < 3; j++)
+				{
+					UINT32 vertexIdx = mIndices[faceIdx * 3 + j];
+					if (mVertexGroups[vertexIdx] == from)
+						fromVertex = vertexIdx;
+					else if (mVertexGroups[vertexIdx] == to)
+						toVertex = vertexIdx;
+				}
+
+				if (toVertex == (UINT32)-1)
+					continue;
+
+				UINT32 mappedVertex = findWedge(fromVertex);
+				if (mappedVertex == (UINT32)-1)
+					mWedgeMap.push_back(std::make_pair(fromVertex, toVertex));
+				else if (mappedVertex != toVertex)
+					return false;
+			}
+
+			// Make sure no triangles flip or degenerate
+			const Vector3& target = mGroupPositions[to];
+			for (UINT32 i = mGroupFaceStarts[from]; i < mGroupFaceStarts[from + 1]; i++)
+			{
+				UINT32 faceIdx = mGroupFaces[i];
+				if (!mFaceLive[faceIdx])
+					continue;
+
+				Vector3 positions[3];
+				Vector3 newPositions[3];
+				bool isRemoved = false;
+
+				for (UINT32 j = 0; j < 3; j++)
+				{
+					UINT32 vertexIdx = mIndices[faceIdx * 3 + j];
+					UINT32 groupIdx = mVertexGroups[vertexIdx];
+
+					if (groupIdx == to)
+						isRemoved = true;
+					else if (groupIdx == from && findWedge(vertexIdx) == (UINT32)-1)
+						return false;
+
+					positions[j] = mGroupPositions[groupIdx];
+					newPositions[j] = groupIdx == from ? target : positions[j];
+				}
+
+				if (isRemoved)
+					continue;
+
+				Vector3 oldNormal = Vector3::cross(positions[1] - positions[0], positions[2] - positions[0]);
+				Vector3 newNormal = Vector3::cross(newPositions[1] - newPositions[0], newPositions[2] - newPositions[0]);
+
+				float oldLength = oldNormal.length();
+				float newLength = newNormal.length();
+				if (newLength <= 0.0f || oldNormal.dot(newNormal) < 0.25f * oldLength * newLength)
+					return false;
+			}
+
+			// Apply the collapse
+			for (UINT32 i = mGroupFaceStarts[from]; i < mGroupFaceStarts[from + 1]; i++)
+			{
+				UINT32 faceIdx = mGroupFaces[i];
+				if (!mFaceLive[faceIdx])
+					continue;
+
+				bool isRemoved = false;
+				for (UINT32 j = 0; j < 3; j++)
+				{
+					if (mVertexGroups[mIndices[faceIdx * 3 + j]] == to)
+						isRemoved = true;
+				}
+
+				if (isRemoved)
+				{
+					mFaceLive[faceIdx] = false;
+					mNumLiveFaces--;
+					continue;
+				}
+
+				for (UINT32 j = 0; j < 3; j++)
+				{
+					UINT32& vertexIdx = mIndices[faceIdx * 3 + j];
+					if (mVertexGroups[vertexIdx] == from)
+						vertexIdx = findWedge(vertexIdx);
+				}
+			}
+
+			mQuadrics[to] += mQuadrics[from];
+			return true;
+		}
+
+		/** Returns the target vertex the provided vertex maps to in the current collapse, or -1 if none. */
+		UINT32 findWedge(UINT32 vertexIdx) const
+		{
+			for (auto& entry : mWedgeMap)
+			{
+				if (entry.first == vertexIdx)
+					return entry.second;
+			}
+
+			return (UINT32)-1;
+		}
+
+		Vector3* mVertices;
+		UINT32 mNumVertices;
+		UINT32 mNumFaces;
+		UINT32 mNumLiveFaces;
+		UINT32 mNumGroups = 0;
+
+		Vector<UINT32> mIndices;
+		Vector<bool> mFaceLive;
+
+		Vector<UINT32> mVertexGroups;
+		Vector<UINT32> mGroupVertices;
+		Vector<UINT32> mGroupStarts;
+		Vector<Vector3> mGroupPositions;
+		Vector<Quadric> mQuadrics;
+		Vector<bool> mLocked;
+
+		Vector<UINT32> mGroupFaceStarts;
+		Vector<UINT32> mGroupFaces;
+		Vector<std::pair<UINT32, UINT32>> mWedgeMap;
+	};
+
 	void MeshUtility::calculateNormals(Vector3* vertices, UINT8* indices, UINT32 numVertices,
 		UINT32 numIndices, Vector3* normals, UINT32 indexSize)
 	{
@@ -929,4 +1428,544 @@ namespace bs
 			ptr += stride;
 		}
 	}
+
+	UINT32 MeshUtility::simplify(Vector3* vertices, UINT8* indices, UINT32 numVertices, UINT32 numIndices, 
+		UINT32 targetNumIndices, UINT8* outIndices, UINT32 indexSize)
+	{
+		MeshSimplifier simplifier(vertices, indices, numVertices, numIndices, indexSize);
+		simplifier.simplify(targetNumIndices / 3);
+
+		return simplifier.writeIndices(outIndices, indexSize);
+	}
+
+	SPtr<MeshData> MeshUtility::generateLODs(const SPtr<MeshData>& meshData, const Vector<SubMesh>& subMeshes, 
+		UINT32 numLODs, float reduction, Vector<SubMesh>& lodSubMeshes, Vector<float>& lodScreenSizes)
+	{
+		// Screen size at which the full detail mesh stops being used. Lower levels scale from this value so that 
+		// triangle density on screen stays roughly constant.
+		static const float FULL_DETAIL_SCREEN_SIZE = 0.5f;
+
+		// If a level doesn't remove at least this fraction of triangles from the previous one, stop generating levels
+		static const float MIN_LEVEL_REDUCTION = 0.05f;
+
+		lodSubMeshes.clear();
+		lodScreenSizes.clear();
+
+		if (meshData == nullptr || numLODs <= 1 || subMeshes.empty())
+			return meshData;
+
+		SPtr<VertexDataDesc> vertexDesc = meshData->getVertexDesc();
+		if (!vertexDesc->hasElement(VES_POSITION))
+			return meshData;
+
+		reduction = Math::clamp(reduction, 0.01f, 0.99f);
+
+		UINT32 numVertices = meshData->getNumVertices();
+		UINT32 numIndices = meshData->getNumIndices();
+		UINT32 indexSize = meshData->getIndexElementSize();
+
+		UINT8* indices;
+		if (meshData->getIndexType() == IT_32BIT)
+			indices = (UINT8*)meshData->getIndices32();
+		else
+			indices = (UINT8*)meshData->getIndices16();
+
+		Vector<Vector3> positions(numVertices);
+		VertexElemIter<Vector3> posIter = meshData->getVec3DataIter(VES_POSITION);
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			positions[i] = posIter.getValue();
+			posIter.moveNext();
+		}
+
+		UINT32 totalNumIndices = 0;
+		for (auto& subMesh : subMeshes)
+			totalNumIndices += subMesh.indexCount;
+
+		if (totalNumIndices == 0)
+			return meshData;
+
+		// Each level is simplified from the previous one
+		Vector<UINT8> lodIndices;
+		Vector<SubMesh> prevSubMeshes = subMeshes;
+		UINT32 prevNumIndices = totalNumIndices;
+		float ratio = 1.0f;
+
+		for (UINT32 i = 1; i < numLODs; i++)
+		{
+			ratio *= reduction;
+
+			UINT32 levelStart = (UINT32)lodIndices.size();
+			Vector<SubMesh> levelSubMeshes;
+			UINT32 levelNumIndices = 0;
+
+			for (UINT32 j = 0; j < (UINT32)subMeshes.size(); j++)
+			{
+				const SubMesh& prevSubMesh = prevSubMeshes[j];
+
+				UINT32 offset = (UINT32)lodIndices.size();
+				lodIndices.resize(offset + prevSubMesh.indexCount * indexSize);
+
+				// Note: Must be retrieved after the resize above, as it can reallocate the buffer the previous level is in
+				UINT8* srcIndices;
+				if (i == 1)
+					srcIndices = indices + prevSubMesh.indexOffset * indexSize;
+				else
+					srcIndices = lodIndices.data() + (prevSubMesh.indexOffset - numIndices) * indexSize;
+
+				UINT32 numWritten;
+				if (prevSubMesh.drawOp == DOT_TRIANGLE_LIST)
+				{
+					UINT32 target = (UINT32)(subMeshes[j].indexCount * ratio) / 3 * 3;
+					target = std::max(target, 3U);
+
+					numWritten = simplify(positions.data(), srcIndices, numVertices, prevSubMesh.indexCount, target, 
+						lodIndices.data() + offset, indexSize);
+				}
+				else
+				{
+					memcpy(lodIndices.data() + offset, srcIndices, prevSubMesh.indexCount * indexSize);
+					numWritten = prevSubMesh.indexCount;
+				}
+
+				lodIndices.resize(offset + numWritten * indexSize);
+				levelSubMeshes.push_back(SubMesh(numIndices + offset / indexSize, numWritten, prevSubMesh.drawOp));
+				levelNumIndices += numWritten;
+			}
+
+			if (levelNumIndices > prevNumIndices * (1.0f - MIN_LEVEL_REDUCTION))
+			{
+				lodIndices.resize(levelStart);
+				break;
+			}
+
+			float keptRatio = levelNumIndices / (float)totalNumIndices;
+			lodScreenSizes.push_back(FULL_DETAIL_SCREEN_SIZE * std::sqrt(keptRatio));
+			lodSubMeshes.insert(lodSubMeshes.end(), levelSubMeshes.begin(), levelSubMeshes.end());
+
+			prevSubMeshes = levelSubMeshes;
+			prevNumIndices = levelNumIndices;
+		}
+
+		if (lodScreenSizes.empty())
+			return meshData;
+
+		// Copy the original data and append the new indices after the original ones
+		UINT32 numLODIndices = (UINT32)lodIndices.size() / indexSize;
+		SPtr<MeshData> output = MeshData::create(numVertices, numIndices + numLODIndices, vertexDesc, 
+			meshData->getIndexType());
+
+		UINT8* srcData = meshData->getData();
+		UINT8* dstData = output->getData();
+		UINT32 vertexDataSize = vertexDesc->getVertexStride() * numVertices;
+
+		memcpy(dstData, srcData, numIndices * indexSize);
+		memcpy(dstData + numIndices * indexSize, lodIndices.data(), lodIndices.size());
+		memcpy(dstData + (numIndices + numLODIndices) * indexSize, srcData + numIndices * indexSize, vertexDataSize);
+
+		return output;
+	}
+
+	void MeshUtility::optimizeVertexCache(UINT8* indices, UINT32 numIndices, UINT32 numVertices, UINT32 indexSize)
+	{
+		static const UINT32 CACHE_SIZE = 32;
+
+		UINT32 numFaces = numIndices / 3;
+		if (numFaces == 0)
+			return;
+
+		Vector<UINT32> faceIndices(numFaces * 3);
+		for (UINT32 i = 0; i < numFaces * 3; i++)
+		{
+			faceIndices[i] = readIndex(indices, i, indexSize);
+			assert(faceIndices[i] < numVertices);
+		}
+
+		// Build a list of faces referencing each vertex
+		Vector<UINT32> vertexFaceStarts(numVertices + 1, 0);
+		for (auto& vertexIdx : faceIndices)
+			vertexFaceStarts[vertexIdx + 1]++;
+
+		for (UINT32 i = 0; i < numVertices; i++)
+			vertexFaceStarts[i + 1] += vertexFaceStarts[i];
+
+		Vector<UINT32> vertexFaces(numFaces * 3);
+		Vector<UINT32> offsets(vertexFaceStarts.begin(), vertexFaceStarts.end() - 1);
+		for (UINT32 i = 0; i < numFaces * 3; i++)
+			vertexFaces[offsets[faceIndices[i]]++] = i / 3;
+
+		// Calculate initial scores
+		Vector<UINT32> numRemainingFaces(numVertices);
+		Vector<INT32> cachePositions(numVertices, -1);
+		Vector<float> vertexScores(numVertices);
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			numRemainingFaces[i] = vertexFaceStarts[i + 1] - vertexFaceStarts[i];
+			vertexScores[i] = getVertexCacheScore(-1, numRemainingFaces[i], CACHE_SIZE);
+		}
+
+		Vector<bool> isEmitted(numFaces, false);
+		INT32 bestFace = 0;
+		float bestScore = -1.0f;
+		for (UINT32 i = 0; i < numFaces; i++)
+		{
+			float score = vertexScores[faceIndices[i * 3 + 0]] + vertexScores[faceIndices[i * 3 + 1]] + 
+				vertexScores[faceIndices[i * 3 + 2]];
+
+			if (score > bestScore)
+			{
+				bestScore = score;
+				bestFace = (INT32)i;
+			}
+		}
+
+		UINT32 cache[CACHE_SIZE + 3];
+		UINT32 newCache[CACHE_SIZE + 3];
+		UINT32 cacheCount = 0;
+		UINT32 nextFace = 0;
+
+		for (UINT32 i = 0; i < numFaces; i++)
+		{
+			// If none of the cached vertices have any triangles left, continue with the first unprocessed triangle
+			if (bestFace == -1)
+			{
+				while (isEmitted[nextFace])
+					nextFace++;
+
+				bestFace = (INT32)nextFace;
+			}
+
+			UINT32 faceIdx = (UINT32)bestFace;
+			isEmitted[faceIdx] = true;
+
+			// Move the triangle's vertices to the front of the cache
+			UINT32 newCount = 0;
+			for (UINT32 j = 0; j < 3; j++)
+			{
+				UINT32 vertexIdx = faceIndices[faceIdx * 3 + j];
+				writeIndex(indices, i * 3 + j, vertexIdx, indexSize);
+
+				numRemainingFaces[vertexIdx]--;
+
+				if (std::find(newCache, newCache + newCount, vertexIdx) == newCache + newCount)
+					newCache[newCount++] = vertexIdx;
+			}
+
+			// Degenerate triangles add fewer than three unique vertices, so only search the ones actually added
+			UINT32 numTriangleVertices = newCount;
+			for (UINT32 j = 0; j < cacheCount; j++)
+			{
+				UINT32 vertexIdx = cache[j];
+				if (std::find(newCache, newCache + numTriangleVertices, vertexIdx) == newCache + numTriangleVertices)
+					newCache[newCount++] = vertexIdx;
+			}
+
+			// Update scores of all vertices that were in the cache, including the ones that were just evicted
+			for (UINT32 j = 0; j < newCount; j++)
+			{
+				UINT32 vertexIdx = newCache[j];
+				cachePositions[vertexIdx] = j < CACHE_SIZE ? (INT32)j : -1;
+				vertexScores[vertexIdx] = getVertexCacheScore(cachePositions[vertexIdx], numRemainingFaces[vertexIdx], 
+					CACHE_SIZE);
+			}
+
+			// Find the best scoring triangle among the ones using cached vertices
+			bestFace = -1;
+			bestScore = -1.0f;
+			for (UINT32 j = 0; j < newCount; j++)
+			{
+				UINT32 vertexIdx = newCache[j];
+				for (UINT32 k = vertexFaceStarts[vertexIdx]; k < vertexFaceStarts[vertexIdx + 1]; k++)
+				{
+					UINT32 candidateIdx = vertexFaces[k];
+					if (isEmitted[candidateIdx])
+						continue;
+
+					float score = vertexScores[faceIndices[candidateIdx * 3 + 0]] + 
+						vertexScores[faceIndices[candidateIdx * 3 + 1]] + vertexScores[faceIndices[candidateIdx * 3 + 2]];
+
+					if (score > bestScore)
+					{
+						bestScore = score;
+						bestFace = (INT32)candidateIdx;
+					}
+				}
+			}
+
+			cacheCount = std::min(newCount, CACHE_SIZE);
+			memcpy(cache, newCache, cacheCount * sizeof(UINT32));
+		}
+	}
+
+	void MeshUtility::optimizeOverdraw(Vector3* vertices, UINT8* indices, UINT32 numIndices, UINT32 numVertices, 
+		float threshold, UINT32 indexSize)
+	{
+		static const UINT32 CACHE_SIZE = 16;
+
+		UINT32 numFaces = numIndices / 3;
+		if (numFaces < 2)
+			return;
+
+		Vector<UINT32> faceIndices(numFaces * 3);
+		for (UINT32 i = 0; i < numFaces * 3; i++)
+		{
+			faceIndices[i] = readIndex(indices, i, indexSize);
+			assert(faceIndices[i] < numVertices);
+		}
+
+		// Split the triangles into clusters at points where the cache gets fully missed. Those are the points where the 
+		// vertex cache optimizer had to restart, so reordering the clusters has a minimal effect on cache efficiency.
+		Vector<UINT32> clusterStarts;
+		Vector<UINT32> timestamps(numVertices, 0);
+		UINT32 time = CACHE_SIZE + 1;
+
+		for (UINT32 i = 0; i < numFaces; i++)
+		{
+			UINT32 numMisses = 0;
+			for (UINT32 j = 0; j < 3; j++)
+			{
+				UINT32 vertexIdx = faceIndices[i * 3 + j];
+				if (time - timestamps[vertexIdx] > CACHE_SIZE)
+				{
+					timestamps[vertexIdx] = time++;
+					numMisses++;
+				}
+			}
+
+			if (i == 0 || numMisses == 3)
+				clusterStarts.push_back(i);
+		}
+
+		UINT32 numClusters = (UINT32)clusterStarts.size();
+		if (numClusters < 2)
+			return;
+
+		clusterStarts.push_back(numFaces);
+
+		// Calculate area weighted centroid and normal of each cluster, as well as of the entire mesh
+		Vector<Vector3> clusterCentroids(numClusters, Vector3::ZERO);
+		Vector<Vector3> clusterNormals(numClusters, Vector3::ZERO);
+		Vector3 meshCentroid = Vector3::ZERO;
+		float meshArea = 0.0f;
+
+		for (UINT32 i = 0; i < numClusters; i++)
+		{
+			float clusterArea = 0.0f;
+			for (UINT32 j = clusterStarts[i]; j < clusterStarts[i + 1]; j++)
+			{
+				const Vector3& p0 = vertices[faceIndices[j * 3 + 0]];
+				const Vector3& p1 = vertices[faceIndices[j * 3 + 1]];
+				const Vector3& p2 = vertices[faceIndices[j * 3 + 2]];
+
+				Vector3 normal = Vector3::cross(p1 - p0, p2 - p0);
+				float area = normal.length();
+
+				clusterCentroids[i] += (p0 + p1 + p2) * (area / 3.0f);
+				clusterNormals[i] += normal;
+				clusterArea += area;
+			}
+
+			meshCentroid += clusterCentroids[i];
+			meshArea += clusterArea;
+
+			if (clusterArea > 0.0f)
+				clusterCentroids[i] /= clusterArea;
+		}
+
+		if (meshArea > 0.0f)
+			meshCentroid /= meshArea;
+
+		// Clusters facing away from the center are more likely to occlude other clusters, so draw them first
+		Vector<float> sortKeys(numClusters);
+		Vector<UINT32> clusterOrder(numClusters);
+		for (UINT32 i = 0; i < numClusters; i++)
+		{
+			sortKeys[i] = Vector3::normalize(clusterNormals[i]).dot(clusterCentroids[i] - meshCentroid);
+			clusterOrder[i] = i;
+		}
+
+		std::stable_sort(clusterOrder.begin(), clusterOrder.end(), 
+			[&](UINT32 a, UINT32 b) { return sortKeys[a] > sortKeys[b]; });
+
+		Vector<UINT32> sortedIndices;
+		sortedIndices.reserve(numFaces * 3);
+		for (auto& clusterIdx : clusterOrder)
+		{
+			sortedIndices.insert(sortedIndices.end(), faceIndices.begin() + clusterStarts[clusterIdx] * 3, 
+				faceIndices.begin() + clusterStarts[clusterIdx + 1] * 3);
+		}
+
+		// Keep the original order if cache efficiency degrades too much
+		float acmrBefore = calculateACMR((UINT8*)faceIndices.data(), numFaces * 3, numVertices, CACHE_SIZE, sizeof(UINT32));
+		float acmrAfter = calculateACMR((UINT8*)sortedIndices.data(), numFaces * 3, numVertices, CACHE_SIZE, sizeof(UINT32));
+		if (acmrAfter > acmrBefore * threshold)
+			return;
+
+		for (UINT32 i = 0; i < numFaces * 3; i++)
+			writeIndex(indices, i, sortedIndices[i], indexSize);
+	}
+
+	void MeshUtility::optimizeVertexFetch(UINT8* indices, UINT32 numIndices, UINT32 numVertices, UINT32* vertexRemap,
+		UINT32 indexSize)
+	{
+		for (UINT32 i = 0; i < numVertices; i++)
+			vertexRemap[i] = (UINT32)-1;
+
+		UINT32 nextVertex = 0;
+		for (UINT32 i = 0; i < numIndices; i++)
+		{
+			UINT32 vertexIdx = readIndex(indices, i, indexSize);
+			if (vertexIdx >= numVertices)
+				continue;
+
+			if (vertexRemap[vertexIdx] == (UINT32)-1)
+				vertexRemap[vertexIdx] = nextVertex++;
+
+			writeIndex(indices, i, vertexRemap[vertexIdx], indexSize);
+		}
+
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			if (vertexRemap[i] == (UINT32)-1)
+				vertexRemap[i] = nextVertex++;
+		}
+	}
+
+	float MeshUtility::calculateACMR(UINT8* indices, UINT32 numIndices, UINT32 numVertices, UINT32 cacheSize, 
+		UINT32 indexSize)
+	{
+		UINT32 numFaces = numIndices / 3;
+		if (numFaces == 0)
+			return 0.0f;
+
+		// Simulate a FIFO cache by storing the time each vertex entered the cache
+		Vector<UINT32> timestamps(numVertices, 0);
+		UINT32 time = cacheSize + 1;
+		UINT32 numMisses = 0;
+
+		for (UINT32 i = 0; i < numFaces * 3; i++)
+		{
+			UINT32 vertexIdx = readIndex(indices, i, indexSize);
+			if (vertexIdx >= numVertices)
+				continue;
+
+			if (time - timestamps[vertexIdx] > cacheSize)
+			{
+				timestamps[vertexIdx] = time++;
+				numMisses++;
+			}
+		}
+
+		return numMisses / (float)numFaces;
+	}
+
+	MeshOptimizationStats MeshUtility::optimize(const SPtr<MeshData>& meshData, const Vector<SubMesh>& subMeshes, 
+		Vector<UINT32>* vertexRemap)
+	{
+		MeshOptimizationStats stats;
+		if (meshData == nullptr)
+			return stats;
+
+		SPtr<VertexDataDesc> vertexDesc = meshData->getVertexDesc();
+		UINT32 numVertices = meshData->getNumVertices();
+		UINT32 numIndices = meshData->getNumIndices();
+		UINT32 indexSize = meshData->getIndexElementSize();
+
+		if (numVertices == 0 || numIndices == 0)
+			return stats;
+
+		UINT8* indices;
+		if (meshData->getIndexType() == IT_32BIT)
+			indices = (UINT8*)meshData->getIndices32();
+		else
+			indices = (UINT8*)meshData->getIndices16();
+
+		// Reordering can't preserve geometry that references vertices that don't exist, so leave such meshes as they are
+		for (UINT32 i = 0; i < numIndices; i++)
+		{
+			if (readIndex(indices, i, indexSize) >= numVertices)
+			{
+				LOGWRN("Skipping mesh optimization. Index " + toString(i) + " references a vertex out of range. Vertex "
+					"count: " + toString(numVertices) + ".");
+				return stats;
+			}
+		}
+
+		Vector<Vector3> positions;
+		if (vertexDesc->hasElement(VES_POSITION))
+		{
+			positions.resize(numVertices);
+
+			VertexElemIter<Vector3> posIter = meshData->getVec3DataIter(VES_POSITION);
+			for (UINT32 i = 0; i < numVertices; i++)
+			{
+				positions[i] = posIter.getValue();
+				posIter.moveNext();
+			}
+		}
+
+		// Reorder triangles within each sub-mesh
+		float numMissesBefore = 0.0f;
+		float numMissesAfter = 0.0f;
+		UINT32 numFaces = 0;
+
+		for (auto& subMesh : subMeshes)
+		{
+			if (subMesh.drawOp != DOT_TRIANGLE_LIST || subMesh.indexCount < 3)
+				continue;
+
+			if ((subMesh.indexOffset + subMesh.indexCount) > numIndices)
+				continue;
+
+			UINT8* subMeshIndices = indices + subMesh.indexOffset * indexSize;
+			UINT32 numSubMeshFaces = subMesh.indexCount / 3;
+
+			numMissesBefore += calculateACMR(subMeshIndices, subMesh.indexCount, numVertices, 16, indexSize) * numSubMeshFaces;
+
+			optimizeVertexCache(subMeshIndices, subMesh.indexCount, numVertices, indexSize);
+
+			if (!positions.empty())
+				optimizeOverdraw(positions.data(), subMeshIndices, subMesh.indexCount, numVertices, 1.05f, indexSize);
+
+			numMissesAfter += calculateACMR(subMeshIndices, subMesh.indexCount, numVertices, 16, indexSize) * numSubMeshFaces;
+			numFaces += numSubMeshFaces;
+		}
+
+		if (numFaces > 0)
+		{
+			stats.acmrBefore = numMissesBefore / numFaces;
+			stats.acmrAfter = numMissesAfter / numFaces;
+		}
+
+		stats.optimized = true;
+
+		// Reorder vertices in the order they are first referenced by the triangles
+		Vector<UINT32> remap(numVertices);
+		optimizeVertexFetch(indices, numIndices, numVertices, remap.data(), indexSize);
+
+		UINT8* vertexData = meshData->getData() + numIndices * indexSize;
+		Vector<UINT8> streamCopy;
+
+		UINT32 numStreams = 0;
+		for (UINT32 i = 0; i < vertexDesc->getNumElements(); i++)
+			numStreams = std::max(numStreams, (UINT32)vertexDesc->getElement(i).getStreamIdx() + 1);
+
+		for (UINT32 i = 0; i < numStreams; i++)
+		{
+			UINT32 stride = vertexDesc->getVertexStride(i);
+			if (stride == 0)
+				continue;
+
+			UINT8* streamData = vertexData + vertexDesc->getStreamOffset(i) * numVertices;
+			streamCopy.assign(streamData, streamData + stride * numVertices);
+
+			for (UINT32 j = 0; j < numVertices; j++)
+				memcpy(streamData + remap[j] * stride, streamCopy.data() + j * stride, stride);
+		}
+
+		if (vertexRemap != nullptr)
+			*vertexRemap = remap;
+
+		return stats;
+	}
 }
\ No newline at end of file
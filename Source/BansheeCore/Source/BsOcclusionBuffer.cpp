@@ -0,0 +1,428 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsOcclusionBuffer.h"
+#include "BsMeshData.h"
+#include "BsVertexDataDesc.h"
+#include "BsVector4.h"
+#include "BsMath.h"
+#include "BsTaskScheduler.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define BS_OCCLUSION_SSE2 1
+	#include <emmintrin.h>
+#else
+	#define BS_OCCLUSION_SSE2 0
+#endif
+
+namespace bs
+{
+	/** Vertices with clip space W smaller than this are considered to be behind the near plane. */
+	static const float NEAR_W_EPSILON = 1e-4f;
+
+	/** Minimum number of rows a worker thread should rasterize. */
+	static const UINT32 MIN_ROWS_PER_TASK = 16;
+
+	/** Minimum number of objects a worker thread should test for visibility. */
+	static const UINT32 MIN_TESTS_PER_TASK = 256;
+
+	/**
+	 * Tolerance when testing if a pixel is fully inside a triangle, as a barycentric coordinate. Ensures pixels whose
+	 * border lies exactly on a triangle edge aren't missed due to rounding errors.
+	 */
+	static const float EDGE_EPSILON = 1e-5f;
+
+	/** Depth of pixels not covered by any occluder. */
+	static const float EMPTY_DEPTH = std::numeric_limits<float>::max();
+
+	/** Maximum size of a bounds footprint, in texels, at the hierarchical depth level used for testing it. */
+	static const UINT32 MAX_TEST_FOOTPRINT = 4;
+
+	SPtr<OccluderGeometry> OccluderGeometry::create(MeshData& meshData)
+	{
+		if (!meshData.getVertexDesc()->hasElement(VES_POSITION) || meshData.getNumIndices() < 3)
+			return nullptr;
+
+		SPtr<OccluderGeometry> geometry = bs_shared_ptr_new<OccluderGeometry>();
+
+		UINT32 numVertices = meshData.getNumVertices();
+		geometry->positions.resize(numVertices);
+
+		VertexElemIter<Vector3> posIter = meshData.getVec3DataIter(VES_POSITION);
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			geometry->positions[i] = posIter.getValue();
+			posIter.moveNext();
+		}
+
+		UINT32 numIndices = meshData.getNumIndices() - (meshData.getNumIndices() % 3);
+		geometry->indices.resize(numIndices);
+
+		if (meshData.getIndexType() == IT_16BIT)
+		{
+			UINT16* indices = meshData.getIndices16();
+			for (UINT32 i = 0; i < numIndices; i++)
+				geometry->indices[i] = indices[i];
+		}
+		else
+		{
+			UINT32* indices = meshData.getIndices32();
+			memcpy(geometry->indices.data(), indices, numIndices * sizeof(UINT32));
+		}
+
+		return geometry;
+	}
+
+	OcclusionBuffer::OcclusionBuffer(UINT32 width, UINT32 height)
+		:mWidth(std::max(4U, (width + 3) & ~3U)), mHeight(std::max(1U, height)), mViewProj(Matrix4::IDENTITY)
+	{
+		mDepth.resize(mWidth * mHeight, EMPTY_DEPTH);
+
+		UINT32 levelWidth = mWidth;
+		UINT32 levelHeight = mHeight;
+
+		// Level 0 is the full resolution buffer, its data is stored in mDepth
+		mHiZ.push_back(DepthLevel());
+		mHiZ.back().width = mWidth;
+		mHiZ.back().height = mHeight;
+
+		while (levelWidth > 1 || levelHeight > 1)
+		{
+			levelWidth = std::max(1U, levelWidth / 2);
+			levelHeight = std::max(1U, levelHeight / 2);
+
+			mHiZ.push_back(DepthLevel());
+			mHiZ.back().width = levelWidth;
+			mHiZ.back().height = levelHeight;
+			mHiZ.back().depth.resize(levelWidth * levelHeight, EMPTY_DEPTH);
+		}
+	}
+
+	void OcclusionBuffer::clear(const Matrix4& viewProj)
+	{
+		mViewProj = viewProj;
+		mTriangles.clear();
+	}
+
+	void OcclusionBuffer::addOccluder(const OccluderGeometry& geometry, const Matrix4& worldTfrm)
+	{
+		Matrix4 worldViewProj = mViewProj * worldTfrm;
+
+		UINT32 numVertices = (UINT32)geometry.positions.size();
+		Vector4* clipPositions = bs_stack_alloc<Vector4>(numVertices);
+
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			const Vector3& position = geometry.positions[i];
+			clipPositions[i] = worldViewProj.multiply(Vector4(position.x, position.y, position.z, 1.0f));
+		}
+
+		float halfWidth = mWidth * 0.5f;
+		float halfHeight = mHeight * 0.5f;
+
+		UINT32 numIndices = (UINT32)geometry.indices.size();
+		for (UINT32 i = 0; i + 2 < numIndices; i += 3)
+		{
+			Triangle triangle;
+			bool clipped = false;
+			for (UINT32 j = 0; j < 3; j++)
+			{
+				UINT32 index = geometry.indices[i + j];
+				if (index >= numVertices)
+				{
+					clipped = true;
+					break;
+				}
+
+				const Vector4& clipPos = clipPositions[index];
+
+				// Occluders are allowed to under-cover the screen, so simply drop any triangle crossing the near plane
+				if (clipPos.w < NEAR_W_EPSILON)
+				{
+					clipped = true;
+					break;
+				}
+
+				float invW = 1.0f / clipPos.w;
+				triangle.v[j].x = (clipPos.x * invW + 1.0f) * halfWidth;
+				triangle.v[j].y = (1.0f - clipPos.y * invW) * halfHeight;
+				triangle.v[j].z = clipPos.z * invW;
+			}
+
+			if (clipped)
+				continue;
+
+			triangle.minY = std::min(triangle.v[0].y, std::min(triangle.v[1].y, triangle.v[2].y));
+			triangle.maxY = std::max(triangle.v[0].y, std::max(triangle.v[1].y, triangle.v[2].y));
+
+			float minX = std::min(triangle.v[0].x, std::min(triangle.v[1].x, triangle.v[2].x));
+			float maxX = std::max(triangle.v[0].x, std::max(triangle.v[1].x, triangle.v[2].x));
+
+			if (maxX < 0.0f || minX > (float)mWidth || triangle.maxY < 0.0f || triangle.minY > (float)mHeight)
+				continue;
+
+			mTriangles.push_back(triangle);
+		}
+
+		bs_stack_free(clipPositions);
+	}
+
+	void OcclusionBuffer::rasterize()
+	{
+		std::fill(mDepth.begin(), mDepth.end(), EMPTY_DEPTH);
+
+		// Each task owns a band of rows, so no synchronization is needed when writing depth
+		TaskScheduler::parallelFor("Occlusion", mHeight, MIN_ROWS_PER_TASK, 
+			[this](UINT32, UINT32 startRow, UINT32 endRow) { rasterizeRows(startRow, endRow); });
+
+		buildHiZ();
+	}
+
+	void OcclusionBuffer::rasterizeRows(UINT32 startRow, UINT32 endRow)
+	{
+		for (auto& triangle : mTriangles)
+		{
+			if (triangle.maxY < (float)startRow || triangle.minY >= (float)endRow)
+				continue;
+
+			rasterizeTriangle(triangle, startRow, endRow);
+		}
+	}
+
+	void OcclusionBuffer::rasterizeTriangle(const Triangle& triangle, UINT32 startRow, UINT32 endRow)
+	{
+		const Vector3& v0 = triangle.v[0];
+		const Vector3& v1 = triangle.v[1];
+		const Vector3& v2 = triangle.v[2];
+
+		float area = (v1.x - v0.x) * (v2.y - v0.y) - (v1.y - v0.y) * (v2.x - v0.x);
+		if (Math::abs(area) < 1e-8f)
+			return;
+
+		// Occluders are rasterized regardless of winding, so flip the edges of back facing triangles
+		float sign = area > 0.0f ? 1.0f : -1.0f;
+		float invArea = 1.0f / Math::abs(area);
+
+		// Edge functions in form E(x, y) = A * x + B * y + C, normalized so they equal the barycentric coordinate of the
+		// vertex opposite to the edge. Edge i is opposite vertex i.
+		float edgeA[3], edgeB[3], edgeC[3];
+		const Vector3* verts[3] = { &v0, &v1, &v2 };
+		for (UINT32 i = 0; i < 3; i++)
+		{
+			const Vector3& a = *verts[(i + 1) % 3];
+			const Vector3& b = *verts[(i + 2) % 3];
+
+			edgeA[i] = -(b.y - a.y) * sign * invArea;
+			edgeB[i] = (b.x - a.x) * sign * invArea;
+			edgeC[i] = ((b.y - a.y) * a.x - (b.x - a.x) * a.y) * sign * invArea;
+		}
+
+		// Depth is linear in screen space: Z(x, y) = zA * x + zB * y + zC
+		float zA = edgeA[0] * v0.z + edgeA[1] * v1.z + edgeA[2] * v2.z;
+		float zB = edgeB[0] * v0.z + edgeB[1] * v1.z + edgeB[2] * v2.z;
+		float zC = edgeC[0] * v0.z + edgeC[1] * v1.z + edgeC[2] * v2.z;
+
+		// Edge functions and depth are evaluated at pixel centers. Offset them by their largest change within half a pixel,
+		// so a pixel only passes the edge tests if all of it is inside the triangle, and receives the farthest depth of the
+		// triangle within it. Pixels only partially covered by an occluder must not hide objects behind their uncovered
+		// part.
+		for (UINT32 i = 0; i < 3; i++)
+			edgeC[i] -= 0.5f * (Math::abs(edgeA[i]) + Math::abs(edgeB[i]));
+
+		zC += 0.5f * (Math::abs(zA) + Math::abs(zB));
+
+		float minX = std::min(v0.x, std::min(v1.x, v2.x));
+		float maxX = std::max(v0.x, std::max(v1.x, v2.x));
+
+		INT32 firstX = std::max(0, Math::floorToInt(minX)) & ~3;
+		INT32 lastX = std::min((INT32)mWidth - 1, Math::ceilToInt(maxX));
+		INT32 firstY = std::max((INT32)startRow, Math::floorToInt(triangle.minY));
+		INT32 lastY = std::min((INT32)endRow - 1, Math::ceilToInt(triangle.maxY));
+
+		for (INT32 y = firstY; y <= lastY; y++)
+		{
+			float py = y + 0.5f;
+			float* row = &mDepth[y * mWidth];
+
+			// Pixels are processed in groups of four, aligned to a multiple of four so the group never leaves the row
+#if BS_OCCLUSION_SSE2
+			const __m128 minEdge = _mm_set1_ps(-EDGE_EPSILON);
+			const __m128 offsets = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+
+			__m128 rowEdge0 = _mm_set1_ps(edgeB[0] * py + edgeC[0]);
+			__m128 rowEdge1 = _mm_set1_ps(edgeB[1] * py + edgeC[1]);
+			__m128 rowEdge2 = _mm_set1_ps(edgeB[2] * py + edgeC[2]);
+			__m128 rowDepth = _mm_set1_ps(zB * py + zC);
+
+			__m128 stepEdge0 = _mm_set1_ps(edgeA[0]);
+			__m128 stepEdge1 = _mm_set1_ps(edgeA[1]);
+			__m128 stepEdge2 = _mm_set1_ps(edgeA[2]);
+			__m128 stepDepth = _mm_set1_ps(zA);
+
+			for (INT32 x = firstX; x <= lastX; x += 4)
+			{
+				__m128 px = _mm_add_ps(_mm_set1_ps((float)x), offsets);
+
+				__m128 e0 = _mm_add_ps(_mm_mul_ps(stepEdge0, px), rowEdge0);
+				__m128 e1 = _mm_add_ps(_mm_mul_ps(stepEdge1, px), rowEdge1);
+				__m128 e2 = _mm_add_ps(_mm_mul_ps(stepEdge2, px), rowEdge2);
+
+				__m128 inside = _mm_and_ps(_mm_cmpge_ps(e0, minEdge),
+					_mm_and_ps(_mm_cmpge_ps(e1, minEdge), _mm_cmpge_ps(e2, minEdge)));
+				if (_mm_movemask_ps(inside) == 0)
+					continue;
+
+				__m128 depth = _mm_add_ps(_mm_mul_ps(stepDepth, px), rowDepth);
+				__m128 oldDepth = _mm_loadu_ps(row + x);
+				__m128 newDepth = _mm_min_ps(oldDepth, depth);
+
+				_mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, newDepth), _mm_andnot_ps(inside, oldDepth)));
+			}
+#else
+			for (INT32 x = firstX; x <= lastX; x += 4)
+			{
+				for (INT32 i = 0; i < 4; i++)
+				{
+					float px = x + i + 0.5f;
+
+					float e0 = edgeA[0] * px + edgeB[0] * py + edgeC[0];
+					float e1 = edgeA[1] * px + edgeB[1] * py + edgeC[1];
+					float e2 = edgeA[2] * px + edgeB[2] * py + edgeC[2];
+
+					if (e0 < -EDGE_EPSILON || e1 < -EDGE_EPSILON || e2 < -EDGE_EPSILON)
+						continue;
+
+					float depth = zA * px + zB * py + zC;
+					row[x + i] = std::min(row[x + i], depth);
+				}
+			}
+#endif
+		}
+	}
+
+	void OcclusionBuffer::buildHiZ()
+	{
+		for (UINT32 level = 1; level < (UINT32)mHiZ.size(); level++)
+		{
+			const DepthLevel& src = mHiZ[level - 1];
+			DepthLevel& dst = mHiZ[level];
+
+			const float* srcDepth = level == 1 ? mDepth.data() : src.depth.data();
+			for (UINT32 y = 0; y < dst.height; y++)
+			{
+				// Odd sized levels fold their last row/column into the last texel of the next level
+				UINT32 srcY0 = y * 2;
+				UINT32 srcY1 = (y == dst.height - 1) ? src.height : std::min(srcY0 + 2, src.height);
+
+				for (UINT32 x = 0; x < dst.width; x++)
+				{
+					UINT32 srcX0 = x * 2;
+					UINT32 srcX1 = (x == dst.width - 1) ? src.width : std::min(srcX0 + 2, src.width);
+
+					float maxDepth = 0.0f;
+					bool first = true;
+					for (UINT32 srcY = srcY0; srcY < srcY1; srcY++)
+					{
+						for (UINT32 srcX = srcX0; srcX < srcX1; srcX++)
+						{
+							float depth = srcDepth[srcY * src.width + srcX];
+							if (first || depth > maxDepth)
+							{
+								maxDepth = depth;
+								first = false;
+							}
+						}
+					}
+
+					dst.depth[y * dst.width + x] = maxDepth;
+				}
+			}
+		}
+	}
+
+	bool OcclusionBuffer::isVisible(const AABox& bounds) const
+	{
+		float minX = std::numeric_limits<float>::max();
+		float minY = std::numeric_limits<float>::max();
+		float minZ = std::numeric_limits<float>::max();
+		float maxX = -std::numeric_limits<float>::max();
+		float maxY = -std::numeric_limits<float>::max();
+
+		for (UINT32 i = 0; i < 8; i++)
+		{
+			Vector3 corner = bounds.getCorner((AABox::CornerEnum)i);
+			Vector4 clipPos = mViewProj.multiply(Vector4(corner.x, corner.y, corner.z, 1.0f));
+
+			// Bounds crossing the near plane could cover the entire screen
+			if (clipPos.w < NEAR_W_EPSILON)
+				return true;
+
+			float invW = 1.0f / clipPos.w;
+			float x = (clipPos.x * invW + 1.0f) * mWidth * 0.5f;
+			float y = (1.0f - clipPos.y * invW) * mHeight * 0.5f;
+			float z = clipPos.z * invW;
+
+			minX = std::min(minX, x);
+			maxX = std::max(maxX, x);
+			minY = std::min(minY, y);
+			maxY = std::max(maxY, y);
+			minZ = std::min(minZ, z);
+		}
+
+		if (maxX < 0.0f || minX >= (float)mWidth || maxY < 0.0f || minY >= (float)mHeight)
+			return true;
+
+		UINT32 x0 = (UINT32)std::max(0, Math::floorToInt(minX));
+		UINT32 x1 = (UINT32)std::min((INT32)mWidth - 1, Math::floorToInt(maxX));
+		UINT32 y0 = (UINT32)std::max(0, Math::floorToInt(minY));
+		UINT32 y1 = (UINT32)std::min((INT32)mHeight - 1, Math::floorToInt(maxY));
+
+		// Pick the most detailed level at which the footprint covers only a few texels
+		UINT32 level = 0;
+		while (level + 1 < (UINT32)mHiZ.size() &&
+			(((x1 >> level) - (x0 >> level) + 1) > MAX_TEST_FOOTPRINT ||
+			((y1 >> level) - (y0 >> level) + 1) > MAX_TEST_FOOTPRINT))
+		{
+			level++;
+		}
+
+		const DepthLevel& depthLevel = mHiZ[level];
+		const float* depth = level == 0 ? mDepth.data() : depthLevel.depth.data();
+
+		UINT32 levelX0 = std::min(x0 >> level, depthLevel.width - 1);
+		UINT32 levelX1 = std::min(x1 >> level, depthLevel.width - 1);
+		UINT32 levelY0 = std::min(y0 >> level, depthLevel.height - 1);
+		UINT32 levelY1 = std::min(y1 >> level, depthLevel.height - 1);
+
+		for (UINT32 y = levelY0; y <= levelY1; y++)
+		{
+			for (UINT32 x = levelX0; x <= levelX1; x++)
+			{
+				// Visible if any part of the footprint has an occluder farther than the nearest point of the bounds
+				if (depth[y * depthLevel.width + x] >= minZ)
+					return true;
+			}
+		}
+
+		return false;
+	}
+
+	void OcclusionBuffer::isVisible(const Vector<AABox>& bounds, Vector<bool>& visible) const
+	{
+		UINT32 numBounds = (UINT32)bounds.size();
+		visible.resize(numBounds);
+
+		// Note: Vector<bool> is bit-packed, so results are first written into a byte per object to avoid tasks writing
+		// to the same memory location
+		UINT8* results = bs_stack_alloc<UINT8>(std::max(1U, numBounds));
+		TaskScheduler::parallelFor("Occlusion", numBounds, MIN_TESTS_PER_TASK, [&](UINT32, UINT32 start, UINT32 end)
+		{
+			for (UINT32 i = start; i < end; i++)
+				results[i] = isVisible(bounds[i]) ? 1 : 0;
+		});
+
+		for (UINT32 i = 0; i < numBounds; i++)
+			visible[i] = results[i] != 0;
+
+		bs_stack_free(results);
+	}
+}
@@ -5,10 +5,80 @@
 #include "BsColor.h"
 #include "BsMath.h"
 #include "BsException.h"
+#include "BsTaskScheduler.h"
 #include <nvtt.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define BS_PIXEL_SSE2 1
+	#include <emmintrin.h>
+#else
+	#define BS_PIXEL_SSE2 0
+#endif
+
 namespace bs 
 {
+	/** Minimum number of pixels a worker thread should process, below this it's not worth splitting the work. */
+	static const UINT32 MIN_PIXELS_PER_WORKER = 64 * 1024;
+
+	/**
+	 * Executes the provided function over a range of rows. If there are enough pixels to process the rows are split
+	 * into chunks that get processed in parallel, see TaskScheduler::parallelFor().
+	 *
+	 * @param[in]	numRows			Total number of rows to process.
+	 * @param[in]	numRowPixels	Number of pixels in a single row. Used for estimating the amount of work.
+	 * @param[in]	func			Function that processes a range of rows, provided as the first row and the row after 
+	 *								the last one.
+	 */
+	static void processRows(UINT32 numRows, UINT32 numRowPixels, const std::function<void(UINT32, UINT32)>& func)
+	{
+		UINT32 minRowsPerWorker = std::max(1U, MIN_PIXELS_PER_WORKER / std::max(1U, numRowPixels));
+
+		TaskScheduler::parallelFor("PixelRows", numRows, minRowsPerWorker, 
+			[&func](UINT32, UINT32 startRow, UINT32 endRow) { func(startRow, endRow); });
+	}
+
+#if BS_PIXEL_SSE2
+	/** 
+	 * Bilinearly interpolates four 4-channel pixels with one byte per channel, using 12-bit fixed point weights. Produces
+	 * the same results as the scalar path in LinearResampler_Byte.
+	 */
+	static UINT32 lerpByte4SSE2(UINT32 x1y1, UINT32 x2y1, UINT32 x1y2, UINT32 x2y2, UINT32 weightX, UINT32 weightY)
+	{
+		const __m128i zero = _mm_setzero_si128();
+
+		// Interleave the horizontal neighbors so a single multiply-add blends them, for all channels at once
+		__m128i weightsX = _mm_set_epi16(
+			(INT16)weightX, (INT16)(0x1000 - weightX), (INT16)weightX, (INT16)(0x1000 - weightX),
+			(INT16)weightX, (INT16)(0x1000 - weightX), (INT16)weightX, (INT16)(0x1000 - weightX));
+
+		__m128i row1 = _mm_unpacklo_epi8(_mm_unpacklo_epi8(_mm_cvtsi32_si128(x1y1), _mm_cvtsi32_si128(x2y1)), zero);
+		__m128i row2 = _mm_unpacklo_epi8(_mm_unpacklo_epi8(_mm_cvtsi32_si128(x1y2), _mm_cvtsi32_si128(x2y2)), zero);
+
+		row1 = _mm_madd_epi16(row1, weightsX);
+		row2 = _mm_madd_epi16(row2, weightsX);
+
+		// Vertical blend requires a 32-bit multiply, which SSE2 only provides for even lanes
+		__m128i weightY1 = _mm_set1_epi32(0x1000 - weightY);
+		__m128i weightY2 = _mm_set1_epi32(weightY);
+
+		__m128i even = _mm_add_epi32(_mm_mul_epu32(row1, weightY1), _mm_mul_epu32(row2, weightY2));
+		__m128i odd = _mm_add_epi32(
+			_mm_mul_epu32(_mm_srli_si128(row1, 4), weightY1), 
+			_mm_mul_epu32(_mm_srli_si128(row2, 4), weightY2));
+
+		__m128i accum = _mm_unpacklo_epi32(
+			_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), 
+			_mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+
+		// Round up to byte size
+		accum = _mm_srli_epi32(_mm_add_epi32(accum, _mm_set1_epi32(0x800000)), 24);
+		accum = _mm_packs_epi32(accum, accum);
+		accum = _mm_packus_epi16(accum, accum);
+
+		return (UINT32)_mm_cvtsi128_si32(accum);
+	}
+#endif
+
 	/**
 	 * Performs pixel data resampling using the point filter (nearest neighbor). Does not perform format conversions.
 	 *
@@ -156,37 +226,44 @@ namespace bs
 			UINT32 numDestChannels = PixelUtil::getNumElemBytes(dest.getFormat()) / sizeof(float);
 
 			float* sourceData = (float*)source.getData();
-			float* destPtr = (float*)dest.getData();
+			float* destData = (float*)dest.getData();
 
 			// Get steps for traversing source data in 16/48 fixed point precision format
 			UINT64 stepX = ((UINT64)source.getWidth() << 48) / dest.getWidth();
 			UINT64 stepY = ((UINT64)source.getHeight() << 48) / dest.getHeight();
 			UINT64 stepZ = ((UINT64)source.getDepth() << 48) / dest.getDepth();
 
-			// Contains 16/16 fixed point precision format. Most significant
-			// 16 bits will contain the coordinate in the source image, and the
-			// least significant 16 bits will contain the fractional part of the coordinate
-			// that will be used for determining the blend amount.
-			UINT32 temp = 0;
-
-			UINT64 curZ = (stepZ >> 1) - 1; // Offset half a pixel to start at pixel center
-			for (UINT32 z = dest.getFront(); z < dest.getBack(); z++, curZ += stepZ) 
+			// Rows of all slices are processed as a single range so they can be split between worker threads
+			UINT32 destHeight = dest.getHeight();
+			processRows(destHeight * dest.getDepth(), dest.getWidth(), [&](UINT32 startRow, UINT32 endRow)
 			{
-				temp = (UINT32)(curZ >> 32);
-				temp = (temp > 0x8000)? temp - 0x8000 : 0;
-				UINT32 sampleCoordZ1 = temp >> 16;
-				UINT32 sampleCoordZ2 = std::min(sampleCoordZ1 + 1, (UINT32)source.getDepth() - 1);
-				float sampleWeightZ = (temp & 0xFFFF) / 65536.0f;
+				// Contains 16/16 fixed point precision format. Most significant
+				// 16 bits will contain the coordinate in the source image, and the
+				// least significant 16 bits will contain the fractional part of the coordinate
+				// that will be used for determining the blend amount.
+				UINT32 temp = 0;
 
-				UINT64 curY = (stepY >> 1) - 1; // Offset half a pixel to start at pixel center
-				for (UINT32 y = dest.getTop(); y < dest.getBottom(); y++, curY += stepY) 
+				for (UINT32 row = startRow; row < endRow; row++)
 				{
+					UINT32 z = row / destHeight;
+					UINT32 y = row % destHeight;
+
+					UINT64 curZ = (stepZ >> 1) - 1 + stepZ * z; // Offset half a pixel to start at pixel center
+					temp = (UINT32)(curZ >> 32);
+					temp = (temp > 0x8000)? temp - 0x8000 : 0;
+					UINT32 sampleCoordZ1 = temp >> 16;
+					UINT32 sampleCoordZ2 = std::min(sampleCoordZ1 + 1, (UINT32)source.getDepth() - 1);
+					float sampleWeightZ = (temp & 0xFFFF) / 65536.0f;
+
+					UINT64 curY = (stepY >> 1) - 1 + stepY * y; // Offset half a pixel to start at pixel center
 					temp = (UINT32)(curY >> 32);
 					temp = (temp > 0x8000)? temp - 0x8000 : 0;
 					UINT32 sampleCoordY1 = temp >> 16;
 					UINT32 sampleCoordY2 = std::min(sampleCoordY1 + 1, (UINT32)source.getHeight() - 1);
 					float sampleWeightY = (temp & 0xFFFF) / 65536.0f;
 
+					float* destPtr = destData + (y * dest.getRowPitch() + z * dest.getSlicePitch()) * numDestChannels;
+
 					UINT64 curX = (stepX >> 1) - 1; // Offset half a pixel to start at pixel center
 					for (UINT32 x = dest.getLeft(); x < dest.getRight(); x++, curX += stepX) 
 					{
@@ -196,6 +273,33 @@ namespace bs
 						UINT32 sampleCoordX2 = std::min(sampleCoordX1 + 1, (UINT32)source.getWidth() - 1);
 						float sampleWeightX = (temp & 0xFFFF) / 65536.0f;
 
+#if BS_PIXEL_SSE2
+						if (numSourceChannels == 4 && numDestChannels == 4)
+						{
+							// All four channels are blended at once
+							__m128 accum = _mm_setzero_ps();
+
+#define ACCUM4_SSE2(x,y,z,factor) \
+							{ UINT32 offset = (x + y*source.getRowPitch() + z*source.getSlicePitch()) * 4; \
+							accum = _mm_add_ps(accum, _mm_mul_ps(_mm_loadu_ps(sourceData + offset), _mm_set1_ps(factor))); }
+
+							ACCUM4_SSE2(sampleCoordX1, sampleCoordY1, sampleCoordZ1, (1.0f - sampleWeightX) * (1.0f - sampleWeightY) * (1.0f - sampleWeightZ));
+							ACCUM4_SSE2(sampleCoordX2, sampleCoordY1, sampleCoordZ1, sampleWeightX		   * (1.0f - sampleWeightY) * (1.0f - sampleWeightZ));
+							ACCUM4_SSE2(sampleCoordX1, sampleCoordY2, sampleCoordZ1, (1.0f - sampleWeightX) * sampleWeightY			* (1.0f - sampleWeightZ));
+							ACCUM4_SSE2(sampleCoordX2, sampleCoordY2, sampleCoordZ1, sampleWeightX		   * sampleWeightY			* (1.0f - sampleWeightZ));
+							ACCUM4_SSE2(sampleCoordX1, sampleCoordY1, sampleCoordZ2, (1.0f - sampleWeightX) * (1.0f - sampleWeightY) * sampleWeightZ);
+							ACCUM4_SSE2(sampleCoordX2, sampleCoordY1, sampleCoordZ2, sampleWeightX		   * (1.0f - sampleWeightY) * sampleWeightZ);
+							ACCUM4_SSE2(sampleCoordX1, sampleCoordY2, sampleCoordZ2, (1.0f - sampleWeightX) * sampleWeightY			* sampleWeightZ);
+							ACCUM4_SSE2(sampleCoordX2, sampleCoordY2, sampleCoordZ2, sampleWeightX		   * sampleWeightY			* sampleWeightZ);
+
+#undef ACCUM4_SSE2
+
+							_mm_storeu_ps(destPtr, accum);
+							destPtr += 4;
+							continue;
+						}
+#endif
+
 						// process R,G,B,A simultaneously for cache coherence?
 						float accum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
 
@@ -245,12 +349,8 @@ namespace bs
 
 						destPtr += numDestChannels;
 					}
-
-					destPtr += numDestChannels*dest.getRowSkip();
 				}
-
-				destPtr += numDestChannels*dest.getSliceSkip();
-			}
+			});
 		}
 	};
 
@@ -280,55 +380,182 @@ namespace bs
 			}
 
 			UINT8* sourceData = (UINT8*)source.getData();
-			UINT8* destPtr = (UINT8*)dest.getData();
+			UINT8* destData = (UINT8*)dest.getData();
 
 			// Get steps for traversing source data in 16/48 fixed point precision format
 			UINT64 stepX = ((UINT64)source.getWidth() << 48) / dest.getWidth();
 			UINT64 stepY = ((UINT64)source.getHeight() << 48) / dest.getHeight();
 
-			// Contains 16/16 fixed point precision format. Most significant
-			// 16 bits will contain the coordinate in the source image, and the
-			// least significant 16 bits will contain the fractional part of the coordinate
-			// that will be used for determining the blend amount.
-			UINT32 temp;
+			processRows(dest.getHeight(), dest.getWidth(), [&](UINT32 startRow, UINT32 endRow)
+			{
+				// Contains 16/16 fixed point precision format. Most significant
+				// 16 bits will contain the coordinate in the source image, and the
+				// least significant 16 bits will contain the fractional part of the coordinate
+				// that will be used for determining the blend amount.
+				UINT32 temp;
+
+				UINT64 curY = (stepY >> 1) - 1 + stepY * startRow; // Offset half a pixel to start at pixel center
+				for (UINT32 y = startRow; y < endRow; y++, curY += stepY)
+				{
+					temp = (UINT32)(curY >> 36);
+					temp = (temp > 0x800)? temp - 0x800: 0;
+					UINT32 sampleWeightY = temp & 0xFFF;
+					UINT32 sampleCoordY1 = temp >> 12;
+					UINT32 sampleCoordY2 = std::min(sampleCoordY1 + 1, (UINT32)source.getBottom() - source.getTop() - 1);
+
+					UINT32 sampleY1Offset = sampleCoordY1 * source.getRowPitch();
+					UINT32 sampleY2Offset = sampleCoordY2 * source.getRowPitch();
+
+					UINT8* destPtr = destData + y * dest.getRowPitch() * channels;
+
+					UINT64 curX = (stepX >> 1) - 1; // Offset half a pixel to start at pixel center
+					for (UINT32 x = dest.getLeft(); x < dest.getRight(); x++, curX += stepX)
+					{
+						temp = (UINT32)(curX >> 36);
+						temp = (temp > 0x800)? temp - 0x800 : 0;
+						UINT32 sampleWeightX = temp & 0xFFF;
+						UINT32 sampleCoordX1 = temp >> 12;
+						UINT32 sampleCoordX2 = std::min(sampleCoordX1 + 1, (UINT32)source.getRight() - source.getLeft() - 1);
+
+#if BS_PIXEL_SSE2
+						if (channels == 4)
+						{
+							UINT32 x1y1, x2y1, x1y2, x2y2;
+							memcpy(&x1y1, &sourceData[(sampleCoordX1 + sampleY1Offset)*channels], sizeof(UINT32));
+							memcpy(&x2y1, &sourceData[(sampleCoordX2 + sampleY1Offset)*channels], sizeof(UINT32));
+							memcpy(&x1y2, &sourceData[(sampleCoordX1 + sampleY2Offset)*channels], sizeof(UINT32));
+							memcpy(&x2y2, &sourceData[(sampleCoordX2 + sampleY2Offset)*channels], sizeof(UINT32));
 
-			UINT64 curY = (stepY >> 1) - 1; // Offset half a pixel to start at pixel center
-			for (UINT32 y = dest.getTop(); y < dest.getBottom(); y++, curY += stepY)
+							UINT32 output = lerpByte4SSE2(x1y1, x2y1, x1y2, x2y2, sampleWeightX, sampleWeightY);
+							memcpy(destPtr, &output, sizeof(UINT32));
+
+							destPtr += channels;
+							continue;
+						}
+#endif
+
+						UINT32 sxfsyf = sampleWeightX*sampleWeightY;
+						for (UINT32 k = 0; k < channels; k++) 
+						{
+							UINT32 accum =
+								sourceData[(sampleCoordX1 + sampleY1Offset)*channels+k]*(0x1000000-(sampleWeightX<<12)-(sampleWeightY<<12)+sxfsyf) +
+								sourceData[(sampleCoordX2 + sampleY1Offset)*channels+k]*((sampleWeightX<<12)-sxfsyf) +
+								sourceData[(sampleCoordX1 + sampleY2Offset)*channels+k]*((sampleWeightY<<12)-sxfsyf) +
+								sourceData[(sampleCoordX2 + sampleY2Offset)*channels+k]*sxfsyf;
+
+							// Round up to byte size
+							*destPtr = (UINT8)((accum + 0x800000) >> 24);
+							destPtr++;
+						}
+					}
+				}
+			});
+		}
+	};
+
+	/**
+	 * Downsamples 2D pixel data to exactly half its size by averaging each 2x2 block of source pixels. Only handles pixel
+	 * formats with one byte per channel. Does not perform format conversion.
+	 *
+	 * @tparam	channels	Number of channels in the pixel format.
+	 */
+	template<UINT32 channels> struct BoxDownsampler_Byte
+	{
+		static void scale(const PixelData& source, const PixelData& dest)
+		{
+			UINT8* sourceData = (UINT8*)source.getData();
+			UINT8* destData = (UINT8*)dest.getData();
+
+			UINT32 width = dest.getWidth();
+			processRows(dest.getHeight(), width, [&](UINT32 startRow, UINT32 endRow)
 			{
-				temp = (UINT32)(curY >> 36);
-				temp = (temp > 0x800)? temp - 0x800: 0;
-				UINT32 sampleWeightY = temp & 0xFFF;
-				UINT32 sampleCoordY1 = temp >> 12;
-				UINT32 sampleCoordY2 = std::min(sampleCoordY1 + 1, (UINT32)source.getBottom() - source.getTop() - 1);
+				for (UINT32 y = startRow; y < endRow; y++)
+				{
+					const UINT8* sourceRow0 = sourceData + (y * 2) * source.getRowPitch() * channels;
+					const UINT8* sourceRow1 = sourceRow0 + source.getRowPitch() * channels;
+					UINT8* destPtr = destData + y * dest.getRowPitch() * channels;
 
-				UINT32 sampleY1Offset = sampleCoordY1 * source.getRowPitch();
-				UINT32 sampleY2Offset = sampleCoordY2 * source.getRowPitch();
+					UINT32 x = 0;
 
-				UINT64 curX = (stepX >> 1) - 1; // Offset half a pixel to start at pixel center
-				for (UINT32 x = dest.getLeft(); x < dest.getRight(); x++, curX += stepX)
+#if BS_PIXEL_SSE2
+					if (channels == 4)
+					{
+						const __m128i zero = _mm_setzero_si128();
+						const __m128i two = _mm_set1_epi16(2);
+
+						for (; x + 2 <= width; x += 2)
+						{
+							__m128i row0 = _mm_loadu_si128((const __m128i*)(sourceRow0 + x * 8));
+							__m128i row1 = _mm_loadu_si128((const __m128i*)(sourceRow1 + x * 8));
+
+							// Sum the rows, each register holds two horizontally adjacent source pixels
+							__m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(row0, zero), _mm_unpacklo_epi8(row1, zero));
+							__m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(row0, zero), _mm_unpackhi_epi8(row1, zero));
+
+							// Sum the horizontal pairs
+							__m128i sum = _mm_add_epi16(_mm_unpacklo_epi64(lo, hi), _mm_unpackhi_epi64(lo, hi));
+							sum = _mm_srli_epi16(_mm_add_epi16(sum, two), 2);
+
+							_mm_storel_epi64((__m128i*)(destPtr + x * 4), _mm_packus_epi16(sum, sum));
+						}
+					}
+#endif
+
+					for (; x < width; x++)
+					{
+						for (UINT32 k = 0; k < channels; k++)
+						{
+							UINT32 sum = sourceRow0[(x * 2) * channels + k] + sourceRow0[(x * 2 + 1) * channels + k] +
+								sourceRow1[(x * 2) * channels + k] + sourceRow1[(x * 2 + 1) * channels + k];
+
+							destPtr[x * channels + k] = (UINT8)((sum + 2) >> 2);
+						}
+					}
+				}
+			});
+		}
+	};
+
+	/** 
+	 * Downsamples 2D pixel data to exactly half its size by averaging each 2x2 block of source pixels. Only handles float
+	 * RGBA pixel data (32 bits per channel). 
+	 */
+	struct BoxDownsampler_Float32
+	{
+		static void scale(const PixelData& source, const PixelData& dest)
+		{
+			float* sourceData = (float*)source.getData();
+			float* destData = (float*)dest.getData();
+
+			UINT32 width = dest.getWidth();
+			processRows(dest.getHeight(), width, [&](UINT32 startRow, UINT32 endRow)
+			{
+				for (UINT32 y = startRow; y < endRow; y++)
 				{
-					temp = (UINT32)(curX >> 36);
-					temp = (temp > 0x800)? temp - 0x800 : 0;
-					UINT32 sampleWeightX = temp & 0xFFF;
-					UINT32 sampleCoordX1 = temp >> 12;
-					UINT32 sampleCoordX2 = std::min(sampleCoordX1 + 1, (UINT32)source.getRight() - source.getLeft() - 1);
-
-					UINT32 sxfsyf = sampleWeightX*sampleWeightY;
-					for (UINT32 k = 0; k < channels; k++) 
+					const float* sourceRow0 = sourceData + (y * 2) * source.getRowPitch() * 4;
+					const float* sourceRow1 = sourceRow0 + source.getRowPitch() * 4;
+					float* destPtr = destData + y * dest.getRowPitch() * 4;
+
+					for (UINT32 x = 0; x < width; x++)
 					{
-						UINT32 accum =
-							sourceData[(sampleCoordX1 + sampleY1Offset)*channels+k]*(0x1000000-(sampleWeightX<<12)-(sampleWeightY<<12)+sxfsyf) +
-							sourceData[(sampleCoordX2 + sampleY1Offset)*channels+k]*((sampleWeightX<<12)-sxfsyf) +
-							sourceData[(sampleCoordX1 + sampleY2Offset)*channels+k]*((sampleWeightY<<12)-sxfsyf) +
-							sourceData[(sampleCoordX2 + sampleY2Offset)*channels+k]*sxfsyf;
-
-						// Round up to byte size
-						*destPtr = (UINT8)((accum + 0x800000) >> 24);
-						destPtr++;
+#if BS_PIXEL_SSE2
+						__m128 sum = _mm_add_ps(
+							_mm_add_ps(_mm_loadu_ps(sourceRow0 + x * 8), _mm_loadu_ps(sourceRow0 + x * 8 + 4)),
+							_mm_add_ps(_mm_loadu_ps(sourceRow1 + x * 8), _mm_loadu_ps(sourceRow1 + x * 8 + 4)));
+
+						_mm_storeu_ps(destPtr + x * 4, _mm_mul_ps(sum, _mm_set1_ps(0.25f)));
+#else
+						for (UINT32 k = 0; k < 4; k++)
+						{
+							float sum = (sourceRow0[x * 8 + k] + sourceRow0[x * 8 + 4 + k]) + 
+								(sourceRow1[x * 8 + k] + sourceRow1[x * 8 + 4 + k]);
+
+							destPtr[x * 4 + k] = sum * 0.25f;
+						}
+#endif
 					}
 				}
-				destPtr += channels*dest.getRowSkip();
-			}
+			});
 		}
 	};
 
@@ -1430,6 +1657,421 @@ namespace bs
 		}
 	}
 
+	/** 
+	 * Converts a row of pixels from one format to another. Receives both formats so a single function can handle a 
+	 * family of related format pairs.
+	 */
+	typedef void(*PixelRowConversionFunc)(const UINT8* src, PixelFormat srcFormat, UINT8* dst, PixelFormat dstFormat, 
+		UINT32 count);
+
+	/** Converts a row of pixels by unpacking and re-packing each pixel separately. Handles any pair of formats. */
+	static void convertRowGeneric(const UINT8* src, PixelFormat srcFormat, UINT8* dst, PixelFormat dstFormat, UINT32 count)
+	{
+		const UINT32 srcPixelSize = PixelUtil::getNumElemBytes(srcFormat);
+		const UINT32 dstPixelSize = PixelUtil::getNumElemBytes(dstFormat);
+
+		float r, g, b, a;
+		for (UINT32 i = 0; i < count; i++)
+		{
+			PixelUtil::unpackColor(&r, &g, &b, &a, srcFormat, src);
+			PixelUtil::packColor(r, g, b, a, dstFormat, dst);
+
+			src += srcPixelSize;
+			dst += dstPixelSize;
+		}
+	}
+
+	/** Swaps the red and blue channels. Handles PF_R8G8B8A8 <-> PF_B8G8R8A8 conversions. */
+	static void convertRowSwizzleRB(const UINT8* src, PixelFormat srcFormat, UINT8* dst, PixelFormat dstFormat, UINT32 count)
+	{
+		UINT32 i = 0;
+
+#if BS_PIXEL_SSE2
+		const __m128i maskGA = _mm_set1_epi32(0xFF00FF00);
+		const __m128i maskByte = _mm_set1_epi32(0x000000FF);
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i val = _mm_loadu_si128((const __m128i*)(src + i * 4));
+
+			__m128i ga = _mm_and_si128(val, maskGA);
+			__m128i lo = _mm_and_si128(_mm_srli_epi32(val, 16), maskByte);
+			__m128i hi = _mm_slli_epi32(_mm_and_si128(val, maskByte), 16);
+
+			_mm_storeu_si128((__m128i*)(dst + i * 4), _mm_or_si128(ga, _mm_or_si128(lo, hi)));
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			dst[i * 4 + 0] = src[i * 4 + 2];
+			dst[i * 4 + 1] = src[i * 4 + 1];
+			dst[i * 4 + 2] = src[i * 4 + 0];
+			dst[i * 4 + 3] = src[i * 4 + 3];
+		}
+	}
+
+	/** Expands single channel pixels into four channels, with an opaque alpha. Handles PF_R8 -> PF_R8G8B8A8/PF_B8G8R8A8. */
+	static void convertRowExpandR8(const UINT8* src, PixelFormat srcFormat, UINT8* dst, PixelFormat dstFormat, UINT32 count)
+	{
+		const UINT32 redShift = dstFormat == PF_B8G8R8A8 ? 16 : 0;
+		UINT32 i = 0;
+
+#if BS_PIXEL_SSE2
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i alpha = _mm_set1_epi32(0xFF000000);
+		const __m128i shift = _mm_cvtsi32_si128(redShift);
+
+		for (; i + 16 <= count; i += 16)
+		{
+			__m128i val = _mm_loadu_si128((const __m128i*)(src + i));
+			__m128i lo = _mm_unpacklo_epi8(val, zero);
+			__m128i hi = _mm_unpackhi_epi8(val, zero);
+
+			__m128i pixels[4] = 
+			{
+				_mm_unpacklo_epi16(lo, zero), _mm_unpackhi_epi16(lo, zero),
+				_mm_unpacklo_epi16(hi, zero), _mm_unpackhi_epi16(hi, zero)
+			};
+
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				__m128i output = _mm_or_si128(_mm_sll_epi32(pixels[j], shift), alpha);
+				_mm_storeu_si128((__m128i*)(dst + (i + j * 4) * 4), output);
+			}
+		}
+#endif
+
+		for (; i < count; i++)
+		{
+			UINT32 output = 0xFF000000 | (src[i] << redShift);
+			memcpy(dst + i * 4, &output, sizeof(output));
+		}
+	}
+
+	/** Extracts the red channel of four channel pixels. Handles PF_R8G8B8A8/PF_B8G8R8A8 -> PF_R8. */
+	static void convertRowExtractR8(const UINT8* src, PixelFormat srcFormat, UINT8* dst, PixelFormat dstFormat, UINT32 count)
+	{
+		const UINT32 redOffset = srcFormat == PF_B8G8R8A8 ? 2 : 0;
+		UINT32 i = 0;
+
+#if BS_PIXEL_SSE2
+		const __m128i maskByte = _mm_set1_epi32(0x000000FF);
+		const __m128i shift = _mm_cvtsi32_si128(redOffset * 8);
+
+		for (; i + 16 <= count; i += 16)
+		{
+			__m128i pixels[4];
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				__m128i val = _mm_loadu_si128((const __m128i*)(src + (i + j * 4) * 4));
+				pixels[j] = _mm_and_si128(_mm_srl_epi32(val, shift), maskByte);
+			}
+
+			__m128i lo = _mm_packs_epi32(pixels[0], pixels[1]);
+			__m128i hi = _mm_packs_epi32(pixels[2], pixels[3]);
+			_mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(lo, hi));
+		}
+#endif
+
+		for (; i < count; i++)
+			dst[i] = src[i * 4 + redOffset];
+	}
+
+#if BS_PIXEL_SSE2
+	/** 
+	 * Converts four half precision floats, stored in the lower 16 bits of each 32-bit lane, to single precision. Matches
+	 * Bitwise::halfToFloat(). 
+	 */
+	static __m128 halfToFloatSSE2(__m128i value)
+	{
+		const __m128i maskNoSign = _mm_set1_epi32(0x7FFF);
+		const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23));
+		const __m128i wasInfNaN = _mm_set1_epi32(0x7BFF);
+		const __m128 expInfNaN = _mm_castsi128_ps(_mm_set1_epi32(255 << 23));
+
+		__m128i expMant = _mm_and_si128(maskNoSign, value);
+		__m128i sign = _mm_slli_epi32(_mm_xor_si128(value, expMant), 16);
+
+		// Re-bias the exponent by scaling, which also normalizes denormals
+		__m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(expMant, 13)), magic);
+
+		// Infinity and NaN need to keep the maximum exponent
+		__m128 infNaN = _mm_and_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(expMant, wasInfNaN)), expInfNaN);
+
+		return _mm_or_ps(scaled, _mm_or_ps(_mm_castsi128_ps(sign), infNaN));
+	}
+
+	/** 
+	 * Converts four single precision floats to half precision, stored in the lower 16 bits of each 32-bit lane. Matches
+	 * Bitwise::floatToHalf(), including truncation of the mantissa. 
+	 */
+	static __m128i floatToHalfSSE2(__m128 value)
+	{
+		const __m128i one = _mm_set1_epi32(1);
+		const __m128i halfInf = _mm_set1_epi32(0x7C00);
+
+		__m128i bits = _mm_castps_si128(value);
+		__m128i sign = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(0x8000));
+		__m128i absBits = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+
+		// Normalized range, re-bias the exponent and truncate the mantissa
+		__m128i normal = _mm_sub_epi32(_mm_srli_epi32(absBits, 13), _mm_set1_epi32(112 << 10));
+
+		// Denormalized range, truncate to a multiple of the smallest half denormal (2^-24)
+		__m128i denormal = _mm_cvttps_epi32(_mm_mul_ps(_mm_castsi128_ps(absBits), _mm_set1_ps(16777216.0f)));
+
+		// NaN keeps the upper mantissa bits, but must not turn into infinity
+		__m128i nanMant = _mm_and_si128(_mm_srli_epi32(absBits, 13), _mm_set1_epi32(0x3FF));
+		nanMant = _mm_or_si128(nanMant, _mm_and_si128(_mm_cmpeq_epi32(nanMant, _mm_setzero_si128()), one));
+		__m128i nan = _mm_or_si128(halfInf, nanMant);
+
+		__m128i isDenormal = _mm_cmplt_epi32(absBits, _mm_set1_epi32(0x38800000));
+		__m128i isOverflow = _mm_cmpgt_epi32(absBits, _mm_set1_epi32(0x477FFFFF));
+		__m128i isNaN = _mm_cmpgt_epi32(absBits, _mm_set1_epi32(0x7F800000));
+		__m128i isZero = _mm_cmplt_epi32(absBits, _mm_set1_epi32(0x33000000));
+
+		__m128i output = _mm_or_si128(_mm_and_si128(isDenormal, denormal), _mm_andnot_si128(isDenormal, normal));
+		output = _mm_or_si128(_mm_and_si128(isOverflow, halfInf), _mm_andnot_si128(isOverflow, output));
+		output = _mm_or_si128(_mm_and_si128(isNaN, nan), _mm_andnot_si128(isNaN, output));
+		output = _mm_or_si128(output, sign);
+
+		// Values too small to be represented lose their sign as well
+		return _mm_andnot_si128(isZero, output);
+	}
+#endif
+
+	/** 
+	 * Unpacks a row of pixels into RGBA floats. Handles PF_R8G8B8A8, PF_B8G8R8A8, PF_R8, PF_FLOAT16_RGBA and 
+	 * PF_FLOAT32_RGBA. 
+	 */
+	static void unpackRowToFloat(const UINT8* src, PixelFormat format, float* dst, UINT32 count)
+	{
+		UINT32 i = 0;
+		switch (format)
+		{
+		case PF_R8G8B8A8:
+		case PF_B8G8R8A8:
+		{
+#if BS_PIXEL_SSE2
+			const __m128i zero = _mm_setzero_si128();
+			const __m128 scale = _mm_set1_ps(1.0f / 255.0f);
+			const bool swizzle = format == PF_B8G8R8A8;
+
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128i val = _mm_loadu_si128((const __m128i*)(src + i * 4));
+				__m128i lo = _mm_unpacklo_epi8(val, zero);
+				__m128i hi = _mm_unpackhi_epi8(val, zero);
+
+				__m128i pixels[4] = 
+				{
+					_mm_unpacklo_epi16(lo, zero), _mm_unpackhi_epi16(lo, zero),
+					_mm_unpacklo_epi16(hi, zero), _mm_unpackhi_epi16(hi, zero)
+				};
+
+				for (UINT32 j = 0; j < 4; j++)
+				{
+					__m128 output = _mm_mul_ps(_mm_cvtepi32_ps(pixels[j]), scale);
+					if (swizzle)
+						output = _mm_shuffle_ps(output, output, _MM_SHUFFLE(3, 0, 1, 2));
+
+					_mm_storeu_ps(dst + (i + j) * 4, output);
+				}
+			}
+#endif
+
+			for (; i < count; i++)
+			{
+				PixelUtil::unpackColor(&dst[i * 4 + 0], &dst[i * 4 + 1], &dst[i * 4 + 2], &dst[i * 4 + 3], format, 
+					src + i * 4);
+			}
+		}
+			break;
+		case PF_R8:
+			for (; i < count; i++)
+			{
+				dst[i * 4 + 0] = Bitwise::fixedToFloat(src[i], 8);
+				dst[i * 4 + 1] = 0.0f;
+				dst[i * 4 + 2] = 0.0f;
+				dst[i * 4 + 3] = 1.0f;
+			}
+			break;
+		case PF_FLOAT16_RGBA:
+		{
+			const UINT16* srcHalf = (const UINT16*)src;
+
+#if BS_PIXEL_SSE2
+			const __m128i zero = _mm_setzero_si128();
+			for (; i + 2 <= count; i += 2)
+			{
+				__m128i val = _mm_loadu_si128((const __m128i*)(srcHalf + i * 4));
+
+				_mm_storeu_ps(dst + i * 4 + 0, halfToFloatSSE2(_mm_unpacklo_epi16(val, zero)));
+				_mm_storeu_ps(dst + i * 4 + 4, halfToFloatSSE2(_mm_unpackhi_epi16(val, zero)));
+			}
+#endif
+
+			for (i *= 4; i < count * 4; i++)
+				dst[i] = Bitwise::halfToFloat(srcHalf[i]);
+		}
+			break;
+		case PF_FLOAT32_RGBA:
+			memcpy(dst, src, count * sizeof(float) * 4);
+			break;
+		default:
+			assert(false);
+			break;
+		}
+	}
+
+	/** 
+	 * Packs a row of RGBA floats into pixels. Handles PF_R8G8B8A8, PF_B8G8R8A8, PF_R8, PF_FLOAT16_RGBA and 
+	 * PF_FLOAT32_RGBA. 
+	 */
+	static void packRowFromFloat(const float* src, PixelFormat format, UINT8* dst, UINT32 count)
+	{
+		UINT32 i = 0;
+		switch (format)
+		{
+		case PF_R8G8B8A8:
+		case PF_B8G8R8A8:
+		{
+#if BS_PIXEL_SSE2
+			const __m128 zero = _mm_setzero_ps();
+			const __m128 scale = _mm_set1_ps(256.0f);
+			const __m128 max = _mm_set1_ps(255.0f);
+			const bool swizzle = format == PF_B8G8R8A8;
+
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128i pixels[4];
+				for (UINT32 j = 0; j < 4; j++)
+				{
+					__m128 val = _mm_loadu_ps(src + (i + j) * 4);
+					if (swizzle)
+						val = _mm_shuffle_ps(val, val, _MM_SHUFFLE(3, 0, 1, 2));
+
+					// Same as Bitwise::floatToFixed(), values at or above 1.0 map to 255
+					val = _mm_min_ps(_mm_max_ps(_mm_mul_ps(val, scale), zero), max);
+					pixels[j] = _mm_cvttps_epi32(val);
+				}
+
+				__m128i lo = _mm_packs_epi32(pixels[0], pixels[1]);
+				__m128i hi = _mm_packs_epi32(pixels[2], pixels[3]);
+				_mm_storeu_si128((__m128i*)(dst + i * 4), _mm_packus_epi16(lo, hi));
+			}
+#endif
+
+			for (; i < count; i++)
+				PixelUtil::packColor(src[i * 4 + 0], src[i * 4 + 1], src[i * 4 + 2], src[i * 4 + 3], format, dst + i * 4);
+		}
+			break;
+		case PF_R8:
+			for (; i < count; i++)
+				dst[i] = (UINT8)Bitwise::floatToFixed(src[i * 4], 8);
+			break;
+		case PF_FLOAT16_RGBA:
+		{
+			UINT16* dstHalf = (UINT16*)dst;
+
+#if BS_PIXEL_SSE2
+			for (; i + 2 <= count; i += 2)
+			{
+				__m128i lo = floatToHalfSSE2(_mm_loadu_ps(src + i * 4 + 0));
+				__m128i hi = floatToHalfSSE2(_mm_loadu_ps(src + i * 4 + 4));
+
+				// Sign extend so the saturating pack keeps all 16 bits intact
+				lo = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+				hi = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+
+				_mm_storeu_si128((__m128i*)(dstHalf + i * 4), _mm_packs_epi32(lo, hi));
+			}
+#endif
+
+			for (i *= 4; i < count * 4; i++)
+				dstHalf[i] = Bitwise::floatToHalf(src[i]);
+		}
+			break;
+		case PF_FLOAT32_RGBA:
+			memcpy(dst, src, count * sizeof(float) * 4);
+			break;
+		default:
+			assert(false);
+			break;
+		}
+	}
+
+	/** 
+	 * Converts a row of pixels by unpacking them into an intermediate floating point buffer, and then packing them into
+	 * the destination format. Handles any pair of formats supported by unpackRowToFloat() and packRowFromFloat().
+	 */
+	static void convertRowViaFloat(const UINT8* src, PixelFormat srcFormat, UINT8* dst, PixelFormat dstFormat, UINT32 count)
+	{
+		if (srcFormat == PF_FLOAT32_RGBA)
+		{
+			packRowFromFloat((const float*)src, dstFormat, dst, count);
+			return;
+		}
+
+		if (dstFormat == PF_FLOAT32_RGBA)
+		{
+			unpackRowToFloat(src, srcFormat, (float*)dst, count);
+			return;
+		}
+
+		static const UINT32 BATCH_SIZE = 256;
+		float buffer[BATCH_SIZE * 4];
+
+		const UINT32 srcPixelSize = PixelUtil::getNumElemBytes(srcFormat);
+		const UINT32 dstPixelSize = PixelUtil::getNumElemBytes(dstFormat);
+
+		for (UINT32 i = 0; i < count; i += BATCH_SIZE)
+		{
+			UINT32 batchCount = std::min(BATCH_SIZE, count - i);
+
+			unpackRowToFloat(src + i * srcPixelSize, srcFormat, buffer, batchCount);
+			packRowFromFloat(buffer, dstFormat, dst + i * dstPixelSize, batchCount);
+		}
+	}
+
+	/** Checks if the format has a specialized conversion path in bulkPixelConversion(). */
+	static bool hasFastConversionPath(PixelFormat format)
+	{
+		switch (format)
+		{
+		case PF_R8G8B8A8:
+		case PF_B8G8R8A8:
+		case PF_R8:
+		case PF_FLOAT16_RGBA:
+		case PF_FLOAT32_RGBA:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	/** Returns a function that can be used for converting rows of pixels between two different formats. */
+	static PixelRowConversionFunc getRowConversionFunc(PixelFormat srcFormat, PixelFormat dstFormat)
+	{
+		if (!hasFastConversionPath(srcFormat) || !hasFastConversionPath(dstFormat))
+			return &convertRowGeneric;
+
+		bool srcIsByte4 = srcFormat == PF_R8G8B8A8 || srcFormat == PF_B8G8R8A8;
+		bool dstIsByte4 = dstFormat == PF_R8G8B8A8 || dstFormat == PF_B8G8R8A8;
+
+		if (srcIsByte4 && dstIsByte4)
+			return &convertRowSwizzleRB;
+
+		if (srcFormat == PF_R8 && dstIsByte4)
+			return &convertRowExpandR8;
+
+		if (srcIsByte4 && dstFormat == PF_R8)
+			return &convertRowExtractR8;
+
+		return &convertRowViaFloat;
+	}
+
     void PixelUtil::bulkPixelConversion(const PixelData &src, PixelData &dst)
     {
         assert(src.getWidth() == dst.getWidth() &&
@@ -1520,6 +2162,7 @@ namespace bs
 			// optimized conversions
 			PixelFormat tempFormat = dst.getFormat() == PF_X8R8G8B8?PF_A8R8G8B8:PF_A8B8G8R8;
 			PixelData tempdst(dst.getWidth(), dst.getHeight(), dst.getDepth(), tempFormat);
+			tempdst.setExternalBuffer(dst.getData());
 			bulkPixelConversion(src, tempdst);
 			return;
 		}
@@ -1537,43 +2180,42 @@ namespace bs
 			return;
 		}
 
+		// Common format pairs use specialized conversion functions, with a generic per-pixel fallback for the rest
+		PixelRowConversionFunc convertRow = getRowConversionFunc(src.getFormat(), dst.getFormat());
+
 		const UINT32 srcPixelSize = PixelUtil::getNumElemBytes(src.getFormat());
 		const UINT32 dstPixelSize = PixelUtil::getNumElemBytes(dst.getFormat());
-        UINT8 *srcptr = static_cast<UINT8*>(src.getData())
-            + (src.getLeft() + src.getTop() * src.getRowPitch() + src.getFront() * src.getSlicePitch()) * srcPixelSize;
-        UINT8 *dstptr = static_cast<UINT8*>(dst.getData())
-            + (dst.getLeft() + dst.getTop() * dst.getRowPitch() + dst.getFront() * dst.getSlicePitch()) * dstPixelSize;
-		
-        // Calculate pitches+skips in bytes
-		const UINT32 srcRowSkipBytes = src.getRowSkip()*srcPixelSize;
-		const UINT32 srcSliceSkipBytes = src.getSliceSkip()*srcPixelSize;
-		const UINT32 dstRowSkipBytes = dst.getRowSkip()*dstPixelSize;
-		const UINT32 dstSliceSkipBytes = dst.getSliceSkip()*dstPixelSize;
-
-        // The brute force fallback
-        float r,g,b,a;
-		for (UINT32 z = src.getFront(); z<src.getBack(); z++)
-		{
-			for (UINT32 y = src.getTop(); y < src.getBottom(); y++)
-            {
-				for (UINT32 x = src.getLeft(); x<src.getRight(); x++)
-                {
-                    unpackColor(&r, &g, &b, &a, src.getFormat(), srcptr);
-                    packColor(r, g, b, a, dst.getFormat(), dstptr);
+		UINT8* srcData = src.getData();
+		UINT8* dstData = dst.getData();
 
-                    srcptr += srcPixelSize;
-                    dstptr += dstPixelSize;
-                }
+		const UINT32 width = src.getWidth();
+		const UINT32 height = src.getHeight();
 
-                srcptr += srcRowSkipBytes;
-                dstptr += dstRowSkipBytes;
-            }
+		// Rows of all slices are processed as a single range so they can be split between worker threads
+		processRows(height * src.getDepth(), width, [&](UINT32 startRow, UINT32 endRow)
+		{
+			for (UINT32 row = startRow; row < endRow; row++)
+			{
+				UINT32 y = row % height;
+				UINT32 z = row / height;
 
-            srcptr += srcSliceSkipBytes;
-            dstptr += dstSliceSkipBytes;
-        }
+				const UINT8* srcptr = srcData + (src.getLeft() + (src.getTop() + y) * src.getRowPitch() + 
+					(src.getFront() + z) * src.getSlicePitch()) * srcPixelSize;
+				UINT8* dstptr = dstData + (dst.getLeft() + (dst.getTop() + y) * dst.getRowPitch() + 
+					(dst.getFront() + z) * dst.getSlicePitch()) * dstPixelSize;
+
+				convertRow(srcptr, src.getFormat(), dstptr, dst.getFormat(), width);
+			}
+		});
     }
 
+	/** Checks if the destination is a 2D image exactly half the size of the source, in both dimensions. */
+	static bool isExactHalf(const PixelData& src, const PixelData& dst)
+	{
+		return src.getDepth() == 1 && dst.getDepth() == 1 && 
+			src.getWidth() == dst.getWidth() * 2 && src.getHeight() == dst.getHeight() * 2;
+	}
+
 	void PixelUtil::scale(const PixelData& src, PixelData& scaled, Filter filter)
 	{
 		assert(PixelUtil::isAccessible(src.getFormat()));
@@ -1643,15 +2285,32 @@ namespace bs
 				}
 
 				// No conversion
-				switch (PixelUtil::getNumElemBytes(src.getFormat())) 
+				if(isExactHalf(src, temp))
 				{
-				case 1: LinearResampler_Byte<1>::scale(src, temp); break;
-				case 2: LinearResampler_Byte<2>::scale(src, temp); break;
-				case 3: LinearResampler_Byte<3>::scale(src, temp); break;
-				case 4: LinearResampler_Byte<4>::scale(src, temp); break;
-				default:
-					// Never reached
-					assert(false);
+					// Common case when generating mipmaps, a plain box filter is both correct and faster
+					switch (PixelUtil::getNumElemBytes(src.getFormat())) 
+					{
+					case 1: BoxDownsampler_Byte<1>::scale(src, temp); break;
+					case 2: BoxDownsampler_Byte<2>::scale(src, temp); break;
+					case 3: BoxDownsampler_Byte<3>::scale(src, temp); break;
+					case 4: BoxDownsampler_Byte<4>::scale(src, temp); break;
+					default:
+						// Never reached
+						assert(false);
+					}
+				}
+				else
+				{
+					switch (PixelUtil::getNumElemBytes(src.getFormat())) 
+					{
+					case 1: LinearResampler_Byte<1>::scale(src, temp); break;
+					case 2: LinearResampler_Byte<2>::scale(src, temp); break;
+					case 3: LinearResampler_Byte<3>::scale(src, temp); break;
+					case 4: LinearResampler_Byte<4>::scale(src, temp); break;
+					default:
+						// Never reached
+						assert(false);
+					}
 				}
 
 				if(temp.getData() != scaled.getData())
@@ -1667,7 +2326,11 @@ namespace bs
 				if (scaled.getFormat() == PF_FLOAT32_RGB || scaled.getFormat() == PF_FLOAT32_RGBA)
 				{
 					// float32 to float32, avoid unpack/repack overhead
-					LinearResampler_Float32::scale(src, scaled);
+					if(src.getFormat() == PF_FLOAT32_RGBA && scaled.getFormat() == PF_FLOAT32_RGBA && isExactHalf(src, scaled))
+						BoxDownsampler_Float32::scale(src, scaled);
+					else
+						LinearResampler_Float32::scale(src, scaled);
+
 					break;
 				}
 				// Else, fall through
@@ -158,6 +158,9 @@ namespace bs
 		reportSample.numObjectsCreated = (UINT32)(sample.endStats.numObjectsCreated - sample.startStats.numObjectsCreated);
 		reportSample.numObjectsDestroyed = (UINT32)(sample.endStats.numObjectsDestroyed - sample.startStats.numObjectsDestroyed);
 
+		reportSample.numFrustumCulled = (UINT32)(sample.endStats.numFrustumCulled - sample.startStats.numFrustumCulled);
+		reportSample.numOcclusionCulled = (UINT32)(sample.endStats.numOcclusionCulled - sample.startStats.numOcclusionCulled);
+
 		mFreeTimerQueries.push(sample.activeTimeQuery);
 		mFreeOcclusionQueries.push(sample.activeOcclusionQuery);
 	}
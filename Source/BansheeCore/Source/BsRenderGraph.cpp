@@ -0,0 +1,400 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsRenderGraph.h"
+#include "BsPixelUtil.h"
+#include "BsDebug.h"
+
+namespace bs
+{
+	UINT32 RenderGraph::createTexture(const String& name, const TEXTURE_DESC& desc)
+	{
+		TextureData data;
+		data.name = name;
+		data.desc = desc;
+		data.imported = false;
+
+		mTextures.push_back(data);
+		mCompiled = false;
+
+		return (UINT32)mTextures.size() - 1;
+	}
+
+	UINT32 RenderGraph::importTexture(const String& name, const SPtr<TextureCore>& texture,
+		const SPtr<RenderTextureCore>& renderTexture)
+	{
+		TextureData data;
+		data.name = name;
+		data.imported = true;
+		data.texture = texture;
+		data.renderTexture = renderTexture;
+
+		mTextures.push_back(data);
+		mCompiled = false;
+
+		return (UINT32)mTextures.size() - 1;
+	}
+
+	UINT32 RenderGraph::addPass(const String& name, const ExecuteCallback& execute)
+	{
+		PassData data;
+		data.name = name;
+		data.execute = execute;
+		data.hasSideEffects = false;
+		data.culled = false;
+
+		mPasses.push_back(data);
+		mCompiled = false;
+
+		return (UINT32)mPasses.size() - 1;
+	}
+
+	void RenderGraph::read(UINT32 pass, UINT32 texture)
+	{
+		mPasses[pass].reads.push_back(texture);
+		mCompiled = false;
+	}
+
+	void RenderGraph::write(UINT32 pass, UINT32 texture)
+	{
+		mPasses[pass].writes.push_back(texture);
+		mTextures[texture].writers.push_back(pass);
+		mCompiled = false;
+	}
+
+	void RenderGraph::setHasSideEffects(UINT32 pass)
+	{
+		mPasses[pass].hasSideEffects = true;
+		mCompiled = false;
+	}
+
+	bool RenderGraph::compile()
+	{
+		mCompiled = false;
+		mOrder.clear();
+		mPhysicalTextures.clear();
+		mStats = RenderGraphStats();
+
+		for (auto& texture : mTextures)
+		{
+			texture.firstUse = (UINT32)-1;
+			texture.lastUse = 0;
+			texture.physicalIdx = (UINT32)-1;
+		}
+
+		cullPasses();
+
+		for(UINT32 i = 0; i < (UINT32)mPasses.size(); i++)
+		{
+			const PassData& pass = mPasses[i];
+			if (pass.culled)
+				continue;
+
+			for(auto& texIdx : pass.reads)
+			{
+				const TextureData& texture = mTextures[texIdx];
+				if (!texture.imported && texture.writers.empty())
+				{
+					LOGERR("Render graph pass \"" + pass.name + "\" reads texture \"" + texture.name + "\" which no pass "
+						"writes to.");
+					return false;
+				}
+			}
+		}
+
+		if(!sortPasses())
+		{
+			LOGERR("Render graph contains a dependency cycle.");
+			return false;
+		}
+
+		assignPhysicalTextures();
+
+		mStats.numPasses = (UINT32)mOrder.size();
+		mStats.numCulledPasses = (UINT32)(mPasses.size() - mOrder.size());
+
+		mCompiled = true;
+		return true;
+	}
+
+	void RenderGraph::cullPasses()
+	{
+		for (auto& pass : mPasses)
+			pass.culled = true;
+
+		Vector<UINT32> todo;
+		for(UINT32 i = 0; i < (UINT32)mPasses.size(); i++)
+		{
+			PassData& pass = mPasses[i];
+
+			bool isRoot = pass.hasSideEffects;
+			for(auto& texIdx : pass.writes)
+				isRoot |= mTextures[texIdx].imported;
+
+			if(isRoot)
+			{
+				pass.culled = false;
+				todo.push_back(i);
+			}
+		}
+
+		// Any pass writing to a texture read by a live pass is live as well
+		while(!todo.empty())
+		{
+			UINT32 passIdx = todo.back();
+			todo.pop_back();
+
+			for(auto& texIdx : mPasses[passIdx].reads)
+			{
+				for(auto& writerIdx : mTextures[texIdx].writers)
+				{
+					PassData& writer = mPasses[writerIdx];
+					if (!writer.culled)
+						continue;
+
+					writer.culled = false;
+					todo.push_back(writerIdx);
+				}
+			}
+		}
+	}
+
+	bool RenderGraph::sortPasses()
+	{
+		UINT32 numPasses = (UINT32)mPasses.size();
+
+		Vector<Vector<UINT32>> dependents(numPasses);
+		Vector<UINT32> numDependencies(numPasses, 0);
+
+		auto addEdge = [&](UINT32 from, UINT32 to)
+		{
+			if (from == to)
+				return;
+
+			dependents[from].push_back(to);
+			numDependencies[to]++;
+		};
+
+		for(UINT32 i = 0; i < numPasses; i++)
+		{
+			if (mPasses[i].culled)
+				continue;
+
+			// Readers execute after all writers
+			for(auto& texIdx : mPasses[i].reads)
+			{
+				for (auto& writerIdx : mTextures[texIdx].writers)
+					addEdge(writerIdx, i);
+			}
+		}
+
+		// Writers of the same texture execute in the order they were added in
+		for(auto& texture : mTextures)
+		{
+			UINT32 prevWriter = (UINT32)-1;
+			for(auto& writerIdx : texture.writers)
+			{
+				if (mPasses[writerIdx].culled)
+					continue;
+
+				if (prevWriter != (UINT32)-1)
+					addEdge(prevWriter, writerIdx);
+
+				prevWriter = writerIdx;
+			}
+		}
+
+		// Kahn's algorithm, always picking the earliest added pass so the order is deterministic and as close as
+		// possible to the order the passes were added in
+		Set<UINT32> ready;
+		UINT32 numLive = 0;
+		for(UINT32 i = 0; i < numPasses; i++)
+		{
+			if (mPasses[i].culled)
+				continue;
+
+			numLive++;
+			if (numDependencies[i] == 0)
+				ready.insert(i);
+		}
+
+		while(!ready.empty())
+		{
+			UINT32 passIdx = *ready.begin();
+			ready.erase(ready.begin());
+
+			mOrder.push_back(passIdx);
+			for(auto& dependentIdx : dependents[passIdx])
+			{
+				if (--numDependencies[dependentIdx] == 0)
+					ready.insert(dependentIdx);
+			}
+		}
+
+		return mOrder.size() == numLive;
+	}
+
+	void RenderGraph::assignPhysicalTextures()
+	{
+		for(UINT32 i = 0; i < (UINT32)mOrder.size(); i++)
+		{
+			const PassData& pass = mPasses[mOrder[i]];
+
+			auto markUse = [&](UINT32 texIdx)
+			{
+				TextureData& texture = mTextures[texIdx];
+				texture.firstUse = std::min(texture.firstUse, i);
+				texture.lastUse = std::max(texture.lastUse, i);
+			};
+
+			for (auto& texIdx : pass.reads)
+				markUse(texIdx);
+
+			for (auto& texIdx : pass.writes)
+				markUse(texIdx);
+		}
+
+		Vector<UINT32> transient;
+		for(UINT32 i = 0; i < (UINT32)mTextures.size(); i++)
+		{
+			const TextureData& texture = mTextures[i];
+			if (texture.imported || texture.firstUse == (UINT32)-1)
+				continue;
+
+			transient.push_back(i);
+		}
+
+		std::stable_sort(transient.begin(), transient.end(),
+			[&](UINT32 a, UINT32 b) { return mTextures[a].firstUse < mTextures[b].firstUse; });
+
+		// Greedily place each texture into the first compatible physical texture that is no longer in use
+		for(auto& texIdx : transient)
+		{
+			TextureData& texture = mTextures[texIdx];
+
+			UINT32 physicalIdx = (UINT32)-1;
+			for(UINT32 i = 0; i < (UINT32)mPhysicalTextures.size(); i++)
+			{
+				PhysicalTexture& physical = mPhysicalTextures[i];
+				if (physical.lastUse < texture.firstUse && isCompatible(physical.desc, texture.desc))
+				{
+					physicalIdx = i;
+					break;
+				}
+			}
+
+			if(physicalIdx == (UINT32)-1)
+			{
+				PhysicalTexture physical;
+				physical.desc = texture.desc;
+				physical.firstUse = texture.firstUse;
+
+				mPhysicalTextures.push_back(physical);
+				physicalIdx = (UINT32)mPhysicalTextures.size() - 1;
+
+				mStats.physicalMemory += getMemorySize(texture.desc);
+			}
+
+			mPhysicalTextures[physicalIdx].lastUse = texture.lastUse;
+			texture.physicalIdx = physicalIdx;
+
+			mStats.transientMemory += getMemorySize(texture.desc);
+		}
+
+		mStats.numTransientTextures = (UINT32)transient.size();
+		mStats.numPhysicalTextures = (UINT32)mPhysicalTextures.size();
+	}
+
+	void RenderGraph::execute(RenderGraphAllocator& allocator)
+	{
+		if(!mCompiled)
+		{
+			LOGERR("Render graph must be successfully compiled before it can be executed.");
+			return;
+		}
+
+		for(UINT32 i = 0; i < (UINT32)mOrder.size(); i++)
+		{
+			for(auto& physical : mPhysicalTextures)
+			{
+				if (physical.firstUse == i)
+					allocator.allocate(physical.desc, physical.texture, physical.renderTexture);
+			}
+
+			const PassData& pass = mPasses[mOrder[i]];
+			if (pass.execute)
+				pass.execute(*this);
+
+			for(auto& physical : mPhysicalTextures)
+			{
+				if (physical.lastUse != i)
+					continue;
+
+				allocator.release(physical.texture);
+				physical.texture = nullptr;
+				physical.renderTexture = nullptr;
+			}
+		}
+	}
+
+	void RenderGraph::clear()
+	{
+		mTextures.clear();
+		mPasses.clear();
+		mPhysicalTextures.clear();
+		mOrder.clear();
+		mStats = RenderGraphStats();
+		mCompiled = false;
+	}
+
+	SPtr<TextureCore> RenderGraph::getTexture(UINT32 texture) const
+	{
+		const TextureData& data = mTextures[texture];
+		if (data.imported)
+			return data.texture;
+
+		if (data.physicalIdx == (UINT32)-1)
+			return nullptr;
+
+		return mPhysicalTextures[data.physicalIdx].texture;
+	}
+
+	SPtr<RenderTextureCore> RenderGraph::getRenderTexture(UINT32 texture) const
+	{
+		const TextureData& data = mTextures[texture];
+		if (data.imported)
+			return data.renderTexture;
+
+		if (data.physicalIdx == (UINT32)-1)
+			return nullptr;
+
+		return mPhysicalTextures[data.physicalIdx].renderTexture;
+	}
+
+	UINT64 RenderGraph::getMemorySize(const TEXTURE_DESC& desc)
+	{
+		UINT32 width = desc.width;
+		UINT32 height = desc.height;
+		UINT32 depth = desc.depth;
+
+		UINT64 size = 0;
+		for(UINT32 i = 0; i <= desc.numMips; i++)
+		{
+			size += PixelUtil::getMemorySize(width, height, depth, desc.format);
+
+			width = std::max(1U, width / 2);
+			height = std::max(1U, height / 2);
+			depth = std::max(1U, depth / 2);
+		}
+
+		UINT32 numFaces = desc.type == TEX_TYPE_CUBE_MAP ? 6 : 1;
+		return size * std::max(1U, desc.numSamples) * std::max(1U, desc.numArraySlices) * numFaces;
+	}
+
+	bool RenderGraph::isCompatible(const TEXTURE_DESC& a, const TEXTURE_DESC& b)
+	{
+		return a.type == b.type && a.format == b.format && a.width == b.width && a.height == b.height &&
+			a.depth == b.depth && a.numMips == b.numMips && a.usage == b.usage && a.hwGamma == b.hwGamma &&
+			std::max(1U, a.numSamples) == std::max(1U, b.numSamples) &&
+			std::max(1U, a.numArraySlices) == std::max(1U, b.numArraySlices);
+	}
+}
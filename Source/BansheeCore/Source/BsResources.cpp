@@ -6,6 +6,7 @@
 #include "BsException.h"
 #include "BsFileSerializer.h"
 #include "BsFileSystem.h"
+#include "BsPackFile.h"
 #include "BsTaskScheduler.h"
 #include "BsUUID.h"
 #include "BsDebug.h"
@@ -37,16 +38,18 @@ namespace bs
 
 	HResource Resources::load(const Path& filePath, ResourceLoadFlags loadFlags)
 	{
-		if (!FileSystem::isFile(filePath))
+		String uuid;
+		bool foundUUID = getUUIDFromFilePath(filePath, uuid);
+
+		// Resources contained in a registered pack don't need to exist as individual files
+		bool isPacked = foundUUID && findPackFile(uuid) != nullptr;
+		if (!isPacked && !FileSystem::isFile(filePath))
 		{
 			LOGWRN_VERBOSE("Cannot load resource. Specified file: " + filePath.toString() + " doesn't exist.");
 
 			return HResource();
 		}
 
-		String uuid;
-		bool foundUUID = getUUIDFromFilePath(filePath, uuid);
-
 		if (!foundUUID)
 			uuid = UUIDGenerator::generateRandom();
 
@@ -64,16 +67,18 @@ namespace bs
 
 	HResource Resources::loadAsync(const Path& filePath, ResourceLoadFlags loadFlags)
 	{
-		if (!FileSystem::isFile(filePath))
+		String uuid;
+		bool foundUUID = getUUIDFromFilePath(filePath, uuid);
+
+		// Resources contained in a registered pack don't need to exist as individual files
+		bool isPacked = foundUUID && findPackFile(uuid) != nullptr;
+		if (!isPacked && !FileSystem::isFile(filePath))
 		{
 			LOGWRN_VERBOSE("Cannot load resource. Specified file: " + filePath.toString() + " doesn't exist.");
 
 			return HResource();
 		}
 
-		String uuid;
-		bool foundUUID = getUUIDFromFilePath(filePath, uuid);
-
 		if (!foundUUID)
 			uuid = UUIDGenerator::generateRandom();
 
@@ -160,9 +165,13 @@ namespace bs
 			}			
 		}
 
+		// Resources contained in a registered pack are read from the pack instead of their own file
+		SPtr<PackFile> packFile = findPackFile(UUID);
+		bool hasSource = packFile != nullptr || !filePath.isEmpty();
+
 		// We have nowhere to load from, warn and complete load if a file path was provided,
 		// otherwise pass through as we might just want to load from memory. 
-		if (filePath.isEmpty())
+		if (!hasSource)
 		{
 			if (!alreadyLoading)
 			{
@@ -174,7 +183,7 @@ namespace bs
 				return outputResource;
 			}
 		}
-		else if (!FileSystem::isFile(filePath))
+		else if (packFile == nullptr && !FileSystem::isFile(filePath))
 		{
 			LOGWRN_VERBOSE("Cannot load resource. Specified file: " + filePath.toString() + " doesn't exist.");
 
@@ -186,12 +195,22 @@ namespace bs
 			return outputResource;
 		}
 
-		// Load dependency data if a file path is provided
+		// Load dependency data if a source is provided
 		SPtr<SavedResourceData> savedResourceData;
-		if (!filePath.isEmpty())
+		SPtr<DataStream> packStream;
+		if (hasSource)
 		{
-			FileDecoder fs(filePath);
-			savedResourceData = std::static_pointer_cast<SavedResourceData>(fs.decode());
+			SPtr<DataStream> stream = openResourceStream(UUID, filePath, packFile);
+			if (stream != nullptr)
+			{
+				FileDecoder fs(stream);
+				savedResourceData = std::static_pointer_cast<SavedResourceData>(fs.decode());
+			}
+
+			// Opening a pack entry can mean decompressing it, so keep the stream for reading the resource itself. Loose
+			// files are cheap to re-open, and keeping them open until the load task runs could exhaust file handles.
+			if (packFile != nullptr)
+				packStream = stream;
 		}
 
 		// If already loading keep the old load operation active, otherwise create a new one
@@ -314,21 +333,23 @@ namespace bs
 		}
 
 		// Actually start the file read operation if not already loaded or in progress
-		if (!alreadyLoading && !filePath.isEmpty())
+		if (!alreadyLoading && hasSource)
 		{
 			// Synchronous or the resource doesn't support async, read the file immediately
-			if (synchronous || !savedResourceData->allowAsyncLoading())
+			if (synchronous || savedResourceData == nullptr || !savedResourceData->allowAsyncLoading())
 			{
-				loadCallback(filePath, outputResource, loadFlags.isSet(ResourceLoadFlag::KeepSourceData));
+				loadCallback(filePath, packFile, packStream, outputResource, 
+					loadFlags.isSet(ResourceLoadFlag::KeepSourceData));
 			}
 			else // Asynchronous, read the file on a worker thread
 			{
-				String fileName = filePath.getFilename();
+				String fileName = packFile != nullptr ? UUID : filePath.getFilename();
 				String taskName = "Resource load: " + fileName;
 
 				bool keepSourceData = loadFlags.isSet(ResourceLoadFlag::KeepSourceData);
 				SPtr<Task> task = Task::create(taskName, 
-					std::bind(&Resources::loadCallback, this, filePath, outputResource, keepSourceData));
+					std::bind(&Resources::loadCallback, this, filePath, packFile, packStream, outputResource, 
+						keepSourceData));
 				TaskScheduler::instance().addTask(task);
 			}
 		}
@@ -353,10 +374,23 @@ namespace bs
 		return outputResource;
 	}
 
-	SPtr<Resource> Resources::loadFromDiskAndDeserialize(const Path& filePath, bool loadWithSaveData)
+	SPtr<Resource> Resources::loadFromDiskAndDeserialize(const String& UUID, const Path& filePath,
+		const SPtr<PackFile>& packFile, const SPtr<DataStream>& openStream, bool loadWithSaveData)
 	{
-		FileDecoder fs(filePath);
-		fs.skip(); // Skipped over saved resource data
+		SPtr<DataStream> stream = openStream;
+		bool skipSavedData = false;
+		if (stream == nullptr)
+		{
+			stream = openResourceStream(UUID, filePath, packFile);
+			if (stream == nullptr)
+				return nullptr;
+
+			skipSavedData = true;
+		}
+
+		FileDecoder fs(stream);
+		if (skipSavedData)
+			fs.skip(); // Skipped over saved resource data
 
 		UnorderedMap<String, UINT64> loadParams;
 		if(loadWithSaveData)
@@ -366,7 +400,14 @@ namespace bs
 
 		if (loadedData == nullptr)
 		{
-			LOGERR("Unable to load resource at path \"" + filePath.toString() + "\"");
+			if (packFile != nullptr)
+			{
+				LOGERR("Unable to load resource \"" + UUID + "\" from pack \"" + packFile->getPath().toString() + "\"");
+			}
+			else
+			{
+				LOGERR("Unable to load resource at path \"" + filePath.toString() + "\"");
+			}
 		}
 		else
 		{
@@ -378,6 +419,39 @@ namespace bs
 		return resource;
 	}
 
+	SPtr<DataStream> Resources::openResourceStream(const String& UUID, const Path& filePath,
+		const SPtr<PackFile>& packFile)
+	{
+		SPtr<DataStream> stream;
+		if (packFile != nullptr)
+		{
+			stream = packFile->openEntry(UUID);
+			if (stream == nullptr)
+				LOGERR("Unable to read resource \"" + UUID + "\" from pack \"" + packFile->getPath().toString() + "\"");
+		}
+		else
+		{
+			stream = FileSystem::openFile(filePath, true);
+			if (stream == nullptr)
+				LOGERR("Unable to open resource file at path \"" + filePath.toString() + "\"");
+		}
+
+		return stream;
+	}
+
+	SPtr<PackFile> Resources::findPackFile(const String& UUID) const
+	{
+		Lock lock(mPackFilesMutex);
+
+		for (auto iter = mPackFiles.rbegin(); iter != mPackFiles.rend(); ++iter)
+		{
+			if ((*iter)->contains(UUID))
+				return *iter;
+		}
+
+		return nullptr;
+	}
+
 	void Resources::release(ResourceHandleBase& resource)
 	{
 		const String& UUID = resource.getUUID();
@@ -601,6 +675,24 @@ namespace bs
 			mResourceManifests.erase(findIter);
 	}
 
+	void Resources::registerPackFile(const SPtr<PackFile>& packFile)
+	{
+		Lock lock(mPackFilesMutex);
+
+		auto findIter = std::find(mPackFiles.begin(), mPackFiles.end(), packFile);
+		if (findIter == mPackFiles.end())
+			mPackFiles.push_back(packFile);
+	}
+
+	void Resources::unregisterPackFile(const SPtr<PackFile>& packFile)
+	{
+		Lock lock(mPackFilesMutex);
+
+		auto findIter = std::find(mPackFiles.begin(), mPackFiles.end(), packFile);
+		if (findIter != mPackFiles.end())
+			mPackFiles.erase(findIter);
+	}
+
 	SPtr<ResourceManifest> Resources::getResourceManifest(const String& name) const
 	{
 		for(auto iter = mResourceManifests.rbegin(); iter != mResourceManifests.rend(); ++iter) 
@@ -761,9 +853,11 @@ namespace bs
 		}
 	}
 
-	void Resources::loadCallback(const Path& filePath, HResource& resource, bool loadWithSaveData)
+	void Resources::loadCallback(const Path& filePath, const SPtr<PackFile>& packFile, 
+		const SPtr<DataStream>& openStream, HResource& resource, bool loadWithSaveData)
 	{
-		SPtr<Resource> rawResource = loadFromDiskAndDeserialize(filePath, loadWithSaveData);
+		SPtr<Resource> rawResource = loadFromDiskAndDeserialize(resource.getUUID(), filePath, packFile, openStream,
+			loadWithSaveData);
 
 		{
 			Lock lock(mInProgressResourcesMutex);
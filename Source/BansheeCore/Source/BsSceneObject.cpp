@@ -95,7 +95,7 @@ namespace bs
 				if (isInstantiated())
 				{
 					if (getActive())
-						component->onDisabled();
+						disableComponent(component.get());
 
 					component->onDestroyed();
 				}
@@ -107,7 +107,13 @@ namespace bs
 			GameObjectManager::instance().unregisterObject(handle);
 		}
 		else
+		{
+			// The hierarchy is no longer part of the scene, so it shouldn't be updated while waiting for destruction
+			if (isInstantiated())
+				stopUpdatingHierarchy();
+
 			GameObjectManager::instance().queueForDestroy(handle);
+		}
 	}
 
 	void SceneObject::_setInstanceData(GameObjectInstanceDataPtr& other)
@@ -225,7 +231,7 @@ namespace bs
 				component->onInitialized();
 
 				if (obj->getActive())
-					component->onEnabled();
+					enableComponent(component.get());
 			}
 
 			for (auto& child : obj->mChildren)
@@ -665,12 +671,12 @@ namespace bs
 				if (activeHierarchy)
 				{
 					for (auto& component : mComponents)
-						component->onEnabled();
+						enableComponent(component.get());
 				}
 				else
 				{
 					for (auto& component : mComponents)
-						component->onDisabled();
+						disableComponent(component.get());
 				}
 			}
 		}
@@ -698,6 +704,26 @@ namespace bs
 		else
 			_unsetFlags(SOF_DontInstantiate);
 
+		// Pre-allocate storage for every scene object and component the clone will register
+		UINT32 numObjects = 0;
+		Stack<HSceneObject> todo;
+		todo.push(mThisHandle);
+
+		while (!todo.empty())
+		{
+			HSceneObject current = todo.top();
+			todo.pop();
+
+			numObjects += 1 + (UINT32)current->mComponents.size();
+
+			UINT32 childCount = current->getNumChildren();
+			for (UINT32 i = 0; i < childCount; i++)
+				todo.push(current->getChild(i));
+		}
+
+		GameObjectManager& gameObjectManager = GameObjectManager::instance();
+		gameObjectManager.reserve(gameObjectManager.getNumObjects() + numObjects);
+
 		UINT32 bufferSize = 0;
 
 		MemorySerializer serializer;
@@ -743,7 +769,7 @@ namespace bs
 			if (isInstantiated())
 			{
 				if (getActive())
-					component->onDisabled();
+					disableComponent(component.get());
 
 				(*iter)->onDestroyed();
 			}
@@ -781,6 +807,27 @@ namespace bs
 		mComponents.push_back(newComponent);
 	}
 
+	void SceneObject::enableComponent(Component* component)
+	{
+		component->onEnabled();
+		gCoreSceneManager()._notifyComponentActivated(component);
+	}
+
+	void SceneObject::disableComponent(Component* component)
+	{
+		gCoreSceneManager()._notifyComponentDeactivated(component);
+		component->onDisabled();
+	}
+
+	void SceneObject::stopUpdatingHierarchy()
+	{
+		for (auto& component : mComponents)
+			gCoreSceneManager()._notifyComponentDeactivated(component.get());
+
+		for (auto& child : mChildren)
+			child->stopUpdatingHierarchy();
+	}
+
 	RTTITypeBase* SceneObject::getRTTIStatic()
 	{
 		return SceneObjectRTTI::instance();
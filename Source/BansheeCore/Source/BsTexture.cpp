@@ -9,6 +9,7 @@
 #include "BsAsyncOp.h"
 #include "BsResources.h"
 #include "BsPixelUtil.h"
+#include "BsFileSystem.h"
 
 namespace bs 
 {
@@ -135,6 +136,13 @@ namespace bs
 			return PixelData(0, 0, 0, PF_UNKNOWN);
 		}
 
+		if (mipLevel < mAllocatedMip)
+		{
+			LOGERR("Mip level " + toString(mipLevel) + " isn't allocated. Most detailed allocated level is " + 
+				toString(mAllocatedMip));
+			return PixelData(0, 0, 0, PF_UNKNOWN);
+		}
+
 		if (face >= mProperties.getNumFaces())
 		{
 			LOGERR("Invalid face index: " + toString(face) + ". Min is 0, max is " + toString(mProperties.getNumFaces()));
@@ -198,6 +206,12 @@ namespace bs
 			return;
 		}
 
+		if (srcMipLevel < mAllocatedMip || dstMipLevel < target->mAllocatedMip)
+		{
+			LOGERR("Source and destination mip levels must be allocated.");
+			return;
+		}
+
 		UINT32 srcMipWidth = mProperties.getWidth() >> srcMipLevel;
 		UINT32 srcMipHeight = mProperties.getHeight() >> srcMipLevel;
 		UINT32 srcMipDepth = mProperties.getDepth() >> srcMipLevel;
@@ -215,6 +229,45 @@ namespace bs
 		copyImpl(srcFace, srcMipLevel, dstFace, dstMipLevel, target, queueIdx);
 	}
 
+	void TextureCore::setMostDetailedMip(UINT32 mip)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		mip = Math::clamp(mip, mAllocatedMip, mProperties.getNumMipmaps());
+		if (mip == mMostDetailedMip)
+			return;
+
+		mMostDetailedMip = mip;
+		setMostDetailedMipImpl(mip);
+	}
+
+	void TextureCore::setAllocatedMip(UINT32 mip)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		mip = std::min(mip, mProperties.getNumMipmaps());
+		if (mip == mAllocatedMip)
+			return;
+
+		const int unsupportedUsage = TU_RENDERTARGET | TU_DEPTHSTENCIL | TU_LOADSTORE;
+		if (mProperties.getTextureType() != TEX_TYPE_2D || mProperties.getNumFaces() != 1 || 
+			(mProperties.getUsage() & unsupportedUsage) != 0)
+		{
+			LOGERR("Mip levels can only be released for 2D textures with a single face that aren't render or load-store "
+				"targets.");
+			return;
+		}
+
+		// Released mip levels can no longer be sampled
+		if (mMostDetailedMip < mip)
+			setMostDetailedMip(mip);
+
+		UINT32 prevMip = mAllocatedMip;
+		mAllocatedMip = mip;
+
+		setAllocatedMipImpl(prevMip);
+	}
+
 	/************************************************************************/
 	/* 								TEXTURE VIEW                      		*/
 	/************************************************************************/
@@ -350,6 +403,11 @@ namespace bs
 
 		SPtr<CoreObjectCore> coreObj = TextureCoreManager::instance().createTextureInternal(props.mDesc, mInitData);
 
+		// Streamed textures are created with only their resident mip levels allocated
+		SPtr<TextureCore> textureCore = std::static_pointer_cast<TextureCore>(coreObj);
+		textureCore->mAllocatedMip = mResidentMip;
+		textureCore->mMostDetailedMip = mResidentMip;
+
 		if ((mProperties.getUsage() & TU_CPUCACHED) == 0)
 			mInitData = nullptr;
 
@@ -395,6 +453,148 @@ namespace bs
 			data, std::placeholders::_1));
 	}
 
+	void Texture::_setResidentMip(UINT32 mip, const Vector<SPtr<PixelData>>& mipData)
+	{
+		if (!_isStreamed())
+			return;
+
+		mip = std::min(mip, mProperties.getNumMipmaps());
+		if (mip == mResidentMip)
+			return;
+
+		std::function<void(const SPtr<TextureCore>&, UINT32)> allocateFunc =
+			[](const SPtr<TextureCore>& texture, UINT32 _mip)
+		{
+			texture->setAllocatedMip(_mip);
+		};
+
+		// Evicted mip levels are released, which also stops them from being sampled
+		if (mip > mResidentMip)
+		{
+			gCoreThread().queueCommand(std::bind(allocateFunc, getCore(), mip));
+			mResidentMip = mip;
+
+			return;
+		}
+
+		UINT32 numFaces = mProperties.getNumFaces();
+		if (mipData.size() != (mResidentMip - mip) * numFaces)
+		{
+			LOGERR("Data for mip levels " + toString(mip) + " to " + toString(mResidentMip - 1) + " wasn't provided.");
+			return;
+		}
+
+		// New mip levels are allocated and written before they are made available for sampling
+		gCoreThread().queueCommand(std::bind(allocateFunc, getCore(), mip));
+
+		for (UINT32 i = mip; i < mResidentMip; i++)
+		{
+			for (UINT32 j = 0; j < numFaces; j++)
+				writeData(mipData[(i - mip) * numFaces + j], j, i, false);
+		}
+
+		std::function<void(const SPtr<TextureCore>&, UINT32)> sampleFunc =
+			[](const SPtr<TextureCore>& texture, UINT32 _mip)
+		{
+			texture->setMostDetailedMip(_mip);
+		};
+
+		gCoreThread().queueCommand(std::bind(sampleFunc, getCore(), mip));
+		mResidentMip = mip;
+	}
+
+	Vector<SPtr<PixelData>> Texture::_readMipLevels(UINT32 mostDetailedMip, UINT32 leastDetailedMip) const
+	{
+		if (!_isStreamed() || mostDetailedMip >= leastDetailedMip)
+			return Vector<SPtr<PixelData>>();
+
+		// The file is only open while reading, so streamed textures don't hold on to file handles
+		SPtr<DataStream> stream = FileSystem::openFile(mStreamPath, true);
+		if (stream == nullptr)
+		{
+			LOGERR("Unable to open texture data at path \"" + mStreamPath.toString() + "\".");
+			return Vector<SPtr<PixelData>>();
+		}
+
+		return readMipLevels(stream, mStreamOffset, mostDetailedMip, leastDetailedMip);
+	}
+
+	void Texture::setStreamingId(UINT32 id)
+	{
+		mStreamingId = id;
+
+		std::function<void(const SPtr<TextureCore>&, UINT32)> func =
+			[](const SPtr<TextureCore>& texture, UINT32 _id)
+		{
+			texture->mStreamingId = _id;
+		};
+
+		gCoreThread().queueCommand(std::bind(func, getCore(), id));
+	}
+
+	Vector<SPtr<PixelData>> Texture::readMipLevels(const SPtr<DataStream>& stream, UINT64 offset, 
+		UINT32 mostDetailedMip, UINT32 leastDetailedMip) const
+	{
+		UINT32 numFaces = mProperties.getNumFaces();
+		leastDetailedMip = std::min(leastDetailedMip, mProperties.getNumMipmaps() + 1);
+
+		Vector<SPtr<PixelData>> output;
+		if (mostDetailedMip >= leastDetailedMip)
+			return output;
+
+		// Mip levels are stored starting with the least detailed one, followed by progressively more detailed ones
+		UINT64 mipOffset = 0;
+		for (UINT32 i = mProperties.getNumMipmaps(); i >= leastDetailedMip; i--)
+		{
+			UINT32 mipWidth, mipHeight, mipDepth;
+			PixelUtil::getSizeForMipLevel(mProperties.getWidth(), mProperties.getHeight(), mProperties.getDepth(),
+				i, mipWidth, mipHeight, mipDepth);
+
+			mipOffset += PixelUtil::getMemorySize(mipWidth, mipHeight, mipDepth, mStreamFormat) * numFaces;
+		}
+
+		output.resize((leastDetailedMip - mostDetailedMip) * numFaces);
+		for (INT32 i = (INT32)leastDetailedMip - 1; i >= (INT32)mostDetailedMip; i--)
+		{
+			UINT32 mipWidth, mipHeight, mipDepth;
+			PixelUtil::getSizeForMipLevel(mProperties.getWidth(), mProperties.getHeight(), mProperties.getDepth(),
+				(UINT32)i, mipWidth, mipHeight, mipDepth);
+
+			for (UINT32 j = 0; j < numFaces; j++)
+			{
+				SPtr<PixelData> pixelData = bs_shared_ptr_new<PixelData>(mipWidth, mipHeight, mipDepth, mStreamFormat);
+				pixelData->allocateInternalBuffer();
+
+				UINT32 dataSize = pixelData->getConsecutiveSize();
+				if ((mipOffset + dataSize) > mStreamSize)
+				{
+					LOGERR("Texture data stream is missing data for face " + toString(j) + " and mip level " +
+						toString(i) + ".");
+				}
+				else
+				{
+					stream->seek((size_t)(offset + mipOffset));
+					stream->read(pixelData->getData(), dataSize);
+				}
+
+				mipOffset += dataSize;
+
+				if (mStreamFormat != mProperties.getFormat())
+				{
+					SPtr<PixelData> convertedData = PixelData::create(mipWidth, mipHeight, mipDepth, 
+						mProperties.getFormat());
+					PixelUtil::bulkPixelConversion(*pixelData, *convertedData);
+
+					pixelData = convertedData;
+				}
+
+				output[((UINT32)i - mostDetailedMip) * numFaces + j] = pixelData;
+			}
+		}
+
+		return output;
+	}
+
 	UINT32 Texture::calculateSize() const
 	{
 		return mProperties.getNumFaces() * PixelUtil::getMemorySize(mProperties.getWidth(),
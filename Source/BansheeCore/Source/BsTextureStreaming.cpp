@@ -0,0 +1,250 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsTextureStreaming.h"
+#include "BsPixelUtil.h"
+#include "BsMath.h"
+
+namespace bs
+{
+	TextureStreaming::TextureStreaming(const TEXTURE_STREAMING_DESC& desc)
+		:mDesc(desc)
+	{ }
+
+	UINT32 TextureStreaming::registerTexture(const TextureProperties& props, UINT32 residentMip)
+	{
+		UINT32 id;
+		if (!mFreeEntries.empty())
+		{
+			id = mFreeEntries.back();
+			mFreeEntries.pop_back();
+		}
+		else
+		{
+			id = (UINT32)mEntries.size();
+			mEntries.push_back(Entry());
+		}
+
+		UINT32 numMips = props.getNumMipmaps() + 1;
+
+		Entry& entry = mEntries[id];
+		entry = Entry();
+		entry.active = true;
+		entry.minResidentMip = calculateMinResidentMip(props, mDesc.minResidentSize);
+		entry.residentMip = std::min(residentMip, numMips - 1);
+		entry.requestedMip = entry.minResidentMip;
+		entry.targetMip = entry.residentMip;
+
+		// Last entry represents an empty mip chain, so the size of any range of mip levels can be looked up
+		entry.mipChainSizes.resize(numMips + 1);
+		entry.mipChainSizes[numMips] = 0;
+		for (INT32 i = (INT32)numMips - 1; i >= 0; i--)
+		{
+			UINT32 mipWidth, mipHeight, mipDepth;
+			PixelUtil::getSizeForMipLevel(props.getWidth(), props.getHeight(), props.getDepth(), i, mipWidth, mipHeight,
+				mipDepth);
+
+			UINT64 mipSize = PixelUtil::getMemorySize(mipWidth, mipHeight, mipDepth, props.getFormat());
+			entry.mipChainSizes[i] = entry.mipChainSizes[i + 1] + mipSize * props.getNumFaces();
+		}
+
+		mResidentBytes += getSize(entry, entry.residentMip);
+		mNumActiveEntries++;
+
+		return id;
+	}
+
+	void TextureStreaming::unregisterTexture(UINT32 id)
+	{
+		if (id >= (UINT32)mEntries.size() || !mEntries[id].active)
+			return;
+
+		Entry& entry = mEntries[id];
+		mResidentBytes -= getSize(entry, entry.residentMip);
+
+		entry = Entry();
+		mFreeEntries.push_back(id);
+		mNumActiveEntries--;
+	}
+
+	void TextureStreaming::requestTexelDensity(UINT32 id, float texelsPerPixel)
+	{
+		if (id >= (UINT32)mEntries.size() || !mEntries[id].active)
+			return;
+
+		Entry& entry = mEntries[id];
+
+		UINT32 numMips = (UINT32)entry.mipChainSizes.size() - 1;
+		UINT32 mip = calculateRequiredMip(texelsPerPixel, numMips);
+
+		if (!entry.hasPendingRequest || mip < entry.pendingRequestMip)
+			entry.pendingRequestMip = mip;
+
+		entry.hasPendingRequest = true;
+	}
+
+	void TextureStreaming::update(Vector<TextureResidencyChange>& changes)
+	{
+		mFrameIdx++;
+
+		// Determine the detail each texture wants, ignoring the budget
+		UINT64 totalSize = 0;
+		UINT32 numEntries = (UINT32)mEntries.size();
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			Entry& entry = mEntries[i];
+			if (!entry.active)
+				continue;
+
+			if (entry.hasPendingRequest)
+			{
+				entry.requestedMip = entry.pendingRequestMip;
+				entry.lastRequestFrame = mFrameIdx;
+				entry.hasPendingRequest = false;
+			}
+
+			bool isStale = entry.lastRequestFrame == 0 || (mFrameIdx - entry.lastRequestFrame) > mDesc.evictionDelay;
+			if (isStale)
+				entry.targetMip = entry.minResidentMip;
+			else
+				entry.targetMip = std::min(entry.requestedMip, entry.minResidentMip);
+
+			totalSize += getSize(entry, entry.targetMip);
+		}
+
+		// Drop detail until within budget, starting with the least recently requested and then the largest textures
+		if (totalSize > mDesc.memoryBudget)
+		{
+			Vector<UINT32> candidates;
+			for (UINT32 i = 0; i < numEntries; i++)
+			{
+				const Entry& entry = mEntries[i];
+				if (entry.active && entry.targetMip < entry.minResidentMip)
+					candidates.push_back(i);
+			}
+
+			std::sort(candidates.begin(), candidates.end(),
+				[&](UINT32 a, UINT32 b)
+			{
+				const Entry& entryA = mEntries[a];
+				const Entry& entryB = mEntries[b];
+
+				if (entryA.lastRequestFrame != entryB.lastRequestFrame)
+					return entryA.lastRequestFrame < entryB.lastRequestFrame;
+
+				return getSize(entryA, entryA.targetMip) > getSize(entryB, entryB.targetMip);
+			});
+
+			for (auto& idx : candidates)
+			{
+				Entry& entry = mEntries[idx];
+				while (entry.targetMip < entry.minResidentMip && totalSize > mDesc.memoryBudget)
+				{
+					totalSize -= getSize(entry, entry.targetMip) - getSize(entry, entry.targetMip + 1);
+					entry.targetMip++;
+				}
+
+				if (totalSize <= mDesc.memoryBudget)
+					break;
+			}
+		}
+
+		// Evict first, so the memory is released before the textures being loaded allocate theirs
+		Vector<UINT32> loads;
+		for (UINT32 i = 0; i < numEntries; i++)
+		{
+			Entry& entry = mEntries[i];
+			if (!entry.active)
+				continue;
+
+			if (entry.targetMip > entry.residentMip)
+			{
+				mResidentBytes -= getSize(entry, entry.residentMip) - getSize(entry, entry.targetMip);
+				entry.residentMip = entry.targetMip;
+
+				changes.push_back({ i, entry.residentMip });
+			}
+			else if (entry.targetMip < entry.residentMip)
+				loads.push_back(i);
+		}
+
+		// Load the most recently requested textures first, then the ones missing the most detail
+		std::sort(loads.begin(), loads.end(),
+			[&](UINT32 a, UINT32 b)
+		{
+			const Entry& entryA = mEntries[a];
+			const Entry& entryB = mEntries[b];
+
+			if (entryA.lastRequestFrame != entryB.lastRequestFrame)
+				return entryA.lastRequestFrame > entryB.lastRequestFrame;
+
+			return (entryA.residentMip - entryA.targetMip) > (entryB.residentMip - entryB.targetMip);
+		});
+
+		UINT64 loadedSize = 0;
+		for (auto& idx : loads)
+		{
+			Entry& entry = mEntries[idx];
+
+			UINT64 loadSize = getSize(entry, entry.targetMip) - getSize(entry, entry.residentMip);
+			if (loadedSize > 0 && (loadedSize + loadSize) > mDesc.maxLoadPerFrame)
+				continue;
+
+			loadedSize += loadSize;
+			mResidentBytes += loadSize;
+			entry.residentMip = entry.targetMip;
+
+			changes.push_back({ idx, entry.residentMip });
+		}
+	}
+
+	TextureResidencyStats TextureStreaming::getStats(UINT32 id) const
+	{
+		TextureResidencyStats stats;
+		if (id >= (UINT32)mEntries.size() || !mEntries[id].active)
+			return stats;
+
+		const Entry& entry = mEntries[id];
+		stats.numMips = (UINT32)entry.mipChainSizes.size() - 1;
+		stats.residentMip = entry.residentMip;
+		stats.requestedMip = entry.requestedMip;
+		stats.targetMip = entry.targetMip;
+		stats.residentBytes = getSize(entry, entry.residentMip);
+		stats.lastRequestFrame = entry.lastRequestFrame;
+
+		return stats;
+	}
+
+	UINT32 TextureStreaming::calculateRequiredMip(float texelsPerPixel, UINT32 numMips)
+	{
+		if (texelsPerPixel <= 1.0f || numMips == 0)
+			return 0;
+
+		UINT32 mip = (UINT32)Math::floorToInt(Math::log2(texelsPerPixel));
+		return std::min(mip, numMips - 1);
+	}
+
+	UINT32 TextureStreaming::calculateMinResidentMip(const TextureProperties& props, UINT32 minResidentSize)
+	{
+		UINT32 mip = 0;
+		UINT32 size = std::max(props.getWidth(), props.getHeight());
+		while ((size >> mip) > minResidentSize && mip < props.getNumMipmaps())
+			mip++;
+
+		return mip;
+	}
+
+	UINT64 TextureStreaming::calculateMipChainSize(const TextureProperties& props, UINT32 mostDetailedMip)
+	{
+		UINT64 size = 0;
+		for (UINT32 i = mostDetailedMip; i <= props.getNumMipmaps(); i++)
+		{
+			UINT32 mipWidth, mipHeight, mipDepth;
+			PixelUtil::getSizeForMipLevel(props.getWidth(), props.getHeight(), props.getDepth(), i, mipWidth, mipHeight,
+				mipDepth);
+
+			size += PixelUtil::getMemorySize(mipWidth, mipHeight, mipDepth, props.getFormat()) * props.getNumFaces();
+		}
+
+		return size;
+	}
+}
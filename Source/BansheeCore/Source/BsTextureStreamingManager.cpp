@@ -0,0 +1,214 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsTextureStreamingManager.h"
+#include "BsTexture.h"
+#include "BsTaskScheduler.h"
+
+namespace bs
+{
+	TextureStreamingManager::TextureStreamingManager(const TEXTURE_STREAMING_DESC& desc)
+		:mStreaming(desc)
+	{ }
+
+	TextureResidencyStats TextureStreamingManager::getStats(const HTexture& texture) const
+	{
+		if (!texture.isLoaded())
+			return TextureResidencyStats();
+
+		UINT32 streamingId = texture->_getStreamingId();
+		if (streamingId == (UINT32)-1)
+			return TextureResidencyStats();
+
+		Lock lock(mMutex);
+		return mStreaming.getStats(streamingId);
+	}
+
+	UINT64 TextureStreamingManager::getResidentBytes() const
+	{
+		Lock lock(mMutex);
+		return mStreaming.getResidentBytes();
+	}
+
+	UINT32 TextureStreamingManager::getNumTextures() const
+	{
+		Lock lock(mMutex);
+		return mStreaming.getNumTextures();
+	}
+
+	TEXTURE_STREAMING_DESC TextureStreamingManager::getDesc() const
+	{
+		Lock lock(mMutex);
+		return mStreaming.getDesc();
+	}
+
+	void TextureStreamingManager::setDesc(const TEXTURE_STREAMING_DESC& desc)
+	{
+		Lock lock(mMutex);
+		mStreaming.setDesc(desc);
+	}
+
+	UINT32 TextureStreamingManager::getMinResidentMip(const TextureProperties& props) const
+	{
+		Lock lock(mMutex);
+		return TextureStreaming::calculateMinResidentMip(props, mStreaming.getDesc().minResidentSize);
+	}
+
+	bool TextureStreamingManager::isStreamable(const TextureProperties& props)
+	{
+		const int nonStreamableUsage = TU_CPUCACHED | TU_DYNAMIC | TU_LOADSTORE | TU_RENDERTARGET | TU_DEPTHSTENCIL;
+
+		return props.getTextureType() == TEX_TYPE_2D && props.getNumFaces() == 1 && props.getNumMipmaps() > 0 &&
+			(props.getUsage() & nonStreamableUsage) == 0;
+	}
+
+	UINT32 TextureStreamingManager::_registerTexture(const SPtr<Texture>& texture)
+	{
+		Lock lock(mMutex);
+
+		UINT32 streamingId = mStreaming.registerTexture(texture->getProperties(), texture->getResidentMip());
+		mTextures[streamingId] = texture;
+
+		return streamingId;
+	}
+
+	void TextureStreamingManager::_notifyTexelDensity(UINT32 streamingId, float texelsPerPixel)
+	{
+		Lock lock(mRequestMutex);
+
+		auto iterFind = mDensityRequests.find(streamingId);
+		if (iterFind == mDensityRequests.end())
+			mDensityRequests[streamingId] = texelsPerPixel;
+		else
+			iterFind->second = std::min(iterFind->second, texelsPerPixel);
+	}
+
+	void TextureStreamingManager::_notifyTexelDensities(const Vector<std::pair<UINT32, float>>& densities)
+	{
+		Lock lock(mRequestMutex);
+
+		for (auto& entry : densities)
+		{
+			auto iterFind = mDensityRequests.find(entry.first);
+			if (iterFind == mDensityRequests.end())
+				mDensityRequests[entry.first] = entry.second;
+			else
+				iterFind->second = std::min(iterFind->second, entry.second);
+		}
+	}
+
+	void TextureStreamingManager::_update()
+	{
+		// Apply mip levels whose reads finished since the last update
+		for (auto iter = mPendingLoads.begin(); iter != mPendingLoads.end();)
+		{
+			PendingLoad& load = iter->second;
+			if (!load.task->isComplete())
+			{
+				++iter;
+				continue;
+			}
+
+			UINT32 streamingId = iter->first;
+			SPtr<Texture> texture = load.texture;
+			UINT32 loadedMip = load.mostDetailedMip;
+			UINT32 nextMip = load.nextMip;
+
+			texture->_setResidentMip(loadedMip, *load.mipData);
+			iter = mPendingLoads.erase(iter);
+
+			if (nextMip != loadedMip)
+				setResidentMip(streamingId, texture, nextMip);
+		}
+
+		UnorderedMap<UINT32, float> requests;
+		{
+			Lock lock(mRequestMutex);
+			std::swap(requests, mDensityRequests);
+		}
+
+		Vector<std::pair<UINT32, SPtr<Texture>>> changedTextures;
+		Vector<UINT32> changedMips;
+		{
+			Lock lock(mMutex);
+
+			for (auto iter = mTextures.begin(); iter != mTextures.end();)
+			{
+				if (iter->second.expired())
+				{
+					mStreaming.unregisterTexture(iter->first);
+					iter = mTextures.erase(iter);
+				}
+				else
+					++iter;
+			}
+
+			for (auto& entry : requests)
+				mStreaming.requestTexelDensity(entry.first, entry.second);
+
+			mChanges.clear();
+			mStreaming.update(mChanges);
+
+			for (auto& change : mChanges)
+			{
+				auto iterFind = mTextures.find(change.id);
+				if (iterFind == mTextures.end())
+					continue;
+
+				SPtr<Texture> texture = iterFind->second.lock();
+				if (texture != nullptr)
+				{
+					changedTextures.push_back(std::make_pair(change.id, texture));
+					changedMips.push_back(change.mostDetailedMip);
+				}
+			}
+		}
+
+		// Applied outside of the lock, as textures can be registered from other threads
+		for (UINT32 i = 0; i < (UINT32)changedTextures.size(); i++)
+			setResidentMip(changedTextures[i].first, changedTextures[i].second, changedMips[i]);
+	}
+
+	void TextureStreamingManager::onShutDown()
+	{
+		for (auto& entry : mPendingLoads)
+			entry.second.task->wait();
+
+		mPendingLoads.clear();
+	}
+
+	void TextureStreamingManager::setResidentMip(UINT32 streamingId, const SPtr<Texture>& texture, UINT32 mip)
+	{
+		// Only one read per texture is in progress at a time, later changes are applied once it finishes
+		auto iterFind = mPendingLoads.find(streamingId);
+		if (iterFind != mPendingLoads.end())
+		{
+			iterFind->second.nextMip = mip;
+			return;
+		}
+
+		// Evicted mip levels are released from GPU memory, so every level that becomes resident needs to be read
+		UINT32 residentMip = texture->getResidentMip();
+		if (mip >= residentMip)
+		{
+			texture->_setResidentMip(mip);
+			return;
+		}
+
+		PendingLoad load;
+		load.texture = texture;
+		load.mipData = bs_shared_ptr_new<Vector<SPtr<PixelData>>>();
+		load.mostDetailedMip = mip;
+		load.nextMip = mip;
+
+		// The pending load keeps the texture alive until the read finishes and is applied on this thread
+		Texture* texturePtr = texture.get();
+		SPtr<Vector<SPtr<PixelData>>> mipData = load.mipData;
+		load.task = Task::create("TextureStreaming", [texturePtr, mipData, mip, residentMip]()
+		{
+			*mipData = texturePtr->_readMipLevels(mip, residentMip);
+		});
+
+		mPendingLoads[streamingId] = load;
+		TaskScheduler::instance().addTask(load.task);
+	}
+}
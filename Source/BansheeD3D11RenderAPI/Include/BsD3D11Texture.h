@@ -59,6 +59,18 @@ namespace bs
 		void writeDataImpl(const PixelData& src, UINT32 mipLevel = 0, UINT32 face = 0, bool discardWholeBuffer = false,
 					   UINT32 queueIdx = 0) override;
 
+		/** @copydoc TextureCore::setMostDetailedMipImpl */
+		void setMostDetailedMipImpl(UINT32 mip) override;
+
+		/** @copydoc TextureCore::setAllocatedMipImpl */
+		void setAllocatedMipImpl(UINT32 prevMip) override;
+
+		/**
+		 * Returns the index of the DX11 subresource for the specified mip level and face. Only allocated mip levels are
+		 * part of the DX11 resource, so their indices are offset by the most detailed allocated mip level.
+		 */
+		UINT32 getSubresourceIdx(UINT32 mipLevel, UINT32 face) const;
+
 		/**	Creates a blank DX11 1D texture object. */
 		void create1DTex();
 
@@ -68,6 +80,12 @@ namespace bs
 		/**	Creates a blank DX11 3D texture object. */
 		void create3DTex();
 
+		/**
+		 * Checks is the texture created as a staging resource. Staging textures cannot be bound to the pipeline but can
+		 * be mapped for reading directly, without an intermediate copy.
+		 */
+		bool isStaging() const;
+
 		/**
 		 * Creates a staging buffer that is used as a temporary buffer for read operations on textures that do not support
 		 * direct reading.
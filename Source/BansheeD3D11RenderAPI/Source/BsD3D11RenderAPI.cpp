@@ -47,7 +47,7 @@ namespace bs
 
 	const StringID& D3D11RenderAPI::getName() const
 	{
-		static StringID strName("D3D11RenderAPI");
+		static StringID strName = "D3D11RenderAPI"_sid;
 		return strName;
 	}
 
@@ -1129,6 +1129,7 @@ namespace bs
 		caps.setRenderAPIName(getName());
 
 		caps.setCapability(RSC_TEXTURE_COMPRESSION_BC);
+		caps.setCapability(RSC_TEXTURE_STREAMING);
 		caps.addShaderProfile("hlsl");
 
 		if(mFeatureLevel >= D3D_FEATURE_LEVEL_10_1)
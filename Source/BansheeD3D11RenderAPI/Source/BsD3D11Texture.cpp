@@ -63,8 +63,8 @@ namespace bs
 	{
 		D3D11TextureCore* other = static_cast<D3D11TextureCore*>(target.get());
 
-		UINT32 srcResIdx = D3D11CalcSubresource(srcMipLevel, srcFace, mProperties.getNumMipmaps() + 1);
-		UINT32 destResIdx = D3D11CalcSubresource(destMipLevel, destFace, target->getProperties().getNumMipmaps() + 1);
+		UINT32 srcResIdx = getSubresourceIdx(srcMipLevel, srcFace);
+		UINT32 destResIdx = other->getSubresourceIdx(destMipLevel, destFace);
 
 		D3D11RenderAPI* rs = static_cast<D3D11RenderAPI*>(RenderAPICore::instancePtr());
 		D3D11Device& device = rs->getPrimaryDevice();
@@ -124,7 +124,12 @@ namespace bs
 
 		if(flags == D3D11_MAP_READ || flags == D3D11_MAP_READ_WRITE)
 		{
-			UINT8* data = (UINT8*)mapstagingbuffer(flags, face, mipLevel, rowPitch, slicePitch);
+			UINT8* data;
+			if (isStaging())
+				data = (UINT8*)map(mTex, flags, face, mipLevel, rowPitch, slicePitch);
+			else
+				data = (UINT8*)mapstagingbuffer(flags, face, mipLevel, rowPitch, slicePitch);
+
 			lockedArea.setExternalBuffer(data);
 			lockedArea.setRowPitch(rowPitch);
 			lockedArea.setSlicePitch(slicePitch);
@@ -151,7 +156,12 @@ namespace bs
 	void D3D11TextureCore::unlockImpl()
 	{
 		if(mLockedForReading)
-			unmapstagingbuffer();
+		{
+			if (isStaging())
+				unmap(mTex);
+			else
+				unmapstagingbuffer();
+		}
 		else
 		{
 			if ((mProperties.getUsage() & TU_DYNAMIC) != 0)
@@ -215,7 +225,7 @@ namespace bs
 			D3D11RenderAPI* rs = static_cast<D3D11RenderAPI*>(RenderAPICore::instancePtr());
 			D3D11Device& device = rs->getPrimaryDevice();
 
-			UINT subresourceIdx = D3D11CalcSubresource(mipLevel, face, mProperties.getNumMipmaps() + 1);
+			UINT subresourceIdx = getSubresourceIdx(mipLevel, face);
 			UINT32 rowWidth = D3D11Mappings::getSizeInBytes(format, src.getWidth());
 			UINT32 sliceWidth = D3D11Mappings::getSizeInBytes(format, src.getWidth(), src.getHeight());
 
@@ -235,6 +245,65 @@ namespace bs
 		}
 	}
 
+	void D3D11TextureCore::setMostDetailedMipImpl(UINT32 mip)
+	{
+		if (mShaderResourceView == nullptr)
+			return;
+
+		// The view is retrieved whenever the texture is bound, so replacing it is enough for the change to take effect
+		TEXTURE_VIEW_DESC viewDesc = mShaderResourceView->getDesc();
+		viewDesc.mostDetailMip = mip;
+		viewDesc.numMips = mProperties.getNumMipmaps() + 1 - mip;
+
+		SPtr<TextureCore> thisPtr = std::static_pointer_cast<TextureCore>(getThisPtr());
+		mShaderResourceView = bs_shared_ptr<D3D11TextureView>(new (bs_alloc<D3D11TextureView>()) D3D11TextureView(thisPtr, viewDesc));
+	}
+
+	void D3D11TextureCore::setAllocatedMipImpl(UINT32 prevMip)
+	{
+		// Resources can't be resized, so a new resource containing only the allocated mip levels is created, and the
+		// levels present in both resources are copied over
+		ID3D11Resource* prevTex = mTex;
+		ID3D11Texture2D* prev2DTex = m2DTex;
+		mTex = nullptr;
+		m2DTex = nullptr;
+
+		create2DTex();
+
+		D3D11RenderAPI* rs = static_cast<D3D11RenderAPI*>(RenderAPICore::instancePtr());
+		D3D11Device& device = rs->getPrimaryDevice();
+
+		UINT32 numMips = mProperties.getNumMipmaps() + 1;
+		UINT32 numFaces = mProperties.getNumFaces();
+		for (UINT32 face = 0; face < numFaces; face++)
+		{
+			for (UINT32 mip = std::max(prevMip, mAllocatedMip); mip < numMips; mip++)
+			{
+				UINT32 srcResIdx = D3D11CalcSubresource(mip - prevMip, face, numMips - prevMip);
+				UINT32 dstResIdx = getSubresourceIdx(mip, face);
+
+				device.getImmediateContext()->CopySubresourceRegion(mTex, dstResIdx, 0, 0, 0, prevTex, srcResIdx, nullptr);
+			}
+		}
+
+		if (device.hasError())
+		{
+			String errorDescription = device.getErrorDescription();
+			BS_EXCEPT(RenderingAPIException, "D3D11 device cannot copy subresource\nError Description:" + errorDescription);
+		}
+
+		SAFE_RELEASE(prevTex);
+		SAFE_RELEASE(prev2DTex);
+
+		// Views reference the previous resource
+		clearBufferViews();
+	}
+
+	UINT32 D3D11TextureCore::getSubresourceIdx(UINT32 mipLevel, UINT32 face) const
+	{
+		return D3D11CalcSubresource(mipLevel - mAllocatedMip, face, mProperties.getNumMipmaps() + 1 - mAllocatedMip);
+	}
+
 	void D3D11TextureCore::create1DTex()
 	{
 		UINT32 width = mProperties.getWidth();
@@ -352,10 +421,11 @@ namespace bs
 
 	void D3D11TextureCore::create2DTex()
 	{
-		UINT32 width = mProperties.getWidth();
-		UINT32 height = mProperties.getHeight();
+		// Only the allocated mip levels are part of the resource
+		UINT32 width = std::max(1U, mProperties.getWidth() >> mAllocatedMip);
+		UINT32 height = std::max(1U, mProperties.getHeight() >> mAllocatedMip);
 		int usage = mProperties.getUsage();
-		UINT32 numMips = mProperties.getNumMipmaps();
+		UINT32 numMips = mProperties.getNumMipmaps() - mAllocatedMip;
 		PixelFormat format = mProperties.getFormat();
 		bool hwGamma = mProperties.isHardwareGammaEnabled();
 		UINT32 sampleCount = mProperties.getNumSamples();
@@ -430,6 +500,18 @@ namespace bs
 			mDXGIColorFormat = D3D11Mappings::getShaderResourceDepthStencilPF(closestFormat);
 			mDXGIDepthStencilFormat = d3dPF;
 		}
+		else if(isStaging())
+		{
+			desc.Usage			= D3D11_USAGE_STAGING;
+			desc.BindFlags		= 0;
+			desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+			desc.MipLevels		= numMips + 1;
+
+			DXGI_SAMPLE_DESC sampleDesc;
+			sampleDesc.Count	= 1;
+			sampleDesc.Quality	= 0;
+			desc.SampleDesc		= sampleDesc;
+		}
 		else
 		{
 			desc.Usage = D3D11Mappings::getUsage((GpuBufferUsage)usage);
@@ -482,11 +564,11 @@ namespace bs
 		mDXGIFormat = desc.Format;
 
 		// Create shader texture view
-		if((usage & TU_DEPTHSTENCIL) == 0 || readableDepth)
+		if(((usage & TU_DEPTHSTENCIL) == 0 || readableDepth) && !isStaging())
 		{
 			TEXTURE_VIEW_DESC viewDesc;
-			viewDesc.mostDetailMip = 0;
-			viewDesc.numMips = desc.MipLevels;
+			viewDesc.mostDetailMip = mMostDetailedMip;
+			viewDesc.numMips = mProperties.getNumMipmaps() + 1 - mMostDetailedMip;
 			viewDesc.firstArraySlice = 0;
 			viewDesc.numArraySlices = desc.ArraySize;
 			viewDesc.usage = GVU_DEFAULT;
@@ -626,7 +708,7 @@ namespace bs
 		D3D11RenderAPI* rs = static_cast<D3D11RenderAPI*>(RenderAPICore::instancePtr());
 		D3D11Device& device = rs->getPrimaryDevice();
 
-		mLockedSubresourceIdx = D3D11CalcSubresource(mipLevel, face, mProperties.getNumMipmaps() + 1);
+		mLockedSubresourceIdx = getSubresourceIdx(mipLevel, face);
 		device.getImmediateContext()->Map(res, mLockedSubresourceIdx, flags, 0, &pMappedResource);
 
 		if (device.hasError())
@@ -680,7 +762,7 @@ namespace bs
 	void* D3D11TextureCore::mapstaticbuffer(PixelData lock, UINT32 mipLevel, UINT32 face)
 	{
 		UINT32 sizeOfImage = lock.getConsecutiveSize();
-		mLockedSubresourceIdx = D3D11CalcSubresource(mipLevel, face, mProperties.getNumMipmaps()+1);
+		mLockedSubresourceIdx = getSubresourceIdx(mipLevel, face);
 
 		mStaticBuffer = bs_new<PixelData>(lock.getWidth(), lock.getHeight(), lock.getDepth(), lock.getFormat());
 		mStaticBuffer->allocateInternalBuffer();
@@ -707,6 +789,16 @@ namespace bs
 			bs_delete(mStaticBuffer);
 	}
 
+	bool D3D11TextureCore::isStaging() const
+	{
+		// Only 2D textures that aren't used by the pipeline in any other way are created as staging resources
+		int usage = mProperties.getUsage();
+		if ((usage & TU_CPUREADABLE) == 0 || (usage & (TU_RENDERTARGET | TU_DEPTHSTENCIL | TU_LOADSTORE)) != 0)
+			return false;
+
+		return mProperties.getTextureType() == TEX_TYPE_2D;
+	}
+
 	ID3D11ShaderResourceView* D3D11TextureCore::getSRV() const
 	{
 		return mShaderResourceView->getSRV();
@@ -15,17 +15,20 @@ namespace bs
 	{
 		D3D11TextureCore* d3d11Texture = static_cast<D3D11TextureCore*>(mOwnerTexture.get());
 
+		// Only the allocated mip levels are part of the DX11 resource
+		UINT32 mostDetailMip = mDesc.mostDetailMip - d3d11Texture->getAllocatedMip();
+
 		if ((mDesc.usage & GVU_RANDOMWRITE) != 0)
-			mUAV = createUAV(d3d11Texture, mDesc.mostDetailMip, mDesc.firstArraySlice, mDesc.numArraySlices);
+			mUAV = createUAV(d3d11Texture, mostDetailMip, mDesc.firstArraySlice, mDesc.numArraySlices);
 		else if ((mDesc.usage & GVU_RENDERTARGET) != 0)
-			mRTV = createRTV(d3d11Texture, mDesc.mostDetailMip, mDesc.firstArraySlice, mDesc.numArraySlices);
+			mRTV = createRTV(d3d11Texture, mostDetailMip, mDesc.firstArraySlice, mDesc.numArraySlices);
 		else if ((mDesc.usage & GVU_DEPTHSTENCIL) != 0)
 		{
-			mDSV = createDSV(d3d11Texture, mDesc.mostDetailMip, mDesc.firstArraySlice, mDesc.numArraySlices, false);
-			mRODSV = createDSV(d3d11Texture, mDesc.mostDetailMip, mDesc.firstArraySlice, mDesc.numArraySlices, true);
+			mDSV = createDSV(d3d11Texture, mostDetailMip, mDesc.firstArraySlice, mDesc.numArraySlices, false);
+			mRODSV = createDSV(d3d11Texture, mostDetailMip, mDesc.firstArraySlice, mDesc.numArraySlices, true);
 		}
 		else
-			mSRV = createSRV(d3d11Texture, mDesc.mostDetailMip, mDesc.numMips, mDesc.firstArraySlice, mDesc.numArraySlices);
+			mSRV = createSRV(d3d11Texture, mostDetailMip, mDesc.numMips, mDesc.firstArraySlice, mDesc.numArraySlices);
 	}
 
 	D3D11TextureView::~D3D11TextureView()
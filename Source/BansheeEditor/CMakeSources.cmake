@@ -114,6 +114,7 @@ set(BS_BANSHEEEDITOR_INC_UNDOREDO
 set(BS_BANSHEEEDITOR_INC_RTTI
 	"Include/BsPlatformInfoRTTI.h"
 	"Include/BsBuildDataRTTI.h"
+	"Include/BsBuildCacheRTTI.h"
 	"Include/BsDockManagerLayoutRTTI.h"
 	"Include/BsEditorWidgetLayoutRTTI.h"
 	"Include/BsProjectLibraryEntriesRTTI.h"
@@ -200,11 +201,13 @@ set(BS_BANSHEEEDITOR_SRC_UNDOREDO
 
 set(BS_BANSHEEEDITOR_INC_BUILD
 	"Include/BsBuildManager.h"
+	"Include/BsBuildCache.h"
 	"Include/BsPlatformInfo.h"
 )
 
 set(BS_BANSHEEEDITOR_SRC_BUILD
 	"Source/BsBuildManager.cpp"
+	"Source/BsBuildCache.cpp"
 	"Source/BsBuiltinEditorResources.cpp"
 	"Source/BsPlatformInfo.cpp"
 )
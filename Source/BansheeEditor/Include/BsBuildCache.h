@@ -0,0 +1,100 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "BsIReflectable.h"
+
+namespace bs
+{
+	/** @addtogroup Build
+	 *  @{
+	 */
+
+	/**
+	 * Content addressed cache of files output by the build. Each output is stored under a key calculated from the data
+	 * it was generated from, so outputs of unchanged resources can be linked into a new build instead of being processed
+	 * again. The cache also remembers hashes of previously hashed files so unmodified files don't need to be re-read on
+	 * every build.
+	 */
+	class BS_ED_EXPORT BuildCache : public IReflectable
+	{
+	public:
+		/** Information about a file whose contents were hashed. */
+		struct FileHash
+		{
+			std::time_t lastModifiedTime;
+			UINT64 size;
+			UINT64 hash;
+		};
+
+		BuildCache();
+
+		/**
+		 * Calculates hashes of the contents of the provided files, using multiple threads if available. Hashes of files 
+		 * that haven't been modified since they were last hashed are reused.
+		 *
+		 * @param[in]	files		Absolute paths to the files to hash.
+		 * @param[out]	hashes		Hash for each entry in @p files, or 0 if the file could not be read.
+		 */
+		void calculateHashes(const Vector<Path>& files, Vector<UINT64>& hashes);
+
+		/** Checks if an output with the provided key exists in the cache. */
+		bool hasOutput(UINT64 key) const;
+
+		/** Returns the path at which the output with the provided key is stored. */
+		Path getOutputPath(UINT64 key) const;
+
+		/**
+		 * Copies the provided files into the cache, using multiple threads if available.
+		 *
+		 * @param[in]	files	Absolute paths to the files to add.
+		 * @param[in]	keys	Key to store each entry in @p files under.
+		 */
+		void addOutputs(const Vector<Path>& files, const Vector<UINT64>& keys);
+
+		/**
+		 * Places cached outputs at the provided locations, using multiple threads if available. Outputs are hard-linked
+		 * where possible, so files at the destination should not be modified in place.
+		 *
+		 * @param[in]	keys			Keys of the outputs to place. All outputs must exist in the cache.
+		 * @param[in]	destinations	Absolute path to place each output in @p keys at.
+		 */
+		void placeOutputs(const Vector<UINT64>& keys, const Vector<Path>& destinations) const;
+
+		/** 
+		 * Removes all cached outputs except the ones with the provided keys, as well as hashes of any files that weren't
+		 * hashed since the cache was loaded. Should be called after a build to keep the cache from growing indefinitely.
+		 */
+		void prune(const Vector<UINT64>& usedKeys);
+
+		/** Saves the cache index into the cache folder. Outputs are saved as they are added. */
+		void save() const;
+
+		/**
+		 * Loads the cache stored in the provided folder. If the folder doesn't contain a cache a new empty cache is
+		 * returned, and the folder is created if needed.
+		 */
+		static SPtr<BuildCache> load(const Path& folder);
+
+		/** Calculates a key from a set of hashes, for use as an output key. Order of the hashes is significant. */
+		static UINT64 calculateKey(const Vector<UINT64>& hashes);
+
+	private:
+		static const WString INDEX_FILENAME;
+
+		Path mFolder;
+		UnorderedMap<Path, FileHash> mFileHashes;
+		UnorderedSet<Path> mUsedFiles;
+
+		/************************************************************************/
+		/* 								RTTI		                     		*/
+		/************************************************************************/
+	public:
+		friend class BuildCacheRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		virtual RTTITypeBase* getRTTI() const override;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,49 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsEditorPrerequisites.h"
+#include "BsRTTIType.h"
+#include "BsBuildCache.h"
+
+namespace bs
+{
+	/** @cond RTTI */
+	/** @addtogroup RTTI-Impl-Editor
+	 *  @{
+	 */
+
+	BS_ALLOW_MEMCPY_SERIALIZATION(BuildCache::FileHash);
+
+	class BuildCacheRTTI : public RTTIType <BuildCache, IReflectable, BuildCacheRTTI>
+	{
+	private:
+		UnorderedMap<Path, BuildCache::FileHash>& getFileHashes(BuildCache* obj) { return obj->mFileHashes; }
+		void setFileHashes(BuildCache* obj, UnorderedMap<Path, BuildCache::FileHash>& val) { obj->mFileHashes = val; }
+
+	public:
+		BuildCacheRTTI()
+		{
+			addPlainField("fileHashes", 0, &BuildCacheRTTI::getFileHashes, &BuildCacheRTTI::setFileHashes);
+		}
+
+		const String& getRTTIName() override
+		{
+			static String name = "BuildCache";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_BuildCache;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return bs_shared_ptr_new<BuildCache>();
+		}
+	};
+
+	/** @} */
+	/** @endcond */
+}
@@ -75,6 +75,9 @@ namespace bs
 		 */
 		Path getBuildFolder(BuildFolder folder, PlatformType platform) const;
 
+		/** Returns the absolute path to the folder in which BuildCache stores processed resources for a specific platform. */
+		Path getBuildCacheFolder(PlatformType platform) const;
+
 		/**	Returns the absolute path of the pre-built executable for the specified platform. */
 		Path getMainExecutable(PlatformType type) const;
 
@@ -92,6 +95,7 @@ namespace bs
 
 	private:
 		static const WString BUILD_FOLDER_NAME;
+		static const WString BUILD_CACHE_FOLDER_NAME;
 
 		SPtr<BuildData> mBuildData;
 	};
@@ -174,6 +174,7 @@ namespace bs
 	class SelectionRenderer;
 	class DropDownWindow;
 	class ProjectSettings;
+	class BuildCache;
 
 	static const char* EDITOR_ASSEMBLY = "MBansheeEditor";
 	static const char* SCRIPT_EDITOR_ASSEMBLY = "MScriptEditor";
@@ -228,6 +229,7 @@ namespace bs
 		TID_Settings = 40019,
 		TID_ProjectSettings = 40020,
 		TID_WindowFrameWidget = 40021,
-		TID_ProjectResourceMeta = 40022
+		TID_ProjectResourceMeta = 40022,
+		TID_BuildCache = 40023
 	};
 }
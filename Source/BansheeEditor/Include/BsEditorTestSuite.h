@@ -93,6 +93,128 @@ namespace bs
 
 		/**	Tests the frame allocator. */
 		void TestFrameAlloc();
+
+		/** Tests audio sample conversion between every supported bit depth against the expected per-sample results. */
+		void TestAudioSampleConversion();
+
+		/** Tests generation of mesh levels of detail, and level selection with and without hysteresis. */
+		void TestMeshLODs();
+
+		/**
+		 * Tests that mesh optimization doesn't increase the vertex cache miss ratio, keeps the same set of triangles and
+		 * vertices, orders vertices by first use, and leaves meshes with out of range indices untouched.
+		 */
+		void TestMeshOptimization();
+
+		/** Tests specialized pixel format conversion and downsampling paths against per-pixel conversion. */
+		void TestPixelConversion();
+
+		/** Tests GameObject instance ID assignment, reuse and lookup. */
+		void TestGameObjectIds();
+
+		/** Tests that components are added to and removed from the scene manager's update lists as they change state. */
+		void TestComponentUpdateLists();
+
+		/** Tests the xxHash implementation against reference values and checks incremental hashing is consistent. */
+		void TestXXHash64();
+
+		/** Tests file hashing, storing, linking and pruning of outputs in the build cache. */
+		void TestBuildCache();
+
+		/** Tests LZ4 compression and writing and reading of compressed and uncompressed pack files. */
+		void TestPackFile();
+
+		/** Tests texture streaming residency decisions for requests, eviction, memory budget and per frame load limits. */
+		void TestTextureStreaming();
+
+		/** Tests software rasterization of occluders and visibility tests against the resulting depth buffer. */
+		void TestOcclusionBuffer();
+
+		/** Tests tracking of modified material parameters, including duplicate modifications and tracking overflow. */
+		void TestMaterialDirtyParams();
+
+		/** Tests that modifications of many core objects synced at once all reach the core thread. */
+		void TestCoreObjectSync();
+
+		/** Tests material parameter lookup by name, including missing parameters and type mismatches. */
+		void TestMaterialParamLookup();
+
+		/**
+		 * Tests render graph compilation: culling of unused passes, pass ordering, texture aliasing and detection of
+		 * invalid graphs. Runs on the CPU only.
+		 */
+		void TestRenderGraph();
+
+		/**
+		 * Tests that string identifiers created from literals, strings and concurrently from multiple threads all resolve
+		 * to the same entries.
+		 */
+		void TestStringID();
+
+		/**
+		 * Tests that messages logged asynchronously from multiple threads are all delivered in order, and that messages
+		 * are dropped once a queue is full.
+		 */
+		void TestAsyncLogger();
+
+		/**
+		 * Tests that atlas layouts created by both packing methods, and by inserting into existing pages, place all
+		 * elements within their pages without overlaps.
+		 */
+		void TestTexAtlasGenerator();
+
+		/** Tests that a parallel for splits work into contiguous chunks that process every element exactly once. */
+		void TestParallelFor();
+	};
+
+	/**
+	 * Contains a set of performance benchmarks for the editor. Each benchmark logs its results. Not run on editor
+	 * start-up unless the editor is built with benchmarks enabled.
+	 */
+	class EditorBenchmarkSuite : public TestSuite
+	{
+	public:
+		EditorBenchmarkSuite();
+
+	private:
+		/** Measures audio sample conversion throughput for every bit depth, and logs the results. */
+		void BenchmarkAudioSampleConversion();
+
+		/** 
+		 * Measures how fast PCM and Vorbis audio clips are decoded when loaded, relative to their playback length, and
+		 * logs the results.
+		 */
+		void BenchmarkAudioDecoding();
+
+		/** Measures pixel format conversion and downsampling throughput, and logs the results. */
+		void BenchmarkPixelConversion();
+
+		/** Measures GameObject creation, lookup and destruction throughput, and logs the results. */
+		void BenchmarkGameObjectManager();
+
+		/** 
+		 * Compares time taken to load resources through the resource manager from individual files, versus from an
+		 * uncompressed and a compressed pack file.
+		 */
+		void BenchmarkPackFile();
+
+		/**
+		 * Compares time taken to find modified parameters of a material with many parameters by checking every parameter
+		 * versus using the tracked dirty parameters, and logs the results.
+		 */
+		void BenchmarkMaterialDirtyParams();
+
+		/**
+		 * Compares time taken to set material parameters by string name, by StringID name and through cached parameter
+		 * handles, and logs the results.
+		 */
+		void BenchmarkMaterialParamAccess();
+
+		/** Compares the time 16 threads take to log messages through the locking log and the asynchronous logger. */
+		void BenchmarkAsyncLogger();
+
+		/** Compares page usage and packing time of the binary tree and MaxRects atlas packers on glyph sets. */
+		void BenchmarkTexAtlasGenerator();
 	};
 
 	/** @} */
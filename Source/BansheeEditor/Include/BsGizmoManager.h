@@ -231,6 +231,9 @@ namespace bs
 		 */
 		HSceneObject getSceneObject(UINT32 gizmoIdx);
 
+		/** Returns scene objects attached to all gizmos drawn since the last call to clearGizmos(), keyed by gizmo index. */
+		const Map<UINT32, HSceneObject>& getSceneObjects() const { return mIdxToSceneObjectMap; }
+
 		/** @name Internal
 		 *  @{
 		 */
@@ -7,6 +7,8 @@
 
 namespace bs
 {
+	struct SubResourceRaw;
+
 	/** @addtogroup Library
 	 *  @{
 	 */
@@ -51,6 +53,7 @@ namespace bs
 
 			SPtr<ProjectFileMeta> meta; /**< Meta file containing various information about the resource(s). */
 			std::time_t lastUpdateTime; /**< Timestamp of when we last imported the resource. */
+			UINT64 contentHash; /**< Hash of the source file contents at the time of the last import, or 0 if unknown. */
 		};
 
 		/**	A library entry representing a folder that contains other entries. */
@@ -327,6 +330,33 @@ namespace bs
 		void reimportResourceInternal(FileEntry* file, const SPtr<ImportOptions>& importOptions = nullptr, 
 			bool forceReimport = false, bool pruneResourceMetas = false);
 
+		/**
+		 * First stage of reimportResourceInternal(). Loads the file's meta-data if not already loaded and checks does the
+		 * file need to be imported.
+		 *
+		 * @param[in]	file				File to prepare for import.
+		 * @param[in]	importOptions		Optional import options provided by the caller. If null the options from the
+		 *									file's meta-data, or the default options, are used.
+		 * @param[in]	forceReimport		Should the file be imported even if we detect no changes.
+		 * @param[out]	outImportOptions	Import options to import the file with. Null for native resources.
+		 * @return							True if the file needs to be imported.
+		 */
+		bool prepareImport(FileEntry* file, const SPtr<ImportOptions>& importOptions, bool forceReimport,
+			SPtr<ImportOptions>& outImportOptions);
+
+		/**
+		 * Last stage of reimportResourceInternal(). Registers resources imported from the file, updates its meta-data,
+		 * saves the resources into the internal folder and reimports any dependants. 
+		 *
+		 * @param[in]	file				File that was imported.
+		 * @param[in]	importOptions		Import options returned by prepareImport().
+		 * @param[in]	importedResources	Resources returned by Importer::_importAllRaw(). Ignored for native resources,
+		 *									which are loaded directly.
+		 * @param[in]	pruneResourceMetas	See reimportResourceInternal().
+		 */
+		void finishImport(FileEntry* file, const SPtr<ImportOptions>& importOptions, 
+			const Vector<SubResourceRaw>& importedResources, bool pruneResourceMetas);
+
 		/**
 		 * Creates a full hierarchy of directory entries up to the provided directory, if any are needed.
 		 *
@@ -339,6 +369,19 @@ namespace bs
 		/**	Checks has a file been modified since the last import. */
 		bool isUpToDate(FileEntry* file) const;
 
+		/**
+		 * Checks which of the provided files need to be reimported, using multiple threads if available. Files whose
+		 * timestamp changed but whose contents hash to the same value as on the last import have their timestamp
+		 * refreshed and are not considered out of date.
+		 *
+		 * @param[in]	files		Files to check.
+		 * @param[out]	outOfDate	Subset of @p files that need to be reimported, in the same order.
+		 */
+		void findOutOfDateFiles(const Vector<FileEntry*>& files, Vector<FileEntry*>& outOfDate);
+
+		/** Calculates a hash of the contents of the file at the provided path. Returns 0 if the file cannot be read. */
+		static UINT64 calculateContentHash(const Path& path);
+
 		/**	Checks is the resource a native engine resource that doesn't require importing. */
 		bool isNative(const Path& path) const;
 
@@ -58,6 +58,7 @@ namespace bs
 			memory = rttiWriteElem(data.path, memory, size);
 			memory = rttiWriteElem(data.elementName, memory, size);
 			memory = rttiWriteElem(data.lastUpdateTime, memory, size);
+			memory = rttiWriteElem(data.contentHash, memory, size);
 
 			memcpy(memoryStart, &size, sizeof(UINT32));
 		}
@@ -65,6 +66,7 @@ namespace bs
 		static UINT32 fromMemory(bs::ProjectLibrary::FileEntry& data, char* memory)
 		{ 
 			UINT32 size = 0;
+			char* memoryStart = memory;
 			memcpy(&size, memory, sizeof(UINT32));
 			memory += sizeof(UINT32);
 
@@ -76,13 +78,19 @@ namespace bs
 			memory = rttiReadElem(data.elementName, memory);
 			memory = rttiReadElem(data.lastUpdateTime, memory);
 
+			// Older libraries don't store the content hash
+			if((UINT32)(memory - memoryStart) < size)
+				memory = rttiReadElem(data.contentHash, memory);
+			else
+				data.contentHash = 0;
+
 			return size;
 		}
 
 		static UINT32 getDynamicSize(const bs::ProjectLibrary::FileEntry& data)	
 		{ 
 			UINT64 dataSize = sizeof(UINT32) + rttiGetElemSize(data.type) + rttiGetElemSize(data.path) + rttiGetElemSize(data.elementName) +
-				rttiGetElemSize(data.lastUpdateTime);
+				rttiGetElemSize(data.lastUpdateTime) + rttiGetElemSize(data.contentHash);
 
 #if BS_DEBUG_MODE
 			if(dataSize > std::numeric_limits<UINT32>::max())
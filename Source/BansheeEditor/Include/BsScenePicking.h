@@ -7,6 +7,7 @@
 #include "BsMatrix4.h"
 #include "BsGpuParam.h"
 #include "BsParamBlocks.h"
+#include "BsGpuReadback.h"
 
 namespace bs
 {
@@ -31,6 +32,9 @@ namespace bs
 
 	class ScenePickingCore;
 
+	/** Callback triggered when an asynchronous scene picking operation completes. */
+	typedef std::function<void(const Vector<HSceneObject>&)> PickCallback;
+
 	/**	Handles picking of scene objects with a pointer in scene view. */
 	class BS_ED_EXPORT ScenePicking : public Module<ScenePicking>
 	{
@@ -79,11 +83,66 @@ namespace bs
 		Vector<HSceneObject> pickObjects(const SPtr<Camera>& cam, const Vector2I& position, const Vector2I& area, 
 			Vector<HSceneObject>& ignoreRenderables, SnapData* data = nullptr);
 
+		/**
+		 * Same as pickObjects(), except that it doesn't wait for the GPU to finish rendering the picking pass. Results are
+		 * instead reported through the callback once available, usually a frame or two later.
+		 *
+		 * @param[in]	cam					Camera to perform the picking from.
+		 * @param[in]	position			Pointer position relative to the camera viewport, in pixels.
+		 * @param[in]	area				Width/height of the checked area in pixels. Use (1, 1) if you want the exact
+		 *									position under the pointer.
+		 * @param[in]	ignoreRenderables	A list of objects that should be ignored during scene picking.
+		 * @param[in]	callback			Callback to trigger with a list of SceneObject%s under the provided area,
+		 *									sorted so the object covering the most of the area is first. Triggered on the
+		 *									simulation thread.
+		 */
+		void pickObjectsAsync(const SPtr<Camera>& cam, const Vector2I& position, const Vector2I& area,
+			Vector<HSceneObject>& ignoreRenderables, const PickCallback& callback);
+
 	private:
 		friend class ScenePickingCore;
 
 		typedef Set<RenderablePickData, std::function<bool(const RenderablePickData&, const RenderablePickData&)>> RenderableSet;
 
+		/**
+		 * Finds all pickable objects visible from the camera and queues them for rendering in the picking pass, followed
+		 * by all gizmos. Must be followed by a call to ScenePickingCore::corePickingEnd() or
+		 * ScenePickingCore::corePickingEndAsync().
+		 *
+		 * @param[in]	cam					Camera to perform the picking from.
+		 * @param[in]	position			Pointer position relative to the camera viewport, in pixels.
+		 * @param[in]	area				Width/height of the checked area in pixels.
+		 * @param[in]	ignoreRenderables	A list of objects that should be ignored during scene picking.
+		 * @param[out]	idxToRenderable		Map of pickable object indices to the scene objects they belong to.
+		 * @return							Index of the first gizmo. All indices past this one belong to gizmos.
+		 */
+		UINT32 queuePicking(const SPtr<Camera>& cam, const Vector2I& position, const Vector2I& area,
+			Vector<HSceneObject>& ignoreRenderables, Map<UINT32, HSceneObject>& idxToRenderable);
+
+		/**
+		 * Converts a list of pickable object indices into scene objects.
+		 *
+		 * @param[in]	objects				Indices of the picked objects.
+		 * @param[in]	firstGizmoIdx		Index of the first gizmo, as returned by queuePicking().
+		 * @param[in]	idxToRenderable		Map of pickable object indices to scene objects, as returned by queuePicking().
+		 * @param[in]	idxToGizmo			Map of gizmo indices to scene objects, at the time picking was queued.
+		 * @return							A list of picked scene objects that are still alive.
+		 */
+		static Vector<HSceneObject> resolvePickedObjects(const Vector<UINT32>& objects, UINT32 firstGizmoIdx,
+			const Map<UINT32, HSceneObject>& idxToRenderable, const Map<UINT32, HSceneObject>& idxToGizmo);
+
+		/**
+		 * Finds all pickable objects in the provided area of the picking pass output and returns their indices, sorted
+		 * by the number of pixels they cover.
+		 *
+		 * @param[in]	pixels		Contents of the picking pass output texture.
+		 * @param[in]	position	Position of the pointer where to pick objects, in pixels relative to viewport.
+		 * @param[in]	area		Width/height of the area to pick objects, in pixels.
+		 * @param[in]	flipY		True if the texture data is stored upside down.
+		 */
+		static Vector<UINT32> decodePickedObjects(const PixelData& pixels, const Vector2I& position, const Vector2I& area,
+			bool flipY);
+
 		/**	Encodes a pickable object identifier to a unique color. */
 		static Color encodeIndex(UINT32 index);
 
@@ -145,6 +204,15 @@ namespace bs
 		void corePickingEnd(const SPtr<RenderTargetCore>& target, const Rect2& viewportArea, const Vector2I& position,
 			const Vector2I& area, bool gatherSnapData, AsyncOp& asyncOp);
 
+		/**
+		 * Ends picking operation started by corePickingBegin() without waiting for the GPU. Contents of the picking
+		 * output are read back asynchronously and passed to the callback on the simulation thread.
+		 *
+		 * @param[in]	target			Render target we're rendering to.
+		 * @param[in]	callback		Callback to trigger with the contents of the picking output texture.
+		 */
+		void corePickingEndAsync(const SPtr<RenderTargetCore>& target, const TextureReadbackCallback& callback);
+
 	private:
 		friend class ScenePicking;
 
@@ -0,0 +1,182 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsBuildCache.h"
+#include "BsBuildCacheRTTI.h"
+#include "BsFileSystem.h"
+#include "BsFileSerializer.h"
+#include "BsTaskScheduler.h"
+#include "BsUtil.h"
+
+namespace bs
+{
+	/** Minimum number of files to process per task. */
+	static const UINT32 MIN_FILES_PER_TASK = 32;
+
+	/** Maximum number of tasks to split file processing into. */
+	static const UINT32 MAX_FILE_TASKS = 16;
+
+	/** 
+	 * Calls @p func for every index in range [0, @p count). If there is enough work the calls are spread over worker
+	 * threads, see TaskScheduler::parallelFor(). Returns once all the calls complete.
+	 */
+	static void forEachParallel(UINT32 count, const std::function<void(UINT32)>& func)
+	{
+		TaskScheduler::parallelFor("BuildCache", count, MIN_FILES_PER_TASK, [&func](UINT32, UINT32 start, UINT32 end)
+		{
+			for (UINT32 i = start; i < end; i++)
+				func(i);
+		}, MAX_FILE_TASKS);
+	}
+
+	const WString BuildCache::INDEX_FILENAME = L"BuildCacheIndex.asset";
+
+	BuildCache::BuildCache()
+	{ }
+
+	void BuildCache::calculateHashes(const Vector<Path>& files, Vector<UINT64>& hashes)
+	{
+		UINT32 numFiles = (UINT32)files.size();
+		Vector<FileHash> fileHashes(numFiles);
+
+		// The hash map is only read by the tasks, and only modified once they are done
+		forEachParallel(numFiles, [&](UINT32 idx)
+		{
+			const Path& path = files[idx];
+
+			FileHash& fileHash = fileHashes[idx];
+			fileHash.lastModifiedTime = FileSystem::getLastModifiedTime(path);
+			fileHash.size = FileSystem::getFileSize(path);
+			fileHash.hash = 0;
+
+			auto iterFind = mFileHashes.find(path);
+			if (iterFind != mFileHashes.end() && iterFind->second.lastModifiedTime == fileHash.lastModifiedTime &&
+				iterFind->second.size == fileHash.size)
+			{
+				fileHash.hash = iterFind->second.hash;
+			}
+			else if(FileSystem::isFile(path))
+			{
+				SPtr<DataStream> stream = FileSystem::openFile(path);
+				if (stream != nullptr)
+					fileHash.hash = xxHash64(stream);
+			}
+		});
+
+		hashes.resize(numFiles);
+		for (UINT32 i = 0; i < numFiles; i++)
+		{
+			hashes[i] = fileHashes[i].hash;
+
+			mFileHashes[files[i]] = fileHashes[i];
+			mUsedFiles.insert(files[i]);
+		}
+	}
+
+	bool BuildCache::hasOutput(UINT64 key) const
+	{
+		return FileSystem::isFile(getOutputPath(key));
+	}
+
+	Path BuildCache::getOutputPath(UINT64 key) const
+	{
+		char name[17];
+		sprintf(name, "%016llx", (unsigned long long)key);
+
+		Path outputPath = mFolder;
+		outputPath.setFilename(String(name) + ".asset");
+
+		return outputPath;
+	}
+
+	void BuildCache::addOutputs(const Vector<Path>& files, const Vector<UINT64>& keys)
+	{
+		forEachParallel((UINT32)files.size(), [&](UINT32 idx)
+		{
+			FileSystem::copy(files[idx], getOutputPath(keys[idx]));
+		});
+	}
+
+	void BuildCache::placeOutputs(const Vector<UINT64>& keys, const Vector<Path>& destinations) const
+	{
+		forEachParallel((UINT32)keys.size(), [&](UINT32 idx)
+		{
+			FileSystem::link(getOutputPath(keys[idx]), destinations[idx]);
+		});
+	}
+
+	void BuildCache::prune(const Vector<UINT64>& usedKeys)
+	{
+		for (auto iter = mFileHashes.begin(); iter != mFileHashes.end();)
+		{
+			if (mUsedFiles.find(iter->first) == mUsedFiles.end())
+				iter = mFileHashes.erase(iter);
+			else
+				++iter;
+		}
+
+		UnorderedSet<Path> usedOutputs;
+		for (auto& key : usedKeys)
+			usedOutputs.insert(getOutputPath(key));
+
+		Path indexPath = mFolder;
+		indexPath.setFilename(INDEX_FILENAME);
+
+		Vector<Path> files;
+		Vector<Path> directories;
+		FileSystem::getChildren(mFolder, files, directories);
+
+		for (auto& file : files)
+		{
+			if (file == indexPath || usedOutputs.find(file) != usedOutputs.end())
+				continue;
+
+			FileSystem::remove(file);
+		}
+	}
+
+	void BuildCache::save() const
+	{
+		Path indexPath = mFolder;
+		indexPath.setFilename(INDEX_FILENAME);
+
+		FileEncoder fe(indexPath);
+		fe.encode(const_cast<BuildCache*>(this));
+	}
+
+	SPtr<BuildCache> BuildCache::load(const Path& folder)
+	{
+		if (!FileSystem::isDirectory(folder))
+			FileSystem::createDir(folder);
+
+		Path indexPath = folder;
+		indexPath.setFilename(INDEX_FILENAME);
+
+		SPtr<BuildCache> cache;
+		if (FileSystem::isFile(indexPath))
+		{
+			FileDecoder fd(indexPath);
+			cache = std::static_pointer_cast<BuildCache>(fd.decode());
+		}
+
+		if (cache == nullptr)
+			cache = bs_shared_ptr_new<BuildCache>();
+
+		cache->mFolder = folder;
+		return cache;
+	}
+
+	UINT64 BuildCache::calculateKey(const Vector<UINT64>& hashes)
+	{
+		return xxHash64(hashes.data(), hashes.size() * sizeof(UINT64));
+	}
+
+	RTTITypeBase* BuildCache::getRTTIStatic()
+	{
+		return BuildCacheRTTI::instance();
+	}
+
+	RTTITypeBase* BuildCache::getRTTI() const
+	{
+		return BuildCache::getRTTIStatic();
+	}
+}
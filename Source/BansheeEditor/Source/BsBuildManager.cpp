@@ -26,6 +26,7 @@ namespace bs
 	}
 
 	const WString BuildManager::BUILD_FOLDER_NAME = L"Builds\\";
+	const WString BuildManager::BUILD_CACHE_FOLDER_NAME = L"BuildCache\\";
 
 	BuildManager::BuildManager()
 	{
@@ -138,6 +139,24 @@ namespace bs
 		return Path::BLANK;
 	}
 
+	Path BuildManager::getBuildCacheFolder(PlatformType platform) const
+	{
+		Path cacheFolder = gEditorApplication().getProjectPath();
+		cacheFolder.append(PROJECT_INTERNAL_DIR);
+		cacheFolder.append(BUILD_CACHE_FOLDER_NAME);
+
+		switch (platform)
+		{
+		case PlatformType::Windows:
+			cacheFolder.append(L"Windows\\");
+			break;
+		default:
+			break;
+		}
+
+		return cacheFolder;
+	}
+
 	Path BuildManager::getMainExecutable(PlatformType type) const
 	{
 		switch (type)
@@ -16,6 +16,40 @@
 #include "BsFrameAlloc.h"
 #include "BsFileSystem.h"
 #include "BsSceneManager.h"
+#include "BsAudioUtility.h"
+#include "BsMath.h"
+#include "BsPixelUtil.h"
+#include "BsBitwise.h"
+#include "BsColor.h"
+#include "BsTimer.h"
+#include "BsGameObjectManager.h"
+#include "BsUtil.h"
+#include "BsBuildCache.h"
+#include "BsCompression.h"
+#include "BsPackFile.h"
+#include "BsDataStream.h"
+#include "BsTextureStreaming.h"
+#include "BsOcclusionBuffer.h"
+#include "BsShader.h"
+#include "BsMaterialParams.h"
+#include "BsCoreObjectManager.h"
+#include "BsCoreThread.h"
+#include "BsLight.h"
+#include "BsMaterial.h"
+#include "BsRenderGraph.h"
+#include "BsAsyncLogger.h"
+#include "BsTexAtlasGenerator.h"
+#include "BsRect2I.h"
+#include "BsMesh.h"
+#include "BsMeshData.h"
+#include "BsMeshUtility.h"
+#include "BsVertexDataDesc.h"
+#include "BsTaskScheduler.h"
+#include "BsStringTable.h"
+#include "BsResourceManifest.h"
+#include "BsImporter.h"
+#include "BsAudioClip.h"
+#include "BsAudioClipImportOptions.h"
 
 namespace bs
 {
@@ -328,6 +362,27 @@ namespace bs
 		TestComponentD() {} // Serialization only
 	};
 
+	class TestComponentE : public Component
+	{
+	public:
+		UINT32 numUpdates;
+
+		/************************************************************************/
+		/* 							COMPONENT OVERRIDES                    		*/
+		/************************************************************************/
+
+		void update() override { numUpdates++; }
+
+	protected:
+		friend class SceneObject;
+
+		TestComponentE(const HSceneObject& parent, ComponentUpdateFlags updateFlags)
+			:Component(parent), numUpdates(0)
+		{
+			mUpdateFlags = updateFlags;
+		}
+	};
+
 	class TestComponentCRTTI : public RTTIType < TestComponentC, Component, TestComponentCRTTI >
 	{
 	private:
@@ -414,6 +469,38 @@ namespace bs
 		BS_ADD_TEST(EditorTestSuite::TestPrefabComplex);
 		BS_ADD_TEST(EditorTestSuite::TestPrefabDiff);
 		BS_ADD_TEST(EditorTestSuite::TestFrameAlloc);
+		BS_ADD_TEST(EditorTestSuite::TestAudioSampleConversion);
+		BS_ADD_TEST(EditorTestSuite::TestMeshLODs);
+		BS_ADD_TEST(EditorTestSuite::TestMeshOptimization);
+		BS_ADD_TEST(EditorTestSuite::TestPixelConversion);
+		BS_ADD_TEST(EditorTestSuite::TestGameObjectIds);
+		BS_ADD_TEST(EditorTestSuite::TestComponentUpdateLists);
+		BS_ADD_TEST(EditorTestSuite::TestXXHash64);
+		BS_ADD_TEST(EditorTestSuite::TestBuildCache);
+		BS_ADD_TEST(EditorTestSuite::TestPackFile);
+		BS_ADD_TEST(EditorTestSuite::TestTextureStreaming);
+		BS_ADD_TEST(EditorTestSuite::TestOcclusionBuffer);
+		BS_ADD_TEST(EditorTestSuite::TestMaterialDirtyParams);
+		BS_ADD_TEST(EditorTestSuite::TestCoreObjectSync);
+		BS_ADD_TEST(EditorTestSuite::TestMaterialParamLookup);
+		BS_ADD_TEST(EditorTestSuite::TestRenderGraph);
+		BS_ADD_TEST(EditorTestSuite::TestStringID);
+		BS_ADD_TEST(EditorTestSuite::TestAsyncLogger);
+		BS_ADD_TEST(EditorTestSuite::TestTexAtlasGenerator);
+		BS_ADD_TEST(EditorTestSuite::TestParallelFor);
+	}
+
+	EditorBenchmarkSuite::EditorBenchmarkSuite()
+	{
+		BS_ADD_TEST(EditorBenchmarkSuite::BenchmarkAudioSampleConversion);
+		BS_ADD_TEST(EditorBenchmarkSuite::BenchmarkAudioDecoding);
+		BS_ADD_TEST(EditorBenchmarkSuite::BenchmarkPixelConversion);
+		BS_ADD_TEST(EditorBenchmarkSuite::BenchmarkGameObjectManager);
+		BS_ADD_TEST(EditorBenchmarkSuite::BenchmarkPackFile);
+		BS_ADD_TEST(EditorBenchmarkSuite::BenchmarkMaterialDirtyParams);
+		BS_ADD_TEST(EditorBenchmarkSuite::BenchmarkMaterialParamAccess);
+		BS_ADD_TEST(EditorBenchmarkSuite::BenchmarkAsyncLogger);
+		BS_ADD_TEST(EditorBenchmarkSuite::BenchmarkTexAtlasGenerator);
 	}
 
 	void EditorTestSuite::SceneObjectRecord_UndoRedo()
@@ -808,4 +895,2175 @@ namespace bs
 		alloc.dealloc(a13);
 		alloc.clear();
 	}
+
+	/** Encodes 32-bit samples as samples of the provided bit depth, keeping only their most significant bits. */
+	static Vector<UINT8> createTestAudioSamples(const Vector<INT32>& samples32, UINT32 bitDepth)
+	{
+		UINT32 bytesPerSample = bitDepth / 8;
+
+		Vector<UINT8> output(samples32.size() * bytesPerSample);
+		for (UINT32 i = 0; i < (UINT32)samples32.size(); i++)
+		{
+			UINT32 sample = (UINT32)samples32[i];
+			for (UINT32 j = 0; j < bytesPerSample; j++)
+				output[i * bytesPerSample + j] = (UINT8)(sample >> (32 - bitDepth + j * 8));
+		}
+
+		return output;
+	}
+
+	/** Decodes a single sample of the provided bit depth, returning it in the upper bits of a 32-bit sample. */
+	static INT32 readTestAudioSample(const UINT8* samples, UINT32 bitDepth, UINT32 idx)
+	{
+		UINT32 bytesPerSample = bitDepth / 8;
+
+		UINT32 sample = 0;
+		for (UINT32 j = 0; j < bytesPerSample; j++)
+			sample |= (UINT32)samples[idx * bytesPerSample + j] << (32 - bitDepth + j * 8);
+
+		return (INT32)sample;
+	}
+
+	void EditorTestSuite::TestAudioSampleConversion()
+	{
+		// Sample count intentionally not a multiple of any vector width, so both vectorized and tail paths are exercised
+		const UINT32 numSamples = 1003;
+
+		Vector<INT16> samples16(numSamples * 2);
+		Vector<INT32> samples32(numSamples);
+		for (UINT32 i = 0; i < numSamples * 2; i++)
+			samples16[i] = (INT16)((i * 7919) % 65536 - 32768);
+
+		for (UINT32 i = 0; i < numSamples; i++)
+			samples32[i] = (INT32)(i * 2654435761U);
+
+		// Stereo to mono downmix
+		Vector<INT16> mono16(numSamples);
+		AudioUtility::convertToMono((UINT8*)samples16.data(), (UINT8*)mono16.data(), 16, numSamples, 2);
+
+		bool monoValid = true;
+		for (UINT32 i = 0; i < numSamples; i++)
+		{
+			INT32 sum = samples16[i * 2 + 0] + samples16[i * 2 + 1];
+			monoValid &= mono16[i] == (INT16)(sum / 2);
+		}
+
+		BS_TEST_ASSERT(monoValid);
+
+		// Test data in every supported bit depth, with the same sample values (truncated to the bit depth)
+		const UINT32 bitDepths[] = { 8, 16, 24, 32 };
+
+		Vector<UINT8> samples[4];
+		for (UINT32 i = 0; i < 4; i++)
+			samples[i] = createTestAudioSamples(samples32, bitDepths[i]);
+
+		// Integer to float conversion
+		Vector<float> floats(numSamples);
+		for (UINT32 i = 0; i < 4; i++)
+		{
+			AudioUtility::convertToFloat(samples[i].data(), bitDepths[i], floats.data(), numSamples);
+
+			// Unlike 8 and 16-bit, 24-bit samples are normalized using the 32-bit range
+			float range = bitDepths[i] == 8 ? 127.0f : (bitDepths[i] == 16 ? 32767.0f : 2147483647.0f);
+			UINT32 shift = bitDepths[i] <= 16 ? 32 - bitDepths[i] : 0;
+
+			bool floatValid = true;
+			for (UINT32 j = 0; j < numSamples; j++)
+			{
+				INT32 sample = readTestAudioSample(samples[i].data(), bitDepths[i], j) >> shift;
+				floatValid &= Math::abs(floats[j] - sample / range) < 1e-6f;
+			}
+
+			BS_TEST_ASSERT_MSG(floatValid, "Float conversion failed for bit depth " + toString(bitDepths[i]));
+		}
+
+		// Bit depth conversion, between every pair of depths
+		Vector<UINT8> converted(numSamples * sizeof(INT32));
+		for (UINT32 i = 0; i < 4; i++)
+		{
+			for (UINT32 j = 0; j < 4; j++)
+			{
+				AudioUtility::convertBitDepth(samples[i].data(), bitDepths[i], converted.data(), bitDepths[j], numSamples);
+
+				// Increasing the depth must keep the values, and reducing it must truncate them
+				const Vector<UINT8>& expected = samples[std::min(i, j)];
+
+				bool depthValid = true;
+				for (UINT32 k = 0; k < numSamples; k++)
+				{
+					INT32 expectedSample = readTestAudioSample(expected.data(), bitDepths[std::min(i, j)], k);
+					depthValid &= readTestAudioSample(converted.data(), bitDepths[j], k) == expectedSample;
+				}
+
+				BS_TEST_ASSERT_MSG(depthValid, "Bit depth conversion failed from " + toString(bitDepths[i]) + " to " +
+					toString(bitDepths[j]) + " bits");
+			}
+		}
+
+		// Round trip through 32-bit samples must reproduce the original data exactly
+		Vector<INT32> intermediate(numSamples);
+		Vector<UINT8> roundTrip(numSamples * sizeof(INT32));
+		for (UINT32 i = 0; i < 4; i++)
+		{
+			AudioUtility::convertBitDepth(samples[i].data(), bitDepths[i], (UINT8*)intermediate.data(), 32, numSamples);
+			AudioUtility::convertBitDepth((UINT8*)intermediate.data(), 32, roundTrip.data(), bitDepths[i], numSamples);
+
+			bool roundTripValid = memcmp(roundTrip.data(), samples[i].data(), samples[i].size()) == 0;
+			BS_TEST_ASSERT_MSG(roundTripValid, "Round trip conversion failed for bit depth " + toString(bitDepths[i]));
+		}
+	}
+
+	void EditorBenchmarkSuite::BenchmarkAudioSampleConversion()
+	{
+		const UINT32 numSamples = 65536;
+		const UINT32 numIterations = 16;
+		const UINT32 bitDepths[] = { 8, 16, 24, 32 };
+
+		Vector<INT32> samples32(numSamples * 2);
+		for (UINT32 i = 0; i < numSamples * 2; i++)
+			samples32[i] = (INT32)(i * 2654435761U);
+
+		Vector<float> floats(numSamples);
+		Vector<UINT8> converted(numSamples * sizeof(INT32));
+
+		Timer timer;
+		for (auto bitDepth : bitDepths)
+		{
+			Vector<UINT8> samples = createTestAudioSamples(samples32, bitDepth);
+
+			UINT64 startTime = timer.getMicroseconds();
+			for (UINT32 i = 0; i < numIterations; i++)
+				AudioUtility::convertToFloat(samples.data(), bitDepth, floats.data(), numSamples);
+
+			UINT64 floatElapsedUs = std::max(timer.getMicroseconds() - startTime, (UINT64)1);
+
+			startTime = timer.getMicroseconds();
+			for (UINT32 i = 0; i < numIterations; i++)
+				AudioUtility::convertToMono(samples.data(), converted.data(), bitDepth, numSamples, 2);
+
+			UINT64 monoElapsedUs = std::max(timer.getMicroseconds() - startTime, (UINT64)1);
+
+			LOGDBG("Audio " + toString(bitDepth) + "-bit -> float: " +
+				toString((numSamples * numIterations) / (float)floatElapsedUs) + " MSamples/s");
+			LOGDBG("Audio " + toString(bitDepth) + "-bit stereo -> mono: " +
+				toString((numSamples * numIterations) / (float)monoElapsedUs) + " MSamples/s");
+
+			for (auto outBitDepth : bitDepths)
+			{
+				if (outBitDepth == bitDepth)
+					continue;
+
+				startTime = timer.getMicroseconds();
+				for (UINT32 i = 0; i < numIterations; i++)
+					AudioUtility::convertBitDepth(samples.data(), bitDepth, converted.data(), outBitDepth, numSamples);
+
+				UINT64 elapsedUs = std::max(timer.getMicroseconds() - startTime, (UINT64)1);
+				LOGDBG("Audio " + toString(bitDepth) + "-bit -> " + toString(outBitDepth) + "-bit: " +
+					toString((numSamples * numIterations) / (float)elapsedUs) + " MSamples/s");
+			}
+		}
+	}
+
+	/** Writes interleaved 16-bit PCM samples into a .wav file. */
+	static void writeTestWave(const Path& path, const Vector<INT16>& samples, UINT32 sampleRate, UINT32 numChannels)
+	{
+		UINT32 dataSize = (UINT32)samples.size() * sizeof(INT16);
+		UINT32 fmtSize = 16;
+		UINT32 riffSize = 4 + (8 + fmtSize) + (8 + dataSize);
+
+		UINT16 format = 1; // PCM
+		UINT16 channels = (UINT16)numChannels;
+		UINT16 bitDepth = 16;
+		UINT16 blockAlign = channels * bitDepth / 8;
+		UINT32 byteRate = sampleRate * blockAlign;
+
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+		stream->write("RIFF", 4);
+		stream->write(&riffSize, sizeof(riffSize));
+		stream->write("WAVE", 4);
+
+		stream->write("fmt ", 4);
+		stream->write(&fmtSize, sizeof(fmtSize));
+		stream->write(&format, sizeof(format));
+		stream->write(&channels, sizeof(channels));
+		stream->write(&sampleRate, sizeof(sampleRate));
+		stream->write(&byteRate, sizeof(byteRate));
+		stream->write(&blockAlign, sizeof(blockAlign));
+		stream->write(&bitDepth, sizeof(bitDepth));
+
+		stream->write("data", 4);
+		stream->write(&dataSize, sizeof(dataSize));
+		stream->write(samples.data(), dataSize);
+		stream->close();
+	}
+
+	void EditorBenchmarkSuite::BenchmarkAudioDecoding()
+	{
+		const UINT32 sampleRate = 44100;
+		const UINT32 numChannels = 2;
+		const UINT32 length = 30; // In seconds
+		const UINT32 numIterations = 4;
+
+		Path testFolder = FileSystem::getTempDirectoryPath();
+		testFolder.append(L"AudioDecodingBenchmark/");
+		FileSystem::createDir(testFolder);
+
+		// A different tone in each channel
+		UINT32 numSamples = sampleRate * length * numChannels;
+		Vector<INT16> samples(numSamples);
+		for (UINT32 i = 0; i < numSamples; i++)
+		{
+			UINT32 frame = i / numChannels;
+			float frequency = 440.0f * (1 + i % numChannels);
+			float phase = (frame % sampleRate) / (float)sampleRate;
+
+			samples[i] = (INT16)(Math::sin(Math::TWO_PI * frequency * phase) * 16384.0f);
+		}
+
+		Path wavePath = testFolder + L"Tone.wav";
+		writeTestWave(wavePath, samples, sampleRate, numChannels);
+
+		// Imports the tone in the provided format and saves it as a fully decompressed clip, so that loading it decodes
+		// all of its samples with the same decoder used by the streaming thread
+		Vector<String> uuids;
+		auto createClip = [&](AudioFormat format, const WString& name)
+		{
+			SPtr<AudioClipImportOptions> importOptions = AudioClipImportOptions::create();
+			importOptions->setFormat(format);
+			importOptions->setReadMode(AudioReadMode::LoadDecompressed);
+			importOptions->setIs3D(false);
+
+			HAudioClip clip = gImporter().import<AudioClip>(wavePath, importOptions);
+			uuids.push_back(clip.getUUID());
+
+			Path clipPath = testFolder + (name + L".asset");
+			gResources().save(clip, clipPath, true);
+			gResources().release(clip);
+
+			return clipPath;
+		};
+
+		Path pcmClipPath = createClip(AudioFormat::PCM, L"ClipPCM");
+		Path vorbisClipPath = createClip(AudioFormat::VORBIS, L"ClipVorbis");
+		gResources().unloadAllUnused();
+
+		Timer timer;
+		auto loadClip = [&](const Path& clipPath)
+		{
+			UINT64 startTime = timer.getMicroseconds();
+			for (UINT32 i = 0; i < numIterations; i++)
+			{
+				HAudioClip clip = gResources().load<AudioClip>(clipPath, ResourceLoadFlag::None);
+				gResources().release(clip);
+				gResources().unloadAllUnused();
+			}
+
+			return std::max(timer.getMicroseconds() - startTime, (UINT64)1);
+		};
+
+		UINT64 pcmElapsedUs = loadClip(pcmClipPath);
+		UINT64 vorbisElapsedUs = loadClip(vorbisClipPath);
+
+		// Real-time factor is also roughly the number of streaming sources a single streaming thread can keep fed
+		float decodedLength = (float)(length * numIterations);
+		LOGDBG("Audio PCM clip load: " + toString(decodedLength * 1000000.0f / pcmElapsedUs) + "x real-time");
+		LOGDBG("Audio Vorbis clip decode: " + toString((numSamples * (UINT64)numIterations) / (float)vorbisElapsedUs) + 
+			" MSamples/s, " + toString(decodedLength * 1000000.0f / vorbisElapsedUs) + "x real-time");
+
+		SPtr<ResourceManifest> manifest = gResources().getResourceManifest("Default");
+		for (auto& uuid : uuids)
+			manifest->unregisterResource(uuid);
+
+		FileSystem::remove(testFolder);
+	}
+
+	/** Creates a flat grid of @p gridSize x @p gridSize quads, with positions only and 32-bit indices. */
+	static SPtr<MeshData> createTestGrid(UINT32 gridSize)
+	{
+		UINT32 numVertices = (gridSize + 1) * (gridSize + 1);
+		UINT32 numIndices = gridSize * gridSize * 6;
+
+		SPtr<VertexDataDesc> vertexDesc = VertexDataDesc::create();
+		vertexDesc->addVertElem(VET_FLOAT3, VES_POSITION);
+
+		SPtr<MeshData> meshData = MeshData::create(numVertices, numIndices, vertexDesc);
+
+		VertexElemIter<Vector3> posIter = meshData->getVec3DataIter(VES_POSITION);
+		for (UINT32 y = 0; y <= gridSize; y++)
+		{
+			for (UINT32 x = 0; x <= gridSize; x++)
+				posIter.addValue(Vector3((float)x, (float)y, 0.0f));
+		}
+
+		UINT32* indices = meshData->getIndices32();
+		for (UINT32 y = 0; y < gridSize; y++)
+		{
+			for (UINT32 x = 0; x < gridSize; x++)
+			{
+				UINT32 v0 = y * (gridSize + 1) + x;
+				UINT32 v1 = v0 + 1;
+				UINT32 v2 = v0 + gridSize + 1;
+				UINT32 v3 = v2 + 1;
+
+				UINT32 quad[] = { v0, v1, v3, v0, v3, v2 };
+				memcpy(indices, quad, sizeof(quad));
+				indices += 6;
+			}
+		}
+
+		return meshData;
+	}
+
+	void EditorTestSuite::TestMeshLODs()
+	{
+		const UINT32 gridSize = 16;
+
+		SPtr<MeshData> meshData = createTestGrid(gridSize);
+		UINT32 numVertices = meshData->getNumVertices();
+		UINT32 numIndices = meshData->getNumIndices();
+
+		Vector<SubMesh> subMeshes = { SubMesh(0, numIndices, DOT_TRIANGLE_LIST) };
+		Vector<SubMesh> lodSubMeshes;
+		Vector<float> lodScreenSizes;
+
+		SPtr<MeshData> lodMeshData = MeshUtility::generateLODs(meshData, subMeshes, 3, 0.5f, lodSubMeshes, 
+			lodScreenSizes);
+
+		// Interior of the grid is flat and can be collapsed freely, so at least one level must be generated
+		BS_TEST_ASSERT(!lodScreenSizes.empty());
+		BS_TEST_ASSERT(lodScreenSizes.size() <= 2);
+		BS_TEST_ASSERT(lodSubMeshes.size() == lodScreenSizes.size());
+
+		// Vertices and full detail indices are kept as is, and reduced levels are appended after them
+		BS_TEST_ASSERT(lodMeshData->getNumVertices() == numVertices);
+		BS_TEST_ASSERT(memcmp(lodMeshData->getIndices32(), meshData->getIndices32(), numIndices * sizeof(UINT32)) == 0);
+
+		UINT32* lodIndices = lodMeshData->getIndices32();
+		UINT32 prevNumIndices = numIndices;
+		float prevScreenSize = std::numeric_limits<float>::infinity();
+		for (UINT32 i = 0; i < (UINT32)lodSubMeshes.size(); i++)
+		{
+			const SubMesh& subMesh = lodSubMeshes[i];
+
+			BS_TEST_ASSERT(subMesh.drawOp == DOT_TRIANGLE_LIST);
+			BS_TEST_ASSERT(subMesh.indexOffset >= numIndices);
+			BS_TEST_ASSERT(subMesh.indexOffset + subMesh.indexCount <= lodMeshData->getNumIndices());
+			BS_TEST_ASSERT(subMesh.indexCount % 3 == 0);
+			BS_TEST_ASSERT(subMesh.indexCount < prevNumIndices);
+
+			BS_TEST_ASSERT(lodScreenSizes[i] > 0.0f && lodScreenSizes[i] < prevScreenSize);
+
+			bool indicesValid = true;
+			for (UINT32 j = 0; j < subMesh.indexCount; j += 3)
+			{
+				UINT32* triangle = &lodIndices[subMesh.indexOffset + j];
+				indicesValid &= triangle[0] < numVertices && triangle[1] < numVertices && triangle[2] < numVertices;
+				indicesValid &= triangle[0] != triangle[1] && triangle[1] != triangle[2] && triangle[0] != triangle[2];
+			}
+
+			BS_TEST_ASSERT(indicesValid);
+
+			prevNumIndices = subMesh.indexCount;
+			prevScreenSize = lodScreenSizes[i];
+		}
+
+		// Level selection, with and without hysteresis
+		MESH_DESC desc;
+		desc.subMeshes = subMeshes;
+		desc.lodSubMeshes = lodSubMeshes;
+		desc.lodScreenSizes = lodScreenSizes;
+
+		SPtr<Mesh> mesh = Mesh::_createPtr(lodMeshData, desc);
+		const MeshProperties& props = mesh->getProperties();
+
+		UINT32 numLODs = (UINT32)lodScreenSizes.size() + 1;
+		float threshold = lodScreenSizes[0];
+		const float hysteresis = 0.1f;
+
+		BS_TEST_ASSERT(props.getNumLODs() == numLODs);
+		BS_TEST_ASSERT(props.getLOD(threshold * 1.05f) == 0);
+		BS_TEST_ASSERT(props.getLOD(threshold * 0.95f) >= 1);
+		BS_TEST_ASSERT(props.getLOD(0.0f) == numLODs - 1);
+
+		// Within the hysteresis band around the threshold the previous level is kept, in both directions
+		BS_TEST_ASSERT(props.getLOD(threshold * 0.95f, 0, hysteresis) == 0);
+		BS_TEST_ASSERT(props.getLOD(threshold * 1.05f, 1, hysteresis) == 1);
+
+		// Past the band the level changes
+		BS_TEST_ASSERT(props.getLOD(threshold * 0.8f, 0, hysteresis) >= 1);
+		BS_TEST_ASSERT(props.getLOD(threshold * 1.2f, 1, hysteresis) == 0);
+	}
+
+	void EditorTestSuite::TestMeshOptimization()
+	{
+		const UINT32 gridSize = 32;
+
+		SPtr<MeshData> meshData = createTestGrid(gridSize);
+		UINT32 numVertices = meshData->getNumVertices();
+		UINT32 numIndices = meshData->getNumIndices();
+		UINT32 numFaces = numIndices / 3;
+
+		// Shuffle the triangles so the input is cache unfriendly
+		UINT32* indices = meshData->getIndices32();
+		UINT32 seed = 12345;
+		for (UINT32 i = numFaces - 1; i > 0; i--)
+		{
+			seed = seed * 1664525 + 1013904223;
+			UINT32 j = (seed >> 8) % (i + 1);
+
+			for (UINT32 k = 0; k < 3; k++)
+				std::swap(indices[i * 3 + k], indices[j * 3 + k]);
+		}
+
+		Vector<UINT32> originalIndices(indices, indices + numIndices);
+
+		Vector<Vector3> originalPositions(numVertices);
+		VertexElemIter<Vector3> posIter = meshData->getVec3DataIter(VES_POSITION);
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			originalPositions[i] = posIter.getValue();
+			posIter.moveNext();
+		}
+
+		float acmrBefore = MeshUtility::calculateACMR((UINT8*)indices, numIndices, numVertices);
+
+		Vector<SubMesh> subMeshes = { SubMesh(0, numIndices, DOT_TRIANGLE_LIST) };
+		Vector<UINT32> vertexRemap;
+		MeshOptimizationStats stats = MeshUtility::optimize(meshData, subMeshes, &vertexRemap);
+
+		// Vertex cache efficiency must not get worse
+		indices = meshData->getIndices32();
+		float acmrAfter = MeshUtility::calculateACMR((UINT8*)indices, numIndices, numVertices);
+
+		BS_TEST_ASSERT(stats.optimized);
+		BS_TEST_ASSERT(Math::approxEquals(stats.acmrBefore, acmrBefore));
+		BS_TEST_ASSERT(stats.acmrAfter <= stats.acmrBefore);
+		BS_TEST_ASSERT(acmrAfter <= acmrBefore);
+
+		// Vertices are only moved, with the remap table pointing to their new location
+		BS_TEST_ASSERT(vertexRemap.size() == numVertices);
+
+		Vector<bool> remapUsed(numVertices, false);
+		bool remapValid = true;
+		for (UINT32 i = 0; i < numVertices && remapValid; i++)
+		{
+			remapValid = vertexRemap[i] < numVertices && !remapUsed[vertexRemap[i]];
+			if (remapValid)
+				remapUsed[vertexRemap[i]] = true;
+		}
+
+		BS_TEST_ASSERT(remapValid);
+		if (!remapValid)
+			return;
+
+		Vector<Vector3> positions(numVertices);
+		posIter = meshData->getVec3DataIter(VES_POSITION);
+		for (UINT32 i = 0; i < numVertices; i++)
+		{
+			positions[i] = posIter.getValue();
+			posIter.moveNext();
+		}
+
+		bool positionsValid = true;
+		for (UINT32 i = 0; i < numVertices; i++)
+			positionsValid &= positions[vertexRemap[i]] == originalPositions[i];
+
+		BS_TEST_ASSERT(positionsValid);
+
+		// Same set of triangles with the same winding, only in a different order. Triangles are compared by rotating
+		// their indices so the smallest one is first, which keeps the winding intact.
+		auto getTriangles = [numFaces](const UINT32* triIndices, const UINT32* remap)
+		{
+			Vector<std::array<UINT32, 3>> output(numFaces);
+			for (UINT32 i = 0; i < numFaces; i++)
+			{
+				std::array<UINT32, 3> triangle;
+				for (UINT32 j = 0; j < 3; j++)
+				{
+					UINT32 idx = triIndices[i * 3 + j];
+					triangle[j] = remap != nullptr ? remap[idx] : idx;
+				}
+
+				while (triangle[0] > triangle[1] || triangle[0] > triangle[2])
+					std::rotate(triangle.begin(), triangle.begin() + 1, triangle.end());
+
+				output[i] = triangle;
+			}
+
+			std::sort(output.begin(), output.end());
+			return output;
+		};
+
+		Vector<std::array<UINT32, 3>> expectedTriangles = getTriangles(originalIndices.data(), vertexRemap.data());
+		Vector<std::array<UINT32, 3>> triangles = getTriangles(indices, nullptr);
+
+		BS_TEST_ASSERT(triangles == expectedTriangles);
+
+		// Vertices are stored in the order they are first referenced
+		UINT32 nextVertex = 0;
+		bool fetchOrdered = true;
+		for (UINT32 i = 0; i < numIndices; i++)
+		{
+			if (indices[i] > nextVertex)
+				fetchOrdered = false;
+			else if (indices[i] == nextVertex)
+				nextVertex++;
+		}
+
+		BS_TEST_ASSERT(fetchOrdered);
+
+		// Meshes with indices referencing non-existent vertices are left untouched
+		SPtr<MeshData> brokenMeshData = createTestGrid(4);
+		UINT32* brokenIndices = brokenMeshData->getIndices32();
+		brokenIndices[5] = brokenMeshData->getNumVertices();
+
+		Vector<UINT32> brokenOriginal(brokenIndices, brokenIndices + brokenMeshData->getNumIndices());
+		Vector<SubMesh> brokenSubMeshes = { SubMesh(0, brokenMeshData->getNumIndices(), DOT_TRIANGLE_LIST) };
+
+		Vector<UINT32> brokenRemap;
+		MeshOptimizationStats brokenStats = MeshUtility::optimize(brokenMeshData, brokenSubMeshes, &brokenRemap);
+
+		BS_TEST_ASSERT(!brokenStats.optimized);
+		BS_TEST_ASSERT(brokenRemap.empty());
+		BS_TEST_ASSERT(Vector<UINT32>(brokenIndices, brokenIndices + brokenMeshData->getNumIndices()) == brokenOriginal);
+	}
+
+	/** Fills pixel data with deterministic pseudo-random contents, within the [0, 1] range for floating point formats. */
+	static void fillTestPixels(PixelData& data)
+	{
+		UINT32 seed = 12345;
+		auto next = [&seed]() { seed = seed * 1664525 + 1013904223; return seed >> 8; };
+
+		UINT32 size = data.getConsecutiveSize();
+		if (data.getFormat() == PF_FLOAT32_RGBA)
+		{
+			float* values = (float*)data.getData();
+			for (UINT32 i = 0; i < size / sizeof(float); i++)
+				values[i] = (next() % 1001) / 1000.0f;
+		}
+		else if (data.getFormat() == PF_FLOAT16_RGBA)
+		{
+			UINT16* values = (UINT16*)data.getData();
+			for (UINT32 i = 0; i < size / sizeof(UINT16); i++)
+				values[i] = Bitwise::floatToHalf((next() % 1001) / 1000.0f);
+		}
+		else
+		{
+			for (UINT32 i = 0; i < size; i++)
+				data.getData()[i] = (UINT8)next();
+		}
+	}
+
+	void EditorTestSuite::TestPixelConversion()
+	{
+		PixelFormat formats[] = { PF_R8G8B8A8, PF_B8G8R8A8, PF_R8, PF_FLOAT16_RGBA, PF_FLOAT32_RGBA };
+
+		// Width intentionally not a multiple of any vector width, so both vectorized and tail paths are exercised
+		const UINT32 width = 37;
+		const UINT32 height = 5;
+
+		for (auto srcFormat : formats)
+		{
+			PixelData src(width, height, 1, srcFormat);
+			src.allocateInternalBuffer();
+			fillTestPixels(src);
+
+			for (auto dstFormat : formats)
+			{
+				PixelData dst(width, height, 1, dstFormat);
+				dst.allocateInternalBuffer();
+
+				PixelUtil::bulkPixelConversion(src, dst);
+
+				// Compare with per-pixel conversion
+				bool valid = true;
+				for (UINT32 y = 0; y < height; y++)
+				{
+					for (UINT32 x = 0; x < width; x++)
+					{
+						float r, g, b, a;
+						PixelUtil::unpackColor(&r, &g, &b, &a, srcFormat, src.getData() + (y * width + x) * 
+							PixelUtil::getNumElemBytes(srcFormat));
+
+						UINT8 packed[16];
+						PixelUtil::packColor(r, g, b, a, dstFormat, packed);
+
+						Color expected;
+						PixelUtil::unpackColor(&expected, dstFormat, packed);
+
+						Color actual = dst.getColorAt(x, y);
+						for (UINT32 i = 0; i < 4; i++)
+							valid &= Math::abs(actual[i] - expected[i]) < 1e-6f;
+					}
+				}
+
+				BS_TEST_ASSERT(valid);
+			}
+		}
+
+		// Downsampling by exactly half uses a 2x2 box filter
+		PixelData src(64, 32, 1, PF_R8G8B8A8);
+		src.allocateInternalBuffer();
+		fillTestPixels(src);
+
+		PixelData half(32, 16, 1, PF_R8G8B8A8);
+		half.allocateInternalBuffer();
+
+		PixelUtil::scale(src, half);
+
+		bool boxValid = true;
+		for (UINT32 y = 0; y < half.getHeight(); y++)
+		{
+			for (UINT32 x = 0; x < half.getWidth(); x++)
+			{
+				for (UINT32 i = 0; i < 4; i++)
+				{
+					UINT32 sum = 
+						src.getData()[((y * 2 + 0) * 64 + x * 2 + 0) * 4 + i] + src.getData()[((y * 2 + 0) * 64 + x * 2 + 1) * 4 + i] +
+						src.getData()[((y * 2 + 1) * 64 + x * 2 + 0) * 4 + i] + src.getData()[((y * 2 + 1) * 64 + x * 2 + 1) * 4 + i];
+
+					boxValid &= half.getData()[(y * 32 + x) * 4 + i] == (sum + 2) / 4;
+				}
+			}
+		}
+
+		BS_TEST_ASSERT(boxValid);
+	}
+
+	void EditorBenchmarkSuite::BenchmarkPixelConversion()
+	{
+		struct FormatPair
+		{
+			PixelFormat src;
+			PixelFormat dst;
+		};
+
+		FormatPair pairs[] = 
+		{
+			{ PF_R8G8B8A8, PF_B8G8R8A8 },
+			{ PF_R8G8B8A8, PF_FLOAT32_RGBA },
+			{ PF_FLOAT32_RGBA, PF_R8G8B8A8 },
+			{ PF_FLOAT16_RGBA, PF_R8G8B8A8 },
+			{ PF_FLOAT32_RGBA, PF_FLOAT16_RGBA },
+			{ PF_R8, PF_B8G8R8A8 },
+			{ PF_A8R8G8B8, PF_R8G8B8A8 }
+		};
+
+		const UINT32 size = 1024;
+		const UINT32 numIterations = 4;
+
+		Timer timer;
+		for (auto& pair : pairs)
+		{
+			PixelData src(size, size, 1, pair.src);
+			src.allocateInternalBuffer();
+			fillTestPixels(src);
+
+			PixelData dst(size, size, 1, pair.dst);
+			dst.allocateInternalBuffer();
+
+			UINT64 startTime = timer.getMicroseconds();
+			for (UINT32 i = 0; i < numIterations; i++)
+				PixelUtil::bulkPixelConversion(src, dst);
+
+			UINT64 elapsedUs = std::max(timer.getMicroseconds() - startTime, (UINT64)1);
+			float megaPixelsPerSecond = (size * size * numIterations) / (float)elapsedUs;
+
+			LOGDBG("Pixel conversion " + PixelUtil::getFormatName(pair.src) + " -> " + 
+				PixelUtil::getFormatName(pair.dst) + ": " + toString(megaPixelsPerSecond) + " MPix/s");
+		}
+
+		PixelData src(size, size, 1, PF_R8G8B8A8);
+		src.allocateInternalBuffer();
+		fillTestPixels(src);
+
+		PixelData half(size / 2, size / 2, 1, PF_R8G8B8A8);
+		half.allocateInternalBuffer();
+
+		PixelData scaled(size / 3, size / 3, 1, PF_R8G8B8A8);
+		scaled.allocateInternalBuffer();
+
+		UINT64 startTime = timer.getMicroseconds();
+		for (UINT32 i = 0; i < numIterations; i++)
+			PixelUtil::scale(src, half);
+
+		UINT64 halfElapsedUs = std::max(timer.getMicroseconds() - startTime, (UINT64)1);
+
+		startTime = timer.getMicroseconds();
+		for (UINT32 i = 0; i < numIterations; i++)
+			PixelUtil::scale(src, scaled);
+
+		UINT64 scaledElapsedUs = std::max(timer.getMicroseconds() - startTime, (UINT64)1);
+
+		LOGDBG("Pixel downsample (box, 1/2): " + toString((size * size * numIterations) / (float)halfElapsedUs) + 
+			" source MPix/s");
+		LOGDBG("Pixel downsample (bilinear, 1/3): " + toString((size * size * numIterations) / (float)scaledElapsedUs) + 
+			" source MPix/s");
+	}
+
+	void EditorTestSuite::TestGameObjectIds()
+	{
+		GameObjectManager& gameObjectManager = GameObjectManager::instance();
+
+		HSceneObject so0 = SceneObject::create("so0");
+		HSceneObject so1 = SceneObject::create("so1");
+		HComponent cmp = so1->addComponent<TestComponentA>();
+
+		UINT64 so0Id = so0->getInstanceId();
+		UINT64 so1Id = so1->getInstanceId();
+		UINT64 cmpId = cmp->getInstanceId();
+
+		BS_TEST_ASSERT(gameObjectManager.getObject(so0Id).get() == so0.get());
+		BS_TEST_ASSERT(gameObjectManager.getObject(cmpId).get() == cmp.get());
+
+		// Destroying an object frees its ID, and a new object must never receive the same one
+		so0->destroy(true);
+		BS_TEST_ASSERT(!gameObjectManager.objectExists(so0Id));
+
+		HSceneObject so2 = SceneObject::create("so2");
+		BS_TEST_ASSERT(so2->getInstanceId() != so0Id);
+		BS_TEST_ASSERT(!gameObjectManager.objectExists(so0Id));
+		BS_TEST_ASSERT(gameObjectManager.getObject(so2->getInstanceId()).get() == so2.get());
+
+		// Queued objects remain accessible until the queue is processed
+		so1->destroy();
+		BS_TEST_ASSERT(gameObjectManager.objectExists(so1Id));
+		BS_TEST_ASSERT(gameObjectManager.objectExists(cmpId));
+
+		gameObjectManager.destroyQueuedObjects();
+		BS_TEST_ASSERT(!gameObjectManager.objectExists(so1Id));
+		BS_TEST_ASSERT(!gameObjectManager.objectExists(cmpId));
+
+		so2->destroy(true);
+	}
+
+	void EditorBenchmarkSuite::BenchmarkGameObjectManager()
+	{
+		const UINT32 numObjects = 20000;
+		GameObjectManager& gameObjectManager = GameObjectManager::instance();
+
+		Vector<HSceneObject> sceneObjects(numObjects);
+
+		Timer timer;
+		UINT64 startTime = timer.getMicroseconds();
+
+		for (UINT32 i = 0; i < numObjects; i++)
+			sceneObjects[i] = SceneObject::create("BenchmarkSO", SOF_Internal | SOF_DontSave);
+
+		UINT64 createElapsedUs = std::max(timer.getMicroseconds() - startTime, (UINT64)1);
+
+		// Resolve in a scattered order, similar to how handles are resolved during deserialization
+		startTime = timer.getMicroseconds();
+
+		UINT32 numResolved = 0;
+		for (UINT32 i = 0; i < numObjects; i++)
+		{
+			UINT64 instanceId = sceneObjects[(i * 7919) % numObjects]->getInstanceId();
+
+			GameObjectHandleBase handle;
+			if (gameObjectManager.tryGetObject(instanceId, handle))
+				numResolved++;
+		}
+
+		UINT64 resolveElapsedUs = std::max(timer.getMicroseconds() - startTime, (UINT64)1);
+		BS_TEST_ASSERT(numResolved == numObjects);
+
+		startTime = timer.getMicroseconds();
+
+		for (UINT32 i = 0; i < numObjects; i++)
+			sceneObjects[i]->destroy(true);
+
+		UINT64 destroyElapsedUs = std::max(timer.getMicroseconds() - startTime, (UINT64)1);
+
+		LOGDBG("GameObject create: " + toString(numObjects * 1000000.0f / createElapsedUs) + " objects/s");
+		LOGDBG("GameObject resolve: " + toString(numObjects * 1000000.0f / resolveElapsedUs) + " lookups/s");
+		LOGDBG("GameObject destroy: " + toString(numObjects * 1000000.0f / destroyElapsedUs) + " objects/s");
+	}
+
+	void EditorTestSuite::TestComponentUpdateLists()
+	{
+		CoreSceneManager& sceneManager = gCoreSceneManager();
+		UINT32 numUpdating = sceneManager._getNumUpdatingComponents();
+
+		HSceneObject parent = SceneObject::create("parent");
+		HSceneObject child = SceneObject::create("child");
+		child->setParent(parent);
+
+		GameObjectHandle<TestComponentE> cmpA = child->addComponent<TestComponentE>(CUF_None);
+		GameObjectHandle<TestComponentE> cmpB = child->addComponent<TestComponentE>(CUF_ThreadSafe);
+		parent->addComponent<TestComponentE>(CUF_NoUpdate);
+
+		// Components that don't need updates must never be registered
+		BS_TEST_ASSERT(sceneManager._getNumUpdatingComponents() == numUpdating + 2);
+
+		parent->setActive(false);
+		BS_TEST_ASSERT(sceneManager._getNumUpdatingComponents() == numUpdating);
+
+		parent->setActive(true);
+		BS_TEST_ASSERT(sceneManager._getNumUpdatingComponents() == numUpdating + 2);
+
+		cmpA->destroy(true);
+		BS_TEST_ASSERT(sceneManager._getNumUpdatingComponents() == numUpdating + 1);
+
+		// Hierarchies queued for destruction stop updating right away
+		parent->destroy();
+		BS_TEST_ASSERT(sceneManager._getNumUpdatingComponents() == numUpdating);
+		BS_TEST_ASSERT(cmpB->numUpdates == 0);
+
+		GameObjectManager::instance().destroyQueuedObjects();
+		BS_TEST_ASSERT(sceneManager._getNumUpdatingComponents() == numUpdating);
+	}
+
+	void EditorTestSuite::TestXXHash64()
+	{
+		const char* text = "Nobody inspects the spammish repetition";
+
+		BS_TEST_ASSERT(xxHash64("", 0) == 0xEF46DB3751D8E999ULL);
+		BS_TEST_ASSERT(xxHash64("abc", 3) == 0x44BC2CF5AD770999ULL);
+		BS_TEST_ASSERT(xxHash64(text, strlen(text)) == 0xFBCEA83C8A378BF1ULL);
+
+		// Hashing in arbitrarily sized pieces must match hashing everything at once
+		UINT8 data[1000];
+		for (UINT32 i = 0; i < 1000; i++)
+			data[i] = (UINT8)(i * 7);
+
+		XXHash64 hasher;
+		for (UINT32 i = 0; i < 1000; i += 13)
+			hasher.update(data + i, std::min(13U, 1000 - i));
+
+		BS_TEST_ASSERT(hasher.digest() == xxHash64(data, 1000));
+		BS_TEST_ASSERT(xxHash64(data, 1000) != xxHash64(data, 1000, 1));
+	}
+
+	void EditorTestSuite::TestBuildCache()
+	{
+		Path testFolder = FileSystem::getTempDirectoryPath();
+		testFolder.append(L"BuildCacheTest/");
+
+		Path cacheFolder = testFolder;
+		cacheFolder.append(L"Cache/");
+
+		Path buildFolder = testFolder;
+		buildFolder.append(L"Build/");
+
+		FileSystem::createDir(buildFolder);
+
+		auto writeFile = [&](const Path& path, const String& contents)
+		{
+			SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+			stream->write(contents.data(), contents.size());
+			stream->close();
+		};
+
+		Path fileA = testFolder + L"a.asset";
+		Path fileB = testFolder + L"b.asset";
+		writeFile(fileA, "Contents A");
+		writeFile(fileB, "Contents B");
+
+		Vector<UINT64> hashes;
+		SPtr<BuildCache> cache = BuildCache::load(cacheFolder);
+		cache->calculateHashes({ fileA, fileB }, hashes);
+
+		BS_TEST_ASSERT(hashes.size() == 2);
+		BS_TEST_ASSERT(hashes[0] == xxHash64("Contents A", 10));
+		BS_TEST_ASSERT(hashes[1] == xxHash64("Contents B", 10));
+
+		UINT64 keyA = BuildCache::calculateKey({ hashes[0] });
+		UINT64 keyB = BuildCache::calculateKey({ hashes[1] });
+		BS_TEST_ASSERT(!cache->hasOutput(keyA));
+
+		cache->addOutputs({ fileA, fileB }, { keyA, keyB });
+		BS_TEST_ASSERT(cache->hasOutput(keyA) && cache->hasOutput(keyB));
+
+		Path destA = buildFolder + L"a.asset";
+		cache->placeOutputs({ keyA }, { destA });
+		BS_TEST_ASSERT(FileSystem::isFile(destA));
+		BS_TEST_ASSERT(FileSystem::getFileSize(destA) == 10);
+
+		// Stored hashes must survive a save/load cycle, and unused outputs must get pruned
+		cache->prune({ keyA });
+		cache->save();
+
+		BS_TEST_ASSERT(cache->hasOutput(keyA));
+		BS_TEST_ASSERT(!cache->hasOutput(keyB));
+
+		SPtr<BuildCache> loadedCache = BuildCache::load(cacheFolder);
+		BS_TEST_ASSERT(loadedCache->hasOutput(keyA));
+
+		Vector<UINT64> loadedHashes;
+		loadedCache->calculateHashes({ fileA }, loadedHashes);
+		BS_TEST_ASSERT(loadedHashes[0] == hashes[0]);
+
+		FileSystem::remove(testFolder);
+	}
+
+	void EditorTestSuite::TestPackFile()
+	{
+		// Compression round trip, on both compressible and incompressible data
+		Vector<UINT8> input(100000);
+		for (UINT32 i = 0; i < (UINT32)input.size(); i++)
+			input[i] = i < 50000 ? (UINT8)(i % 17) : (UINT8)((i * 2654435761U) >> 24);
+
+		Vector<UINT8> compressed(Compression::getMaxCompressedSizeLZ4((UINT32)input.size()));
+		UINT32 compressedSize = Compression::compressLZ4(input.data(), (UINT32)input.size(), compressed.data(),
+			(UINT32)compressed.size());
+		BS_TEST_ASSERT(compressedSize > 0 && compressedSize < input.size());
+
+		Vector<UINT8> decompressed(input.size());
+		BS_TEST_ASSERT(Compression::decompressLZ4(compressed.data(), compressedSize, decompressed.data(),
+			(UINT32)decompressed.size()));
+		BS_TEST_ASSERT(decompressed == input);
+
+		// Truncated data must be rejected
+		BS_TEST_ASSERT(!Compression::decompressLZ4(compressed.data(), compressedSize / 2, decompressed.data(),
+			(UINT32)decompressed.size()));
+
+		Path testFolder = FileSystem::getTempDirectoryPath();
+		testFolder.append(L"PackFileTest/");
+		FileSystem::createDir(testFolder);
+
+		auto writeFile = [&](const Path& path, const void* data, UINT32 size)
+		{
+			SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+			stream->write(data, size);
+			stream->close();
+		};
+
+		Path fileA = testFolder + L"a.asset";
+		Path fileB = testFolder + L"b.asset";
+		writeFile(fileA, input.data(), (UINT32)input.size());
+		writeFile(fileB, "Contents B", 10);
+
+		for (UINT32 i = 0; i < 2; i++)
+		{
+			bool compress = i == 1;
+
+			PackFileWriter writer(64);
+			writer.add("b", fileB, compress);
+			writer.add("a", fileA, compress);
+
+			Path packPath = testFolder + L"Test.pack";
+			BS_TEST_ASSERT(writer.write(packPath));
+
+			SPtr<PackFile> pack = PackFile::open(packPath);
+			BS_TEST_ASSERT(pack != nullptr);
+			if (pack == nullptr)
+				continue;
+
+			BS_TEST_ASSERT(pack->getNumEntries() == 2);
+			BS_TEST_ASSERT(pack->contains("a") && pack->contains("b") && !pack->contains("c"));
+			BS_TEST_ASSERT(pack->openEntry("c") == nullptr);
+
+			SPtr<DataStream> streamA = pack->openEntry("a");
+			SPtr<DataStream> streamB = pack->openEntry("b");
+			BS_TEST_ASSERT(streamA != nullptr && streamB != nullptr);
+			if (streamA == nullptr || streamB == nullptr)
+				continue;
+
+			BS_TEST_ASSERT(streamA->size() == input.size());
+
+			Vector<UINT8> readData(input.size());
+			streamA->skip(10);
+			BS_TEST_ASSERT(streamA->tell() == 10);
+			streamA->seek(0);
+			BS_TEST_ASSERT(streamA->read(readData.data(), readData.size()) == input.size());
+			BS_TEST_ASSERT(readData == input);
+			BS_TEST_ASSERT(streamA->eof());
+
+			BS_TEST_ASSERT(streamB->getAsString() == "Contents B");
+		}
+
+		// Corrupt indices must be rejected. Index entries are stored as: identifier length, identifier, flags, offset,
+		// packed size and size. The footer starts with the index offset.
+		{
+			PackFileWriter writer(64);
+			writer.add("a", fileA, false);
+			writer.add("b", fileB, false);
+
+			Path packPath = testFolder + L"Test.pack";
+			BS_TEST_ASSERT(writer.write(packPath));
+
+			SPtr<DataStream> packStream = FileSystem::openFile(packPath, true);
+			Vector<UINT8> packData(packStream->size());
+			packStream->read(packData.data(), packData.size());
+			packStream->close();
+
+			UINT64 indexOffset;
+			memcpy(&indexOffset, packData.data() + packData.size() - 16, sizeof(indexOffset));
+
+			// First entry has a single character identifier
+			const UINT32 firstEntryOffset = (UINT32)indexOffset;
+			const UINT32 firstEntryFlags = firstEntryOffset + 5;
+			const UINT32 firstEntrySize = firstEntryOffset + 25;
+			const UINT32 secondEntryOffset = firstEntryOffset + 33;
+
+			auto openModified = [&](const std::function<void(Vector<UINT8>&)>& modify)
+			{
+				Vector<UINT8> modifiedData = packData;
+				modify(modifiedData);
+
+				Path modifiedPath = testFolder + L"Modified.pack";
+				writeFile(modifiedPath, modifiedData.data(), (UINT32)modifiedData.size());
+
+				return PackFile::open(modifiedPath);
+			};
+
+			BS_TEST_ASSERT(openModified([](Vector<UINT8>& data) {}) != nullptr);
+
+			// Uncompressed entry larger than its data
+			BS_TEST_ASSERT(openModified([&](Vector<UINT8>& data)
+			{
+				UINT64 size;
+				memcpy(&size, &data[firstEntrySize], sizeof(size));
+				size++;
+				memcpy(&data[firstEntrySize], &size, sizeof(size));
+			}) == nullptr);
+
+			// Compressed entry decompressing to an unreasonable size
+			BS_TEST_ASSERT(openModified([&](Vector<UINT8>& data)
+			{
+				UINT32 flags = PackFile::ENTRY_COMPRESSED;
+				memcpy(&data[firstEntryFlags], &flags, sizeof(flags));
+
+				UINT64 size = 1ULL << 40;
+				memcpy(&data[firstEntrySize], &size, sizeof(size));
+			}) == nullptr);
+
+			// Index not sorted by identifier
+			BS_TEST_ASSERT(openModified([&](Vector<UINT8>& data) { data[firstEntryOffset + 4] = 'c'; }) == nullptr);
+
+			// Duplicate identifiers
+			BS_TEST_ASSERT(openModified([&](Vector<UINT8>& data) { data[secondEntryOffset + 4] = 'a'; }) == nullptr);
+		}
+
+		FileSystem::remove(testFolder);
+	}
+
+	void EditorBenchmarkSuite::BenchmarkPackFile()
+	{
+		const UINT32 numResources = 500;
+		const UINT32 numStrings = 64;
+
+		Path testFolder = FileSystem::getTempDirectoryPath();
+		testFolder.append(L"PackFileBenchmark/");
+
+		Path looseFolder = testFolder;
+		looseFolder.append(L"Loose/");
+		FileSystem::createDir(looseFolder);
+
+		// Save a set of resources, which registers them in the default manifest the same as resources of a game build
+		PackFileWriter writer;
+		PackFileWriter compressedWriter;
+
+		Vector<String> uuids(numResources);
+		for (UINT32 i = 0; i < numResources; i++)
+		{
+			HStringTable stringTable = StringTable::create();
+			for (UINT32 j = 0; j < numStrings; j++)
+			{
+				stringTable->setString(L"Identifier" + toWString(j), Language::EnglishUS, 
+					L"Localized text number " + toWString(j) + L" of table " + toWString(i));
+			}
+
+			uuids[i] = stringTable.getUUID();
+
+			Path path = looseFolder + (uuids[i] + ".asset");
+			gResources().save(stringTable, path, true);
+
+			writer.add(uuids[i], path, false);
+			compressedWriter.add(uuids[i], path, true);
+
+			gResources().release(stringTable);
+		}
+
+		gResources().unloadAllUnused();
+
+		Path packPath = testFolder + L"Test.pack";
+		Path compressedPackPath = testFolder + L"TestCompressed.pack";
+		writer.write(packPath);
+		compressedWriter.write(compressedPackPath);
+
+		// Loads every resource through the resource manager the same way the game does on start-up, including opening
+		// the pack, and unloads them afterwards so the next run loads them again. Note the OS file cache is warm for all
+		// runs.
+		Timer timer;
+		auto loadResources = [&](const Path& packFilePath)
+		{
+			UINT64 startTime = timer.getMicroseconds();
+
+			SPtr<PackFile> pack;
+			if (!packFilePath.isEmpty())
+			{
+				pack = PackFile::open(packFilePath);
+				gResources().registerPackFile(pack);
+			}
+
+			Vector<HResource> resources(numResources);
+			for (UINT32 i = 0; i < numResources; i++)
+				resources[i] = gResources().loadFromUUID(uuids[i], false, ResourceLoadFlag::None);
+
+			UINT64 elapsedUs = std::max(timer.getMicroseconds() - startTime, (UINT64)1);
+
+			for (auto& resource : resources)
+			{
+				if (resource != nullptr)
+					gResources().release(resource);
+			}
+
+			gResources().unloadAllUnused();
+
+			if (pack != nullptr)
+				gResources().unregisterPackFile(pack);
+
+			return elapsedUs;
+		};
+
+		UINT64 looseElapsedUs = loadResources(Path::BLANK);
+		UINT64 packElapsedUs = loadResources(packPath);
+		UINT64 compressedPackElapsedUs = loadResources(compressedPackPath);
+
+		UINT64 packSize = FileSystem::getFileSize(packPath);
+		UINT64 compressedPackSize = FileSystem::getFileSize(compressedPackPath);
+
+		LOGDBG("Loose files: " + toString(numResources * 1000000.0f / looseElapsedUs) + " resources/s");
+		LOGDBG("Pack file: " + toString(numResources * 1000000.0f / packElapsedUs) + " resources/s, " +
+			toString(packSize) + " bytes");
+		LOGDBG("Compressed pack file: " + toString(numResources * 1000000.0f / compressedPackElapsedUs) +
+			" resources/s, " + toString(compressedPackSize) + " bytes");
+
+		SPtr<ResourceManifest> manifest = gResources().getResourceManifest("Default");
+		for (auto& uuid : uuids)
+			manifest->unregisterResource(uuid);
+
+		FileSystem::remove(testFolder);
+	}
+
+	void EditorTestSuite::TestTextureStreaming()
+	{
+		TEXTURE_DESC texDesc;
+		texDesc.type = TEX_TYPE_2D;
+		texDesc.width = 1024;
+		texDesc.height = 1024;
+		texDesc.format = PF_R8G8B8A8;
+		texDesc.numMips = 10;
+
+		TextureProperties props(texDesc);
+
+		BS_TEST_ASSERT(TextureStreaming::calculateRequiredMip(0.5f, 11) == 0);
+		BS_TEST_ASSERT(TextureStreaming::calculateRequiredMip(1.0f, 11) == 0);
+		BS_TEST_ASSERT(TextureStreaming::calculateRequiredMip(4.0f, 11) == 2);
+		BS_TEST_ASSERT(TextureStreaming::calculateRequiredMip(10000.0f, 11) == 10);
+		BS_TEST_ASSERT(TextureStreaming::calculateMinResidentMip(props, 128) == 3);
+		BS_TEST_ASSERT(TextureStreaming::calculateMipChainSize(props, 10) == 4);
+
+		UINT64 fullSize = TextureStreaming::calculateMipChainSize(props, 0);
+		UINT64 minSize = TextureStreaming::calculateMipChainSize(props, 3);
+
+		TEXTURE_STREAMING_DESC desc;
+		desc.evictionDelay = 2;
+		desc.minResidentSize = 128;
+
+		TextureStreaming streaming(desc);
+		Vector<TextureResidencyChange> changes;
+
+		// Only the minimal mip levels are resident until requested
+		UINT32 texA = streaming.registerTexture(props, 3);
+		BS_TEST_ASSERT(streaming.getResidentBytes() == minSize);
+
+		streaming.update(changes);
+		BS_TEST_ASSERT(changes.empty());
+
+		// Most detailed request during a frame wins
+		streaming.requestTexelDensity(texA, 8.0f);
+		streaming.requestTexelDensity(texA, 1.0f);
+		streaming.update(changes);
+		BS_TEST_ASSERT(changes.size() == 1 && changes[0].id == texA && changes[0].mostDetailedMip == 0);
+		BS_TEST_ASSERT(streaming.getStats(texA).residentMip == 0);
+		BS_TEST_ASSERT(streaming.getResidentBytes() == fullSize);
+
+		// Detail is kept for a while after the last request, and then evicted
+		for (UINT32 i = 0; i < desc.evictionDelay; i++)
+		{
+			changes.clear();
+			streaming.update(changes);
+			BS_TEST_ASSERT(changes.empty());
+		}
+
+		changes.clear();
+		streaming.update(changes);
+		BS_TEST_ASSERT(changes.size() == 1 && changes[0].mostDetailedMip == 3);
+		BS_TEST_ASSERT(streaming.getResidentBytes() == minSize);
+
+		// When over budget, the least recently requested texture gives up detail first
+		desc.memoryBudget = fullSize + minSize;
+		desc.evictionDelay = 100;
+		streaming.setDesc(desc);
+
+		UINT32 texB = streaming.registerTexture(props, 3);
+
+		changes.clear();
+		streaming.requestTexelDensity(texB, 1.0f);
+		streaming.update(changes);
+		BS_TEST_ASSERT(streaming.getStats(texB).residentMip == 0);
+
+		changes.clear();
+		streaming.requestTexelDensity(texA, 1.0f);
+		streaming.update(changes);
+		BS_TEST_ASSERT(changes.size() == 2);
+		BS_TEST_ASSERT(changes[0].id == texB && changes[0].mostDetailedMip == 3);
+		BS_TEST_ASSERT(changes[1].id == texA && changes[1].mostDetailedMip == 0);
+		BS_TEST_ASSERT(streaming.getResidentBytes() <= desc.memoryBudget);
+
+		TextureResidencyStats statsB = streaming.getStats(texB);
+		BS_TEST_ASSERT(statsB.requestedMip == 0 && statsB.targetMip == 3 && statsB.residentMip == 3);
+
+		// Loads are limited per frame, but at least one texture is always loaded
+		desc.memoryBudget = fullSize * 4;
+		desc.maxLoadPerFrame = 1;
+		streaming.setDesc(desc);
+
+		UINT32 texC = streaming.registerTexture(props, 3);
+
+		changes.clear();
+		streaming.requestTexelDensity(texB, 1.0f);
+		streaming.requestTexelDensity(texC, 2.0f);
+		streaming.update(changes);
+		BS_TEST_ASSERT(changes.size() == 1 && changes[0].id == texB);
+
+		TextureResidencyStats statsC = streaming.getStats(texC);
+		BS_TEST_ASSERT(statsC.requestedMip == 1 && statsC.targetMip == 1 && statsC.residentMip == 3);
+
+		changes.clear();
+		streaming.update(changes);
+		BS_TEST_ASSERT(changes.size() == 1 && changes[0].id == texC && changes[0].mostDetailedMip == 1);
+
+		// Unregistered textures no longer count towards the resident size, and their identifiers get reused
+		UINT64 residentBytes = streaming.getResidentBytes();
+		streaming.unregisterTexture(texC);
+		BS_TEST_ASSERT(streaming.getNumTextures() == 2);
+		BS_TEST_ASSERT(streaming.getResidentBytes() == residentBytes - TextureStreaming::calculateMipChainSize(props, 1));
+		BS_TEST_ASSERT(streaming.registerTexture(props, 3) == texC);
+	}
+
+	void EditorTestSuite::TestOcclusionBuffer()
+	{
+		// Camera at origin looking down -Z, with a 10x10 wall 10 units in front of it
+		float nearPlane = 0.1f;
+		float farPlane = 100.0f;
+		float aspect = 2.0f;
+		float t = 1.0f / Math::tan(Radian(1.5f) * 0.5f);
+
+		Matrix4 proj(
+			t / aspect, 0.0f, 0.0f, 0.0f,
+			0.0f, t, 0.0f, 0.0f,
+			0.0f, 0.0f, (farPlane + nearPlane) / (nearPlane - farPlane), 2.0f * farPlane * nearPlane / (nearPlane - farPlane),
+			0.0f, 0.0f, -1.0f, 0.0f);
+
+		OccluderGeometry wall;
+		wall.positions = { Vector3(-5, -5, 0), Vector3(5, -5, 0), Vector3(5, 5, 0), Vector3(-5, 5, 0) };
+		wall.indices = { 0, 1, 2, 0, 2, 3 };
+
+		Matrix4 wallTfrm = Matrix4::translation(Vector3(0.0f, 0.0f, -10.0f));
+
+		OcclusionBuffer buffer(256, 128);
+		buffer.clear(proj);
+		buffer.addOccluder(wall, wallTfrm);
+		buffer.rasterize();
+
+		BS_TEST_ASSERT(buffer.getNumTriangles() == 2);
+		BS_TEST_ASSERT(buffer.getDepth(128, 64) < 1.0f);
+		BS_TEST_ASSERT(buffer.getDepth(0, 0) == std::numeric_limits<float>::max());
+
+		// Only fully covered pixels are rasterized. The wall's diagonal edge crosses pixel (127, 64), which is only
+		// partially covered by each of the wall's triangles.
+		BS_TEST_ASSERT(buffer.getDepth(127, 64) == std::numeric_limits<float>::max());
+
+		// Objects fully behind the wall are hidden, regardless of their size
+		BS_TEST_ASSERT(!buffer.isVisible(AABox(Vector3(3, -7, -21), Vector3(7, -3, -19))));
+		BS_TEST_ASSERT(!buffer.isVisible(AABox(Vector3(6, -14, -41), Vector3(14, -6, -39))));
+
+		// Objects in front of, beside or only partially behind the wall remain visible
+		BS_TEST_ASSERT(buffer.isVisible(AABox(Vector3(-1, -1, -6), Vector3(1, 1, -4))));
+		BS_TEST_ASSERT(buffer.isVisible(AABox(Vector3(20, -1, -31), Vector3(22, 1, -29))));
+		BS_TEST_ASSERT(buffer.isVisible(AABox(Vector3(4, -1, -21), Vector3(12, 1, -19))));
+
+		// Objects crossing the near plane are always visible
+		BS_TEST_ASSERT(buffer.isVisible(AABox(Vector3(-1, -1, -1), Vector3(1, 1, 1))));
+
+		// Batched tests match individual ones
+		Vector<AABox> bounds;
+		for (UINT32 i = 0; i < 1000; i++)
+		{
+			float offset = (float)(i % 40) - 20.0f;
+			bounds.push_back(AABox(Vector3(offset, -1, -21), Vector3(offset + 1, 1, -19)));
+		}
+
+		Vector<bool> visible;
+		buffer.isVisible(bounds, visible);
+
+		BS_TEST_ASSERT(visible.size() == bounds.size());
+		for (UINT32 i = 0; i < (UINT32)bounds.size(); i++)
+			BS_TEST_ASSERT(visible[i] == buffer.isVisible(bounds[i]));
+
+		// Clearing removes all occluders
+		buffer.clear(proj);
+		buffer.rasterize();
+
+		BS_TEST_ASSERT(buffer.getNumTriangles() == 0);
+		BS_TEST_ASSERT(buffer.isVisible(AABox(Vector3(3, -7, -21), Vector3(7, -3, -19))));
+	}
+
+	/** Creates a shader without techniques, containing the specified number of Vector4 parameters. */
+	HShader createDirtyParamsTestShader(UINT32 numParams)
+	{
+		SHADER_DESC desc;
+		for (UINT32 i = 0; i < numParams; i++)
+		{
+			String name = "gParam" + toString(i);
+			desc.addParameter(name, name, GPDT_FLOAT4);
+		}
+
+		return Shader::create("DirtyParamsTest", desc, {});
+	}
+
+	void EditorTestSuite::TestMaterialDirtyParams()
+	{
+		HShader shader = createDirtyParamsTestShader(100);
+		MaterialParams params(shader);
+
+		UINT32 idxA = params.getParamIndex("gParam3");
+		UINT32 idxB = params.getParamIndex("gParam42");
+		const MaterialParams::ParamData& paramA = *params.getParamData(idxA);
+		const MaterialParams::ParamData& paramB = *params.getParamData(idxB);
+
+		// Initial state isn't tracked
+		Vector<UINT32> dirty;
+		BS_TEST_ASSERT(!params.getDirtyParams(0, dirty));
+
+		UINT64 version = params.getParamVersion();
+		BS_TEST_ASSERT(params.getDirtyParams(version, dirty));
+		BS_TEST_ASSERT(dirty.empty());
+
+		// Modified parameters are reported once, regardless of how many times they were modified
+		params.setDataParam(paramA, 0, Vector4(1.0f, 0.0f, 0.0f, 0.0f));
+		params.setDataParam(paramB, 0, Vector4(2.0f, 0.0f, 0.0f, 0.0f));
+		params.setDataParam(paramA, 0, Vector4(3.0f, 0.0f, 0.0f, 0.0f));
+
+		BS_TEST_ASSERT(params.getDirtyParams(version, dirty));
+		BS_TEST_ASSERT(dirty.size() == 2);
+		BS_TEST_ASSERT(std::count(dirty.begin(), dirty.end(), idxA) == 1);
+		BS_TEST_ASSERT(std::count(dirty.begin(), dirty.end(), idxB) == 1);
+
+		// Only modifications after the provided version are reported
+		version = params.getParamVersion();
+		params.setDataParam(paramB, 0, Vector4(4.0f, 0.0f, 0.0f, 0.0f));
+
+		dirty.clear();
+		BS_TEST_ASSERT(params.getDirtyParams(version, dirty));
+		BS_TEST_ASSERT(dirty.size() == 1 && dirty[0] == idxB);
+
+		// Too many modifications since the provided version must report an overflow
+		for (UINT32 i = 0; i < 100; i++)
+		{
+			const MaterialParams::ParamData& param = *params.getParamData(params.getParamIndex("gParam" + toString(i)));
+			params.setDataParam(param, 0, Vector4((float)i, 0.0f, 0.0f, 0.0f));
+		}
+
+		dirty.clear();
+		BS_TEST_ASSERT(!params.getDirtyParams(version, dirty));
+
+		// But recent modifications are still tracked
+		version = params.getParamVersion();
+		params.setDataParam(paramA, 0, Vector4(5.0f, 0.0f, 0.0f, 0.0f));
+
+		dirty.clear();
+		BS_TEST_ASSERT(params.getDirtyParams(version, dirty));
+		BS_TEST_ASSERT(dirty.size() == 1 && dirty[0] == idxA);
+
+		Vector4 value;
+		params.getDataParam(paramA, 0, value);
+		BS_TEST_ASSERT(value.x == 5.0f);
+	}
+
+	void EditorBenchmarkSuite::BenchmarkMaterialDirtyParams()
+	{
+		const UINT32 numParams = 128;
+		const UINT32 numFrames = 100000;
+		const UINT32 numChangesPerFrame = 2;
+
+		HShader shader = createDirtyParamsTestShader(numParams);
+		MaterialParams params(shader);
+
+		Vector<const MaterialParams::ParamData*> paramData(numParams);
+		for (UINT32 i = 0; i < numParams; i++)
+			paramData[i] = params.getParamData(i);
+
+		Timer timer;
+
+		// Check the version of every parameter, as done when the dirty parameters aren't tracked
+		UINT64 version = params.getParamVersion();
+		UINT32 numFoundFull = 0;
+
+		UINT64 startTime = timer.getMicroseconds();
+		for (UINT32 i = 0; i < numFrames; i++)
+		{
+			for (UINT32 j = 0; j < numChangesPerFrame; j++)
+				params.setDataParam(*paramData[(i * 7 + j * 31) % numParams], 0, Vector4((float)i, 0.0f, 0.0f, 0.0f));
+
+			for (UINT32 j = 0; j < numParams; j++)
+			{
+				if (paramData[j]->version > version)
+					numFoundFull++;
+			}
+
+			version = params.getParamVersion();
+		}
+
+		UINT64 fullElapsedUs = std::max(timer.getMicroseconds() - startTime, (UINT64)1);
+
+		// Only visit the tracked dirty parameters
+		Vector<UINT32> dirty;
+		UINT32 numFoundDirty = 0;
+
+		startTime = timer.getMicroseconds();
+		for (UINT32 i = 0; i < numFrames; i++)
+		{
+			for (UINT32 j = 0; j < numChangesPerFrame; j++)
+				params.setDataParam(*paramData[(i * 7 + j * 31) % numParams], 0, Vector4((float)i, 0.0f, 0.0f, 0.0f));
+
+			dirty.clear();
+			params.getDirtyParams(version, dirty);
+			numFoundDirty += (UINT32)dirty.size();
+
+			version = params.getParamVersion();
+		}
+
+		UINT64 dirtyElapsedUs = std::max(timer.getMicroseconds() - startTime, (UINT64)1);
+
+		BS_TEST_ASSERT(numFoundFull == numFrames * numChangesPerFrame);
+		BS_TEST_ASSERT(numFoundDirty == numFrames * numChangesPerFrame);
+
+		LOGDBG("Material dirty params (" + toString(numParams) + " params, " + toString(numChangesPerFrame) +
+			" changes per frame), full scan: " + toString(fullElapsedUs / 1000.0f) + " ms, tracked: " +
+			toString(dirtyElapsedUs / 1000.0f) + " ms");
+	}
+
+	void EditorTestSuite::TestCoreObjectSync()
+	{
+		const UINT32 NUM_LIGHTS = 1024;
+
+		Vector<SPtr<Light>> lights(NUM_LIGHTS);
+		for (UINT32 i = 0; i < NUM_LIGHTS; i++)
+			lights[i] = Light::create(LightType::Point);
+
+		CoreObjectManager::instance().syncToCore();
+		gCoreThread().submitAll(true);
+
+		// Modify all lights and sync them at once, enough for the serialization to be split between workers
+		for (UINT32 i = 0; i < NUM_LIGHTS; i++)
+			lights[i]->setColor(Color(i / (float)NUM_LIGHTS, 0.5f, 1.0f));
+
+		CoreObjectManager::instance().syncToCore();
+		BS_TEST_ASSERT(CoreObjectManager::instance().getSyncStats().numSyncedObjects >= NUM_LIGHTS);
+
+		gCoreThread().submitAll(true);
+
+		bool allSynced = true;
+		for (UINT32 i = 0; i < NUM_LIGHTS; i++)
+		{
+			SPtr<LightCore> lightCore = lights[i]->getCore();
+			if (lightCore->getColor() != lights[i]->getColor())
+				allSynced = false;
+		}
+
+		BS_TEST_ASSERT(allSynced);
+
+		// Clean objects aren't synced again
+		CoreObjectManager::instance().syncToCore();
+		BS_TEST_ASSERT(CoreObjectManager::instance().getSyncStats().numSyncedObjects < NUM_LIGHTS);
+
+		gCoreThread().submitAll(true);
+
+		for (auto& light : lights)
+			light->destroy();
+	}
+
+	void EditorTestSuite::TestMaterialParamLookup()
+	{
+		const UINT32 numParams = 100;
+
+		HShader shader = createDirtyParamsTestShader(numParams);
+		MaterialParams params(shader);
+
+		// Every parameter maps to a unique index
+		Vector<bool> found(numParams, false);
+		for (UINT32 i = 0; i < numParams; i++)
+		{
+			UINT32 idx = params.getParamIndex("gParam" + toString(i));
+			BS_TEST_ASSERT(idx < numParams && !found[idx]);
+
+			if (idx < numParams)
+				found[idx] = true;
+		}
+
+		// Lookups by StringID and by string resolve to the same parameter
+		StringID name("gParam17");
+		BS_TEST_ASSERT(params.getParamIndex(name) == params.getParamIndex("gParam17"));
+
+		BS_TEST_ASSERT(params.getParamIndex("gParamMissing") == (UINT32)-1);
+		BS_TEST_ASSERT(params.getParamIndex(StringID::NONE) == (UINT32)-1);
+
+		UINT32 idx;
+		BS_TEST_ASSERT(params.getParamIndex(name, MaterialParams::ParamType::Data, GPDT_FLOAT4, 0, idx) ==
+			MaterialParams::GetParamResult::Success);
+		BS_TEST_ASSERT(params.getParamIndex(name, MaterialParams::ParamType::Data, GPDT_FLOAT1, 0, idx) ==
+			MaterialParams::GetParamResult::InvalidType);
+		BS_TEST_ASSERT(params.getParamIndex(name, MaterialParams::ParamType::Data, GPDT_FLOAT4, 1, idx) ==
+			MaterialParams::GetParamResult::IndexOutOfBounds);
+
+		// Values set by name are visible through the parameter handle
+		params.setDataParam(name, 0, Vector4(1.0f, 2.0f, 3.0f, 4.0f));
+
+		Vector4 value;
+		params.getDataParam(*params.getParamData(params.getParamIndex(name)), 0, value);
+		BS_TEST_ASSERT(value == Vector4(1.0f, 2.0f, 3.0f, 4.0f));
+	}
+
+	void EditorBenchmarkSuite::BenchmarkMaterialParamAccess()
+	{
+		const UINT32 numParams = 128;
+		const UINT32 numIterations = 1000000;
+
+		HShader shader = createDirtyParamsTestShader(numParams);
+		HMaterial material = Material::create(shader);
+
+		Vector<String> names(numParams);
+		Vector<StringID> ids(numParams);
+		Vector<TMaterialDataParam<Vector4, false>> handles(numParams);
+		for (UINT32 i = 0; i < numParams; i++)
+		{
+			names[i] = "gParam" + toString(i);
+			ids[i] = names[i];
+			handles[i] = material->getParamVec4(ids[i]);
+		}
+
+		Timer timer;
+
+		UINT64 startTime = timer.getMicroseconds();
+		for (UINT32 i = 0; i < numIterations; i++)
+			material->setVec4(names[(i * 7) % numParams], Vector4((float)i, 0.0f, 0.0f, 0.0f));
+
+		UINT64 stringElapsedUs = std::max(timer.getMicroseconds() - startTime, (UINT64)1);
+
+		startTime = timer.getMicroseconds();
+		for (UINT32 i = 0; i < numIterations; i++)
+			material->setVec4(ids[(i * 7) % numParams], Vector4((float)i, 0.0f, 0.0f, 0.0f));
+
+		UINT64 idElapsedUs = std::max(timer.getMicroseconds() - startTime, (UINT64)1);
+
+		startTime = timer.getMicroseconds();
+		for (UINT32 i = 0; i < numIterations; i++)
+			handles[(i * 7) % numParams].set(Vector4((float)i, 0.0f, 0.0f, 0.0f));
+
+		UINT64 handleElapsedUs = std::max(timer.getMicroseconds() - startTime, (UINT64)1);
+
+		UINT32 lastIdx = (numIterations - 1) * 7 % numParams;
+		BS_TEST_ASSERT(material->getVec4(ids[lastIdx]).x == (float)(numIterations - 1));
+
+		LOGDBG("Material param access (" + toString(numIterations) + " sets), by string: " +
+			toString(stringElapsedUs / 1000.0f) + " ms, by StringID: " + toString(idElapsedUs / 1000.0f) +
+			" ms, by handle: " + toString(handleElapsedUs / 1000.0f) + " ms");
+
+		material->destroy();
+	}
+
+	/** Render graph allocator that doesn't create any GPU resources, only tracks the number of live allocations. */
+	class TestRenderGraphAllocator : public RenderGraphAllocator
+	{
+	public:
+		void allocate(const TEXTURE_DESC& desc, SPtr<TextureCore>& texture,
+			SPtr<RenderTextureCore>& renderTexture) override
+		{
+			numAllocations++;
+			numLive++;
+			maxLive = std::max(maxLive, numLive);
+		}
+
+		void release(const SPtr<TextureCore>& texture) override
+		{
+			numLive--;
+		}
+
+		UINT32 numAllocations = 0;
+		UINT32 numLive = 0;
+		UINT32 maxLive = 0;
+	};
+
+	void EditorTestSuite::TestRenderGraph()
+	{
+		TEXTURE_DESC colorDesc;
+		colorDesc.width = 256;
+		colorDesc.height = 256;
+		colorDesc.format = PF_R8G8B8A8;
+		colorDesc.usage = TU_RENDERTARGET;
+
+		TEXTURE_DESC hdrDesc = colorDesc;
+		hdrDesc.format = PF_FLOAT16_RGBA;
+
+		RenderGraph graph;
+		Vector<UINT32> executed;
+		UINT32 numPasses = 0;
+		auto addPass = [&](const String& name)
+		{
+			UINT32 passIdx = numPasses++;
+			graph.addPass(name, [&executed, passIdx](const RenderGraph&) { executed.push_back(passIdx); });
+
+			return passIdx;
+		};
+
+		UINT32 output = graph.importTexture("Output", nullptr);
+		UINT32 texA = graph.createTexture("A", colorDesc);
+		UINT32 texB = graph.createTexture("B", hdrDesc);
+		UINT32 texC = graph.createTexture("C", colorDesc);
+		UINT32 texUnused = graph.createTexture("Unused", colorDesc);
+
+		// Passes are intentionally added out of order
+		UINT32 passFinal = addPass("Final");
+		graph.read(passFinal, texC);
+		graph.write(passFinal, output);
+
+		UINT32 passA = addPass("A");
+		graph.write(passA, texA);
+
+		UINT32 passUnused = addPass("Unused");
+		graph.read(passUnused, texA);
+		graph.write(passUnused, texUnused);
+
+		UINT32 passB = addPass("B");
+		graph.read(passB, texA);
+		graph.write(passB, texB);
+
+		UINT32 passC = addPass("C");
+		graph.read(passC, texB);
+		graph.write(passC, texC);
+
+		BS_TEST_ASSERT(graph.compile());
+
+		// Pass whose output is never read is culled, others are ordered by their dependencies
+		BS_TEST_ASSERT(graph.isPassCulled(passUnused));
+		BS_TEST_ASSERT(!graph.isPassCulled(passFinal));
+
+		const Vector<UINT32>& order = graph.getExecutionOrder();
+		BS_TEST_ASSERT(order.size() == 4);
+		if (order.size() == 4)
+		{
+			BS_TEST_ASSERT(order[0] == passA);
+			BS_TEST_ASSERT(order[1] == passB);
+			BS_TEST_ASSERT(order[2] == passC);
+			BS_TEST_ASSERT(order[3] == passFinal);
+		}
+
+		// C is created after A is no longer used and has the same description, so they share memory. B has a different
+		// format and must not be shared with either.
+		BS_TEST_ASSERT(graph.getPhysicalTextureIdx(texA) == graph.getPhysicalTextureIdx(texC));
+		BS_TEST_ASSERT(graph.getPhysicalTextureIdx(texA) != graph.getPhysicalTextureIdx(texB));
+		BS_TEST_ASSERT(graph.getPhysicalTextureIdx(texUnused) == (UINT32)-1);
+		BS_TEST_ASSERT(graph.getPhysicalTextureIdx(output) == (UINT32)-1);
+
+		const RenderGraphStats& stats = graph.getStats();
+		BS_TEST_ASSERT(stats.numPasses == 4);
+		BS_TEST_ASSERT(stats.numCulledPasses == 1);
+		BS_TEST_ASSERT(stats.numTransientTextures == 3);
+		BS_TEST_ASSERT(stats.numPhysicalTextures == 2);
+		BS_TEST_ASSERT(stats.transientMemory ==
+			RenderGraph::getMemorySize(colorDesc) * 2 + RenderGraph::getMemorySize(hdrDesc));
+		BS_TEST_ASSERT(stats.physicalMemory ==
+			RenderGraph::getMemorySize(colorDesc) + RenderGraph::getMemorySize(hdrDesc));
+
+		// Execution follows the compiled order and never keeps more than the physical textures alive
+		TestRenderGraphAllocator allocator;
+		graph.execute(allocator);
+
+		BS_TEST_ASSERT(executed == order);
+		BS_TEST_ASSERT(allocator.numAllocations == 2);
+		BS_TEST_ASSERT(allocator.maxLive == 2);
+		BS_TEST_ASSERT(allocator.numLive == 0);
+
+		// Reading a transient texture nobody writes to is an error
+		graph.clear();
+
+		UINT32 texMissing = graph.createTexture("Missing", colorDesc);
+		UINT32 passMissing = graph.addPass("ReadMissing", nullptr);
+		graph.read(passMissing, texMissing);
+		graph.setHasSideEffects(passMissing);
+
+		BS_TEST_ASSERT(!graph.compile());
+
+		// So are dependency cycles
+		graph.clear();
+
+		UINT32 texX = graph.createTexture("X", colorDesc);
+		UINT32 texY = graph.createTexture("Y", colorDesc);
+
+		UINT32 passX = graph.addPass("X", nullptr);
+		graph.read(passX, texY);
+		graph.write(passX, texX);
+		graph.setHasSideEffects(passX);
+
+		UINT32 passY = graph.addPass("Y", nullptr);
+		graph.read(passY, texX);
+		graph.write(passY, texY);
+
+		BS_TEST_ASSERT(!graph.compile());
+	}
+
+	void EditorTestSuite::TestStringID()
+	{
+		// Literal hashes are evaluated at compile time and match the runtime hash
+		static_assert("ab"_sid.hash == 'a' * 101 + 'b', "StringID literal hash must be a compile time constant.");
+		BS_TEST_ASSERT("TestStringIDLiteral"_sid.hash == StringID::calcHash("TestStringIDLiteral", 19));
+
+		StringID fromLiteral = "TestStringIDLiteral"_sid;
+		StringID fromCStr("TestStringIDLiteral");
+		StringID fromString(String("TestStringIDLiteral"));
+
+		BS_TEST_ASSERT(fromLiteral == fromCStr);
+		BS_TEST_ASSERT(fromLiteral == fromString);
+		BS_TEST_ASSERT(strcmp(fromLiteral.cstr(), "TestStringIDLiteral") == 0);
+		BS_TEST_ASSERT(fromLiteral != "TestStringIDLiteral2"_sid);
+		BS_TEST_ASSERT(fromLiteral != "TestStringIDLitera"_sid);
+		BS_TEST_ASSERT(StringID(""_sid) == StringID(""));
+
+		// Identifiers registered concurrently from multiple threads resolve to the same entries
+		const UINT32 numThreads = 8;
+		const UINT32 numNames = 512;
+
+		Vector<String> names(numNames);
+		for (UINT32 i = 0; i < numNames; i++)
+			names[i] = "TestStringIDConcurrent" + toString(i);
+
+		Vector<Vector<UINT32>> ids(numThreads, Vector<UINT32>(numNames));
+		Vector<Thread> threads;
+		for (UINT32 i = 0; i < numThreads; i++)
+		{
+			threads.push_back(Thread([&, i]()
+			{
+				// Each thread registers the names in a different order
+				for (UINT32 j = 0; j < numNames; j++)
+				{
+					UINT32 nameIdx = (j * 7 + i * 31) % numNames;
+					ids[i][nameIdx] = StringID(names[nameIdx]).id();
+				}
+			}));
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		for (UINT32 i = 0; i < numNames; i++)
+		{
+			StringID id(names[i]);
+			BS_TEST_ASSERT(strcmp(id.cstr(), names[i].c_str()) == 0);
+
+			for (UINT32 j = 0; j < numThreads; j++)
+				BS_TEST_ASSERT(ids[j][i] == id.id());
+		}
+	}
+
+	void EditorTestSuite::TestAsyncLogger()
+	{
+		const UINT32 numThreads = 16;
+		const UINT32 numMessages = 500;
+
+		// Messages from all threads are delivered, and each thread's messages arrive in the order they were logged in
+		{
+			Vector<LogEntry> entries;
+			AsyncLogger logger([&](const LogEntry& entry) { entries.push_back(entry); }, 64);
+
+			Vector<Thread> threads;
+			for (UINT32 i = 0; i < numThreads; i++)
+			{
+				threads.push_back(Thread([&, i]()
+				{
+					for (UINT32 j = 0; j < numMessages; j++)
+						logger.log(toString(j), i, true);
+				}));
+			}
+
+			for (auto& thread : threads)
+				thread.join();
+
+			logger.flush();
+
+			BS_TEST_ASSERT(entries.size() == numThreads * numMessages);
+			BS_TEST_ASSERT(logger.getNumDropped() == 0);
+
+			Vector<UINT32> nextMessage(numThreads, 0);
+			for (auto& entry : entries)
+			{
+				UINT32 thread = entry.getChannel();
+				BS_TEST_ASSERT(entry.getMessage() == toString(nextMessage[thread]));
+
+				nextMessage[thread]++;
+			}
+		}
+
+		// Messages are dropped while the queue is full, which is then reported through the sink
+		{
+			std::atomic<bool> blockSink(true);
+			Vector<LogEntry> entries;
+			AsyncLogger logger([&](const LogEntry& entry)
+			{
+				while (blockSink.load())
+					std::this_thread::yield();
+
+				entries.push_back(entry);
+			}, 4);
+
+			UINT32 numQueued = 0;
+			while (numQueued < 100 && logger.log("Message", 0))
+				numQueued++;
+
+			BS_TEST_ASSERT(numQueued < 100);
+			BS_TEST_ASSERT(logger.getNumDropped() == 1);
+
+			blockSink.store(false);
+			logger.flush();
+
+			UINT32 numWarnings = 0;
+			for (auto& entry : entries)
+			{
+				if (entry.getChannel() == (UINT32)DebugChannel::Warning)
+					numWarnings++;
+			}
+
+			BS_TEST_ASSERT(entries.size() == numQueued + 1);
+			BS_TEST_ASSERT(numWarnings == 1);
+		}
+	}
+
+	void EditorBenchmarkSuite::BenchmarkAsyncLogger()
+	{
+		const UINT32 numThreads = 16;
+		const UINT32 numMessages = 20000;
+
+		String message = "Benchmark warning message with some typical length to it.";
+		auto logFromThreads = [&](const std::function<void()>& logMessage)
+		{
+			Vector<Thread> threads;
+			for (UINT32 i = 0; i < numThreads; i++)
+			{
+				threads.push_back(Thread([&]()
+				{
+					for (UINT32 j = 0; j < numMessages; j++)
+						logMessage();
+				}));
+			}
+
+			for (auto& thread : threads)
+				thread.join();
+		};
+
+		Timer timer;
+
+		// Every thread appends to the log directly, taking its lock
+		Log syncLog;
+
+		UINT64 startTime = timer.getMicroseconds();
+		logFromThreads([&]() { syncLog.logMsg(message, (UINT32)DebugChannel::Warning); });
+
+		UINT64 syncElapsedUs = std::max(timer.getMicroseconds() - startTime, (UINT64)1);
+
+		// Threads queue messages and the logger's worker appends them to the log
+		Log asyncLog;
+		UINT64 asyncElapsedUs;
+		UINT64 asyncTotalElapsedUs;
+		UINT64 numDropped;
+		{
+			AsyncLogger logger([&](const LogEntry& entry) { asyncLog.logMsg(entry.getMessage(), entry.getChannel()); });
+
+			startTime = timer.getMicroseconds();
+			logFromThreads([&]() { logger.log(message, (UINT32)DebugChannel::Warning); });
+
+			asyncElapsedUs = std::max(timer.getMicroseconds() - startTime, (UINT64)1);
+
+			logger.flush();
+			asyncTotalElapsedUs = std::max(timer.getMicroseconds() - startTime, (UINT64)1);
+			numDropped = logger.getNumDropped();
+		}
+
+		UINT64 numTotal = numThreads * numMessages;
+		LOGDBG("Logging " + toString(numTotal) + " messages from " + toString(numThreads) + " threads, locking: " +
+			toString(syncElapsedUs / 1000.0f) + " ms (" + toString((UINT64)(numTotal * 1000000 / syncElapsedUs)) +
+			" msg/s), async: " + toString(asyncElapsedUs / 1000.0f) + " ms (" +
+			toString((UINT64)(numTotal * 1000000 / asyncElapsedUs)) + " msg/s, " + toString(numDropped) +
+			" dropped), async including flush: " + toString(asyncTotalElapsedUs / 1000.0f) + " ms");
+	}
+
+	/**
+	 * Creates atlas elements with sizes similar to rendered glyphs of a font of the provided size: mostly narrower than
+	 * tall, with some wide glyphs, and some without any area (like spaces).
+	 */
+	static Vector<TexAtlasElementDesc> createTestGlyphElements(UINT32 numGlyphs, UINT32 fontSize, UINT32 seed)
+	{
+		auto next = [&seed]() { seed = seed * 1664525 + 1013904223; return seed >> 8; };
+
+		Vector<TexAtlasElementDesc> elements(numGlyphs);
+		for (UINT32 i = 0; i < numGlyphs; i++)
+		{
+			TexAtlasElementDesc& element = elements[i];
+			if (next() % 50 == 0)
+			{
+				element.input.width = 0;
+				element.input.height = fontSize;
+			}
+			else
+			{
+				element.input.width = std::max(1U, fontSize * (20 + next() % 90) / 100);
+				element.input.height = std::max(1U, fontSize * (40 + next() % 90) / 100);
+			}
+		}
+
+		return elements;
+	}
+
+	/** Checks that all elements with area are placed within their pages, and that no elements on a page overlap. */
+	static bool isTexAtlasLayoutValid(const Vector<TexAtlasElementDesc>& elements, const Vector<TexAtlasPageDesc>& pages)
+	{
+		for (UINT32 i = 0; i < (UINT32)elements.size(); i++)
+		{
+			const TexAtlasElementDesc& a = elements[i];
+			if (a.input.width * a.input.height == 0)
+				continue;
+
+			if (a.output.page < 0 || a.output.page >= (INT32)pages.size())
+				return false;
+
+			const TexAtlasPageDesc& page = pages[a.output.page];
+			if (a.output.x + a.input.width > page.width || a.output.y + a.input.height > page.height)
+				return false;
+
+			for (UINT32 j = i + 1; j < (UINT32)elements.size(); j++)
+			{
+				const TexAtlasElementDesc& b = elements[j];
+				if (b.input.width * b.input.height == 0 || a.output.page != b.output.page)
+					continue;
+
+				Rect2I rectA(a.output.x, a.output.y, a.input.width, a.input.height);
+				Rect2I rectB(b.output.x, b.output.y, b.input.width, b.input.height);
+
+				if (rectA.overlaps(rectB))
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+	void EditorTestSuite::TestTexAtlasGenerator()
+	{
+		// Layouts created from scratch, with both packing methods
+		TexAtlasPackMethod methods[] = { TexAtlasPackMethod::BinaryTree, TexAtlasPackMethod::MaxRects };
+		for (auto& method : methods)
+		{
+			Vector<TexAtlasElementDesc> elements = createTestGlyphElements(400, 32, 1);
+
+			TexAtlasGenerator generator(false, 256, 256, false, method);
+			Vector<TexAtlasPageDesc> pages = generator.createAtlasLayout(elements);
+
+			BS_TEST_ASSERT(pages.size() > 1);
+			BS_TEST_ASSERT(isTexAtlasLayoutValid(elements, pages));
+
+			// Last page should have been shrunk, all others are of maximum size
+			for (UINT32 i = 0; i < (UINT32)pages.size() - 1; i++)
+				BS_TEST_ASSERT(pages[i].width == 256 && pages[i].height == 256);
+
+			BS_TEST_ASSERT(pages.back().width * pages.back().height <= 256 * 256);
+
+			// Elements larger than the maximum page size can't be placed
+			Vector<TexAtlasElementDesc> largeElements = createTestGlyphElements(10, 32, 2);
+			largeElements[3].input.width = 300;
+
+			BS_TEST_ASSERT(generator.createAtlasLayout(largeElements).empty());
+		}
+
+		// Incremental insertion, without moving existing elements
+		DynamicTexAtlasLayout layout(128, 128);
+
+		Vector<TexAtlasElementDesc> elements = createTestGlyphElements(200, 24, 3);
+		for (UINT32 i = 0; i < 100; i++)
+			BS_TEST_ASSERT(layout.insert(elements[i]));
+
+		Vector<TexAtlasElementDesc> firstHalf(elements.begin(), elements.begin() + 100);
+		UINT32 numPagesBefore = layout.getNumPages();
+
+		for (UINT32 i = 100; i < 200; i++)
+			BS_TEST_ASSERT(layout.insert(elements[i]));
+
+		bool unchanged = true;
+		for (UINT32 i = 0; i < 100; i++)
+		{
+			unchanged &= elements[i].output.x == firstHalf[i].output.x && elements[i].output.y == firstHalf[i].output.y &&
+				elements[i].output.page == firstHalf[i].output.page;
+		}
+
+		BS_TEST_ASSERT(unchanged);
+		BS_TEST_ASSERT(layout.getNumPages() >= numPagesBefore);
+
+		Vector<TexAtlasPageDesc> pages(layout.getNumPages(), layout.getPageDesc());
+		BS_TEST_ASSERT(isTexAtlasLayoutValid(elements, pages));
+
+		for (UINT32 i = 0; i < layout.getNumPages(); i++)
+			BS_TEST_ASSERT(layout.getOccupancy(i) > 0.0f && layout.getOccupancy(i) <= 1.0f);
+
+		// Full layouts only grow when allowed
+		DynamicTexAtlasLayout smallLayout(16, 16);
+
+		TexAtlasElementDesc element;
+		element.input.width = 16;
+		element.input.height = 16;
+
+		BS_TEST_ASSERT(smallLayout.insert(element, false) == false);
+		BS_TEST_ASSERT(smallLayout.insert(element) && element.output.page == 0);
+		BS_TEST_ASSERT(smallLayout.insert(element, false) == false);
+		BS_TEST_ASSERT(smallLayout.insert(element) && element.output.page == 1);
+
+		element.input.width = 17;
+		BS_TEST_ASSERT(smallLayout.insert(element) == false);
+	}
+
+	void EditorTestSuite::TestParallelFor()
+	{
+		const UINT32 NUM_ELEMENTS = 10007; // Not divisible by the number of chunks
+		const UINT32 MIN_PER_CHUNK = 100;
+
+		// Every element is processed exactly once, by the chunk it belongs to
+		Vector<std::atomic<UINT32>> visits(NUM_ELEMENTS);
+		for (auto& entry : visits)
+			entry = 0;
+
+		UINT32 numChunks = TaskScheduler::getNumParallelChunks(NUM_ELEMENTS, MIN_PER_CHUNK);
+		Vector<UINT32> chunkStarts(numChunks, (UINT32)-1);
+		Vector<UINT32> chunkEnds(numChunks, (UINT32)-1);
+
+		UINT32 numExecuted = TaskScheduler::parallelFor("TestParallelFor", NUM_ELEMENTS, MIN_PER_CHUNK, 
+			[&](UINT32 chunkIdx, UINT32 start, UINT32 end)
+		{
+			chunkStarts[chunkIdx] = start;
+			chunkEnds[chunkIdx] = end;
+
+			for (UINT32 i = start; i < end; i++)
+				visits[i]++;
+		});
+
+		BS_TEST_ASSERT(numExecuted == numChunks);
+
+		bool allVisitedOnce = true;
+		for (auto& entry : visits)
+		{
+			if (entry != 1)
+				allVisitedOnce = false;
+		}
+
+		BS_TEST_ASSERT(allVisitedOnce);
+
+		// Chunks are contiguous, in order and never empty
+		bool chunksValid = chunkStarts[0] == 0 && chunkEnds[numChunks - 1] == NUM_ELEMENTS;
+		for (UINT32 i = 0; i < numChunks; i++)
+		{
+			if (chunkStarts[i] >= chunkEnds[i] || (i > 0 && chunkStarts[i] != chunkEnds[i - 1]))
+				chunksValid = false;
+		}
+
+		BS_TEST_ASSERT(chunksValid);
+
+		// Too little work is never split
+		BS_TEST_ASSERT(TaskScheduler::getNumParallelChunks(MIN_PER_CHUNK, MIN_PER_CHUNK) == 1);
+		BS_TEST_ASSERT(TaskScheduler::getNumParallelChunks(NUM_ELEMENTS, MIN_PER_CHUNK, 1) == 1);
+
+		UINT32 numCalls = 0;
+		BS_TEST_ASSERT(TaskScheduler::parallelFor("TestParallelFor", 0, MIN_PER_CHUNK, 
+			[&](UINT32, UINT32, UINT32) { numCalls++; }) == 0);
+		BS_TEST_ASSERT(numCalls == 0);
+	}
+
+	void EditorBenchmarkSuite::BenchmarkTexAtlasGenerator()
+	{
+		struct GlyphSet
+		{
+			const char* name;
+			UINT32 numGlyphs;
+			UINT32 fontSize;
+			UINT32 pageSize;
+		};
+
+		GlyphSet glyphSets[] =
+		{
+			{ "Latin 12pt", 224, 16, 128 },
+			{ "Latin 36pt", 224, 48, 256 },
+			{ "Latin 72pt", 224, 96, 512 },
+			{ "CJK 16pt", 6000, 22, 1024 }
+		};
+
+		Timer timer;
+		for (auto& glyphSet : glyphSets)
+		{
+			Vector<TexAtlasElementDesc> glyphs = createTestGlyphElements(glyphSet.numGlyphs, glyphSet.fontSize, 7);
+
+			// Page counts rarely differ for small sets, so density is measured on the first page, which every packer
+			// fills as much as it can
+			UINT64 pageArea = glyphSet.pageSize * glyphSet.pageSize;
+			auto getResult = [&](const char* name, const Vector<TexAtlasElementDesc>& elements, UINT32 numPages,
+				UINT64 elapsedUs)
+			{
+				UINT64 firstPageArea = 0;
+				for (auto& element : elements)
+				{
+					if (element.output.page == 0)
+						firstPageArea += element.input.width * element.input.height;
+				}
+
+				return String(" ") + name + ": " + toString(numPages) + " pages, first page " +
+					toString(firstPageArea * 100.0f / pageArea) + "% used, " + toString(elapsedUs / 1000.0f) + " ms;";
+			};
+
+			String report = String(glyphSet.name) + " (" + toString(glyphSet.numGlyphs) + " glyphs, " +
+				toString(glyphSet.pageSize) + "px pages):";
+
+			// Whole set at once, with both packing methods
+			TexAtlasPackMethod methods[] = { TexAtlasPackMethod::BinaryTree, TexAtlasPackMethod::MaxRects };
+			const char* methodNames[] = { "binary tree", "MaxRects" };
+
+			for (UINT32 i = 0; i < 2; i++)
+			{
+				Vector<TexAtlasElementDesc> elements = glyphs;
+				TexAtlasGenerator generator(false, glyphSet.pageSize, glyphSet.pageSize, true, methods[i]);
+
+				UINT64 startTime = timer.getMicroseconds();
+				Vector<TexAtlasPageDesc> pages = generator.createAtlasLayout(elements);
+				UINT64 elapsedUs = timer.getMicroseconds() - startTime;
+
+				BS_TEST_ASSERT(isTexAtlasLayoutValid(elements, pages));
+				report += getResult(methodNames[i], elements, (UINT32)pages.size(), elapsedUs);
+			}
+
+			// One glyph at a time, as a runtime glyph cache would
+			{
+				Vector<TexAtlasElementDesc> elements = glyphs;
+				DynamicTexAtlasLayout layout(glyphSet.pageSize, glyphSet.pageSize);
+
+				UINT64 startTime = timer.getMicroseconds();
+				for (auto& element : elements)
+					layout.insert(element);
+
+				UINT64 elapsedUs = timer.getMicroseconds() - startTime;
+
+				Vector<TexAtlasPageDesc> pages(layout.getNumPages(), layout.getPageDesc());
+				BS_TEST_ASSERT(isTexAtlasLayoutValid(elements, pages));
+				report += getResult("incremental", elements, layout.getNumPages(), elapsedUs);
+			}
+
+			LOGDBG(report);
+		}
+	}
 }
\ No newline at end of file
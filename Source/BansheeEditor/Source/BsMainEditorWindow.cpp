@@ -40,6 +40,11 @@ namespace bs
 		ExceptionTestOutput testOutput;
 		testSuite->run(testOutput);
 
+#if BS_EDITOR_BENCHMARKS
+		SPtr<TestSuite> benchmarkSuite = TestSuite::create<EditorBenchmarkSuite>();
+		benchmarkSuite->run(testOutput);
+#endif
+
 		mRenderWindow->maximize();
 	}
 
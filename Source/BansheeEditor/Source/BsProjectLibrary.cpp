@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsProjectLibrary.h"
 #include "BsFileSystem.h"
+#include "BsDataStream.h"
 #include "BsException.h"
 #include "BsResources.h"
 #include "BsResourceManifest.h"
@@ -16,6 +17,9 @@
 #include "BsResource.h"
 #include "BsEditorApplication.h"
 #include "BsShader.h"
+#include "BsTaskScheduler.h"
+#include "BsCoreThread.h"
+#include "BsUtil.h"
 #include <regex>
 
 using namespace std::placeholders;
@@ -27,6 +31,71 @@ namespace bs
 	const WString ProjectLibrary::LIBRARY_ENTRIES_FILENAME = L"ProjectLibrary.asset";
 	const WString ProjectLibrary::RESOURCE_MANIFEST_FILENAME = L"ResourceManifest.asset";
 
+	/** Minimum number of directories to read from disk per task when scanning the library for modifications. */
+	static const UINT32 MIN_DIRECTORIES_PER_TASK = 4;
+
+	/** Minimum number of files to check per task when scanning the library for modifications. */
+	static const UINT32 MIN_FILES_PER_TASK = 64;
+
+	/** Maximum number of tasks to split library scanning work into. */
+	static const UINT32 MAX_SCAN_TASKS = 16;
+
+	/** 
+	 * Number of files to import in parallel before registering them with the library. Limits how many imported
+	 * resources are kept in memory at once.
+	 */
+	static const UINT32 IMPORT_BATCH_SIZE = 32;
+
+	/** Maximum number of tasks to split file import work into. */
+	static const UINT32 MAX_IMPORT_TASKS = 8;
+
+	/** Contents of a single directory on disk, as read during a library scan. */
+	struct DirectoryContents
+	{
+		Vector<Path> files;
+		Vector<Path> directories;
+		Vector<Path> orphanedMetas;
+	};
+
+	/** File that is about to be imported or reimported during a library scan. */
+	struct PendingImport
+	{
+		Path path;
+		ProjectLibrary::DirectoryEntry* parent;
+		ProjectLibrary::FileEntry* entry; /**< Existing entry for the file, or null if the file is new. */
+	};
+
+	/**
+	 * Reads all the files and directories in the provided folder. Meta files are not returned as files, instead those
+	 * without a corresponding resource file are reported as orphaned. Safe to call from any thread.
+	 */
+	static void readDirectoryContents(const Path& path, DirectoryContents& output)
+	{
+		Vector<Path> childFiles;
+		FileSystem::getChildren(path, childFiles, output.directories);
+
+		UnorderedSet<Path> resourceFiles;
+		for (auto& filePath : childFiles)
+		{
+			if (filePath.getWExtension() != L".meta")
+				resourceFiles.insert(filePath);
+		}
+
+		for (auto& filePath : childFiles)
+		{
+			if (filePath.getWExtension() == L".meta")
+			{
+				Path sourceFilePath = filePath;
+				sourceFilePath.setExtension(L"");
+
+				if (resourceFiles.find(sourceFilePath) == resourceFiles.end())
+					output.orphanedMetas.push_back(filePath);
+			}
+			else
+				output.files.push_back(filePath);
+		}
+	}
+
 	ProjectLibrary::LibraryEntry::LibraryEntry()
 		:type(LibraryEntryType::Directory), parent(nullptr)
 	{ }
@@ -36,11 +105,11 @@ namespace bs
 	{ }
 
 	ProjectLibrary::FileEntry::FileEntry()
-		: lastUpdateTime(0)
+		: lastUpdateTime(0), contentHash(0)
 	{ }
 
 	ProjectLibrary::FileEntry::FileEntry(const Path& path, const WString& name, DirectoryEntry* parent)
-		: LibraryEntry(path, name, parent, LibraryEntryType::File), lastUpdateTime(0)
+		: LibraryEntry(path, name, parent, LibraryEntryType::File), lastUpdateTime(0), contentHash(0)
 	{ }
 
 	ProjectLibrary::DirectoryEntry::DirectoryEntry()
@@ -149,121 +218,224 @@ namespace bs
 			}
 			else
 			{
-				Stack<DirectoryEntry*> todo;
-				todo.push(static_cast<DirectoryEntry*>(entry));
-
-				Vector<Path> childFiles;
-				Vector<Path> childDirectories;
+				// Directory contents are read from disk in parallel, one hierarchy level at a time. The library hierarchy
+				// itself is only ever modified from this thread.
+				Vector<DirectoryEntry*> currentLevel;
+				Vector<DirectoryEntry*> nextLevel;
+				currentLevel.push_back(static_cast<DirectoryEntry*>(entry));
+
+				Vector<DirectoryContents> contents;
+				Vector<FileEntry*> existingFiles;
+				Vector<PendingImport> newFiles;
+				UnorderedMap<Path, UINT32> childLookup;
 				Vector<bool> existingEntries;
 				Vector<LibraryEntry*> toDelete;
 
-				while(!todo.empty())
+				while(!currentLevel.empty())
 				{
-					DirectoryEntry* currentDir = todo.top();
-					todo.pop();
+					UINT32 numDirectories = (UINT32)currentLevel.size();
 
-					existingEntries.clear();
-					existingEntries.resize(currentDir->mChildren.size());
-					for(UINT32 i = 0; i < (UINT32)currentDir->mChildren.size(); i++)
-						existingEntries[i] = false;
+					contents.clear();
+					contents.resize(numDirectories);
 
-					childFiles.clear();
-					childDirectories.clear();
+					auto readDirectories = [&](UINT32, UINT32 start, UINT32 end)
+					{
+						for (UINT32 i = start; i < end; i++)
+							readDirectoryContents(currentLevel[i]->path, contents[i]);
+					};
 
-					FileSystem::getChildren(currentDir->path, childFiles, childDirectories);
-			
-					for(auto& filePath : childFiles)
+					TaskScheduler::parallelFor("ProjectLibraryScan", numDirectories, MIN_DIRECTORIES_PER_TASK, 
+						readDirectories, MAX_SCAN_TASKS);
+
+					for(UINT32 dirIdx = 0; dirIdx < numDirectories; dirIdx++)
 					{
-						if(isMeta(filePath))
+						DirectoryEntry* currentDir = currentLevel[dirIdx];
+						DirectoryContents& dirContents = contents[dirIdx];
+			
+						for(auto& metaPath : dirContents.orphanedMetas)
 						{
-							Path sourceFilePath = filePath;
-							sourceFilePath.setExtension(L"");
+							LOGWRN("Found a .meta file without a corresponding resource. Deleting.");
 
-							if(!FileSystem::isFile(sourceFilePath))
-							{
-								LOGWRN("Found a .meta file without a corresponding resource. Deleting.");
+							FileSystem::remove(metaPath);
+						}
+
+						existingEntries.clear();
+						existingEntries.resize(currentDir->mChildren.size(), false);
 
-								FileSystem::remove(filePath);
+						childLookup.clear();
+						for(UINT32 i = 0; i < (UINT32)currentDir->mChildren.size(); i++)
+							childLookup[currentDir->mChildren[i]->path] = i;
+
+						for(auto& filePath : dirContents.files)
+						{
+							auto iterFind = childLookup.find(filePath);
+							if(iterFind != childLookup.end() && currentDir->mChildren[iterFind->second]->type == LibraryEntryType::File)
+							{
+								existingEntries[iterFind->second] = true;
+								existingFiles.push_back(static_cast<FileEntry*>(currentDir->mChildren[iterFind->second]));
 							}
+							else
+								newFiles.push_back({ filePath, currentDir, nullptr });
+						}
+
+						for(auto& dirPath : dirContents.directories)
+						{
+							auto iterFind = childLookup.find(dirPath);
+							if(iterFind != childLookup.end() && currentDir->mChildren[iterFind->second]->type == LibraryEntryType::Directory)
+								existingEntries[iterFind->second] = true;
+							else
+								addDirectoryInternal(currentDir, dirPath);
 						}
-						else
+
 						{
-							FileEntry* existingEntry = nullptr;
-							UINT32 idx = 0;
-							for(auto& child : currentDir->mChildren)
+							for(UINT32 i = 0; i < (UINT32)existingEntries.size(); i++)
 							{
-								if(child->type == LibraryEntryType::File && child->path == filePath)
-								{
-									existingEntries[idx] = true;
-									existingEntry = static_cast<FileEntry*>(child);
-									break;
-								}
+								if(existingEntries[i])
+									continue;
 
-								idx++;
+								toDelete.push_back(currentDir->mChildren[i]);
 							}
 
-							if(existingEntry != nullptr)
+							for(auto& child : toDelete)
 							{
-								if (import)
-									reimportResourceInternal(existingEntry);
-
-								if (!isUpToDate(existingEntry))
-									dirtyResources.push_back(existingEntry->path);
+								if(child->type == LibraryEntryType::Directory)
+									deleteDirectoryInternal(static_cast<DirectoryEntry*>(child));
+								else if(child->type == LibraryEntryType::File)
+									deleteResourceInternal(static_cast<FileEntry*>(child));
 							}
-							else
-							{
-								if (import)
-									addResourceInternal(currentDir, filePath);
 
-								dirtyResources.push_back(filePath);
-							}
+							toDelete.clear();
 						}
-					}
 
-					for(auto& dirPath : childDirectories)
-					{
-						DirectoryEntry* existingEntry = nullptr;
-						UINT32 idx = 0;
 						for(auto& child : currentDir->mChildren)
 						{
-							if(child->type == LibraryEntryType::Directory && child->path == dirPath)
-							{
-								existingEntries[idx] = true;
-								existingEntry = static_cast<DirectoryEntry*>(child);
-								break;
-							}
-
-							idx++;
+							if(child->type == LibraryEntryType::Directory)
+								nextLevel.push_back(static_cast<DirectoryEntry*>(child));
 						}
+					}
+
+					std::swap(currentLevel, nextLevel);
+					nextLevel.clear();
+				}
+
+				Vector<FileEntry*> outOfDateFiles;
+				findOutOfDateFiles(existingFiles, outOfDateFiles);
+
+				Vector<PendingImport> pendingImports;
+				pendingImports.reserve(outOfDateFiles.size() + newFiles.size());
+
+				for(auto& file : outOfDateFiles)
+					pendingImports.push_back({ file->path, file->parent, file });
+
+				pendingImports.insert(pendingImports.end(), newFiles.begin(), newFiles.end());
 
-						if(existingEntry == nullptr)
-							addDirectoryInternal(currentDir, dirPath);
+				// Import files other files depend on first (e.g. shader includes), so their dependants get reimported
+				// only once, as a consequence of the dependency reimport
+				auto firstIndependent = std::stable_partition(pendingImports.begin(), pendingImports.end(),
+					[&](const PendingImport& pending)
+				{
+					auto iterFind = mDependencies.find(pending.path);
+					return iterFind != mDependencies.end() && !iterFind->second.empty();
+				});
+
+				// Importing a dependency reimports its dependants, so those are imported one by one
+				UINT32 numImports = (UINT32)pendingImports.size();
+				UINT32 numDependencies = (UINT32)(firstIndependent - pendingImports.begin());
+				for(UINT32 i = 0; i < numDependencies; i++)
+				{
+					PendingImport& pending = pendingImports[i];
+					if(pending.entry != nullptr)
+					{
+						if (import)
+							reimportResourceInternal(pending.entry);
+
+						if (!isUpToDate(pending.entry))
+							dirtyResources.push_back(pending.path);
 					}
+					else
+					{
+						if (import)
+							addResourceInternal(pending.parent, pending.path);
+
+						dirtyResources.push_back(pending.path);
+					}
+				}
 
+				if(!import)
+				{
+					for(UINT32 i = numDependencies; i < numImports; i++)
+						dirtyResources.push_back(pendingImports[i].path);
+				}
+				else
+				{
+					// The rest of the files don't depend on each other, so they are read and imported in parallel and
+					// only registered with the library serially
+					for(UINT32 batchStart = numDependencies; batchStart < numImports; batchStart += IMPORT_BATCH_SIZE)
 					{
-						for(UINT32 i = 0; i < (UINT32)existingEntries.size(); i++)
+						UINT32 batchSize = std::min(IMPORT_BATCH_SIZE, numImports - batchStart);
+
+						Vector<FileEntry*> entries(batchSize, nullptr);
+						Vector<SPtr<ImportOptions>> importOptions(batchSize);
+						Vector<Vector<SubResourceRaw>> importedResources(batchSize);
+						Vector<UINT8> needsImport(batchSize, 0);
+						Vector<UINT8> importConcurrently(batchSize, 0); // Not Vector<bool>, as it is read concurrently
+
+						for(UINT32 i = 0; i < batchSize; i++)
 						{
-							if(existingEntries[i])
+							PendingImport& pending = pendingImports[batchStart + i];
+
+							FileEntry* entry = pending.entry;
+							if(entry == nullptr)
+							{
+								entry = bs_new<FileEntry>(pending.path, pending.path.getWTail(), pending.parent);
+								pending.parent->mChildren.push_back(entry);
+							}
+
+							entries[i] = entry;
+							if(!prepareImport(entry, nullptr, false, importOptions[i]))
 								continue;
 
-							toDelete.push_back(currentDir->mChildren[i]);
+							needsImport[i] = 1;
+							importConcurrently[i] = !isNative(entry->path) && 
+								gImporter()._supportsConcurrentImport(entry->path);
 						}
 
-						for(auto& child : toDelete)
+						auto importFiles = [&](UINT32, UINT32 start, UINT32 end)
 						{
-							if(child->type == LibraryEntryType::Directory)
-								deleteDirectoryInternal(static_cast<DirectoryEntry*>(child));
-							else if(child->type == LibraryEntryType::File)
-								deleteResourceInternal(static_cast<FileEntry*>(child));
-						}
+							for (UINT32 i = start; i < end; i++)
+							{
+								if (importConcurrently[i])
+									importedResources[i] = gImporter()._importAllRaw(entries[i]->path, importOptions[i]);
+							}
 
-						toDelete.clear();
-					}
+							// Imported resources queue their initialization on this thread's core thread queue
+							gCoreThread().submit();
+						};
 
-					for(auto& child : currentDir->mChildren)
-					{
-						if(child->type == LibraryEntryType::Directory)
-							todo.push(static_cast<DirectoryEntry*>(child));
+						TaskScheduler::parallelFor("ProjectLibraryImport", batchSize, 1, importFiles, MAX_IMPORT_TASKS);
+
+						for(UINT32 i = 0; i < batchSize; i++)
+						{
+							PendingImport& pending = pendingImports[batchStart + i];
+							FileEntry* entry = entries[i];
+
+							if(needsImport[i])
+							{
+								if (!importConcurrently[i] && !isNative(entry->path))
+									importedResources[i] = gImporter()._importAllRaw(entry->path, importOptions[i]);
+
+								finishImport(entry, importOptions[i], importedResources[i], false);
+								importedResources[i].clear();
+							}
+
+							if(pending.entry == nullptr)
+							{
+								onEntryAdded(entry->path);
+								dirtyResources.push_back(pending.path);
+							}
+							else if (!isUpToDate(entry))
+								dirtyResources.push_back(pending.path);
+						}
 					}
 				}
 			}
@@ -361,6 +533,20 @@ namespace bs
 
 	void ProjectLibrary::reimportResourceInternal(FileEntry* fileEntry, const SPtr<ImportOptions>& importOptions,
 		bool forceReimport, bool pruneResourceMetas)
+	{
+		SPtr<ImportOptions> curImportOptions;
+		if (!prepareImport(fileEntry, importOptions, forceReimport, curImportOptions))
+			return;
+
+		Vector<SubResourceRaw> importedResourcesRaw;
+		if (!isNative(fileEntry->path))
+			importedResourcesRaw = gImporter()._importAllRaw(fileEntry->path, curImportOptions);
+
+		finishImport(fileEntry, curImportOptions, importedResourcesRaw, pruneResourceMetas);
+	}
+
+	bool ProjectLibrary::prepareImport(FileEntry* fileEntry, const SPtr<ImportOptions>& importOptions, 
+		bool forceReimport, SPtr<ImportOptions>& outImportOptions)
 	{
 		Path metaPath = fileEntry->path;
 		metaPath.setFilename(metaPath.getWFilename() + L".meta");
@@ -393,171 +579,182 @@ namespace bs
 			}
 		}
 
-		if (!isUpToDate(fileEntry) || forceReimport)
+		if (isUpToDate(fileEntry) && !forceReimport)
+			return false;
+
+		if (importOptions == nullptr && !isNative(fileEntry->path))
 		{
-			// Note: If resource is native we just copy it to the internal folder. We could avoid the copy and 
-			// load the resource directly from the Resources folder but that requires complicating library code.
-			bool isNativeResource = isNative(fileEntry->path);
+			if (fileEntry->meta != nullptr)
+				outImportOptions = fileEntry->meta->getImportOptions();
+			else
+				outImportOptions = Importer::instance().createImportOptions(fileEntry->path);
+		}
+		else
+			outImportOptions = importOptions;
+
+		return true;
+	}
 
-			SPtr<ImportOptions> curImportOptions = nullptr;
-			if (importOptions == nullptr && !isNativeResource)
+	void ProjectLibrary::finishImport(FileEntry* fileEntry, const SPtr<ImportOptions>& curImportOptions,
+		const Vector<SubResourceRaw>& importedResourcesRaw, bool pruneResourceMetas)
+	{
+		Path metaPath = fileEntry->path;
+		metaPath.setFilename(metaPath.getWFilename() + L".meta");
+
+		// Note: If resource is native we just copy it to the internal folder. We could avoid the copy and 
+		// load the resource directly from the Resources folder but that requires complicating library code.
+		bool isNativeResource = isNative(fileEntry->path);
+
+		Vector<SubResource> importedResources;
+		if (isNativeResource)
+		{
+			// If meta exists make sure it is registered in the manifest before load, otherwise it will get assigned a new UUID.
+			// This can happen if library isn't properly saved before exiting the application.
+			if (fileEntry->meta != nullptr)
 			{
-				if (fileEntry->meta != nullptr)
-					curImportOptions = fileEntry->meta->getImportOptions();
-				else
-					curImportOptions = Importer::instance().createImportOptions(fileEntry->path);
+				auto& resourceMetas = fileEntry->meta->getResourceMetaData();
+				mResourceManifest->registerResource(resourceMetas[0]->getUUID(), fileEntry->path);
 			}
-			else
-				curImportOptions = importOptions;
 
-			Vector<SubResource> importedResources;
-			if (isNativeResource)
-			{
-				// If meta exists make sure it is registered in the manifest before load, otherwise it will get assigned a new UUID.
-				// This can happen if library isn't properly saved before exiting the application.
-				if (fileEntry->meta != nullptr)
-				{
-					auto& resourceMetas = fileEntry->meta->getResourceMetaData();
-					mResourceManifest->registerResource(resourceMetas[0]->getUUID(), fileEntry->path);
-				}
+			// Don't load dependencies because we don't need them, but also because they might not be in the manifest
+			// which would screw up their UUIDs.
+			importedResources.push_back({ L"primary", gResources().load(fileEntry->path, ResourceLoadFlag::KeepSourceData) });
+		}
 
-				// Don't load dependencies because we don't need them, but also because they might not be in the manifest
-				// which would screw up their UUIDs.
-				importedResources.push_back({ L"primary", gResources().load(fileEntry->path, ResourceLoadFlag::KeepSourceData) });
+		if(fileEntry->meta == nullptr)
+		{
+			if (!isNativeResource)
+			{
+				for (auto& entry : importedResourcesRaw)
+					importedResources.push_back({ entry.name, gResources()._createResourceHandle(entry.value) });
 			}
 
-			if(fileEntry->meta == nullptr)
-			{
-				if (!isNativeResource)
-					importedResources = Importer::instance().importAll(fileEntry->path, curImportOptions);
+			fileEntry->meta = ProjectFileMeta::create(curImportOptions);
 
-				fileEntry->meta = ProjectFileMeta::create(curImportOptions);
+			for(auto& entry : importedResources)
+			{
+				SPtr<ResourceMetaData> subMeta = entry.value->getMetaData();
+				UINT32 typeId = entry.value->getTypeId();
+				const String& UUID = entry.value.getUUID();
 
-				for(auto& entry : importedResources)
-				{
-					SPtr<ResourceMetaData> subMeta = entry.value->getMetaData();
-					UINT32 typeId = entry.value->getTypeId();
-					const String& UUID = entry.value.getUUID();
+				SPtr<ProjectResourceMeta> resMeta = ProjectResourceMeta::create(entry.name, UUID, typeId, subMeta);
+				fileEntry->meta->add(resMeta);
+			}
 
-					SPtr<ProjectResourceMeta> resMeta = ProjectResourceMeta::create(entry.name, UUID, typeId, subMeta);
-					fileEntry->meta->add(resMeta);
-				}
+			if(importedResources.size() > 0)
+			{
+				HResource primary = importedResources[0].value;
 
-				if(importedResources.size() > 0)
+				mUUIDToPath[primary.getUUID()] = fileEntry->path;
+				for (UINT32 i = 1; i < (UINT32)importedResources.size(); i++)
 				{
-					HResource primary = importedResources[0].value;
+					SubResource& entry = importedResources[i];
 
-					mUUIDToPath[primary.getUUID()] = fileEntry->path;
-					for (UINT32 i = 1; i < (UINT32)importedResources.size(); i++)
-					{
-						SubResource& entry = importedResources[i];
-
-						const String& UUID = entry.value.getUUID();
-						mUUIDToPath[UUID] = fileEntry->path + entry.name;
-					}
+					const String& UUID = entry.value.getUUID();
+					mUUIDToPath[UUID] = fileEntry->path + entry.name;
 				}
-
-				FileEncoder fs(metaPath);
-				fs.encode(fileEntry->meta.get());
 			}
-			else
+
+			FileEncoder fs(metaPath);
+			fs.encode(fileEntry->meta.get());
+		}
+		else
+		{
+			removeDependencies(fileEntry);
+
+			if (!isNativeResource)
 			{
-				removeDependencies(fileEntry);
+				Vector<SPtr<ProjectResourceMeta>> existingResourceMetas = fileEntry->meta->getAllResourceMetaData();
+				fileEntry->meta->clearResourceMetaData();
 
-				if (!isNativeResource)
+				for(auto& resEntry : importedResourcesRaw)
 				{
-					Vector<SubResourceRaw> importedResourcesRaw = gImporter()._importAllRaw(fileEntry->path, curImportOptions);
-					Vector<SPtr<ProjectResourceMeta>> existingResourceMetas = fileEntry->meta->getAllResourceMetaData();
-					fileEntry->meta->clearResourceMetaData();
-
-					for(auto& resEntry : importedResourcesRaw)
+					bool foundMeta = false;
+					for (auto iter = existingResourceMetas.begin(); iter != existingResourceMetas.end(); ++iter)
 					{
-						bool foundMeta = false;
-						for (auto iter = existingResourceMetas.begin(); iter != existingResourceMetas.end(); ++iter)
-						{
-							SPtr<ProjectResourceMeta> metaEntry = *iter;
-
-							if(resEntry.name == metaEntry->getUniqueName())
-							{
-								HResource importedResource = gResources()._getResourceHandle(metaEntry->getUUID());
-								gResources().update(importedResource, resEntry.value);
-
-								importedResources.push_back({ resEntry.name, importedResource });
-								fileEntry->meta->add(metaEntry);
-
-								existingResourceMetas.erase(iter);
-								foundMeta = true;
-								break;
-							}
-						}
+						SPtr<ProjectResourceMeta> metaEntry = *iter;
 
-						if(!foundMeta)
+						if(resEntry.name == metaEntry->getUniqueName())
 						{
-							HResource importedResource = gResources()._createResourceHandle(resEntry.value);
-							importedResources.push_back({ resEntry.name, importedResource });
+							HResource importedResource = gResources()._getResourceHandle(metaEntry->getUUID());
+							gResources().update(importedResource, resEntry.value);
 
-							SPtr<ResourceMetaData> subMeta = resEntry.value->getMetaData();
-							UINT32 typeId = resEntry.value->getTypeId();
-							const String& UUID = importedResource.getUUID();
+							importedResources.push_back({ resEntry.name, importedResource });
+							fileEntry->meta->add(metaEntry);
 
-							SPtr<ProjectResourceMeta> resMeta = ProjectResourceMeta::create(resEntry.name, UUID, typeId, subMeta);
-							fileEntry->meta->add(resMeta);
+							existingResourceMetas.erase(iter);
+							foundMeta = true;
+							break;
 						}
 					}
 
-					// Keep resource metas that we are not currently using, in case they get restored so their references
-					// don't get broken
-					if(!pruneResourceMetas)
+					if(!foundMeta)
 					{
-						for (auto& entry : existingResourceMetas)
-							fileEntry->meta->addInactive(entry);
-					}
+						HResource importedResource = gResources()._createResourceHandle(resEntry.value);
+						importedResources.push_back({ resEntry.name, importedResource });
 
-					// Update UUID to path mapping
-					auto& resourceMetas = fileEntry->meta->getResourceMetaData();
-					if (resourceMetas.size() > 0)
-					{
-						mUUIDToPath[resourceMetas[0]->getUUID()] = fileEntry->path;
+						SPtr<ResourceMetaData> subMeta = resEntry.value->getMetaData();
+						UINT32 typeId = resEntry.value->getTypeId();
+						const String& UUID = importedResource.getUUID();
 
-						for (UINT32 i = 1; i < (UINT32)resourceMetas.size(); i++)
-						{
-							SPtr<ProjectResourceMeta> entry = resourceMetas[i];
-							mUUIDToPath[entry->getUUID()] = fileEntry->path + entry->getUniqueName();
-						}
+						SPtr<ProjectResourceMeta> resMeta = ProjectResourceMeta::create(resEntry.name, UUID, typeId, subMeta);
+						fileEntry->meta->add(resMeta);
 					}
 				}
 
-				fileEntry->meta->mImportOptions = curImportOptions;
+				// Keep resource metas that we are not currently using, in case they get restored so their references
+				// don't get broken
+				if(!pruneResourceMetas)
+				{
+					for (auto& entry : existingResourceMetas)
+						fileEntry->meta->addInactive(entry);
+				}
+
+				// Update UUID to path mapping
+				auto& resourceMetas = fileEntry->meta->getResourceMetaData();
+				if (resourceMetas.size() > 0)
+				{
+					mUUIDToPath[resourceMetas[0]->getUUID()] = fileEntry->path;
 
-				FileEncoder fs(metaPath);
-				fs.encode(fileEntry->meta.get());
+					for (UINT32 i = 1; i < (UINT32)resourceMetas.size(); i++)
+					{
+						SPtr<ProjectResourceMeta> entry = resourceMetas[i];
+						mUUIDToPath[entry->getUUID()] = fileEntry->path + entry->getUniqueName();
+					}
+				}
 			}
 
-			addDependencies(fileEntry);
+			fileEntry->meta->mImportOptions = curImportOptions;
 
-			if (importedResources.size() > 0)
-			{
-				Path internalResourcesPath = mProjectFolder;
-				internalResourcesPath.append(INTERNAL_RESOURCES_DIR);
+			FileEncoder fs(metaPath);
+			fs.encode(fileEntry->meta.get());
+		}
 
-				if (!FileSystem::isDirectory(internalResourcesPath))
-					FileSystem::createDir(internalResourcesPath);
+		addDependencies(fileEntry);
 
-				for (auto& entry : importedResources)
-				{
-					internalResourcesPath.setFilename(toWString(entry.value.getUUID()) + L".asset");
-					gResources().save(entry.value, internalResourcesPath, true);
+		if (importedResources.size() > 0)
+		{
+			Path internalResourcesPath = mProjectFolder;
+			internalResourcesPath.append(INTERNAL_RESOURCES_DIR);
 
-					String uuid = entry.value.getUUID();
-					mResourceManifest->registerResource(uuid, internalResourcesPath);
-				}
-			}
+			if (!FileSystem::isDirectory(internalResourcesPath))
+				FileSystem::createDir(internalResourcesPath);
 
-			fileEntry->lastUpdateTime = std::time(nullptr);
+			for (auto& entry : importedResources)
+			{
+				internalResourcesPath.setFilename(toWString(entry.value.getUUID()) + L".asset");
+				gResources().save(entry.value, internalResourcesPath, true);
 
-			onEntryImported(fileEntry->path);
-			reimportDependants(fileEntry->path);
+				String uuid = entry.value.getUUID();
+				mResourceManifest->registerResource(uuid, internalResourcesPath);
+			}
 		}
+
+		fileEntry->lastUpdateTime = std::time(nullptr);
+		fileEntry->contentHash = calculateContentHash(fileEntry->path);
+
+		onEntryImported(fileEntry->path);
+		reimportDependants(fileEntry->path);
 	}
 
 	bool ProjectLibrary::isUpToDate(FileEntry* resource) const
@@ -580,6 +777,50 @@ namespace bs
 		return lastModifiedTime <= resource->lastUpdateTime;
 	}
 
+	void ProjectLibrary::findOutOfDateFiles(const Vector<FileEntry*>& files, Vector<FileEntry*>& outOfDate)
+	{
+		// Each task only touches its own entries, and the manifest is only read
+		UINT32 numFiles = (UINT32)files.size();
+		Vector<UINT8> isOutOfDate(numFiles, 0); // Not Vector<bool> as its elements cannot be written to concurrently
+
+		auto checkFiles = [&](UINT32, UINT32 start, UINT32 end)
+		{
+			for (UINT32 i = start; i < end; i++)
+			{
+				FileEntry* file = files[i];
+
+				// If the file was touched but its contents are the same as on last import, there is no need to reimport
+				std::time_t lastModifiedTime = FileSystem::getLastModifiedTime(file->path);
+				if (lastModifiedTime > file->lastUpdateTime && file->contentHash != 0)
+				{
+					if (calculateContentHash(file->path) == file->contentHash)
+						file->lastUpdateTime = lastModifiedTime;
+				}
+
+				isOutOfDate[i] = isUpToDate(file) ? 0 : 1;
+			}
+		};
+
+		TaskScheduler::parallelFor("ProjectLibraryScan", numFiles, MIN_FILES_PER_TASK, checkFiles, MAX_SCAN_TASKS);
+
+		for (UINT32 i = 0; i < numFiles; i++)
+		{
+			if (isOutOfDate[i])
+				outOfDate.push_back(files[i]);
+		}
+	}
+
+	UINT64 ProjectLibrary::calculateContentHash(const Path& path)
+	{
+		SPtr<DataStream> stream = FileSystem::openFile(path, true);
+		if (stream == nullptr)
+			return 0;
+
+		// Reserve 0 for "unknown"
+		UINT64 hash = xxHash64(stream);
+		return hash != 0 ? hash : 1;
+	}
+
 	Vector<ProjectLibrary::LibraryEntry*> ProjectLibrary::search(const WString& pattern)
 	{
 		return search(pattern, {});
@@ -72,6 +72,60 @@ namespace bs
 
 	Vector<HSceneObject> ScenePicking::pickObjects(const SPtr<Camera>& cam, const Vector2I& position, const Vector2I& area, 
 		Vector<HSceneObject>& ignoreRenderables, SnapData* data)
+	{
+		Map<UINT32, HSceneObject> idxToRenderable;
+		UINT32 firstGizmoIdx = queuePicking(cam, position, area, ignoreRenderables, idxToRenderable);
+
+		SPtr<RenderTargetCore> target = cam->getViewport()->getTarget()->getCore();
+		AsyncOp op = gCoreThread().queueReturnCommand(std::bind(&ScenePickingCore::corePickingEnd, mCore, target,
+			cam->getViewport()->getNormArea(), position, area, data != nullptr, _1));
+		gCoreThread().submit(true);
+
+		assert(op.hasCompleted());
+
+		PickResults pickResults = op.getReturnValue<PickResults>();
+		if (data != nullptr)
+		{
+			data->pickPosition = cam->screenToWorldPointDeviceDepth(position, pickResults.depth);
+			data->normal = pickResults.normal;
+		}
+
+		return resolvePickedObjects(pickResults.objects, firstGizmoIdx, idxToRenderable,
+			GizmoManager::instance().getSceneObjects());
+	}
+
+	void ScenePicking::pickObjectsAsync(const SPtr<Camera>& cam, const Vector2I& position, const Vector2I& area,
+		Vector<HSceneObject>& ignoreRenderables, const PickCallback& callback)
+	{
+		SPtr<RenderTarget> target = cam->getViewport()->getTarget();
+		const RenderTargetProperties& rtProps = target->getProperties();
+
+		if (position.x < 0 || position.x >= (INT32)rtProps.getWidth() ||
+			position.y < 0 || position.y >= (INT32)rtProps.getHeight())
+		{
+			callback(Vector<HSceneObject>());
+			return;
+		}
+
+		Map<UINT32, HSceneObject> idxToRenderable;
+		UINT32 firstGizmoIdx = queuePicking(cam, position, area, ignoreRenderables, idxToRenderable);
+
+		// Gizmos are redrawn every frame, so remember the objects they belong to at the time of picking
+		Map<UINT32, HSceneObject> idxToGizmo = GizmoManager::instance().getSceneObjects();
+		bool flipY = rtProps.requiresTextureFlipping();
+
+		auto onReadback = [=](const SPtr<PixelData>& pixels)
+		{
+			Vector<UINT32> objects = decodePickedObjects(*pixels, position, area, flipY);
+			callback(resolvePickedObjects(objects, firstGizmoIdx, idxToRenderable, idxToGizmo));
+		};
+
+		gCoreThread().queueCommand(std::bind(&ScenePickingCore::corePickingEndAsync, mCore, target->getCore(),
+			TextureReadbackCallback(onReadback)));
+	}
+
+	UINT32 ScenePicking::queuePicking(const SPtr<Camera>& cam, const Vector2I& position, const Vector2I& area,
+		Vector<HSceneObject>& ignoreRenderables, Map<UINT32, HSceneObject>& idxToRenderable)
 	{
 		auto comparePickElement = [&] (const ScenePicking::RenderablePickData& a, const ScenePicking::RenderablePickData& b)
 		{
@@ -91,7 +145,6 @@ namespace bs
 
 		const Map<Renderable*, SceneRenderableData>& renderables = SceneManager::instance().getAllRenderables();
 		RenderableSet pickData(comparePickElement);
-		Map<UINT32, HSceneObject> idxToRenderable;
 
 		for (auto& renderableData : renderables)
 		{
@@ -178,48 +231,114 @@ namespace bs
 
 		SPtr<RenderTargetCore> target = cam->getViewport()->getTarget()->getCore();
 		gCoreThread().queueCommand(std::bind(&ScenePickingCore::corePickingBegin, mCore, target,
-			cam->getViewport()->getNormArea(), std::cref(pickData), position, area));
+			cam->getViewport()->getNormArea(), pickData, position, area));
 
 		GizmoManager::instance().renderForPicking(cam, [&](UINT32 inputIdx) { return encodeIndex(firstGizmoIdx + inputIdx); });
 
-		AsyncOp op = gCoreThread().queueReturnCommand(std::bind(&ScenePickingCore::corePickingEnd, mCore, target,
-			cam->getViewport()->getNormArea(), position, area, data != nullptr, _1));
-		gCoreThread().submit(true);
-
-		assert(op.hasCompleted());
-
-		PickResults pickResults = op.getReturnValue<PickResults>();
-		if (data != nullptr)
-		{
-			data->pickPosition = cam->screenToWorldPointDeviceDepth(position, pickResults.depth);
-			data->normal = pickResults.normal;
-		}
+		return firstGizmoIdx;
+	}
 
-		Vector<UINT32> selectedObjects = pickResults.objects;
+	Vector<HSceneObject> ScenePicking::resolvePickedObjects(const Vector<UINT32>& objects, UINT32 firstGizmoIdx,
+		const Map<UINT32, HSceneObject>& idxToRenderable, const Map<UINT32, HSceneObject>& idxToGizmo)
+	{
 		Vector<HSceneObject> results;
-
-		for (auto& selectedObjectIdx : selectedObjects)
+		for (auto& selectedObjectIdx : objects)
 		{
+			HSceneObject so;
 			if (selectedObjectIdx < firstGizmoIdx)
 			{
 				auto iterFind = idxToRenderable.find(selectedObjectIdx);
-
 				if (iterFind != idxToRenderable.end())
-					results.push_back(iterFind->second);
+					so = iterFind->second;
 			}
 			else
 			{
-				UINT32 gizmoIdx = selectedObjectIdx - firstGizmoIdx;
-
-				HSceneObject so = GizmoManager::instance().getSceneObject(gizmoIdx);
-				if (so)
-					results.push_back(so);
+				auto iterFind = idxToGizmo.find(selectedObjectIdx - firstGizmoIdx);
+				if (iterFind != idxToGizmo.end())
+					so = iterFind->second;
 			}
+
+			// Objects can get destroyed while an asynchronous pick is in progress
+			if (so && !so.isDestroyed())
+				results.push_back(so);
 		}
 
 		return results;
 	}
 
+	Vector<UINT32> ScenePicking::decodePickedObjects(const PixelData& pixels, const Vector2I& position,
+		const Vector2I& area, bool flipY)
+	{
+		Map<UINT32, UINT32> selectionScores;
+		UINT32 maxWidth = std::min((UINT32)(position.x + area.x), pixels.getWidth());
+		UINT32 maxHeight = std::min((UINT32)(position.y + area.y), pixels.getHeight());
+
+		if (flipY)
+		{
+			UINT32 vertOffset = pixels.getHeight();
+
+			for (UINT32 y = maxHeight; y > (UINT32)position.y; y--)
+			{
+				for (UINT32 x = (UINT32)position.x; x < maxWidth; x++)
+				{
+					Color color = pixels.getColorAt(x, vertOffset - y);
+					UINT32 index = decodeIndex(color);
+
+					if (index == 0x00FFFFFF) // Nothing selected
+						continue;
+
+					auto iterFind = selectionScores.find(index);
+					if (iterFind == selectionScores.end())
+						selectionScores[index] = 1;
+					else
+						iterFind->second++;
+				}
+			}
+		}
+		else
+		{
+			for (UINT32 y = (UINT32)position.y; y < maxHeight; y++)
+			{
+				for (UINT32 x = (UINT32)position.x; x < maxWidth; x++)
+				{
+					Color color = pixels.getColorAt(x, y);
+					UINT32 index = decodeIndex(color);
+
+					if (index == 0x00FFFFFF) // Nothing selected
+						continue;
+
+					auto iterFind = selectionScores.find(index);
+					if (iterFind == selectionScores.end())
+						selectionScores[index] = 1;
+					else
+						iterFind->second++;
+				}
+			}
+		}
+
+		// Sort by score
+		struct SelectedObject { UINT32 index; UINT32 score; };
+
+		Vector<SelectedObject> selectedObjects(selectionScores.size());
+		UINT32 idx = 0;
+		for (auto& selectionScore : selectionScores)
+		{
+			selectedObjects[idx++] = { selectionScore.first, selectionScore.second };
+		}
+
+		std::sort(selectedObjects.begin(), selectedObjects.end(),
+			[&](const SelectedObject& a, const SelectedObject& b)
+		{
+			return b.score < a.score;
+		});
+
+		Vector<UINT32> objects;
+		for (auto& selectedObject : selectedObjects)
+			objects.push_back(selectedObject.index);
+
+		return objects;
+	}
+
 	Color ScenePicking::encodeIndex(UINT32 index)
 	{
 		Color encoded;
@@ -412,72 +531,8 @@ namespace bs
 
 		outputTexture->readData(*outputPixelData);
 
-		Map<UINT32, UINT32> selectionScores;
-		UINT32 maxWidth = std::min((UINT32)(position.x + area.x), outputPixelData->getWidth());
-		UINT32 maxHeight = std::min((UINT32)(position.y + area.y), outputPixelData->getHeight());
-
-		if (rtProps.requiresTextureFlipping())
-		{
-			UINT32 vertOffset = outputPixelData->getHeight();
-
-			for (UINT32 y = maxHeight; y > (UINT32)position.y; y--)
-			{
-				for (UINT32 x = (UINT32)position.x; x < maxWidth; x++)
-				{
-					Color color = outputPixelData->getColorAt(x, vertOffset - y);
-					UINT32 index = ScenePicking::decodeIndex(color);
-
-					if (index == 0x00FFFFFF) // Nothing selected
-						continue;
-
-					auto iterFind = selectionScores.find(index);
-					if (iterFind == selectionScores.end())
-						selectionScores[index] = 1;
-					else
-						iterFind->second++;
-				}
-			}
-		}
-		else
-		{
-			for (UINT32 y = (UINT32)position.y; y < maxHeight; y++)
-			{
-				for (UINT32 x = (UINT32)position.x; x < maxWidth; x++)
-				{
-					Color color = outputPixelData->getColorAt(x, y);
-					UINT32 index = ScenePicking::decodeIndex(color);
-
-					if (index == 0x00FFFFFF) // Nothing selected
-						continue;
-
-					auto iterFind = selectionScores.find(index);
-					if (iterFind == selectionScores.end())
-						selectionScores[index] = 1;
-					else
-						iterFind->second++;
-				}
-			}
-		}
-
-		// Sort by score
-		struct SelectedObject { UINT32 index; UINT32 score; };
-
-		Vector<SelectedObject> selectedObjects(selectionScores.size());
-		UINT32 idx = 0;
-		for (auto& selectionScore : selectionScores)
-		{
-			selectedObjects[idx++] = { selectionScore.first, selectionScore.second };
-		}
-
-		std::sort(selectedObjects.begin(), selectedObjects.end(),
-			[&](const SelectedObject& a, const SelectedObject& b)
-		{
-			return b.score < a.score;
-		});
-
-		Vector<UINT32> objects;
-		for (auto& selectedObject : selectedObjects)
-			objects.push_back(selectedObject.index);
+		Vector<UINT32> objects = ScenePicking::decodePickedObjects(*outputPixelData, position, area,
+			rtProps.requiresTextureFlipping());
 		
 		PickResults result;
 		if (gatherSnapData)
@@ -506,4 +561,20 @@ namespace bs
 		result.objects = objects;
 		asyncOp._completeOperation(result);
 	}
+
+	void ScenePickingCore::corePickingEndAsync(const SPtr<RenderTargetCore>& target, const TextureReadbackCallback& callback)
+	{
+		RenderAPICore& rs = RenderAPICore::instance();
+		rs.setRenderTarget(nullptr);
+
+		if (target->getProperties().isWindow())
+		{
+			BS_EXCEPT(NotImplementedException, "Picking is not supported on render windows as framebuffer readback methods aren't implemented");
+		}
+
+		SPtr<TextureCore> outputTexture = mPickingTexture->getColorTexture(0);
+		GpuReadbackManager::instance().readTextureCore(outputTexture, callback);
+
+		mPickingTexture = nullptr;
+	}
 }
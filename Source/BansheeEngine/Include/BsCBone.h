@@ -77,7 +77,7 @@ namespace bs
 		RTTITypeBase* getRTTI() const override;
 
 	protected:
-		CBone() {} // Serialization only
+		CBone() { mUpdateFlags = CUF_NoUpdate; } // Serialization only
      };
 
 	 /** @} */
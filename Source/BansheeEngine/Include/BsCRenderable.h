@@ -36,6 +36,12 @@ namespace bs
 		/** @copydoc Renderable::getLayer */
 		UINT64 getLayer() const { return mInternal->getLayer(); }
 
+		/** @copydoc Renderable::setIsOccluder */
+		void setIsOccluder(bool occluder) { mInternal->setIsOccluder(occluder); }
+
+		/** @copydoc Renderable::getIsOccluder */
+		bool getIsOccluder() const { return mInternal->getIsOccluder(); }
+
 		/** @copydoc Renderable::getMesh */
 		HMesh getMesh() const { return mInternal->getMesh(); }
 
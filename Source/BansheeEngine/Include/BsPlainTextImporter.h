@@ -27,6 +27,9 @@ namespace bs
 		/** @copydoc SpecificImporter::import */
 		virtual SPtr<Resource> import(const Path& filePath, SPtr<const ImportOptions> importOptions) override;
 
+		/** @copydoc SpecificImporter::isThreadSafe */
+		virtual bool isThreadSafe() const override { return true; }
+
 		static const WString DEFAULT_EXTENSION;
 	};
 
@@ -113,10 +113,10 @@
 
 namespace bs
 {
-	static const StringID RenderAPIDX9 = "D3D9RenderAPI";
-	static const StringID RenderAPIDX11 = "D3D11RenderAPI";
-	static const StringID RenderAPIOpenGL = "GLRenderAPI";
-	static const StringID RendererDefault = "RenderBeast";
+	static const StringID RenderAPIDX9 = "D3D9RenderAPI"_sid;
+	static const StringID RenderAPIDX11 = "D3D11RenderAPI"_sid;
+	static const StringID RenderAPIOpenGL = "GLRenderAPI"_sid;
+	static const StringID RendererDefault = "RenderBeast"_sid;
 
 	class VirtualButton;
 	class VirtualInput;
@@ -107,6 +107,16 @@ namespace bs
 		 */
 		void setUseOverrideBounds(bool enable);
 
+		/**
+		 * Determines if the renderable should hide other objects behind it during occlusion culling. Good occluders are
+		 * large objects with simple geometry, such as walls and terrain features. The mesh must be created with
+		 * MU_CPUCACHED usage for this to have an effect. Disabled by default.
+		 */
+		void setIsOccluder(bool occluder);
+
+		/** @copydoc setIsOccluder */
+		bool getIsOccluder() const { return mIsOccluder; }
+
 		/**
 		 * Gets the layer bitfield that controls whether a renderable is considered visible in a specific camera. 
 		 * Renderable layer must match camera layer in order for the camera to render the component.
@@ -163,6 +173,7 @@ namespace bs
 		Matrix4 mTransform;
 		Matrix4 mTransformNoScale;
 		bool mIsActive;
+		bool mIsOccluder;
 		RenderableAnimType mAnimType;
 	};
 
@@ -208,6 +219,12 @@ namespace bs
 		/** Returns vertex declaration used for rendering meshes containing morph shape information. */
 		const SPtr<VertexDeclarationCore>& getMorphVertexDeclaration() const { return mMorphVertexDeclaration; }
 
+		/**
+		 * Returns geometry to rasterize when using the object as an occluder. Null if the object is not an occluder or its
+		 * mesh isn't accessible from the CPU.
+		 */
+		const SPtr<OccluderGeometry>& getOccluderGeometry() const { return mOccluderGeometry; }
+
 	protected:
 		friend class Renderable;
 
@@ -229,6 +246,7 @@ namespace bs
 		SPtr<GpuBufferCore> mBoneMatrixBuffer;
 		SPtr<VertexBufferCore> mMorphShapeBuffer;
 		SPtr<VertexDeclarationCore> mMorphVertexDeclaration;
+		SPtr<OccluderGeometry> mOccluderGeometry;
 	};
 
 	/** @copydoc TRenderable */
@@ -271,6 +289,9 @@ namespace bs
 		/** Updates animation properties depending on the current mesh. */
 		void refreshAnimation();
 
+		/** Rebuilds the occluder geometry from the current mesh, if it's marked as dirty. */
+		void refreshOccluderGeometry();
+
 		/** @copydoc TRenderable::_markCoreDirty */
 		void _markCoreDirty(RenderableDirtyFlag flag = RenderableDirtyFlag::Everything) override;
 
@@ -300,6 +321,8 @@ namespace bs
 
 		UINT32 mLastUpdateHash;
 		SPtr<Animation> mAnimation;
+		SPtr<OccluderGeometry> mOccluderGeometry;
+		bool mOccluderGeometryDirty;
 
 		/************************************************************************/
 		/* 								RTTI		                     		*/
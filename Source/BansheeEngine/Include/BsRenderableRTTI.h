@@ -22,6 +22,9 @@ namespace bs
 		UINT64& getLayer(Renderable* obj) { return obj->mLayer; }
 		void setLayer(Renderable* obj, UINT64& val) { obj->mLayer = val; }
 
+		bool& getIsOccluder(Renderable* obj) { return obj->mIsOccluder; }
+		void setIsOccluder(Renderable* obj, bool& val) { obj->mIsOccluder = val; }
+
 		HMaterial& getMaterial(Renderable* obj, UINT32 idx) { return obj->mMaterials[idx]; }
 		void setMaterial(Renderable* obj, UINT32 idx, HMaterial& val) { obj->setMaterial(idx, val); }
 		UINT32 getNumMaterials(Renderable* obj) { return (UINT32)obj->mMaterials.size(); }
@@ -34,6 +37,7 @@ namespace bs
 			addPlainField("mLayer", 1, &RenderableRTTI::getLayer, &RenderableRTTI::setLayer);
 			addReflectableArrayField("mMaterials", 2, &RenderableRTTI::getMaterial, 
 				&RenderableRTTI::getNumMaterials, &RenderableRTTI::setMaterial, &RenderableRTTI::setNumMaterials);
+			addPlainField("mIsOccluder", 3, &RenderableRTTI::getIsOccluder, &RenderableRTTI::setIsOccluder);
 		}
 
 		void onDeserializationEnded(IReflectable* obj, const UnorderedMap<String, UINT64>& params) override
@@ -12,12 +12,15 @@ namespace bs
 {
 	CAnimation::CAnimation()
 		:mWrapMode(AnimWrapMode::Loop), mSpeed(1.0f), mEnableCull(true), mUseBounds(false)
-	{ }
+	{
+		mUpdateFlags = CUF_NoUpdate;
+	}
 
 	CAnimation::CAnimation(const HSceneObject& parent)
 		: Component(parent), mWrapMode(AnimWrapMode::Loop), mSpeed(1.0f), mEnableCull(true), mUseBounds(false)
 	{
 		mNotifyFlags = TCF_Transform;
+		mUpdateFlags = CUF_NoUpdate;
 
 		setName("Animation");
 	}
@@ -15,6 +15,7 @@ namespace bs
 		setName("Bone");
 
 		mNotifyFlags = TCF_Parent;
+		mUpdateFlags = CUF_NoUpdate;
 	}
 
 	void CBone::setBoneName(const String& name)
@@ -12,6 +12,8 @@ namespace bs
 		mCastsShadows(castsShadows), mSpotAngle(spotAngle), mSpotFalloffAngle(spotFalloffAngle)
 	{
 		setName("Light");
+
+		mUpdateFlags = CUF_NoUpdate;
 	}
 
 	CLight::~CLight()
@@ -14,6 +14,7 @@
 #include "BsMorphShapes.h"
 #include "BsGpuBuffer.h"
 #include "BsAnimationManager.h"
+#include "BsOcclusionBuffer.h"
 
 namespace bs
 {
@@ -29,7 +30,7 @@ namespace bs
 	template<bool Core>
 	TRenderable<Core>::TRenderable()
 		: mLayer(1), mUseOverrideBounds(false), mPosition(BsZero), mTransform(BsIdentity), mTransformNoScale(BsIdentity)
-		, mIsActive(true), mAnimType(RenderableAnimType::None)
+		, mIsActive(true), mIsOccluder(false), mAnimType(RenderableAnimType::None)
 	{
 		mMaterials.resize(1);
 	}
@@ -145,6 +146,16 @@ namespace bs
 		_markCoreDirty();
 	}
 
+	template<bool Core>
+	void TRenderable<Core>::setIsOccluder(bool occluder)
+	{
+		if (mIsOccluder == occluder)
+			return;
+
+		mIsOccluder = occluder;
+		_markCoreDirty();
+	}
+
 	template class TRenderable < false >;
 	template class TRenderable < true >;
 
@@ -320,6 +331,7 @@ namespace bs
 		dataPtr = rttiReadElem(mLayer, dataPtr);
 		dataPtr = rttiReadElem(mOverrideBounds, dataPtr);
 		dataPtr = rttiReadElem(mUseOverrideBounds, dataPtr);
+		dataPtr = rttiReadElem(mIsOccluder, dataPtr);
 		dataPtr = rttiReadElem(numMaterials, dataPtr);
 		dataPtr = rttiReadElem(mTransform, dataPtr);
 		dataPtr = rttiReadElem(mTransformNoScale, dataPtr);
@@ -334,6 +346,11 @@ namespace bs
 		mesh->~SPtr<MeshCore>();
 		dataPtr += sizeof(SPtr<MeshCore>);
 
+		SPtr<OccluderGeometry>* occluderGeometry = (SPtr<OccluderGeometry>*)dataPtr;
+		mOccluderGeometry = *occluderGeometry;
+		occluderGeometry->~SPtr<OccluderGeometry>();
+		dataPtr += sizeof(SPtr<OccluderGeometry>);
+
 		for (UINT32 i = 0; i < numMaterials; i++)
 		{
 			SPtr<MaterialCore>* material = (SPtr<MaterialCore>*)dataPtr;
@@ -381,7 +398,7 @@ namespace bs
 	}
 
 	Renderable::Renderable()
-		:mLastUpdateHash(0)
+		:mLastUpdateHash(0), mOccluderGeometryDirty(true)
 	{
 		
 	}
@@ -441,6 +458,7 @@ namespace bs
 	void Renderable::onMeshChanged()
 	{
 		refreshAnimation();
+		mOccluderGeometryDirty = true;
 	}
 
 	void Renderable::refreshAnimation()
@@ -477,6 +495,27 @@ namespace bs
 		}
 	}
 
+	void Renderable::refreshOccluderGeometry()
+	{
+		if (!mOccluderGeometryDirty || !mMesh.isLoaded())
+			return;
+
+		mOccluderGeometryDirty = false;
+		mOccluderGeometry = nullptr;
+
+		if ((mMesh->getUsage() & MU_CPUCACHED) == 0)
+		{
+			LOGWRN("Renderable is marked as an occluder but its mesh \"" + toString(mMesh->getName()) + "\" was not "
+				"created with CPU caching enabled. It will not occlude other objects.");
+			return;
+		}
+
+		SPtr<MeshData> meshData = mMesh->allocBuffer();
+		mMesh->readCachedData(*meshData);
+
+		mOccluderGeometry = OccluderGeometry::create(*meshData);
+	}
+
 	void Renderable::_updateTransform(const HSceneObject& so, bool force)
 	{
 		UINT32 curHash = so->getTransformHash();
@@ -538,9 +577,13 @@ namespace bs
 		else
 			animationId = (UINT64)-1;
 
+		if (mIsOccluder)
+			refreshOccluderGeometry();
+
 		UINT32 size = rttiGetElemSize(mLayer) + 
 			rttiGetElemSize(mOverrideBounds) + 
 			rttiGetElemSize(mUseOverrideBounds) +
+			rttiGetElemSize(mIsOccluder) +
 			rttiGetElemSize(numMaterials) + 
 			rttiGetElemSize(mTransform) +
 			rttiGetElemSize(mTransformNoScale) +
@@ -550,6 +593,7 @@ namespace bs
 			rttiGetElemSize(mAnimType) + 
 			rttiGetElemSize(getCoreDirtyFlags()) +
 			sizeof(SPtr<MeshCore>) + 
+			sizeof(SPtr<OccluderGeometry>) +
 			numMaterials * sizeof(SPtr<MaterialCore>);
 
 		UINT8* data = allocator->alloc(size);
@@ -557,6 +601,7 @@ namespace bs
 		dataPtr = rttiWriteElem(mLayer, dataPtr);
 		dataPtr = rttiWriteElem(mOverrideBounds, dataPtr);
 		dataPtr = rttiWriteElem(mUseOverrideBounds, dataPtr);
+		dataPtr = rttiWriteElem(mIsOccluder, dataPtr);
 		dataPtr = rttiWriteElem(numMaterials, dataPtr);
 		dataPtr = rttiWriteElem(mTransform, dataPtr);
 		dataPtr = rttiWriteElem(mTransformNoScale, dataPtr);
@@ -572,6 +617,12 @@ namespace bs
 
 		dataPtr += sizeof(SPtr<MeshCore>);
 
+		SPtr<OccluderGeometry>* occluderGeometry = new (dataPtr) SPtr<OccluderGeometry>();
+		if (mIsOccluder)
+			*occluderGeometry = mOccluderGeometry;
+
+		dataPtr += sizeof(SPtr<OccluderGeometry>);
+
 		for (UINT32 i = 0; i < numMaterials; i++)
 		{
 			SPtr<MaterialCore>* material = new (dataPtr)SPtr<MaterialCore>();
@@ -40,7 +40,7 @@ namespace bs
 			mSamplerParam = mMaterial->getParamSamplerState("gMainTexSamp");
 		}
 
-		static StringID GUIParamsSemantic = "GUIParams";
+		static StringID GUIParamsSemantic = "GUIParams"_sid;
 		const Map<String, SHADER_PARAM_BLOCK_DESC>& paramBlockDescs = shader->getParamBlocks();
 
 		for (auto& paramBlockDesc : paramBlockDescs)
@@ -150,6 +150,13 @@ namespace bs
 		/** Parses the scene and generates morph shapes for the imported meshes using the imported raw data. */
 		SPtr<MorphShapes> createMorphShapes(const FBXImportScene& scene);
 
+		/** 
+		 * Reorders triangles and vertices of the imported mesh data for more efficient rendering. Any morph shapes in
+		 * @p desc are updated to match the new vertex order. Vertex cache efficiency before and after is logged at debug
+		 * level, tagged with @p filePath.
+		 */
+		void optimizeMesh(const Path& filePath, const SPtr<MeshData>& meshData, MESH_DESC& desc);
+
 		/**	Creates an internal representation of an FBX node from an FbxNode object. */
 		FBXImportNode* createImportNode(FBXImportScene& scene, FbxNode* fbxNode, FBXImportNode* parent);
 
@@ -130,7 +130,13 @@ namespace bs
 		if (meshImportOptions->getCPUCached())
 			desc.usage |= MU_CPUCACHED;
 
-		SPtr<Mesh> mesh = Mesh::_createPtr(rendererMeshData->getData(), desc);
+		SPtr<MeshData> meshData = MeshUtility::generateLODs(rendererMeshData->getData(), desc.subMeshes, 
+			meshImportOptions->getNumLODs(), meshImportOptions->getLODReduction(), desc.lodSubMeshes, desc.lodScreenSizes);
+
+		if (meshImportOptions->getOptimizeMesh())
+			optimizeMesh(filePath, meshData, desc);
+
+		SPtr<Mesh> mesh = Mesh::_createPtr(meshData, desc);
 
 		WString fileName = filePath.getWFilename(false);
 		mesh->setName(fileName);
@@ -152,7 +158,13 @@ namespace bs
 		if (meshImportOptions->getCPUCached())
 			desc.usage |= MU_CPUCACHED;
 
-		SPtr<Mesh> mesh = Mesh::_createPtr(rendererMeshData->getData(), desc);
+		SPtr<MeshData> meshData = MeshUtility::generateLODs(rendererMeshData->getData(), desc.subMeshes, 
+			meshImportOptions->getNumLODs(), meshImportOptions->getLODReduction(), desc.lodSubMeshes, desc.lodScreenSizes);
+
+		if (meshImportOptions->getOptimizeMesh())
+			optimizeMesh(filePath, meshData, desc);
+
+		SPtr<Mesh> mesh = Mesh::_createPtr(meshData, desc);
 
 		WString fileName = filePath.getWFilename(false);
 		mesh->setName(fileName);
@@ -251,13 +263,56 @@ namespace bs
 			convertAnimations(importedScene.clips, splits, skeleton, meshImportOptions->getImportRootMotion(), animation);
 		}
 
-		// TODO - Later: Optimize mesh: Remove bad and degenerate polygons, weld nearby vertices, optimize for vertex cache
+		// TODO - Later: Clean up mesh: Remove bad and degenerate polygons, weld nearby vertices
 
 		shutDownSdk();
 
 		return rendererMeshData;
 	}
 
+	void FBXImporter::optimizeMesh(const Path& filePath, const SPtr<MeshData>& meshData, MESH_DESC& desc)
+	{
+		Vector<SubMesh> subMeshes = desc.subMeshes;
+		subMeshes.insert(subMeshes.end(), desc.lodSubMeshes.begin(), desc.lodSubMeshes.end());
+
+		Vector<UINT32> vertexRemap;
+		MeshOptimizationStats stats = MeshUtility::optimize(meshData, subMeshes, &vertexRemap);
+		if (!stats.optimized)
+			return;
+
+		LOGDBG("Optimized mesh \"" + filePath.toString() + "\". Vertex cache misses per triangle: " + 
+			toString(stats.acmrBefore) + " before, " + toString(stats.acmrAfter) + " after.");
+
+		// Morph shapes reference vertices by index, so they must follow the new vertex order
+		if (desc.morphShapes == nullptr || vertexRemap.empty())
+			return;
+
+		Vector<SPtr<MorphChannel>> channels;
+		for (UINT32 i = 0; i < desc.morphShapes->getNumChannels(); i++)
+		{
+			SPtr<MorphChannel> channel = desc.morphShapes->getChannel(i);
+
+			Vector<SPtr<MorphShape>> shapes;
+			for (UINT32 j = 0; j < channel->getNumShapes(); j++)
+			{
+				SPtr<MorphShape> shape = channel->getShape(j);
+
+				Vector<MorphVertex> vertices = shape->getVertices();
+				for (auto& vertex : vertices)
+				{
+					if (vertex.sourceIdx < (UINT32)vertexRemap.size())
+						vertex.sourceIdx = vertexRemap[vertex.sourceIdx];
+				}
+
+				shapes.push_back(MorphShape::create(shape->getName(), shape->getWeight(), vertices));
+			}
+
+			channels.push_back(MorphChannel::create(channel->getName(), shapes));
+		}
+
+		desc.morphShapes = MorphShapes::create(channels, desc.morphShapes->getNumVertices());
+	}
+
 	SPtr<Skeleton> FBXImporter::createSkeleton(const FBXImportScene& scene, bool sharedRoot)
 	{
 		Vector<BONE_DESC> allBones;
@@ -30,6 +30,9 @@ namespace bs
 		/** @copydoc SpecificImporter::import */
 		virtual SPtr<Resource> import(const Path& filePath, SPtr<const ImportOptions> importOptions) override;
 
+		/** @copydoc SpecificImporter::isThreadSafe */
+		virtual bool isThreadSafe() const override { return true; }
+
 		/** @copydoc SpecificImporter::createImportOptions */
 		virtual SPtr<ImportOptions> createImportOptions() const override;
 	private:
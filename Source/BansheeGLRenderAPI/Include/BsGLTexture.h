@@ -66,6 +66,12 @@ namespace bs
 		void writeDataImpl(const PixelData& src, UINT32 mipLevel = 0, UINT32 face = 0, bool discardWholeBuffer = false,
 					   UINT32 queueIdx = 0) override;
 
+		/** @copydoc TextureCore::setMostDetailedMipImpl */
+		void setMostDetailedMipImpl(UINT32 mip) override;
+
+		/** @copydoc TextureCore::setAllocatedMipImpl */
+		void setAllocatedMipImpl(UINT32 prevMip) override;
+
 		/** Creates pixel buffers for each face and mip level. Texture must have been created previously. */
 		void createSurfaceList();
 
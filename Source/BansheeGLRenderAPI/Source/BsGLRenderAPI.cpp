@@ -81,7 +81,7 @@ namespace bs
 
 	const StringID& GLRenderAPI::getName() const
 	{
-		static StringID strName("GLRenderAPI");
+		static StringID strName = "GLRenderAPI"_sid;
 		return strName;
 	}
 
@@ -2073,6 +2073,7 @@ namespace bs
 
 		caps.addShaderProfile("glsl");
 		caps.setCapability(RSC_TEXTURE_COMPRESSION_BC);
+		caps.setCapability(RSC_TEXTURE_STREAMING);
 
 		// Check if geometry shaders are supported
 		if (GLEW_VERSION_2_0 &&
@@ -65,6 +65,10 @@ namespace bs
 		// This needs to be set otherwise the texture doesn't get rendered
 		glTexParameteri(getGLTextureTarget(), GL_TEXTURE_MAX_LEVEL, numMips);
 
+		// Streamed textures start with only some of their mip levels available
+		if (mMostDetailedMip > 0)
+			glTexParameteri(getGLTextureTarget(), GL_TEXTURE_BASE_LEVEL, mMostDetailedMip);
+
 		// Allocate internal buffer so that glTexSubImageXD can be used
 		mGLFormat = GLPixelUtil::getClosestGLInternalFormat(pixFormat, mProperties.isHardwareGammaEnabled());
 
@@ -121,7 +125,13 @@ namespace bs
 				case TEX_TYPE_2D:
 				{
 					if (numFaces <= 1)
-						glTexImage2D(GL_TEXTURE_2D, mip, mGLFormat, width, height, 0, baseFormat, baseDataType, nullptr);
+					{
+						// Mip levels that aren't allocated are specified without any storage
+						if (mip >= mAllocatedMip)
+							glTexImage2D(GL_TEXTURE_2D, mip, mGLFormat, width, height, 0, baseFormat, baseDataType, nullptr);
+						else
+							glTexImage2D(GL_TEXTURE_2D, mip, mGLFormat, 0, 0, 0, baseFormat, baseDataType, nullptr);
+					}
 					else
 						glTexImage3D(GL_TEXTURE_2D_ARRAY, mip, mGLFormat, width, height, numFaces, 0, baseFormat, baseDataType, nullptr);
 				}
@@ -256,6 +266,41 @@ namespace bs
 		getBuffer(face, mipLevel)->upload(src, src.getExtents());
 	}
 
+	void GLTextureCore::setMostDetailedMipImpl(UINT32 mip)
+	{
+		glBindTexture(getGLTextureTarget(), mTextureID);
+		glTexParameteri(getGLTextureTarget(), GL_TEXTURE_BASE_LEVEL, mip);
+	}
+
+	void GLTextureCore::setAllocatedMipImpl(UINT32 prevMip)
+	{
+		// Mip levels are released by specifying them again without any storage, and allocated by specifying them with
+		// their full size. Only levels starting with the base level are sampled, so the texture remains complete.
+		PixelFormat pixFormat = mProperties.getFormat();
+		GLenum baseFormat = GLPixelUtil::getGLOriginFormat(pixFormat);
+		GLenum baseDataType = GLPixelUtil::getGLOriginDataType(pixFormat);
+
+		glBindTexture(GL_TEXTURE_2D, mTextureID);
+
+		UINT32 firstMip = std::min(prevMip, mAllocatedMip);
+		UINT32 lastMip = std::max(prevMip, mAllocatedMip);
+		for (UINT32 mip = firstMip; mip < lastMip; mip++)
+		{
+			UINT32 width = 0;
+			UINT32 height = 0;
+			if (mip >= mAllocatedMip)
+			{
+				width = std::max(1U, mProperties.getWidth() >> mip);
+				height = std::max(1U, mProperties.getHeight() >> mip);
+			}
+
+			glTexImage2D(GL_TEXTURE_2D, mip, mGLFormat, width, height, 0, baseFormat, baseDataType, nullptr);
+		}
+
+		// Surfaces keep track of the size of their mip level
+		createSurfaceList();
+	}
+
 	void GLTextureCore::copyImpl(UINT32 srcFace, UINT32 srcMipLevel, UINT32 destFace, UINT32 destMipLevel,
 								 const SPtr<TextureCore>& target, UINT32 queueIdx)
 	{
@@ -278,6 +323,11 @@ namespace bs
 					mProperties.isHardwareGammaEnabled(), mProperties.getNumSamples());
 
 				mSurfaceList.push_back(bs_shared_ptr<GLPixelBuffer>(buf));
+
+				// Mip levels that aren't allocated have no storage
+				if (mip < mAllocatedMip)
+					continue;
+
                 if(buf->getWidth() == 0 || buf->getHeight() == 0 || buf->getDepth() == 0)
                 {
 					BS_EXCEPT(RenderingAPIException, 
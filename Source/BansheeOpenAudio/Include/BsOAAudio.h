@@ -4,6 +4,7 @@
 
 #include "BsOAPrerequisites.h"
 #include "BsAudio.h"
+#include "BsThreadPool.h"
 #include "AL/alc.h"
 
 namespace bs
@@ -83,6 +84,21 @@ namespace bs
 		 */
 		void _writeToOpenALBuffer(UINT32 bufferId, UINT8* samples, const AudioDataInfo& info);
 
+		/** 
+		 * Returns a decoder from the decoder pool, or creates a new one if none are available. Decoders are used by
+		 * streaming sources for reading compressed clip data. Must be returned by calling _releaseDecoder().
+		 */
+		OggVorbisDecoder* _acquireDecoder();
+
+		/** Returns a decoder previously retrieved by _acquireDecoder() back to the pool. */
+		void _releaseDecoder(OggVorbisDecoder* decoder);
+
+		/** 
+		 * Returns the total number of times a streaming source ran out of queued data before the streaming thread could
+		 * provide more.
+		 */
+		UINT32 _getNumStreamingUnderruns() const { return mNumUnderruns.load(); }
+
 		/** @} */
 
 	private:
@@ -123,6 +139,9 @@ namespace bs
 		/** Delete all existing OpenAL contexts. */
 		void clearContexts();
 
+		/** Main loop of the streaming thread. Periodically streams new data until the manager is destroyed. */
+		void runStreamingThread();
+
 		/** Streams new data to audio sources that require it. */
 		void updateStreaming();
 
@@ -148,8 +167,18 @@ namespace bs
 		Vector<StreamingCommand> mStreamingCommandQueue;
 		UnorderedSet<OAAudioSource*> mStreamingSources;
 		UnorderedSet<OAAudioSource*> mDestroyedSources;
-		SPtr<Task> mStreamingTask;
+		HThread mStreamingThread;
+		Signal mStreamingSignal;
+		bool mStreamingShutdown;
+		std::atomic<UINT32> mNumUnderruns;
 		mutable Mutex mMutex;
+		Mutex mStreamingMutex;
+
+		Vector<OggVorbisDecoder*> mFreeDecoders;
+		Mutex mDecoderMutex;
+
+		/** Interval at which the streaming thread checks sources for processed buffers, in milliseconds. */
+		static const UINT32 StreamingUpdateInterval = 10;
 	};
 
 	/** Provides easier access to OAAudio. */
@@ -40,6 +40,23 @@ namespace bs
 		/** Returns the internal OpenAL buffer. Only valid if the audio clip was created without AudioReadMode::Stream. */
 		UINT32 _getOpenALBuffer() const { return mBufferId; }
 
+		/** Returns true if the clip's samples need to be decompressed when read by getSamples(). */
+		bool _needsDecompression() const { return mNeedsDecompression; }
+
+		/** 
+		 * Opens the provided decoder so it reads from a private copy of the clip's sample stream, positioned at the 
+		 * provided offset. This allows a streaming source to read compressed data sequentially without contending with 
+		 * other readers of the same clip. Only valid if _needsDecompression() returns true.
+		 *
+		 * @param[in]	decoder		Decoder to open. Any previously opened data will be released.
+		 * @param[in]	offset		Offset in number of samples at which to start reading (should be a multiple of number
+		 *							of channels).
+		 * @return					True if the decoder was successfully opened.
+		 *
+		 * @note	Thread safe.
+		 */
+		bool _openDecoder(OggVorbisDecoder& decoder, UINT32 offset) const;
+
 		/** @} */
 	protected:
 		/** @copydoc Resource::initialize */
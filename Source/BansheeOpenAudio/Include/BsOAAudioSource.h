@@ -63,6 +63,18 @@ namespace bs
 		/** @copydoc AudioSource::getState */
 		AudioSourceState getState() const override { return mState; }
 
+		/** @name Internal
+		 *  @{
+		 */
+
+		/** 
+		 * Returns the number of times playback of this source stalled because the streaming thread didn't provide new 
+		 * data in time. Only relevant for streaming sources.
+		 */
+		UINT32 _getNumUnderruns() const { return mNumUnderruns.load(); }
+
+		/** @} */
+
 	private:
 		friend class OAAudio;
 
@@ -99,6 +111,25 @@ namespace bs
 		/** Fills the provided buffer with streaming data. */
 		bool fillBuffer(UINT32 buffer, AudioDataInfo& info, UINT32 maxNumSamples);
 
+		/** 
+		 * Reads samples from the attached clip into the provided buffer, starting at the current queued position. Uses
+		 * the source's own decoder if one is assigned, or reads directly from the clip otherwise.
+		 */
+		void readSamples(UINT8* samples, UINT32 numSamples);
+
+		/** 
+		 * Calculates the number of samples a single streaming buffer should hold, based on the bitrate of the attached
+		 * clip.
+		 */
+		UINT32 getStreamBufferNumSamples() const;
+
+		/**
+		 * Calculates how many streaming buffers the source should cycle through. Enough buffers are used to keep
+		 * StreamReadAheadDuration of audio queued ahead of the one currently playing, so the count depends on the bitrate
+		 * of the attached clip.
+		 */
+		UINT32 getStreamBufferCount() const;
+
 		/** Makes the current audio clip active. Should be called whenever the audio clip changes. */
 		void applyClip();
 
@@ -111,13 +142,21 @@ namespace bs
 		AudioSourceState mState;
 		bool mGloballyPaused;
 
-		static const UINT32 StreamBufferCount = 3; // Maximum 32
-		UINT32 mStreamBuffers[StreamBufferCount];
-		UINT32 mBusyBuffers[StreamBufferCount];
+		static const UINT32 MinStreamBufferCount = 3;
+		static const UINT32 MaxStreamBufferCount = 32;
+		static const float StreamBufferDuration; // In seconds
+		static const float StreamReadAheadDuration; // In seconds
+		static const UINT32 MaxStreamBufferSize; // In bytes
+		Vector<UINT32> mStreamBuffers;
+		Vector<UINT32> mBusyBuffers; // Bit per source ID still playing the buffer
+		UINT32 mNextStreamBuffer;
 		UINT32 mStreamProcessedPosition;
 		UINT32 mStreamQueuedPosition;
 		bool mIsStreaming;
-		mutable Mutex mMutex;
+		OggVorbisDecoder* mStreamDecoder;
+		UINT32 mStreamDecoderPosition;
+		std::atomic<UINT32> mNumUnderruns;
+		mutable RecursiveMutex mMutex;
 	};
 
 	/** @} */
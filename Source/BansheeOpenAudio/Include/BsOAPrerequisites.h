@@ -24,6 +24,7 @@ namespace bs
 {
 	class OAAudioListener;
 	class OAAudioSource;
+	class OggVorbisDecoder;
 }
 
 /** @addtogroup Plugins
@@ -41,6 +41,9 @@ namespace bs
 
 		/** @copydoc AudioDecoder::isValid */
 		bool isValid(const SPtr<DataStream>& stream, UINT32 offset = 0) override;
+
+		/** Releases the currently open file and its stream, if any. The decoder can be re-opened afterwards. */
+		void close();
 	private:
 		OggDecoderData mDecoderData;
 		OggVorbis_File mOggVorbisFile;
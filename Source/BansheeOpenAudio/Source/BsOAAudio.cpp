@@ -4,15 +4,15 @@
 #include "BsOAAudioClip.h"
 #include "BsOAAudioListener.h"
 #include "BsOAAudioSource.h"
+#include "BsOggVorbisDecoder.h"
 #include "BsMath.h"
-#include "BsTaskScheduler.h"
 #include "BsAudioUtility.h"
 #include "AL\al.h"
 
 namespace bs
 {
 	OAAudio::OAAudio()
-		:mVolume(1.0f), mIsPaused(false)
+		:mVolume(1.0f), mIsPaused(false), mStreamingShutdown(false), mNumUnderruns(0)
 	{
 		bool enumeratedDevices;
 		if(_isExtensionSupported("ALC_ENUMERATE_ALL_EXT"))
@@ -68,11 +68,26 @@ namespace bs
 		}
 
 		rebuildContexts();
+
+		mStreamingThread = ThreadPool::instance().run("AudioStream", std::bind(&OAAudio::runStreamingThread, this));
 	}
 
 	OAAudio::~OAAudio()
 	{
 		assert(mListeners.size() == 0 && mSources.size() == 0); // Everything should be destroyed at this point
+
+		{
+			Lock lock(mMutex);
+			mStreamingShutdown = true;
+		}
+
+		mStreamingSignal.notify_one();
+		mStreamingThread.blockUntilComplete();
+
+		for (auto& decoder : mFreeDecoders)
+			bs_delete(decoder);
+
+		mFreeDecoders.clear();
 		clearContexts();
 
 		alcCloseDevice(mDevice);
@@ -104,15 +119,8 @@ namespace bs
 
 	void OAAudio::_update()
 	{
-		auto worker = [this]() { updateStreaming(); };
-
-		// If previous task still hasn't completed, just skip streaming this frame, queuing more tasks won't help
-		if (mStreamingTask != nullptr && !mStreamingTask->isComplete())
-			return;
-
-		mStreamingTask = Task::create("AudioStream", worker, TaskPriority::VeryHigh);
-		TaskScheduler::instance().addTask(mStreamingTask);
-
+		// Note: Streaming is handled by a dedicated thread that runs independently of the frame rate, so nothing needs
+		// to be queued here
 		Audio::_update();
 	}
 
@@ -169,24 +177,59 @@ namespace bs
 	void OAAudio::_unregisterSource(OAAudioSource* source)
 	{
 		mSources.erase(source);
+
+		// By now the source has stopped streaming and is in the destroyed list, so once the streaming thread releases
+		// this lock it is guaranteed not to touch the source again. Must not be called while holding the source's mutex.
+		Lock streamingLock(mStreamingMutex);
 	}
 
 	void OAAudio::startStreaming(OAAudioSource* source)
 	{
-		Lock(mMutex);
+		{
+			Lock lock(mMutex);
 
-		mStreamingCommandQueue.push_back({ StreamingCommandType::Start, source });
-		mDestroyedSources.erase(source);
+			mStreamingCommandQueue.push_back({ StreamingCommandType::Start, source });
+			mDestroyedSources.erase(source);
+		}
+
+		// Wake up the streaming thread so the new source starts receiving data right away
+		mStreamingSignal.notify_one();
 	}
 
 	void OAAudio::stopStreaming(OAAudioSource* source)
 	{
-		Lock(mMutex);
+		Lock lock(mMutex);
 
 		mStreamingCommandQueue.push_back({ StreamingCommandType::Stop, source });
 		mDestroyedSources.insert(source);
 	}
 
+	OggVorbisDecoder* OAAudio::_acquireDecoder()
+	{
+		{
+			Lock lock(mDecoderMutex);
+
+			if (!mFreeDecoders.empty())
+			{
+				OggVorbisDecoder* decoder = mFreeDecoders.back();
+				mFreeDecoders.pop_back();
+
+				return decoder;
+			}
+		}
+
+		return bs_new<OggVorbisDecoder>();
+	}
+
+	void OAAudio::_releaseDecoder(OggVorbisDecoder* decoder)
+	{
+		// Release the stream reference right away, so pooled decoders don't keep clip data alive
+		decoder->close();
+
+		Lock lock(mDecoderMutex);
+		mFreeDecoders.push_back(decoder);
+	}
+
 	ALCcontext* OAAudio::_getContext(const OAAudioListener* listener) const
 	{
 		if (mListeners.size() > 0)
@@ -260,10 +303,28 @@ namespace bs
 		mContexts.clear();
 	}
 
+	void OAAudio::runStreamingThread()
+	{
+		while (true)
+		{
+			{
+				Lock lock(mMutex);
+
+				if (!mStreamingShutdown && mStreamingCommandQueue.empty())
+					mStreamingSignal.wait_for(lock, std::chrono::milliseconds(StreamingUpdateInterval));
+
+				if (mStreamingShutdown)
+					break;
+			}
+
+			updateStreaming();
+		}
+	}
+
 	void OAAudio::updateStreaming()
 	{
 		{
-			Lock(mMutex);
+			Lock lock(mMutex);
 
 			for(auto& command : mStreamingCommandQueue)
 			{
@@ -286,9 +347,13 @@ namespace bs
 
 		for (auto& source : mStreamingSources)
 		{
+			// Held for the duration of the stream() call, so a source cannot finish unregistering (and be destroyed)
+			// between the check below and the call itself. See _unregisterSource().
+			Lock streamingLock(mStreamingMutex);
+
 			// Check if the source got destroyed while streaming
 			{
-				Lock(mMutex);
+				Lock lock(mMutex);
 
 				auto iterFind = mDestroyedSources.find(source);
 				if (iterFind != mDestroyedSources.end())
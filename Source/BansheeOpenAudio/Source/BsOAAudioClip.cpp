@@ -172,6 +172,24 @@ namespace bs
 		LOGWRN("Attempting to read samples while sample data is not available.");
 	}
 
+	bool OAAudioClip::_openDecoder(OggVorbisDecoder& decoder, UINT32 offset) const
+	{
+		Lock lock(mMutex);
+
+		if (!mNeedsDecompression || mStreamData == nullptr)
+			return false;
+
+		// Clone without copying so the decoder gets its own read position, while sharing the underlying data
+		SPtr<DataStream> stream = mStreamData->clone(false);
+
+		AudioDataInfo info;
+		if (!decoder.open(stream, info, mStreamOffset))
+			return false;
+
+		decoder.seek(offset);
+		return true;
+	}
+
 	SPtr<DataStream> OAAudioClip::getSourceStream(UINT32& size)
 	{
 		Lock lock(mMutex);
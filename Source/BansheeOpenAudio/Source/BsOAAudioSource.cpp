@@ -3,14 +3,23 @@
 #include "BsOAAudioSource.h"
 #include "BsOAAudio.h"
 #include "BsOAAudioClip.h"
+#include "BsOggVorbisDecoder.h"
+#include "BsMath.h"
 #include "AL/al.h"
 
 namespace bs
 {
+	const float OAAudioSource::StreamBufferDuration = 0.5f;
+	const UINT32 OAAudioSource::MaxStreamBufferSize = 256 * 1024;
+
+	// Must cover the time the streaming thread might take to get back to the source, which includes its update interval
+	// and decoding for all other streaming sources
+	const float OAAudioSource::StreamReadAheadDuration = 1.0f;
+
 	OAAudioSource::OAAudioSource()
 		: mSavedTime(0.0f), mState(AudioSourceState::Stopped), mSavedState(AudioSourceState::Stopped)
-		, mGloballyPaused(false), mStreamBuffers(), mBusyBuffers(), mStreamProcessedPosition(0), mStreamQueuedPosition(0)
-		, mIsStreaming(false)
+		, mGloballyPaused(false), mNextStreamBuffer(0), mStreamProcessedPosition(0), mStreamQueuedPosition(0)
+		, mIsStreaming(false), mStreamDecoder(nullptr), mStreamDecoderPosition(0), mNumUnderruns(0)
 	{
 		gOAAudio()._registerSource(this);
 		rebuild();
@@ -26,7 +35,7 @@ namespace bs
 	{
 		stop();
 
-		Lock(mMutex);
+		RecursiveLock lock(mMutex);
 		AudioSource::setClip(clip);
 
 		applyClip();
@@ -163,7 +172,7 @@ namespace bs
 
 		if(requiresStreaming())
 		{
-			Lock(mMutex);
+			RecursiveLock lock(mMutex);
 			
 			if (!mIsStreaming)
 			{
@@ -221,7 +230,7 @@ namespace bs
 		}
 
 		{
-			Lock(mMutex);
+			RecursiveLock lock(mMutex);
 
 			mStreamProcessedPosition = 0;
 			mStreamQueuedPosition = 0;
@@ -270,7 +279,7 @@ namespace bs
 		bool needsStreaming = requiresStreaming();
 		float clipTime;
 		{
-			Lock(mMutex);
+			RecursiveLock lock(mMutex);
 
 			if (!needsStreaming)
 				clipTime = time;
@@ -305,7 +314,7 @@ namespace bs
 
 	float OAAudioSource::getTime() const
 	{
-		Lock(mMutex);
+		RecursiveLock lock(mMutex);
 
 		auto& contexts = gOAAudio()._getContexts();
 
@@ -340,7 +349,7 @@ namespace bs
 		auto& contexts = gOAAudio()._getContexts();
 		UINT32 numContexts = (UINT32)contexts.size();
 		
-		Lock(mMutex);
+		RecursiveLock lock(mMutex);
 		for (UINT32 i = 0; i < numContexts; i++)
 		{
 			if (contexts.size() > 1)
@@ -359,7 +368,7 @@ namespace bs
 		UINT32 numContexts = (UINT32)contexts.size();
 
 		{
-			Lock(mMutex);
+			RecursiveLock lock(mMutex);
 
 			for (UINT32 i = 0; i < numContexts; i++)
 			{
@@ -401,7 +410,7 @@ namespace bs
 			}
 
 			{
-				Lock(mMutex);
+				RecursiveLock lock(mMutex);
 
 				if (!mIsStreaming)
 				{
@@ -430,10 +439,29 @@ namespace bs
 	{
 		assert(!mIsStreaming);
 
-		alGenBuffers(StreamBufferCount, mStreamBuffers);
-		gOAAudio().startStreaming(this);
+		UINT32 numBuffers = getStreamBufferCount();
+		mStreamBuffers.resize(numBuffers);
+		mBusyBuffers.assign(numBuffers, 0);
+		mNextStreamBuffer = 0;
+
+		alGenBuffers(numBuffers, mStreamBuffers.data());
 
-		memset(&mBusyBuffers, 0, sizeof(mBusyBuffers));
+		// Compressed clips are decoded using a decoder private to this source, so that multiple sources streaming the
+		// same clip don't need to share (and constantly re-seek) a single decoder
+		OAAudioClip* audioClip = static_cast<OAAudioClip*>(mAudioClip.get());
+		if (audioClip->_needsDecompression())
+		{
+			mStreamDecoder = gOAAudio()._acquireDecoder();
+			if (audioClip->_openDecoder(*mStreamDecoder, mStreamQueuedPosition))
+				mStreamDecoderPosition = mStreamQueuedPosition;
+			else
+			{
+				gOAAudio()._releaseDecoder(mStreamDecoder);
+				mStreamDecoder = nullptr;
+			}
+		}
+
+		gOAAudio().startStreaming(this);
 		mIsStreaming = true;
 	}
 
@@ -459,12 +487,24 @@ namespace bs
 				alSourceUnqueueBuffers(mSourceIDs[i], 1, &buffer);
 		}
 
-		alDeleteBuffers(StreamBufferCount, mStreamBuffers);
+		alDeleteBuffers((UINT32)mStreamBuffers.size(), mStreamBuffers.data());
+		mStreamBuffers.clear();
+		mBusyBuffers.clear();
+
+		if (mStreamDecoder != nullptr)
+		{
+			gOAAudio()._releaseDecoder(mStreamDecoder);
+			mStreamDecoder = nullptr;
+		}
 	}
 
 	void OAAudioSource::stream()
 	{
-		Lock(mMutex);
+		RecursiveLock lock(mMutex);
+
+		// Streaming might have been stopped after the streaming thread already picked up the source
+		if (!mIsStreaming)
+			return;
 
 		AudioDataInfo info;
 		info.bitDepth = mAudioClip->getBitDepth();
@@ -478,6 +518,7 @@ namespace bs
 		// stop all streaming before changing contexts. Otherwise a mutex lock would be needed for every context access.
 		auto& contexts = gOAAudio()._getContexts();
 		UINT32 numContexts = (UINT32)contexts.size();
+		bool isStarved = false;
 		for (UINT32 i = 0; i < numContexts; i++)
 		{
 			if (contexts.size() > 1)
@@ -486,13 +527,25 @@ namespace bs
 			INT32 numProcessedBuffers = 0;
 			alGetSourcei(mSourceIDs[i], AL_BUFFERS_PROCESSED, &numProcessedBuffers);
 
+			// A source that played through all of its queued buffers stops on its own. If there was still data left to
+			// decode it means we didn't stream new data in time. Otherwise the clip simply reached its end.
+			bool hasDataLeft = mLoop || mStreamQueuedPosition < totalNumSamples;
+			if (numProcessedBuffers > 0 && hasDataLeft && mState == AudioSourceState::Playing && !mGloballyPaused)
+			{
+				INT32 sourceState = 0;
+				alGetSourcei(mSourceIDs[i], AL_SOURCE_STATE, &sourceState);
+
+				if (sourceState == AL_STOPPED)
+					isStarved = true;
+			}
+
 			for (INT32 j = numProcessedBuffers; j > 0; j--)
 			{
 				UINT32 buffer;
 				alSourceUnqueueBuffers(mSourceIDs[i], 1, &buffer);
 
 				INT32 bufferIdx = -1;
-				for (UINT32 k = 0; k < StreamBufferCount; k++)
+				for (UINT32 k = 0; k < (UINT32)mStreamBuffers.size(); k++)
 				{
 					if (buffer == mStreamBuffers[k])
 					{
@@ -505,11 +558,11 @@ namespace bs
 				if (bufferIdx == -1)
 					continue;
 
-				mBusyBuffers[bufferIdx] &= ~(1 << bufferIdx);
+				mBusyBuffers[bufferIdx] &= ~(1 << i);
 
 				// Check if all sources are done with this buffer
 				if (mBusyBuffers[bufferIdx] != 0)
-					break;
+					continue;
 
 				INT32 bufferSize;
 				INT32 bufferBits;
@@ -541,20 +594,43 @@ namespace bs
 			}
 		}
 
-		for(UINT32 i = 0; i < StreamBufferCount; i++)
+		// Buffers are played in the order they were queued, so they get freed, and refilled, in a ring
+		UINT32 numBuffers = (UINT32)mStreamBuffers.size();
+		UINT32 allSourcesMask = (1 << (UINT32)mSourceIDs.size()) - 1;
+		while (mBusyBuffers[mNextStreamBuffer] == 0)
+		{
+			UINT32 buffer = mStreamBuffers[mNextStreamBuffer];
+			if (!fillBuffer(buffer, info, totalNumSamples))
+				break;
+
+			for (auto& source : mSourceIDs)
+				alSourceQueueBuffers(source, 1, &buffer);
+
+			mBusyBuffers[mNextStreamBuffer] = allSourcesMask;
+			mNextStreamBuffer = (mNextStreamBuffer + 1) % numBuffers;
+		}
+
+		if (isStarved)
 		{
-			if (mBusyBuffers[i] != 0)
-				continue;
+			mNumUnderruns++;
+			gOAAudio().mNumUnderruns++;
 
-			if (fillBuffer(mStreamBuffers[i], info, totalNumSamples))
+			// Resume playback now that new data has been queued
+			for (UINT32 i = 0; i < numContexts; i++)
 			{
-				for (auto& source : mSourceIDs)
-					alSourceQueueBuffers(source, 1, &mStreamBuffers[i]);
+				if (contexts.size() > 1)
+					alcMakeContextCurrent(contexts[i]);
+
+				INT32 sourceState = 0;
+				alGetSourcei(mSourceIDs[i], AL_SOURCE_STATE, &sourceState);
 
-				mBusyBuffers[i] |= 1 << i;
+				if (sourceState == AL_STOPPED)
+					alSourcePlay(mSourceIDs[i]);
+
+				// Non-3D clips play only on a single source
+				if (!is3D())
+					break;
 			}
-			else
-				break;
 		}
 	}
 
@@ -573,14 +649,12 @@ namespace bs
 		}
 
 		// Read audio data
-		UINT32 numSamples = std::min(numRemainingSamples, info.sampleRate * info.numChannels); // 1 second of data
+		UINT32 numSamples = std::min(numRemainingSamples, getStreamBufferNumSamples());
 		UINT32 sampleBufferSize = numSamples * (info.bitDepth / 8);
 
 		UINT8* samples = (UINT8*)bs_stack_alloc(sampleBufferSize);
 
-		OAAudioClip* audioClip = static_cast<OAAudioClip*>(mAudioClip.get());
-
-		audioClip->getSamples(samples, mStreamQueuedPosition, numSamples);
+		readSamples(samples, numSamples);
 		mStreamQueuedPosition += numSamples;
 
 		info.numSamples = numSamples;
@@ -591,6 +665,58 @@ namespace bs
 		return true;
 	}
 
+	void OAAudioSource::readSamples(UINT8* samples, UINT32 numSamples)
+	{
+		if (mStreamDecoder != nullptr)
+		{
+			// Decoder is read sequentially, so a seek is only required after looping or a position change
+			if (mStreamDecoderPosition != mStreamQueuedPosition)
+				mStreamDecoder->seek(mStreamQueuedPosition);
+
+			UINT32 numReadSamples = mStreamDecoder->read(samples, numSamples);
+			if (numReadSamples < numSamples)
+			{
+				UINT32 bytesPerSample = mAudioClip->getBitDepth() / 8;
+				memset(samples + numReadSamples * bytesPerSample, 0, (numSamples - numReadSamples) * bytesPerSample);
+			}
+
+			mStreamDecoderPosition = mStreamQueuedPosition + numSamples;
+		}
+		else
+		{
+			OAAudioClip* audioClip = static_cast<OAAudioClip*>(mAudioClip.get());
+			audioClip->getSamples(samples, mStreamQueuedPosition, numSamples);
+		}
+	}
+
+	UINT32 OAAudioSource::getStreamBufferNumSamples() const
+	{
+		UINT32 numChannels = mAudioClip->getNumChannels();
+		UINT32 bytesPerSample = mAudioClip->getBitDepth() / 8;
+
+		// Size buffers to hold a fixed duration of audio, but limit their size for high bitrate clips so that a single
+		// fill doesn't stall the streaming thread (and the other sources it services)
+		UINT32 numSamples = (UINT32)(mAudioClip->getFrequency() * StreamBufferDuration) * numChannels;
+		UINT32 maxNumSamples = MaxStreamBufferSize / bytesPerSample;
+		if (numSamples > maxNumSamples)
+			numSamples = maxNumSamples;
+
+		// Buffers must always contain whole frames
+		numSamples -= numSamples % numChannels;
+		return std::max(numSamples, numChannels);
+	}
+
+	UINT32 OAAudioSource::getStreamBufferCount() const
+	{
+		UINT32 numBufferSamples = getStreamBufferNumSamples();
+		UINT32 numReadAheadSamples = (UINT32)(mAudioClip->getFrequency() * StreamReadAheadDuration) * 
+			mAudioClip->getNumChannels();
+
+		// One extra buffer for the one currently playing
+		UINT32 numBuffers = (numReadAheadSamples + numBufferSamples - 1) / numBufferSamples + 1;
+		return Math::clamp(numBuffers, MinStreamBufferCount, MaxStreamBufferCount);
+	}
+
 	void OAAudioSource::applyClip()
 	{
 		auto& contexts = gOAAudio()._getContexts();
@@ -627,7 +753,7 @@ namespace bs
 		stop();
 
 		{
-			Lock(mMutex);
+			RecursiveLock lock(mMutex);
 			applyClip();
 		}
 
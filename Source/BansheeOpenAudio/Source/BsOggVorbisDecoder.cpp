@@ -47,9 +47,20 @@ namespace bs
 	}
 
 	OggVorbisDecoder::~OggVorbisDecoder()
+	{
+		close();
+	}
+
+	void OggVorbisDecoder::close()
 	{
 		if (mOggVorbisFile.datasource != nullptr)
+		{
 			ov_clear(&mOggVorbisFile);
+			mOggVorbisFile.datasource = nullptr;
+		}
+
+		mDecoderData.stream = nullptr;
+		mDecoderData.offset = 0;
 	}
 
 	bool OggVorbisDecoder::isValid(const SPtr<DataStream>& stream, UINT32 offset)
@@ -73,6 +84,9 @@ namespace bs
 		if (stream == nullptr)
 			return false;
 
+		// Decoders may be re-used, in which case release any previously opened file
+		close();
+
 		stream->seek(offset);
 		mDecoderData.stream = stream;
 		mDecoderData.offset = offset;
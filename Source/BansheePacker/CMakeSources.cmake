@@ -0,0 +1,9 @@
+set(BS_BANSHEEPACKER_SRC_NOFILTER
+	"Source/Main.cpp"
+)
+
+source_group("Source Files" FILES ${BS_BANSHEEPACKER_SRC_NOFILTER})
+
+set(BS_BANSHEEPACKER_SRC
+	${BS_BANSHEEPACKER_SRC_NOFILTER}
+)
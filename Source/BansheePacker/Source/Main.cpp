@@ -0,0 +1,116 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsPrerequisitesUtil.h"
+#include "BsFileSystem.h"
+#include "BsPackFile.h"
+#include "BsTimer.h"
+#include <iostream>
+
+using namespace bs;
+
+/** Checks if the provided string has the layout of a UUID (e.g. "d0b6c3b4-8e07-4bbd-a6d2-2b3f5b3a2f6e"). */
+bool isUUID(const String& value)
+{
+	if (value.size() != 36)
+		return false;
+
+	for (UINT32 i = 0; i < 36; i++)
+	{
+		bool isSeparator = i == 8 || i == 13 || i == 18 || i == 23;
+		if (isSeparator != (value[i] == '-'))
+			return false;
+	}
+
+	return true;
+}
+
+void printUsage()
+{
+	std::cout << "Packs resources into a single pack file that can be loaded by the game." << std::endl;
+	std::cout << "Usage: BansheePacker <resources folder> <output file> [--compress] [--alignment <bytes>]" << std::endl;
+	std::cout << "  Every <UUID>.asset file in the resources folder is added to the pack." << std::endl;
+	std::cout << "  --compress           LZ4 compress the packed resources." << std::endl;
+	std::cout << "  --alignment <bytes>  Boundary to align each resource to. Must be a power of two. Default is 16." 
+		<< std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 3)
+	{
+		printUsage();
+		return 1;
+	}
+
+	Path inputFolder = Path(String(argv[1]));
+	Path outputPath = Path(String(argv[2]));
+
+	bool compress = false;
+	UINT32 alignment = 16;
+	for (int i = 3; i < argc; i++)
+	{
+		String arg = argv[i];
+		if (arg == "--compress")
+			compress = true;
+		else if (arg == "--alignment" && (i + 1) < argc)
+			alignment = (UINT32)atoi(argv[++i]);
+		else
+		{
+			printUsage();
+			return 1;
+		}
+	}
+
+	if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+	{
+		std::cout << "Alignment must be a power of two." << std::endl;
+		return 1;
+	}
+
+	if (!FileSystem::isDirectory(inputFolder))
+	{
+		std::cout << "Folder \"" << inputFolder.toString() << "\" doesn't exist." << std::endl;
+		return 1;
+	}
+
+	Timer timer;
+	UINT64 startTime = timer.getMilliseconds();
+
+	PackFileWriter writer(alignment);
+
+	Stack<Path> todo;
+	todo.push(inputFolder);
+
+	while (!todo.empty())
+	{
+		Path folder = todo.top();
+		todo.pop();
+
+		Vector<Path> files;
+		Vector<Path> directories;
+		FileSystem::getChildren(folder, files, directories);
+
+		for (auto& file : files)
+		{
+			String uuid = file.getFilename(false);
+			if (file.getExtension() == ".asset" && isUUID(uuid))
+				writer.add(uuid, file, compress);
+		}
+
+		for (auto& directory : directories)
+			todo.push(directory);
+	}
+
+	if (!writer.write(outputPath))
+	{
+		std::cout << "Failed to write pack file \"" << outputPath.toString() << "\"." << std::endl;
+		return 1;
+	}
+
+	UINT64 elapsedMs = timer.getMilliseconds() - startTime;
+	UINT64 outputSize = FileSystem::getFileSize(outputPath);
+	std::cout << "Packed " << writer.getNumEntries() << " resources into \"" << outputPath.toString() << "\" (" 
+		<< outputSize << " bytes) in " << elapsedMs << " ms." << std::endl;
+
+	return 0;
+}
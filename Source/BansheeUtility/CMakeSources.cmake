@@ -49,6 +49,7 @@ set(BS_BANSHEEUTILITY_SRC_IMAGE
 )
 
 set(BS_BANSHEEUTILITY_SRC_GENERAL
+	"Source/BsCompression.cpp"
 	"Source/BsDynLib.cpp"
 	"Source/BsDynLibManager.cpp"
 	"Source/BsMessageHandler.cpp"
@@ -61,18 +62,21 @@ set(BS_BANSHEEUTILITY_INC_DEBUG
 	"Include/BsBitmapWriter.h"
 	"Include/BsDebug.h"
 	"Include/BsLog.h"
+	"Include/BsAsyncLogger.h"
 )
 
 set(BS_BANSHEEUTILITY_INC_FILESYSTEM
 	"Include/BsFileSystem.h"
 	"Include/BsDataStream.h"
 	"Include/BsPath.h"
+	"Include/BsPackFile.h"
 )
 
 set(BS_BANSHEEUTILITY_SRC_FILESYSTEM
 	"Source/BsDataStream.cpp"
 	"Source/BsFileSystem.cpp"
 	"Source/BsPath.cpp"
+	"Source/BsPackFile.cpp"
 )
 
 set(BS_BANSHEEUTILITY_SRC_THREADING
@@ -84,6 +88,7 @@ set(BS_BANSHEEUTILITY_SRC_THREADING
 set(BS_BANSHEEUTILITY_INC_GENERAL
 	"Include/BsAny.h"
 	"Include/BsBitwise.h"
+	"Include/BsCompression.h"
 	"Include/BsDynLib.h"
 	"Include/BsDynLibManager.h"
 	"Include/BsEvent.h"
@@ -114,6 +119,7 @@ set(BS_BANSHEEUTILITY_SRC_RTTI
 set(BS_BANSHEEUTILITY_SRC_DEBUG
 	"Source/BsBitmapWriter.cpp"
 	"Source/BsLog.cpp"
+	"Source/BsAsyncLogger.cpp"
 	"Source/BsDebug.cpp"
 )
 
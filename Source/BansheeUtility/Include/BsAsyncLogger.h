@@ -0,0 +1,109 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+#include "BsLog.h"
+
+namespace bs
+{
+	/** @addtogroup Debug
+	 *  @{
+	 */
+
+	/**
+	 * Records log messages without blocking the logging threads, and forwards them to a sink on a separate worker thread.
+	 *
+	 * Each thread that logs gets its own fixed size queue that it writes to without locking. The worker periodically
+	 * empties all queues and passes the messages to the sink in the order they were logged in. Memory use is therefore
+	 * bounded by the queue size and the number of logging threads. When a queue is full new messages are dropped, unless
+	 * the caller requests to wait for space.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_UTILITY_EXPORT AsyncLogger
+	{
+	public:
+		/** Callback that receives the logged messages. Always called from the worker thread. */
+		typedef std::function<void(const LogEntry&)> Sink;
+
+		/**
+		 * Creates the logger and starts its worker thread.
+		 *
+		 * @param[in]	sink		Callback to forward the logged messages to.
+		 * @param[in]	queueSize	Maximum number of messages waiting to be processed, per logging thread. Rounded up to
+		 *							a power of two.
+		 */
+		AsyncLogger(const Sink& sink, UINT32 queueSize = 1024);
+
+		/** Processes all queued messages and stops the worker thread. */
+		~AsyncLogger();
+
+		/**
+		 * Queues a new message.
+		 *
+		 * @param[in]	message		Text of the message.
+		 * @param[in]	channel		Channel to log the message in.
+		 * @param[in]	wait		If true and the queue of the calling thread is full, waits until space is available.
+		 *							Otherwise the message is dropped.
+		 * @return					True if the message was queued, false if it was dropped.
+		 */
+		bool log(const String& message, UINT32 channel, bool wait = false);
+
+		/** 
+		 * Blocks until all messages queued before this call have been passed to the sink. Does nothing if called from
+		 * the sink.
+		 */
+		void flush();
+
+		/** Returns the total number of messages dropped due to a full queue. */
+		UINT64 getNumDropped() const { return mNumDropped.load(std::memory_order_relaxed); }
+
+	private:
+		/** Message waiting in a queue. */
+		struct Record
+		{
+			UINT64 sequence = 0;
+			String message;
+			UINT32 channel = 0;
+		};
+
+		/** Single producer, single consumer ring buffer of messages logged by one thread. */
+		struct ThreadQueue
+		{
+			ThreadQueue(ThreadId owner, UINT32 size);
+
+			ThreadId owner;
+			Vector<Record> records;
+			std::atomic<UINT32> head; // Next record to read, written by the worker
+			std::atomic<UINT32> tail; // Next record to write, written by the owner
+			ThreadQueue* next;
+		};
+
+		/** Returns the queue owned by the calling thread, creating a new one if needed. */
+		ThreadQueue* getThreadQueue();
+
+		/** Wakes up the worker thread if it is sleeping. */
+		void wakeWorker();
+
+		/** Entry point of the worker thread. */
+		void run();
+
+		Sink mSink;
+		UINT32 mQueueSize;
+		UINT64 mId;
+
+		std::atomic<ThreadQueue*> mQueues;
+		std::atomic<UINT64> mNextSequence;
+		std::atomic<UINT64> mNumProcessed;
+		std::atomic<UINT64> mNumDropped;
+
+		std::atomic<bool> mWorkerSleeping;
+		bool mShutdown = false;
+		Mutex mMutex;
+		Signal mSignal;
+		Thread mWorker;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,50 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+
+namespace bs
+{
+	/** @addtogroup General
+	 *  @{
+	 */
+
+	/** Performs lossless compression and decompression of blocks of memory. */
+	class BS_UTILITY_EXPORT Compression
+	{
+	public:
+		/** 
+		 * Returns the maximum size of a block of memory after it has been compressed using compressLZ4(). Compression
+		 * output buffers should be at least this large.
+		 */
+		static UINT32 getMaxCompressedSizeLZ4(UINT32 size);
+
+		/**
+		 * Compresses a block of memory, outputting data in the LZ4 block format. Compression is fast and focused on
+		 * decompression speed rather than compression ratio.
+		 *
+		 * @param[in]	input			Data to compress.
+		 * @param[in]	inputSize		Size of @p input in bytes.
+		 * @param[out]	output			Buffer to write the compressed data to.
+		 * @param[in]	outputSize		Size of the @p output buffer in bytes. Must be at least as large as the size
+		 *								returned by getMaxCompressedSizeLZ4().
+		 * @return						Number of bytes written to @p output, or 0 if the output buffer is too small.
+		 */
+		static UINT32 compressLZ4(const UINT8* input, UINT32 inputSize, UINT8* output, UINT32 outputSize);
+
+		/**
+		 * Decompresses a block of memory in LZ4 block format, as output by compressLZ4(). 
+		 *
+		 * @param[in]	input			Compressed data.
+		 * @param[in]	inputSize		Size of @p input in bytes.
+		 * @param[out]	output			Buffer to write the decompressed data to.
+		 * @param[in]	outputSize		Exact size of the data once decompressed.
+		 * @return						True if decompression succeeded, or false if the compressed data is corrupt or
+		 *								doesn't decompress to exactly @p outputSize bytes.
+		 */
+		static bool decompressLZ4(const UINT8* input, UINT32 inputSize, UINT8* output, UINT32 outputSize);
+	};
+
+	/** @} */
+}
@@ -139,6 +139,16 @@ namespace bs
 		 */
 		virtual SPtr<DataStream> clone(bool copyData = true) const = 0;
 
+		/**
+		 * Retrieves the file the stream reads its data from, and the offset in that file at which the stream's data
+		 * starts. Allows the data to be read again later without keeping the stream open.
+		 *
+		 * @param[out]	path	Path of the file the data is read from.
+		 * @param[out]	offset	Offset in bytes, relative to the start of the file, at which position 0 of the stream is.
+		 * @return				False if the stream doesn't read its data directly from a file.
+		 */
+		virtual bool getSourceFile(Path& path, size_t& offset) const { return false; }
+
         /** Close the stream. This makes further operations invalid. */
         virtual void close() = 0;
 		
@@ -260,6 +270,9 @@ namespace bs
 		/** @copydoc DataStream::clone */
 		SPtr<DataStream> clone(bool copyData = true) const override;
 
+		/** @copydoc DataStream::getSourceFile */
+		bool getSourceFile(Path& path, size_t& offset) const override;
+
         /** @copydoc DataStream::close */
 		void close() override;
 
@@ -8,6 +8,7 @@
 namespace bs
 {
 	class Log;
+	class AsyncLogger;
 
 	/** @addtogroup Debug
 	 *  @{
@@ -28,6 +29,7 @@ namespace bs
 	{
 	public:
 		Debug() {}
+		~Debug();
 
 		/** Adds a log entry in the "Debug" channel. */
 		void logDebug(const String& msg);
@@ -48,12 +50,34 @@ namespace bs
 		void writeAsBMP(UINT8* rawPixels, UINT32 bytesPerPixel, UINT32 width, UINT32 height, const Path& filePath, bool overwrite = true) const;
 
 		/**
-		 * Saves a log about the current state of the application to the specified location.
+		 * Saves a log about the current state of the application to the specified location. Waits until all messages
+		 * logged so far are recorded in the log first.
 		 * 
 		 * @param	path	Absolute path to the log filename.
 		 */
 		void saveLog(const Path& path) const;
 
+		/**
+		 * Switches to asynchronous logging. Messages are queued on the logging thread without taking any locks, and are
+		 * recorded in the log, printed to the console and written to the log file on a separate thread. If a thread logs
+		 * too many messages at once debug and warning messages get dropped, while errors wait until they can be queued.
+		 *
+		 * @param[in]	logFile		Optional path to a text file to write all logged messages to.
+		 *
+		 * @note	Must not be called while other threads are logging.
+		 */
+		void startAsyncLogging(const Path& logFile = Path::BLANK);
+
+		/**
+		 * Records all queued messages and switches back to synchronous logging.
+		 *
+		 * @note	Must not be called while other threads are logging.
+		 */
+		void stopAsyncLogging();
+
+		/** Blocks until all messages logged so far are recorded in the log. Only relevant for asynchronous logging. */
+		void flushLog();
+
 		/**
 		 * Triggered when a new entry in the log is added.
 		 * 			
@@ -84,6 +108,9 @@ namespace bs
 	private:
 		UINT64 mLogHash = 0;
 		Log mLog;
+
+		AsyncLogger* mAsyncLogger = nullptr;
+		SPtr<DataStream> mLogFile;
 	};
 
 	/** A simpler way of accessing the Debug module. */
@@ -46,6 +46,9 @@ namespace bs
 	public:
 		FileDecoder(const Path& fileLocation);
 
+		/** Decodes objects from the provided stream, starting at its current position. */
+		FileDecoder(const SPtr<DataStream>& stream);
+
 		/**	
 		 * Deserializes an IReflectable object by reading the binary data at the provided file location. 
 		 *
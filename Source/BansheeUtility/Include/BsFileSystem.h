@@ -66,6 +66,18 @@ namespace bs
 		 */
 		static void copy(const Path& oldPath, const Path& newPath, bool overwriteExisting = true);
 
+		/**
+		 * Makes the file at the new path refer to the same data as the file at the old path by creating a hard link. If
+		 * a link cannot be created (for example if the paths are on different volumes) the file is copied instead. Only
+		 * works on files. Note that modifying the contents of a linked file modifies the contents of all its links.
+		 *
+		 * @param[in]	oldPath			 	Full path to the existing file.
+		 * @param[in]	newPath			 	Full path to the new file.
+		 * @param[in]	overwriteExisting	(optional) If true, any existing file at the new location will be
+		 *									overwritten, otherwise a warning is logged if a file already exists.
+		 */
+		static void link(const Path& oldPath, const Path& newPath, bool overwriteExisting = true);
+
 		/**
 		 * Creates a folder at the specified path.
 		 *
@@ -134,6 +146,8 @@ namespace bs
 	private:
 		/** Copy a single file. Internal function used by copy(). */
 		static void copyFile(const Path& oldPath, const Path& newPath);
+		/** Create a hard link to a single file. Returns false if the link couldn't be created. Internal function used by link(). */
+		static bool linkFile(const Path& oldPath, const Path& newPath);
 		/** Remove a single file. Internal function used by remove(). */
 		static void removeFile(const Path& path);
 		/** Move a single file. Internal function used by move(). */
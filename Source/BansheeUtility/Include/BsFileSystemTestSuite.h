@@ -32,6 +32,7 @@ namespace bs
 		void testCopy_recursive();
 		void testCopy_overwrite_existing();
 		void testCopy_no_overwrite_existing();
+		void testLink();
 		void testGetChildren();
 		void testGetLastModifiedTime();
 		void testGetTempDirectoryPath();
@@ -68,6 +68,8 @@ namespace bs
 	class DataStream;
 	class MemoryDataStream;
 	class FileDataStream;
+	class PackDataStream;
+	class PackFile;
 	class MeshData;
 	class FileSystem;
 	class Timer;
@@ -0,0 +1,167 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+#include "BsDataStream.h"
+
+namespace bs
+{
+	/** @addtogroup Filesystem
+	 *  @{
+	 */
+
+	/** 
+	 * Data stream that reads a sub-range of another data stream. Multiple pack data streams can share the same source 
+	 * stream, in which case access to the source stream is synchronized through a shared mutex.
+	 */
+	class BS_UTILITY_EXPORT PackDataStream : public DataStream
+	{
+	public:
+		/**
+		 * Constructs a new pack data stream.
+		 *
+		 * @param[in]	source		Stream containing the data to read.
+		 * @param[in]	mutex		Mutex to lock whenever reading from @p source.
+		 * @param[in]	offset		Offset in bytes at which the readable range starts, relative to the start of @p source.
+		 * @param[in]	size		Size of the readable range in bytes.
+		 */
+		PackDataStream(const SPtr<DataStream>& source, const SPtr<Mutex>& mutex, size_t offset, size_t size);
+
+		bool isFile() const override { return mSource != nullptr && mSource->isFile(); }
+
+        /** @copydoc DataStream::read */
+		size_t read(void* buf, size_t count) override;
+
+        /** @copydoc DataStream::skip */
+		void skip(size_t count) override;
+	
+        /** @copydoc DataStream::seek */
+		void seek(size_t pos) override;
+
+        /** @copydoc DataStream::tell */
+		size_t tell() const override;
+
+        /** @copydoc DataStream::eof */
+		bool eof() const override;
+
+		/** @copydoc DataStream::clone */
+		SPtr<DataStream> clone(bool copyData = true) const override;
+
+		/** @copydoc DataStream::getSourceFile */
+		bool getSourceFile(Path& path, size_t& offset) const override;
+
+        /** @copydoc DataStream::close */
+		void close() override;
+
+	private:
+		SPtr<DataStream> mSource;
+		SPtr<Mutex> mMutex;
+		size_t mOffset;
+		size_t mPos;
+	};
+
+	/**
+	 * Archive containing a set of files packed into a single file, each identified by a unique string (normally a 
+	 * resource UUID). Allows the packed files to be opened without the overhead of opening a separate file for each.
+	 *
+	 * The archive starts with a header, followed by the data for each packed file aligned to a specified boundary. Data of
+	 * each file may optionally be LZ4 compressed. The data is followed by an index of all packed files sorted by their
+	 * identifier, and a footer pointing to the index.
+	 *
+	 * @note	Thread safe. Once opened the pack file is immutable and its entries may be opened from any thread.
+	 */
+	class BS_UTILITY_EXPORT PackFile
+	{
+		/** Information about a single file stored in the pack file. */
+		struct Entry
+		{
+			String id;
+			UINT32 flags;
+			UINT64 offset;
+			UINT64 packedSize;
+			UINT64 size;
+		};
+
+	public:
+		/** Opens a pack file at the specified location. Returns null if the file cannot be opened or is not a pack file. */
+		static SPtr<PackFile> open(const Path& path);
+
+		/** Checks does the pack contain a file with the specified identifier. */
+		bool contains(const String& id) const;
+
+		/** 
+		 * Opens a stream that allows you to read the contents of the file with the specified identifier. Returns null if
+		 * the pack doesn't contain the file. Compressed files are decompressed into memory when opened, while 
+		 * uncompressed ones are read directly from the pack file.
+		 */
+		SPtr<DataStream> openEntry(const String& id) const;
+
+		/** Returns the number of files stored in the pack. */
+		UINT32 getNumEntries() const { return (UINT32)mEntries.size(); }
+
+		/** Returns the location the pack file was opened from. */
+		const Path& getPath() const { return mPath; }
+
+		static const UINT32 MAGIC;
+		static const UINT32 VERSION;
+
+		/** Flag set on entries whose data is LZ4 compressed. */
+		static const UINT32 ENTRY_COMPRESSED;
+
+	private:
+		friend class PackFileWriter;
+
+		PackFile() { }
+
+		/** Finds an entry with the specified identifier, or returns null if one cannot be found. */
+		const Entry* findEntry(const String& id) const;
+
+		Path mPath;
+		SPtr<DataStream> mStream;
+		SPtr<Mutex> mMutex;
+		Vector<Entry> mEntries;
+	};
+
+	/** Creates new pack files. See PackFile for information about the format. */
+	class BS_UTILITY_EXPORT PackFileWriter
+	{
+		/** Information about a file to be added to the pack. */
+		struct PendingEntry
+		{
+			Path path;
+			bool compress;
+		};
+
+	public:
+		/** 
+		 * Constructs a new writer.
+		 *
+		 * @param[in]	alignment	Boundary in bytes to align each packed file to. Must be a power of two.
+		 */
+		PackFileWriter(UINT32 alignment = 16);
+
+		/**
+		 * Queues a file to be added to the pack. If a file with the same identifier was already added it will be 
+		 * replaced.
+		 *
+		 * @param[in]	id			Unique identifier used for retrieving the file from the pack.
+		 * @param[in]	path		Location of the file on the disk.
+		 * @param[in]	compress	If true the file will be stored LZ4 compressed. Compression is skipped if it doesn't
+		 *							noticeably reduce the size of the file.
+		 */
+		void add(const String& id, const Path& path, bool compress = false);
+
+		/** Returns the number of files queued for packing. */
+		UINT32 getNumEntries() const { return (UINT32)mEntries.size(); }
+
+		/** Writes all the queued files into a pack file at the specified location. Returns true on success. */
+		bool write(const Path& path);
+
+	private:
+		UINT32 mAlignment;
+		Map<String, PendingEntry> mEntries;
+	};
+
+	/** @} */
+}
@@ -20,10 +20,9 @@ namespace bs
 	class SpinLock
 	{
 	public:
-		SpinLock()
-		{
-			mLock.clear(std::memory_order_relaxed);
-		}
+		constexpr SpinLock()
+			:mLock ATOMIC_FLAG_INIT
+		{ }
 
 		/** Lock any following operations with the spin lock, not allowing any other thread to access them. */
 		void lock()
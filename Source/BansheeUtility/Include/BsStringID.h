@@ -11,6 +11,8 @@ namespace bs
 	 *  @{
 	 */
 
+	struct StringIDLiteral;
+
 	/**
 	 * A string identifier that provides very fast comparisons to other string identifiers. Significantly faster than
 	 * comparing raw strings.
@@ -19,7 +21,8 @@ namespace bs
 	 * Essentially a unique ID is generated for each string and then the ID is used for comparisons as if you were using 
 	 * an integer or an enum.
 	 * @note
-	 * Thread safe.
+	 * Thread safe. Looking up an already registered string doesn't take a lock. The string table requires no dynamic
+	 * initialization, so string identifiers may be safely constructed during static initialization.
 	 */
 	class BS_UTILITY_EXPORT StringID
 	{
@@ -28,52 +31,42 @@ namespace bs
 		static const int ELEMENTS_PER_CHUNK = 256;
 		static const int STRING_SIZE = 256;
 
-		/** Helper class that performs string actions on both null terminated character arrays and standard strings. */
-		template<class T>
-		class StringIDUtil
-		{
-		public:
-			static UINT32 size(T const& input) { return 0; }
-			static void copy(T const& input, char* dest) { }
-			static bool compare(T const& a, char* b) { return 0; }
-		};
-
 		/**	Internal data that is shared by all instances for a specific string. */
 		struct InternalData
 		{
 			UINT32 id;
-			InternalData* next;
+			UINT32 hash;
+			std::atomic<InternalData*> next;
 			char chars[STRING_SIZE];
 		};
 
-		/**	Performs initialization of static members as soon as the library is loaded. */
-		struct InitStatics
-		{
-			InitStatics();
-		};
-
 	public:
-		StringID();
+		constexpr StringID()
+			:mData(nullptr)
+		{ }
 
 		StringID(const char* name)
 			:mData(nullptr)
 		{
-			construct(name);
+			construct(name, (UINT32)strlen(name));
 		}
 
 		StringID(const String& name)
 			:mData(nullptr)
 		{
-			construct(name);
+			construct(name.c_str(), (UINT32)name.length());
 		}
 
 		template<int N>
 		StringID(const char name[N])
 			:mData(nullptr)
 		{
-			construct((const char*)name);
+			construct((const char*)name, (UINT32)strlen(name));
 		}
 
+		/** Constructs a string identifier from a literal whose hash was calculated at compile time. */
+		StringID(const StringIDLiteral& literal);
+
 		/**	Compare to string ids for equality. Uses fast integer comparison. */
 		bool operator== (const StringID& rhs) const
 		{
@@ -101,16 +94,42 @@ namespace bs
 			return mData->chars;
 		}
 
+		/**
+		 * Returns a unique integer identifier of the string. Identifiers are assigned sequentially starting at zero, and
+		 * remain the same for the lifetime of the application. Returns -1 if the string id has no value assigned.
+		 */
+		UINT32 id() const
+		{
+			if (mData == nullptr)
+				return (UINT32)-1;
+
+			return mData->id;
+		}
+
+		/** Calculates a hash value for a string of the provided length. Can be evaluated at compile time. */
+		static constexpr UINT32 calcHash(const char* input, UINT32 length)
+		{
+			UINT32 hash = 0;
+			for (UINT32 i = 0; i < length; i++)
+				hash = hash * 101 + (UINT32)input[i];
+
+			return hash;
+		}
+
 		static const StringID NONE;
 
 	private:
-		/**Constructs a StringID object in a way that works for pointers to character arrays and standard strings. */
-		template<class T>
-		void construct(T const& name);
+		/** Finds the entry for the provided string, or registers a new one if the string wasn't used before. */
+		void construct(const char* name, UINT32 length)
+		{
+			construct(name, length, calcHash(name, length));
+		}
+
+		/** @copydoc construct(const char*, UINT32) */
+		void construct(const char* name, UINT32 length, UINT32 hash);
 
-		/**	Calculates a hash value for the provided null-terminated string. */
-		template<class T>
-		UINT32 calcHash(T const& input);
+		/** Searches the bucket for an entry matching the provided string. Returns null if not found. */
+		static InternalData* find(InternalData* entry, const char* name, UINT32 length, UINT32 hash);
 
 		/**
 		 * Allocates a new string entry and assigns it a unique ID. Optionally expands the chunks buffer if the new entry 
@@ -120,8 +139,9 @@ namespace bs
 
 		InternalData* mData;
 
-		static volatile InitStatics mInitStatics;
-		static InternalData* mStringHashTable[HASH_TABLE_SIZE];
+		// Zero initialized and written only while holding mSync. Entries are published with release semantics so they
+		// can be read without locking.
+		static std::atomic<InternalData*> mStringHashTable[HASH_TABLE_SIZE];
 		static InternalData* mChunks[MAX_CHUNK_COUNT];
 
 		static UINT32 mNextId;
@@ -129,6 +149,33 @@ namespace bs
 		static SpinLock mSync;
 	};
 
+	/**
+	 * Name and hash of a string identifier, calculated at compile time. Created using the _sid literal, e.g. 
+	 * "Skinned"_sid. The name is registered on first conversion to StringID, without the need to hash it again.
+	 */
+	struct StringIDLiteral
+	{
+		constexpr StringIDLiteral(const char* name, UINT32 length)
+			:name(name), length(length), hash(StringID::calcHash(name, length))
+		{ }
+
+		const char* name;
+		UINT32 length;
+		UINT32 hash;
+	};
+
+	inline StringID::StringID(const StringIDLiteral& literal)
+		:mData(nullptr)
+	{
+		construct(literal.name, literal.length, literal.hash);
+	}
+
+	/** Creates a string identifier literal whose hash is calculated at compile time. */
+	constexpr StringIDLiteral operator"" _sid(const char* name, size_t length)
+	{
+		return StringIDLiteral(name, (UINT32)length);
+	}
+
 	/** @cond SPECIALIZATIONS */
 
 	template<> struct RTTIPlainType <StringID>
@@ -108,6 +108,31 @@ namespace bs
 
 		/** Returns the maximum available worker threads (maximum number of tasks that can be executed simultaneously). */
 		UINT32 getNumWorkers() const { return mMaxActiveTasks; }
+
+		/**
+		 * Splits a range of elements into contiguous chunks of roughly equal size and executes the provided function for
+		 * each chunk. Chunks other than the first are executed as tasks on worker threads, while the calling thread 
+		 * processes the first chunk and then blocks until the rest are done. If the task scheduler isn't running or there 
+		 * isn't enough work, all elements are processed as a single chunk on the calling thread.
+		 *
+		 * @param[in]	name		Name of the tasks executing the chunks.
+		 * @param[in]	count		Number of elements to process.
+		 * @param[in]	minPerChunk	Minimum number of elements in a chunk, below which it's not worth splitting the work.
+		 * @param[in]	func		Function that processes a single chunk. Receives the index of the chunk, the first 
+		 *							element in the chunk and the element after the last one. Must be safe to execute from
+		 *							multiple threads at once.
+		 * @param[in]	maxChunks	Maximum number of chunks to split the work into. If zero the number of hardware threads
+		 *							is used.
+		 * @return					Number of chunks the work was split into, as returned by getNumParallelChunks().
+		 */
+		static UINT32 parallelFor(const String& name, UINT32 count, UINT32 minPerChunk, 
+			const std::function<void(UINT32, UINT32, UINT32)>& func, UINT32 maxChunks = 0);
+
+		/** 
+		 * Returns the number of chunks parallelFor() will split the work into, for the same parameters. Useful when 
+		 * resources need to be prepared for each chunk ahead of time. Returns zero if @p count is zero.
+		 */
+		static UINT32 getNumParallelChunks(UINT32 count, UINT32 minPerChunk, UINT32 maxChunks = 0);
 	protected:
 		friend class Task;
 
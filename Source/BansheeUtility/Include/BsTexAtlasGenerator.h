@@ -37,7 +37,20 @@ namespace bs
 		UINT32 width, height;
 	};
 
+	/** Algorithms that can be used for packing elements into texture atlas pages. */
+	enum class TexAtlasPackMethod
+	{
+		/** Splits the free space of a page in two with each inserted element. Fast, but leaves more empty space. */
+		BinaryTree,
+		/**
+		 * Keeps track of all maximal free rectangles in a page, and places each element in the one that leaves the least
+		 * space along its shorter side (MaxRects, best short side fit). Produces denser pages.
+		 */
+		MaxRects
+	};
+
 	class TexAtlasNode;
+	class TexAtlasMaxRectsPage;
 
 	/** Organizes a set of textures into a single larger texture (an atlas) by minimizing empty space. */
 	class BS_UTILITY_EXPORT TexAtlasGenerator
@@ -53,8 +66,10 @@ namespace bs
 		 * @param[in]	fixedSize   	(optional) If this field is false, algorithm will try to reduce the size of the texture
 		 * 								if possible. If it is true, the algorithm will always produce textures of the specified
 		 * 								@p maxTexWidth, @p maxTexHeight size.
+		 * @param[in]	method			(optional) Algorithm to use for packing the elements.
 		 */
-		TexAtlasGenerator(bool square = false, UINT32 maxTexWidth = 2048, UINT32 maxTexHeight = 2048, bool fixedSize = false);
+		TexAtlasGenerator(bool square = false, UINT32 maxTexWidth = 2048, UINT32 maxTexHeight = 2048, bool fixedSize = false,
+			TexAtlasPackMethod method = TexAtlasPackMethod::MaxRects);
 
 		/**
 		 * Creates an optimal texture layout by packing texture elements in order to end up with as little empty space 
@@ -76,6 +91,7 @@ namespace bs
 		bool mFixedSize;
 		UINT32 mMaxTexWidth;
 		UINT32 mMaxTexHeight;
+		TexAtlasPackMethod mMethod;
 
 		/**
 		 * Organize all of the provide elements and place them into minimum number of pages with the specified width and height.
@@ -85,9 +101,26 @@ namespace bs
 		 * 			
 		 * Using @p startPage parameter you may add an offset to the generated page indexes.
 		 *
-		 * @return	Number of pages generated.
+		 * @return	Number of pages generated, or -1 if the elements don't fit in @p maxPages pages.
+		 */
+		int generatePagesForSize(Vector<TexAtlasElementDesc>& elements, UINT32 width, UINT32 height, UINT32 startPage = 0,
+			UINT32 maxPages = std::numeric_limits<UINT32>::max()) const;
+
+		/** Version of generatePagesForSize() using the TexAtlasPackMethod::MaxRects algorithm. */
+		int generatePagesMaxRects(Vector<TexAtlasElementDesc>& elements, UINT32 width, UINT32 height, UINT32 startPage,
+			UINT32 maxPages) const;
+
+		/**
+		 * Attempts to repack the elements on the last page into a smaller page. Candidate sizes are packed in parallel
+		 * if the task scheduler is running.
+		 *
+		 * @param[in, out]	elements	All elements of the atlas. Elements on the last page are moved if a smaller
+		 *								page is found.
+		 * @param[in]		lastPageIdx	Index of the last page.
+		 * @param[in, out]	width		Width of the last page. Updated to the reduced width.
+		 * @param[in, out]	height		Height of the last page. Updated to the reduced height.
 		 */
-		int generatePagesForSize(Vector<TexAtlasElementDesc>& elements, UINT32 width, UINT32 height, UINT32 startPage = 0) const;
+		void shrinkLastPage(Vector<TexAtlasElementDesc>& elements, INT32 lastPageIdx, UINT32& width, UINT32& height) const;
 
 		/**
 		 * Finds the largest element without a page that fits within the provided node.
@@ -107,5 +140,50 @@ namespace bs
 		void sortBySize(Vector<TexAtlasElementDesc>& elements) const;
 	};
 
+	/**
+	 * Texture atlas layout that can be extended with new elements after it was created. Elements are never moved once
+	 * inserted, so the layout can be used for atlases that are filled in at runtime, like glyph caches. All pages are of
+	 * the same size. Elements are placed using the TexAtlasPackMethod::MaxRects algorithm.
+	 */
+	class BS_UTILITY_EXPORT DynamicTexAtlasLayout
+	{
+	public:
+		DynamicTexAtlasLayout(UINT32 pageWidth = 2048, UINT32 pageHeight = 2048);
+		~DynamicTexAtlasLayout();
+
+		/**
+		 * Finds a place for the element in one of the existing pages. If none of them has enough space a new page is
+		 * added.
+		 *
+		 * @param[in, out]	element			Element to insert. Input needs to be filled in, and output will be filled in
+		 *									when the method returns.
+		 * @param[in]		allowNewPage	If false, the method fails instead of adding a new page.
+		 * @return							True if the element was inserted. Elements larger than the page size can never
+		 *									be inserted. Elements with no area are always inserted, but aren't assigned
+		 *									a page.
+		 */
+		bool insert(TexAtlasElementDesc& element, bool allowNewPage = true);
+
+		/** Returns the number of pages currently in the layout. */
+		UINT32 getNumPages() const { return (UINT32)mPages.size(); }
+
+		/** Returns the size of a single page. */
+		TexAtlasPageDesc getPageDesc() const { return { mPageWidth, mPageHeight }; }
+
+		/** Returns the portion of the page area covered by elements, in range [0, 1]. */
+		float getOccupancy(UINT32 page) const;
+
+		/** Removes all pages from the layout. */
+		void clear();
+
+	private:
+		DynamicTexAtlasLayout(const DynamicTexAtlasLayout&) = delete;
+		DynamicTexAtlasLayout& operator=(const DynamicTexAtlasLayout&) = delete;
+
+		UINT32 mPageWidth;
+		UINT32 mPageHeight;
+		Vector<TexAtlasMaxRectsPage*> mPages;
+	};
+
 	/** @} */
 }
\ No newline at end of file
@@ -26,6 +26,35 @@ namespace bs
 	/**	Generates an MD5 hash string for the provided source string. */
 	String BS_UTILITY_EXPORT md5(const String& source);
 
+	/**
+	 * Incrementally computes a 64-bit xxHash (XXH64) of a stream of bytes. Much faster than cryptographic hashes and
+	 * suitable for detecting content changes in large files, but not for security purposes.
+	 */
+	class BS_UTILITY_EXPORT XXHash64
+	{
+	public:
+		XXHash64(UINT64 seed = 0);
+
+		/** Appends @p length bytes from @p data to the hashed stream. */
+		void update(const void* data, size_t length);
+
+		/** Returns the hash of all the data provided so far. Doesn't modify the state so more data can be appended. */
+		UINT64 digest() const;
+
+	private:
+		UINT64 mSeed;
+		UINT64 mAcc[4];
+		UINT8 mBuffer[32];
+		UINT32 mBufferSize;
+		UINT64 mTotalLength;
+	};
+
+	/** Generates a 64-bit xxHash (XXH64) of the provided block of memory. */
+	UINT64 BS_UTILITY_EXPORT xxHash64(const void* data, size_t length, UINT64 seed = 0);
+
+	/** Generates a 64-bit xxHash (XXH64) of all the remaining data in the provided stream. */
+	UINT64 BS_UTILITY_EXPORT xxHash64(const SPtr<DataStream>& stream, UINT64 seed = 0);
+
 	/** Sets contents of a struct to zero. */
 	template<class T>
 	void bs_zero_out(T& s)
@@ -0,0 +1,196 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsAsyncLogger.h"
+#include "BsDebug.h"
+#include "BsBitwise.h"
+
+namespace bs
+{
+	/** Maximum time the worker thread sleeps for before checking the queues, in milliseconds. */
+	static const UINT32 WORKER_SLEEP_MS = 5;
+
+	/** Most recently used queue of the calling thread, to avoid searching for it on every message. */
+	static BS_THREADLOCAL UINT64 sCachedLoggerId = 0;
+	static BS_THREADLOCAL void* sCachedQueue = nullptr;
+	static std::atomic<UINT64> sNextLoggerId(1);
+
+	AsyncLogger::ThreadQueue::ThreadQueue(ThreadId owner, UINT32 size)
+		:owner(owner), records(size), head(0), tail(0), next(nullptr)
+	{ }
+
+	AsyncLogger::AsyncLogger(const Sink& sink, UINT32 queueSize)
+		:mSink(sink), mQueueSize(Bitwise::firstPO2From(std::max(queueSize, 2U))), mId(sNextLoggerId++),
+		mQueues(nullptr), mNextSequence(0), mNumProcessed(0), mNumDropped(0), mWorkerSleeping(false)
+	{
+		mWorker = Thread(std::bind(&AsyncLogger::run, this));
+	}
+
+	AsyncLogger::~AsyncLogger()
+	{
+		{
+			Lock lock(mMutex);
+			mShutdown = true;
+		}
+
+		mSignal.notify_one();
+		mWorker.join();
+
+		ThreadQueue* queue = mQueues.load(std::memory_order_acquire);
+		while (queue != nullptr)
+		{
+			ThreadQueue* next = queue->next;
+			bs_delete(queue);
+
+			queue = next;
+		}
+	}
+
+	bool AsyncLogger::log(const String& message, UINT32 channel, bool wait)
+	{
+		ThreadQueue* queue = getThreadQueue();
+
+		UINT32 tail = queue->tail.load(std::memory_order_relaxed);
+		while (tail - queue->head.load(std::memory_order_acquire) >= mQueueSize)
+		{
+			if (!wait)
+			{
+				mNumDropped.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+
+			wakeWorker();
+			std::this_thread::yield();
+		}
+
+		Record& record = queue->records[tail & (mQueueSize - 1)];
+		record.message = message;
+		record.channel = channel;
+		record.sequence = mNextSequence.fetch_add(1, std::memory_order_relaxed);
+
+		queue->tail.store(tail + 1, std::memory_order_release);
+
+		if (mWorkerSleeping.load(std::memory_order_relaxed))
+			wakeWorker();
+
+		return true;
+	}
+
+	void AsyncLogger::flush()
+	{
+		// The worker would wait for itself, for example when the sink crashes and the crash handler flushes the log
+		if (BS_THREAD_CURRENT_ID == mWorker.get_id())
+			return;
+
+		UINT64 target = mNextSequence.load(std::memory_order_relaxed);
+		while (mNumProcessed.load(std::memory_order_acquire) < target)
+		{
+			wakeWorker();
+			std::this_thread::yield();
+		}
+	}
+
+	AsyncLogger::ThreadQueue* AsyncLogger::getThreadQueue()
+	{
+		if (sCachedLoggerId == mId)
+			return (ThreadQueue*)sCachedQueue;
+
+		// Queues are never removed, so they can be searched without locking. A thread whose id is reused by a new thread
+		// is no longer running, so the new thread can safely take over its queue.
+		ThreadId threadId = BS_THREAD_CURRENT_ID;
+		ThreadQueue* queue = mQueues.load(std::memory_order_acquire);
+		while (queue != nullptr && queue->owner != threadId)
+			queue = queue->next;
+
+		if (queue == nullptr)
+		{
+			queue = bs_new<ThreadQueue>(threadId, mQueueSize);
+			queue->next = mQueues.load(std::memory_order_relaxed);
+
+			while (!mQueues.compare_exchange_weak(queue->next, queue, std::memory_order_release,
+				std::memory_order_relaxed))
+			{ }
+		}
+
+		sCachedLoggerId = mId;
+		sCachedQueue = queue;
+
+		return queue;
+	}
+
+	void AsyncLogger::wakeWorker()
+	{
+		mSignal.notify_one();
+	}
+
+	void AsyncLogger::run()
+	{
+		// Records taken from the queues but not yet passed to the sink
+		Vector<Record> pending;
+		UINT64 nextSequence = 0;
+		UINT64 numReportedDropped = 0;
+
+		while (true)
+		{
+			UINT32 numPending = (UINT32)pending.size();
+
+			ThreadQueue* queue = mQueues.load(std::memory_order_acquire);
+			while (queue != nullptr)
+			{
+				UINT32 head = queue->head.load(std::memory_order_relaxed);
+				UINT32 tail = queue->tail.load(std::memory_order_acquire);
+
+				for (UINT32 i = head; i != tail; i++)
+					pending.push_back(std::move(queue->records[i & (mQueueSize - 1)]));
+
+				queue->head.store(tail, std::memory_order_release);
+				queue = queue->next;
+			}
+
+			if ((UINT32)pending.size() == numPending)
+			{
+				Lock lock(mMutex);
+				if (mShutdown)
+					break;
+
+				// Messages logged after the queues were checked wake the worker up, or are picked up after the timeout
+				mWorkerSleeping.store(true, std::memory_order_relaxed);
+				mSignal.wait_for(lock, std::chrono::milliseconds(WORKER_SLEEP_MS));
+				mWorkerSleeping.store(false, std::memory_order_relaxed);
+
+				continue;
+			}
+
+			std::sort(pending.begin(), pending.end(),
+				[](const Record& a, const Record& b) { return a.sequence < b.sequence; });
+
+			// Sequence numbers are assigned before a record is added to its queue, so a record logged earlier on a 
+			// different thread might not have been added yet. Hold back records until all earlier ones have arrived.
+			UINT32 numReady = 0;
+			while (numReady < (UINT32)pending.size() && pending[numReady].sequence == nextSequence)
+			{
+				numReady++;
+				nextSequence++;
+			}
+
+			for (UINT32 i = 0; i < numReady; i++)
+				mSink(LogEntry(pending[i].message, pending[i].channel));
+
+			pending.erase(pending.begin(), pending.begin() + numReady);
+
+			UINT64 numDropped = mNumDropped.load(std::memory_order_relaxed);
+			if (numDropped != numReportedDropped)
+			{
+				mSink(LogEntry(toString(numDropped - numReportedDropped) + " log messages were dropped because the "
+					"log queue was full.", (UINT32)DebugChannel::Warning));
+
+				numReportedDropped = numDropped;
+			}
+
+			mNumProcessed.store(nextSequence, std::memory_order_release);
+		}
+
+		// Threads still logging during shutdown might never add their records, so don't wait for them
+		for (auto& record : pending)
+			mSink(LogEntry(record.message, record.channel));
+	}
+}
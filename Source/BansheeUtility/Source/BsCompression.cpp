@@ -0,0 +1,207 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsCompression.h"
+
+namespace bs
+{
+	/** Minimum length of a match, as defined by the LZ4 block format. */
+	static const UINT32 LZ4_MIN_MATCH = 4;
+
+	/** Last match must start at least this many bytes before the end of the block, as defined by the LZ4 block format. */
+	static const UINT32 LZ4_MF_LIMIT = 12;
+
+	/** Last bytes of the block must always be literals, as defined by the LZ4 block format. */
+	static const UINT32 LZ4_LAST_LITERALS = 5;
+
+	/** Maximum distance between a match and its reference. */
+	static const UINT32 LZ4_MAX_DISTANCE = 65535;
+
+	static const UINT32 LZ4_HASH_LOG = 12;
+
+	static inline UINT32 lz4Read32(const UINT8* data)
+	{
+		UINT32 value;
+		memcpy(&value, data, sizeof(value));
+		return value;
+	}
+
+	static inline UINT32 lz4Hash(UINT32 sequence)
+	{
+		return (sequence * 2654435761U) >> (32 - LZ4_HASH_LOG);
+	}
+
+	/** Writes the remainder of a length that didn't fit in a token, and returns the new output position. */
+	static inline UINT8* lz4WriteLength(UINT8* output, UINT32 length)
+	{
+		while (length >= 255)
+		{
+			*output++ = 255;
+			length -= 255;
+		}
+
+		*output++ = (UINT8)length;
+		return output;
+	}
+
+	/** Reads the remainder of a length that didn't fit in a token. Returns false if the input ends prematurely. */
+	static inline bool lz4ReadLength(const UINT8*& input, const UINT8* inputEnd, UINT32& length)
+	{
+		UINT8 value;
+		do
+		{
+			if (input >= inputEnd)
+				return false;
+
+			value = *input++;
+			length += value;
+		} while (value == 255);
+
+		return true;
+	}
+
+	UINT32 Compression::getMaxCompressedSizeLZ4(UINT32 size)
+	{
+		return size + size / 255 + 16;
+	}
+
+	UINT32 Compression::compressLZ4(const UINT8* input, UINT32 inputSize, UINT8* output, UINT32 outputSize)
+	{
+		if (outputSize < getMaxCompressedSizeLZ4(inputSize))
+			return 0;
+
+		const UINT8* inputPos = input;
+		const UINT8* inputEnd = input + inputSize;
+		const UINT8* anchor = input;
+		UINT8* outputPos = output;
+
+		if (inputSize > LZ4_MF_LIMIT)
+		{
+			// Offsets of the last occurrence of a four byte sequence with the given hash
+			UINT32 hashTable[1 << LZ4_HASH_LOG];
+			memset(hashTable, 0, sizeof(hashTable));
+
+			const UINT8* matchSearchEnd = inputEnd - LZ4_MF_LIMIT;
+			const UINT8* matchEnd = inputEnd - LZ4_LAST_LITERALS;
+
+			while (inputPos < matchSearchEnd)
+			{
+				UINT32 sequence = lz4Read32(inputPos);
+				UINT32 hash = lz4Hash(sequence);
+
+				const UINT8* reference = input + hashTable[hash];
+				hashTable[hash] = (UINT32)(inputPos - input);
+
+				if (reference >= inputPos || (UINT32)(inputPos - reference) > LZ4_MAX_DISTANCE || 
+					lz4Read32(reference) != sequence)
+				{
+					inputPos++;
+					continue;
+				}
+
+				UINT32 matchLength = LZ4_MIN_MATCH;
+				while (inputPos + matchLength < matchEnd && inputPos[matchLength] == reference[matchLength])
+					matchLength++;
+
+				// Token, followed by literals, match offset and match length
+				UINT32 numLiterals = (UINT32)(inputPos - anchor);
+				UINT8* token = outputPos++;
+
+				if (numLiterals >= 15)
+				{
+					*token = 15 << 4;
+					outputPos = lz4WriteLength(outputPos, numLiterals - 15);
+				}
+				else
+					*token = (UINT8)(numLiterals << 4);
+
+				memcpy(outputPos, anchor, numLiterals);
+				outputPos += numLiterals;
+
+				UINT32 offset = (UINT32)(inputPos - reference);
+				*outputPos++ = (UINT8)(offset & 0xFF);
+				*outputPos++ = (UINT8)(offset >> 8);
+
+				UINT32 encodedMatchLength = matchLength - LZ4_MIN_MATCH;
+				if (encodedMatchLength >= 15)
+				{
+					*token |= 15;
+					outputPos = lz4WriteLength(outputPos, encodedMatchLength - 15);
+				}
+				else
+					*token |= (UINT8)encodedMatchLength;
+
+				inputPos += matchLength;
+				anchor = inputPos;
+			}
+		}
+
+		// Last sequence contains only literals
+		UINT32 numLiterals = (UINT32)(inputEnd - anchor);
+		if (numLiterals >= 15)
+		{
+			*outputPos++ = 15 << 4;
+			outputPos = lz4WriteLength(outputPos, numLiterals - 15);
+		}
+		else
+			*outputPos++ = (UINT8)(numLiterals << 4);
+
+		memcpy(outputPos, anchor, numLiterals);
+		outputPos += numLiterals;
+
+		return (UINT32)(outputPos - output);
+	}
+
+	bool Compression::decompressLZ4(const UINT8* input, UINT32 inputSize, UINT8* output, UINT32 outputSize)
+	{
+		const UINT8* inputPos = input;
+		const UINT8* inputEnd = input + inputSize;
+		UINT8* outputPos = output;
+		UINT8* outputEnd = output + outputSize;
+
+		while (inputPos < inputEnd)
+		{
+			UINT8 token = *inputPos++;
+
+			UINT32 numLiterals = token >> 4;
+			if (numLiterals == 15 && !lz4ReadLength(inputPos, inputEnd, numLiterals))
+				return false;
+
+			if (numLiterals > (UINT32)(inputEnd - inputPos) || numLiterals > (UINT32)(outputEnd - outputPos))
+				return false;
+
+			memcpy(outputPos, inputPos, numLiterals);
+			inputPos += numLiterals;
+			outputPos += numLiterals;
+
+			// Last sequence has no match
+			if (inputPos == inputEnd)
+				break;
+
+			if (inputEnd - inputPos < 2)
+				return false;
+
+			UINT32 offset = inputPos[0] | (inputPos[1] << 8);
+			inputPos += 2;
+
+			if (offset == 0 || offset > (UINT32)(outputPos - output))
+				return false;
+
+			UINT32 matchLength = token & 15;
+			if (matchLength == 15 && !lz4ReadLength(inputPos, inputEnd, matchLength))
+				return false;
+
+			matchLength += LZ4_MIN_MATCH;
+			if (matchLength > (UINT32)(outputEnd - outputPos))
+				return false;
+
+			// Match may overlap the output, so copy byte by byte
+			const UINT8* matchPos = outputPos - offset;
+			for (UINT32 i = 0; i < matchLength; i++)
+				outputPos[i] = matchPos[i];
+
+			outputPos += matchLength;
+		}
+
+		return outputPos == outputEnd;
+	}
+}
@@ -41,6 +41,9 @@ namespace bs
 		errorMessage << stackTrace;
 
 		gDebug().logError(errorMessage.str());
+
+		// The application might terminate right after, so make sure the error reaches the console and the log file
+		gDebug().flushLog();
 	}
 
 	void CrashHandler::logErrorAndStackTrace(const String& type,
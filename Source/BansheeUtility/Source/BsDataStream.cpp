@@ -354,7 +354,14 @@ namespace bs
 		if (!copyData)
 			return bs_shared_ptr_new<MemoryDataStream>(mData, mSize, false);
 		
-		return bs_shared_ptr_new<MemoryDataStream>(*this);
+		// Note: Not using the copy constructor, as that would make both streams own (and free) the same buffer
+		UINT8* data = (UINT8*)bs_alloc((UINT32)mSize);
+		memcpy(data, mData, mSize);
+
+		SPtr<MemoryDataStream> stream = bs_shared_ptr_new<MemoryDataStream>(data, mSize, true);
+		stream->seek(tell());
+
+		return stream;
 	}
 
     void MemoryDataStream::close()    
@@ -456,6 +463,14 @@ namespace bs
 		return bs_shared_ptr_new<FileDataStream>(mPath, (AccessMode)getAccessMode(), true);
 	}
 
+	bool FileDataStream::getSourceFile(Path& path, size_t& offset) const
+	{
+		path = mPath;
+		offset = 0;
+
+		return true;
+	}
+
     void FileDataStream::close()
     {
         if (mInStream)
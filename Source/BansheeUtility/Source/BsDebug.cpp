@@ -6,6 +6,7 @@
 #include "BsBitmapWriter.h"
 #include "BsFileSystem.h"
 #include "BsDataStream.h"
+#include "BsAsyncLogger.h"
 
 #if BS_PLATFORM == BS_PLATFORM_WIN32 && BS_COMPILER == BS_COMPILER_MSVC
 #include <windows.h>
@@ -28,30 +29,83 @@ void logToIDEConsole(const bs::String& message)
 
 namespace bs
 {
+	Debug::~Debug()
+	{
+		stopAsyncLogging();
+	}
+
 	void Debug::logDebug(const String& msg)
 	{
-		mLog.logMsg(msg, (UINT32)DebugChannel::Debug);
-		logToIDEConsole(msg);
+		log(msg, (UINT32)DebugChannel::Debug);
 	}
 
 	void Debug::logWarning(const String& msg)
 	{
-		mLog.logMsg(msg, (UINT32)DebugChannel::Warning);
-		logToIDEConsole(msg);
+		log(msg, (UINT32)DebugChannel::Warning);
 	}
 
 	void Debug::logError(const String& msg)
 	{
-		mLog.logMsg(msg, (UINT32)DebugChannel::Error);
-		logToIDEConsole(msg);
+		log(msg, (UINT32)DebugChannel::Error);
 	}
 
 	void Debug::log(const String& msg, UINT32 channel)
 	{
+		if (mAsyncLogger != nullptr)
+		{
+			// Errors are never dropped
+			mAsyncLogger->log(msg, channel, channel == (UINT32)DebugChannel::Error);
+			return;
+		}
+
 		mLog.logMsg(msg, channel);
 		logToIDEConsole(msg);
 	}
 
+	void Debug::startAsyncLogging(const Path& logFile)
+	{
+		if (mAsyncLogger != nullptr)
+			return;
+
+		if (!logFile.isEmpty())
+			mLogFile = FileSystem::createAndOpenFile(logFile);
+
+		mAsyncLogger = bs_new<AsyncLogger>([this](const LogEntry& entry)
+		{
+			const String& msg = entry.getMessage();
+
+			mLog.logMsg(msg, entry.getChannel());
+			logToIDEConsole(msg);
+
+			if (mLogFile != nullptr)
+			{
+				mLogFile->write(msg.data(), msg.size());
+				mLogFile->write("\n", 1);
+			}
+		});
+	}
+
+	void Debug::stopAsyncLogging()
+	{
+		if (mAsyncLogger == nullptr)
+			return;
+
+		bs_delete(mAsyncLogger);
+		mAsyncLogger = nullptr;
+
+		if (mLogFile != nullptr)
+		{
+			mLogFile->close();
+			mLogFile = nullptr;
+		}
+	}
+
+	void Debug::flushLog()
+	{
+		if (mAsyncLogger != nullptr)
+			mAsyncLogger->flush();
+	}
+
 	void Debug::writeAsBMP(UINT8* rawPixels, UINT32 bytesPerPixel, UINT32 width, UINT32 height, const Path& filePath, bool overwrite) const
 	{
 		if(FileSystem::isFile(filePath))
@@ -212,6 +266,10 @@ table td
 		stream << style;
 		stream << htmlPostStyleHeader;
 
+		// Make sure messages logged asynchronously before this call are included
+		if (mAsyncLogger != nullptr)
+			mAsyncLogger->flush();
+
 		bool alternate = false;
 		Vector<LogEntry> entries = mLog.getAllEntries();
 		for (auto& entry : entries)
@@ -77,6 +77,19 @@ namespace bs
 		}
 	}
 
+	FileDecoder::FileDecoder(const SPtr<DataStream>& stream)
+		:mInputStream(stream)
+	{
+		if (mInputStream == nullptr)
+			return;
+
+		if (mInputStream->size() > std::numeric_limits<UINT32>::max())
+		{
+			BS_EXCEPT(InternalErrorException,
+				"File size is larger that UINT32 can hold. Ask a programmer to use a bigger data type.");
+		}
+	}
+
 	SPtr<IReflectable> FileDecoder::decode(const UnorderedMap<String, UINT64>& params)
 	{
 		if (mInputStream->eof())
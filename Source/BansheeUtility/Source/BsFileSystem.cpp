@@ -70,6 +70,29 @@ namespace bs
 		}
 	}
 
+	void FileSystem::link(const Path& oldPath, const Path& newPath, bool overwriteExisting)
+	{
+		if (!FileSystem::isFile(oldPath))
+		{
+			LOGWRN("Link operation failed because the source is not a file: \"" + oldPath.toString() + "\"");
+			return;
+		}
+
+		if (FileSystem::exists(newPath))
+		{
+			if (!overwriteExisting)
+			{
+				LOGWRN("Link operation failed because another file already exists at the new path: \"" + newPath.toString() + "\"");
+				return;
+			}
+
+			FileSystem::remove(newPath);
+		}
+
+		if (!FileSystem::linkFile(oldPath, newPath))
+			FileSystem::copyFile(oldPath, newPath);
+	}
+
 	void FileSystem::remove(const Path& path, bool recursively)
 	{
 		if (!FileSystem::exists(path))
@@ -81,6 +81,7 @@ namespace bs
 		BS_ADD_TEST(FileSystemTestSuite::testCopy);
 		BS_ADD_TEST(FileSystemTestSuite::testCopy_overwrite_existing);
 		BS_ADD_TEST(FileSystemTestSuite::testCopy_no_overwrite_existing);
+		BS_ADD_TEST(FileSystemTestSuite::testLink);
 		BS_ADD_TEST(FileSystemTestSuite::testGetChildren);
 		BS_ADD_TEST(FileSystemTestSuite::testGetLastModifiedTime);
 		BS_ADD_TEST(FileSystemTestSuite::testGetTempDirectoryPath);
@@ -254,6 +255,23 @@ namespace bs
 		BS_TEST_ASSERT(readFile(destination) == "copy-data-destination-3");
 	}
 
+	void FileSystemTestSuite::testLink()
+	{
+		Path source = mTestDirectory + "link-source-1";
+		Path destination = mTestDirectory + "link-destination-1";
+		createFile(source, "link-data-source-1");
+		createFile(destination, "link-data-destination-1");
+		BS_TEST_ASSERT(FileSystem::exists(source));
+		BS_TEST_ASSERT(FileSystem::exists(destination));
+		FileSystem::link(source, destination);
+		BS_TEST_ASSERT(FileSystem::exists(source));
+		BS_TEST_ASSERT(FileSystem::exists(destination));
+		BS_TEST_ASSERT(readFile(destination) == "link-data-source-1");
+		FileSystem::remove(source);
+		BS_TEST_ASSERT(!FileSystem::exists(source));
+		BS_TEST_ASSERT(readFile(destination) == "link-data-source-1");
+	}
+
 
 #define CONTAINS(v, e) (std::find(v.begin(), v.end(), e) != v.end())
 
@@ -0,0 +1,419 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsPackFile.h"
+#include "BsCompression.h"
+#include "BsFileSystem.h"
+#include "BsDebug.h"
+
+namespace bs
+{
+	const UINT32 PackFile::MAGIC = 0x4B505342; // "BSPK"
+	const UINT32 PackFile::VERSION = 1;
+	const UINT32 PackFile::ENTRY_COMPRESSED = 1 << 0;
+
+	/** Compressed data is only kept if it is smaller than this fraction of the uncompressed data. */
+	static const float MIN_COMPRESSION_RATIO = 0.9f;
+
+	/** Header at the start of the pack file. */
+	struct PackFileHeader
+	{
+		UINT32 magic;
+		UINT32 version;
+		UINT32 alignment;
+		UINT32 reserved;
+	};
+
+	/** Footer at the end of the pack file, written last so the index can be written without seeking back. */
+	struct PackFileFooter
+	{
+		UINT64 indexOffset;
+		UINT32 numEntries;
+		UINT32 magic;
+	};
+
+	/** Size of an index entry with an empty identifier: identifier length, flags, offset, packed size and size. */
+	static const size_t MIN_INDEX_ENTRY_SIZE = sizeof(UINT32) * 2 + sizeof(UINT64) * 3;
+
+	/** Largest ratio between decompressed and compressed data LZ4 is able to produce. */
+	static const UINT64 MAX_LZ4_RATIO = 255;
+
+	/** Largest file the writer is willing to compress. */
+	static const UINT64 MAX_COMPRESSED_ENTRY_SIZE = std::numeric_limits<UINT32>::max() / 2;
+
+	/** Size of the buffer used for copying uncompressed files into the pack. */
+	static const UINT32 COPY_BUFFER_SIZE = 1024 * 1024;
+
+	PackDataStream::PackDataStream(const SPtr<DataStream>& source, const SPtr<Mutex>& mutex, size_t offset, size_t size)
+		:DataStream(READ), mSource(source), mMutex(mutex), mOffset(offset), mPos(0)
+	{
+		mSize = size;
+	}
+
+	size_t PackDataStream::read(void* buf, size_t count)
+	{
+		if (mSource == nullptr)
+			return 0;
+
+		count = std::min(count, mSize - mPos);
+		if (count == 0)
+			return 0;
+
+		size_t numRead;
+		{
+			Lock lock(*mMutex);
+
+			mSource->seek(mOffset + mPos);
+			numRead = mSource->read(buf, count);
+		}
+
+		mPos += numRead;
+		return numRead;
+	}
+
+	void PackDataStream::skip(size_t count)
+	{
+		mPos = std::min(mPos + count, mSize);
+	}
+
+	void PackDataStream::seek(size_t pos)
+	{
+		mPos = std::min(pos, mSize);
+	}
+
+	size_t PackDataStream::tell() const
+	{
+		return mPos;
+	}
+
+	bool PackDataStream::eof() const
+	{
+		return mPos >= mSize;
+	}
+
+	SPtr<DataStream> PackDataStream::clone(bool copyData) const
+	{
+		// Same as with file streams the clone reads from the same source, but has its own read position. Reads are
+		// synchronized so there is no need to copy the data, and this allows resources to stream from the pack file.
+		return bs_shared_ptr_new<PackDataStream>(mSource, mMutex, mOffset, mSize);
+	}
+
+	bool PackDataStream::getSourceFile(Path& path, size_t& offset) const
+	{
+		if (mSource == nullptr || !mSource->getSourceFile(path, offset))
+			return false;
+
+		offset += mOffset;
+		return true;
+	}
+
+	void PackDataStream::close()
+	{
+		mSource = nullptr;
+		mMutex = nullptr;
+	}
+
+	SPtr<PackFile> PackFile::open(const Path& path)
+	{
+		if (!FileSystem::isFile(path))
+			return nullptr;
+
+		SPtr<DataStream> stream = FileSystem::openFile(path, true);
+		if (stream == nullptr)
+			return nullptr;
+
+		size_t fileSize = stream->size();
+		if (fileSize < sizeof(PackFileHeader) + sizeof(PackFileFooter))
+		{
+			LOGERR("Cannot open pack file \"" + path.toString() + "\". File is too small.");
+			return nullptr;
+		}
+
+		PackFileHeader header;
+		stream->read(&header, sizeof(header));
+
+		if (header.magic != MAGIC || header.version != VERSION)
+		{
+			LOGERR("Cannot open pack file \"" + path.toString() + "\". Unrecognized format or version.");
+			return nullptr;
+		}
+
+		PackFileFooter footer;
+		stream->seek(fileSize - sizeof(footer));
+		stream->read(&footer, sizeof(footer));
+
+		if (footer.magic != MAGIC || footer.indexOffset < sizeof(PackFileHeader) || 
+			footer.indexOffset > fileSize - sizeof(footer))
+		{
+			LOGERR("Cannot open pack file \"" + path.toString() + "\". File is corrupt.");
+			return nullptr;
+		}
+
+		// Reject entry counts that can't fit in the index, before allocating space for them
+		size_t indexEnd = fileSize - sizeof(footer);
+		if (footer.numEntries > (indexEnd - footer.indexOffset) / MIN_INDEX_ENTRY_SIZE)
+		{
+			LOGERR("Cannot open pack file \"" + path.toString() + "\". File is corrupt.");
+			return nullptr;
+		}
+
+		SPtr<PackFile> packFile = bs_shared_ptr<PackFile>(new (bs_alloc<PackFile>()) PackFile());
+		packFile->mPath = path;
+		packFile->mStream = stream;
+		packFile->mMutex = bs_shared_ptr_new<Mutex>();
+		packFile->mEntries.resize(footer.numEntries);
+
+		stream->seek((size_t)footer.indexOffset);
+
+		const Entry* prevEntry = nullptr;
+		for (auto& entry : packFile->mEntries)
+		{
+			if (indexEnd - stream->tell() < MIN_INDEX_ENTRY_SIZE)
+			{
+				LOGERR("Cannot open pack file \"" + path.toString() + "\". File is corrupt.");
+				return nullptr;
+			}
+
+			UINT32 idLength = 0;
+			stream->read(&idLength, sizeof(idLength));
+
+			if (idLength > indexEnd - stream->tell() - (MIN_INDEX_ENTRY_SIZE - sizeof(idLength)))
+			{
+				LOGERR("Cannot open pack file \"" + path.toString() + "\". File is corrupt.");
+				return nullptr;
+			}
+
+			entry.id.resize(idLength);
+			stream->read(&entry.id[0], idLength);
+
+			stream->read(&entry.flags, sizeof(entry.flags));
+			stream->read(&entry.offset, sizeof(entry.offset));
+			stream->read(&entry.packedSize, sizeof(entry.packedSize));
+			stream->read(&entry.size, sizeof(entry.size));
+
+			bool isValid = entry.offset <= footer.indexOffset && entry.packedSize <= footer.indexOffset - entry.offset;
+
+			// Uncompressed entries are read directly from the pack, and compressed ones are decompressed into a buffer
+			// allocated up front, so their sizes must be sane
+			if ((entry.flags & ENTRY_COMPRESSED) == 0)
+				isValid &= entry.size == entry.packedSize;
+			else
+			{
+				isValid &= entry.size <= MAX_COMPRESSED_ENTRY_SIZE;
+				isValid &= entry.packedSize < entry.size;
+				isValid &= entry.size <= entry.packedSize * MAX_LZ4_RATIO;
+			}
+
+			// Entries are looked up using a binary search, so the index must be sorted and contain no duplicates
+			if (prevEntry != nullptr)
+				isValid &= prevEntry->id < entry.id;
+
+			if (!isValid)
+			{
+				LOGERR("Cannot open pack file \"" + path.toString() + "\". File is corrupt.");
+				return nullptr;
+			}
+
+			prevEntry = &entry;
+		}
+
+		return packFile;
+	}
+
+	const PackFile::Entry* PackFile::findEntry(const String& id) const
+	{
+		auto iterFind = std::lower_bound(mEntries.begin(), mEntries.end(), id,
+			[](const Entry& entry, const String& value) { return entry.id < value; });
+
+		if (iterFind == mEntries.end() || iterFind->id != id)
+			return nullptr;
+
+		return &*iterFind;
+	}
+
+	bool PackFile::contains(const String& id) const
+	{
+		return findEntry(id) != nullptr;
+	}
+
+	SPtr<DataStream> PackFile::openEntry(const String& id) const
+	{
+		const Entry* entry = findEntry(id);
+		if (entry == nullptr)
+			return nullptr;
+
+		if ((entry->flags & ENTRY_COMPRESSED) == 0)
+			return bs_shared_ptr_new<PackDataStream>(mStream, mMutex, (size_t)entry->offset, (size_t)entry->size);
+
+		// Sizes of compressed entries are validated to fit in 32 bits when the pack is opened
+		UINT32 packedSize = (UINT32)entry->packedSize;
+		UINT32 size = (UINT32)entry->size;
+
+		UINT8* packedData = (UINT8*)bs_alloc(packedSize);
+		{
+			Lock lock(*mMutex);
+
+			mStream->seek((size_t)entry->offset);
+			mStream->read(packedData, packedSize);
+		}
+
+		UINT8* data = (UINT8*)bs_alloc(size);
+		bool success = Compression::decompressLZ4(packedData, packedSize, data, size);
+		bs_free(packedData);
+
+		if (!success)
+		{
+			LOGERR("Failed to decompress \"" + id + "\" from pack file \"" + mPath.toString() + "\".");
+
+			bs_free(data);
+			return nullptr;
+		}
+
+		return bs_shared_ptr_new<MemoryDataStream>(data, size, true);
+	}
+
+	PackFileWriter::PackFileWriter(UINT32 alignment)
+		:mAlignment(std::max(alignment, 1U))
+	{
+		assert((mAlignment & (mAlignment - 1)) == 0 && "Alignment must be a power of two.");
+	}
+
+	void PackFileWriter::add(const String& id, const Path& path, bool compress)
+	{
+		mEntries[id] = { path, compress };
+	}
+
+	bool PackFileWriter::write(const Path& path)
+	{
+		Path parentDir = path.getDirectory();
+		if (!FileSystem::exists(parentDir))
+			FileSystem::createDir(parentDir);
+
+		SPtr<DataStream> output = FileSystem::createAndOpenFile(path);
+		if (output == nullptr)
+			return false;
+
+		PackFileHeader header;
+		header.magic = PackFile::MAGIC;
+		header.version = PackFile::VERSION;
+		header.alignment = mAlignment;
+		header.reserved = 0;
+
+		output->write(&header, sizeof(header));
+		UINT64 offset = sizeof(header);
+
+		UINT8 padding[256];
+		memset(padding, 0, sizeof(padding));
+
+		auto writePadding = [&](UINT64 count)
+		{
+			while (count > 0)
+			{
+				UINT32 numBytes = (UINT32)std::min(count, (UINT64)sizeof(padding));
+				output->write(padding, numBytes);
+
+				count -= numBytes;
+			}
+		};
+
+		// Entries are stored in a map, so the index ends up sorted by identifier
+		Vector<PackFile::Entry> index;
+		index.reserve(mEntries.size());
+
+		bool success = true;
+		for (auto& entryPair : mEntries)
+		{
+			const PendingEntry& pendingEntry = entryPair.second;
+
+			SPtr<DataStream> input = FileSystem::openFile(pendingEntry.path, true);
+			if (input == nullptr)
+			{
+				LOGERR("Unable to add file \"" + pendingEntry.path.toString() + "\" to the pack. Cannot open file.");
+				success = false;
+				continue;
+			}
+
+			UINT64 size = input->size();
+
+			UINT64 alignedOffset = (offset + mAlignment - 1) & ~(UINT64)(mAlignment - 1);
+			writePadding(alignedOffset - offset);
+
+			UINT32 flags = 0;
+			UINT64 packedSize = 0;
+
+			// Only files small enough to compress are read into memory as a whole, others are copied in chunks so that
+			// their size isn't limited by the size of a single allocation
+			if (pendingEntry.compress && size > 0 && size <= MAX_COMPRESSED_ENTRY_SIZE)
+			{
+				UINT8* data = (UINT8*)bs_alloc((UINT32)size);
+				input->read(data, (size_t)size);
+
+				UINT32 maxCompressedSize = Compression::getMaxCompressedSizeLZ4((UINT32)size);
+				UINT8* compressedData = (UINT8*)bs_alloc(maxCompressedSize);
+
+				UINT32 compressedSize = Compression::compressLZ4(data, (UINT32)size, compressedData, maxCompressedSize);
+				if (compressedSize > 0 && compressedSize < size * MIN_COMPRESSION_RATIO)
+				{
+					flags |= PackFile::ENTRY_COMPRESSED;
+					output->write(compressedData, compressedSize);
+					packedSize = compressedSize;
+				}
+				else
+				{
+					output->write(data, (size_t)size);
+					packedSize = size;
+				}
+
+				bs_free(compressedData);
+				bs_free(data);
+			}
+			else
+			{
+				UINT8* buffer = (UINT8*)bs_alloc(COPY_BUFFER_SIZE);
+
+				UINT64 remaining = size;
+				while (remaining > 0)
+				{
+					size_t numBytes = input->read(buffer, (size_t)std::min(remaining, (UINT64)COPY_BUFFER_SIZE));
+					if (numBytes == 0)
+						break;
+
+					output->write(buffer, numBytes);
+					remaining -= numBytes;
+				}
+
+				bs_free(buffer);
+
+				// Keep the index consistent with the data if the file shrank while being read
+				packedSize = size - remaining;
+				size = packedSize;
+			}
+
+			input->close();
+			offset = alignedOffset + packedSize;
+
+			index.push_back({ entryPair.first, flags, alignedOffset, packedSize, size });
+		}
+
+		PackFileFooter footer;
+		footer.indexOffset = offset;
+		footer.numEntries = (UINT32)index.size();
+		footer.magic = PackFile::MAGIC;
+
+		for (auto& entry : index)
+		{
+			UINT32 idLength = (UINT32)entry.id.size();
+			output->write(&idLength, sizeof(idLength));
+			output->write(entry.id.data(), idLength);
+
+			output->write(&entry.flags, sizeof(entry.flags));
+			output->write(&entry.offset, sizeof(entry.offset));
+			output->write(&entry.packedSize, sizeof(entry.packedSize));
+			output->write(&entry.size, sizeof(entry.size));
+		}
+
+		output->write(&footer, sizeof(footer));
+		output->close();
+
+		return success;
+	}
+}
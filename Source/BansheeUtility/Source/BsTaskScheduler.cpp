@@ -109,6 +109,57 @@ namespace bs
 			mMaxActiveTasks--;
 	}
 
+	UINT32 TaskScheduler::parallelFor(const String& name, UINT32 count, UINT32 minPerChunk, 
+		const std::function<void(UINT32, UINT32, UINT32)>& func, UINT32 maxChunks)
+	{
+		UINT32 numChunks = getNumParallelChunks(count, minPerChunk, maxChunks);
+		if (numChunks <= 1)
+		{
+			if (numChunks == 1)
+				func(0, 0, count);
+
+			return numChunks;
+		}
+
+		// Chunk boundaries are spread evenly so there are never any empty chunks
+		auto getChunkStart = [=](UINT32 chunkIdx) { return (UINT32)(((UINT64)chunkIdx * count) / numChunks); };
+
+		Vector<SPtr<Task>> tasks;
+		for (UINT32 i = 1; i < numChunks; i++)
+		{
+			UINT32 start = getChunkStart(i);
+			UINT32 end = getChunkStart(i + 1);
+
+			SPtr<Task> task = Task::create(name, std::bind(func, i, start, end));
+			instance().addTask(task);
+
+			tasks.push_back(task);
+		}
+
+		// Process the first chunk on this thread while the workers run
+		func(0, 0, getChunkStart(1));
+
+		for (auto& task : tasks)
+			task->wait();
+
+		return numChunks;
+	}
+
+	UINT32 TaskScheduler::getNumParallelChunks(UINT32 count, UINT32 minPerChunk, UINT32 maxChunks)
+	{
+		if (count == 0)
+			return 0;
+
+		if (!isStarted())
+			return 1;
+
+		if (maxChunks == 0)
+			maxChunks = BS_THREAD_HARDWARE_CONCURRENCY;
+
+		UINT32 numChunks = std::min(count / std::max(1U, minPerChunk), maxChunks);
+		return std::max(numChunks, 1U);
+	}
+
 	void TaskScheduler::runMain()
 	{
 		while(true)
@@ -2,6 +2,8 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsTexAtlasGenerator.h"
 #include "BsDebug.h"
+#include "BsRect2I.h"
+#include "BsTaskScheduler.h"
 
 namespace bs
 {
@@ -94,8 +96,124 @@ namespace bs
 		}
 	};
 
-	TexAtlasGenerator::TexAtlasGenerator(bool square, UINT32 maxTexWidth, UINT32 maxTexHeight, bool fixedSize)
-		:mSquare(square), mFixedSize(fixedSize), mMaxTexWidth(maxTexWidth), mMaxTexHeight(maxTexHeight)
+	/** Single atlas page whose free space is tracked as a set of maximal (possibly overlapping) free rectangles. */
+	class TexAtlasMaxRectsPage
+	{
+	public:
+		TexAtlasMaxRectsPage(UINT32 width, UINT32 height)
+			:width(width), height(height), usedArea(0)
+		{
+			freeRects.push_back(Rect2I(0, 0, (INT32)width, (INT32)height));
+		}
+
+		UINT32 width, height;
+		UINT64 usedArea;
+		Vector<Rect2I> freeRects;
+		Vector<Rect2I> splitRects;
+
+		/**
+		 * Finds the free rectangle that leaves the least space along its shorter side when the element is placed in its
+		 * top left corner. Lower scores are better. Returns false if the element doesn't fit anywhere.
+		 */
+		bool findPosition(UINT32 elemWidth, UINT32 elemHeight, Rect2I& output, INT32& shortSideScore,
+			INT32& longSideScore) const
+		{
+			shortSideScore = std::numeric_limits<INT32>::max();
+			longSideScore = std::numeric_limits<INT32>::max();
+
+			bool found = false;
+			for (auto& freeRect : freeRects)
+			{
+				INT32 leftoverX = freeRect.width - (INT32)elemWidth;
+				INT32 leftoverY = freeRect.height - (INT32)elemHeight;
+
+				if (leftoverX < 0 || leftoverY < 0)
+					continue;
+
+				INT32 shortSide = std::min(leftoverX, leftoverY);
+				INT32 longSide = std::max(leftoverX, leftoverY);
+
+				if (shortSide < shortSideScore || (shortSide == shortSideScore && longSide < longSideScore))
+				{
+					output = Rect2I(freeRect.x, freeRect.y, (INT32)elemWidth, (INT32)elemHeight);
+					shortSideScore = shortSide;
+					longSideScore = longSide;
+					found = true;
+				}
+			}
+
+			return found;
+		}
+
+		/** Marks the provided area as used, splitting all free rectangles that overlap it. */
+		void place(const Rect2I& used)
+		{
+			splitRects.clear();
+
+			UINT32 numKept = 0;
+			for (UINT32 i = 0; i < (UINT32)freeRects.size(); i++)
+			{
+				Rect2I freeRect = freeRects[i];
+				if (!freeRect.overlaps(used))
+				{
+					freeRects[numKept++] = freeRect;
+					continue;
+				}
+
+				INT32 freeRight = freeRect.x + freeRect.width;
+				INT32 freeBottom = freeRect.y + freeRect.height;
+				INT32 usedRight = used.x + used.width;
+				INT32 usedBottom = used.y + used.height;
+
+				if (used.x > freeRect.x)
+					splitRects.push_back(Rect2I(freeRect.x, freeRect.y, used.x - freeRect.x, freeRect.height));
+
+				if (usedRight < freeRight)
+					splitRects.push_back(Rect2I(usedRight, freeRect.y, freeRight - usedRight, freeRect.height));
+
+				if (used.y > freeRect.y)
+					splitRects.push_back(Rect2I(freeRect.x, freeRect.y, freeRect.width, used.y - freeRect.y));
+
+				if (usedBottom < freeBottom)
+					splitRects.push_back(Rect2I(freeRect.x, usedBottom, freeRect.width, freeBottom - usedBottom));
+			}
+
+			freeRects.resize(numKept);
+
+			// Rectangles that weren't split can't be contained in the new ones, since the new ones are parts of
+			// rectangles that didn't contain them. So only the new rectangles need to be checked.
+			for (UINT32 i = 0; i < (UINT32)splitRects.size(); i++)
+			{
+				const Rect2I& rect = splitRects[i];
+
+				bool contained = false;
+				for (UINT32 j = 0; j < (UINT32)splitRects.size() && !contained; j++)
+				{
+					// If two rectangles are equal, keep only the first one
+					if (i != j && isContained(rect, splitRects[j]) && (j < i || !(rect == splitRects[j])))
+						contained = true;
+				}
+
+				for (UINT32 j = 0; j < numKept && !contained; j++)
+					contained = isContained(rect, freeRects[j]);
+
+				if (!contained)
+					freeRects.push_back(rect);
+			}
+
+			usedArea += (UINT64)used.width * used.height;
+		}
+
+		/** Checks if rectangle @p a is completely within rectangle @p b. */
+		static bool isContained(const Rect2I& a, const Rect2I& b)
+		{
+			return a.x >= b.x && a.y >= b.y && a.x + a.width <= b.x + b.width && a.y + a.height <= b.y + b.height;
+		}
+	};
+
+	TexAtlasGenerator::TexAtlasGenerator(bool square, UINT32 maxTexWidth, UINT32 maxTexHeight, bool fixedSize,
+		TexAtlasPackMethod method)
+		:mSquare(square), mFixedSize(fixedSize), mMaxTexWidth(maxTexWidth), mMaxTexHeight(maxTexHeight), mMethod(method)
 	{
 		if(square)
 		{
@@ -130,57 +248,7 @@ namespace bs
 
 		// If size isn't fixed, try to reduce the size of the last page
 		if(!mFixedSize)
-		{
-			while (true)
-			{
-				if (lastPageWidth <= 1 || lastPageHeight <= 1)
-					break;
-
-				int newLastPageWidth = lastPageWidth;
-				int newLastPageHeight = lastPageHeight;
-
-				if(mSquare)
-				{
-					if (newLastPageWidth > newLastPageHeight)
-						newLastPageWidth /= 2;
-					else
-						newLastPageHeight /= 2;
-				}
-				else
-				{
-					if (newLastPageWidth > newLastPageHeight)
-						newLastPageWidth /= 2;
-					else
-						newLastPageHeight /= 2;
-				}
-
-				// Clear page indexes so we know which pages to process
-				for(size_t i = 0; i < elements.size(); i++)
-				{
-					if(elements[i].output.page >= lastPageIdx)
-						elements[i].output.page = -1;
-				}
-
-				if(generatePagesForSize(elements, newLastPageWidth, newLastPageHeight, lastPageIdx) == 1)
-				{
-					lastPageWidth = newLastPageWidth;
-					lastPageHeight = newLastPageHeight;
-				}
-				else
-				{
-					// We're done but we need to re-do all the pages with the last valid size
-					for(size_t i = 0; i < elements.size(); i++)
-					{
-						if(elements[i].output.page >= lastPageIdx)
-							elements[i].output.page = -1;
-					}
-
-					generatePagesForSize(elements, lastPageWidth, lastPageHeight, lastPageIdx);
-
-					break;
-				}
-			}
-		}
+			shrinkLastPage(elements, lastPageIdx, lastPageWidth, lastPageHeight);
 
 		// Handle degenerate case
 		for(size_t i = 0; i < elements.size(); i++)
@@ -212,11 +280,98 @@ namespace bs
 		return pages;
 	}
 
-	int TexAtlasGenerator::generatePagesForSize(Vector<TexAtlasElementDesc>& elements, UINT32 width, UINT32 height, UINT32 startPage) const
+	void TexAtlasGenerator::shrinkLastPage(Vector<TexAtlasElementDesc>& elements, INT32 lastPageIdx, UINT32& width,
+		UINT32& height) const
+	{
+		// Find all the sizes to try, in the order they would be tried if done one by one
+		Vector<std::pair<UINT32, UINT32>> sizes;
+
+		UINT32 newWidth = width;
+		UINT32 newHeight = height;
+		while (newWidth > 1 && newHeight > 1)
+		{
+			if (newWidth > newHeight)
+				newWidth /= 2;
+			else
+				newHeight /= 2;
+
+			sizes.push_back(std::make_pair(newWidth, newHeight));
+		}
+
+		Vector<UINT32> lastPageElementIds;
+		Vector<TexAtlasElementDesc> lastPageElements;
+		for (UINT32 i = 0; i < (UINT32)elements.size(); i++)
+		{
+			if (elements[i].output.page != lastPageIdx)
+				continue;
+
+			lastPageElementIds.push_back(i);
+			lastPageElements.push_back(elements[i]);
+			lastPageElements.back().output.page = -1;
+		}
+
+		// Each size is packed into its own copy of the elements, so multiple sizes can be packed at once. Sizes are
+		// processed in batches of one size per hardware thread, and the search stops at the first size that doesn't fit.
+		UINT32 batchSize = 1;
+		if (TaskScheduler::isStarted())
+			batchSize = std::max(1U, (UINT32)BS_THREAD_HARDWARE_CONCURRENCY);
+
+		Vector<Vector<TexAtlasElementDesc>> layouts(sizes.size());
+		Vector<UINT8> fits(sizes.size(), 0); // Not Vector<bool> as its elements cannot be written to concurrently
+
+		auto packSize = [&](UINT32 idx)
+		{
+			layouts[idx] = lastPageElements;
+			fits[idx] = generatePagesForSize(layouts[idx], sizes[idx].first, sizes[idx].second, lastPageIdx, 1) == 1;
+		};
+
+		INT32 bestIdx = -1;
+		for (UINT32 batchStart = 0; batchStart < (UINT32)sizes.size(); batchStart += batchSize)
+		{
+			UINT32 batchEnd = std::min(batchStart + batchSize, (UINT32)sizes.size());
+
+			TaskScheduler::parallelFor("TexAtlasPage", batchEnd - batchStart, 1, [&](UINT32, UINT32 start, UINT32 end)
+			{
+				for (UINT32 i = batchStart + start; i < batchStart + end; i++)
+					packSize(i);
+			}, batchSize);
+
+			bool done = false;
+			for (UINT32 i = batchStart; i < batchEnd; i++)
+			{
+				if (!fits[i])
+				{
+					done = true;
+					break;
+				}
+
+				bestIdx = (INT32)i;
+			}
+
+			if (done)
+				break;
+		}
+
+		if (bestIdx == -1)
+			return;
+
+		const Vector<TexAtlasElementDesc>& bestLayout = layouts[bestIdx];
+		for (UINT32 i = 0; i < (UINT32)lastPageElementIds.size(); i++)
+			elements[lastPageElementIds[i]] = bestLayout[i];
+
+		width = sizes[bestIdx].first;
+		height = sizes[bestIdx].second;
+	}
+
+	int TexAtlasGenerator::generatePagesForSize(Vector<TexAtlasElementDesc>& elements, UINT32 width, UINT32 height, 
+		UINT32 startPage, UINT32 maxPages) const
 	{
 		if(elements.size() == 0)
 			return 0;
 
+		if (mMethod == TexAtlasPackMethod::MaxRects)
+			return generatePagesMaxRects(elements, width, height, startPage, maxPages);
+
 		int currentPage = startPage;
 		int numPages = 0;
 		while (true)
@@ -232,6 +387,9 @@ namespace bs
 			while (width < currentElem.input.width || height < currentElem.input.height)
 				return -1;
 
+			if ((UINT32)numPages == maxPages)
+				return -1;
+
 			TexAtlasNode atlasNode(0, 0, width, height);
 			atlasNode.insert(elements[largestTexId]);
 			elements[largestTexId].output.page = currentPage;
@@ -251,6 +409,75 @@ namespace bs
 		}
 	}
 
+	int TexAtlasGenerator::generatePagesMaxRects(Vector<TexAtlasElementDesc>& elements, UINT32 width, UINT32 height, 
+		UINT32 startPage, UINT32 maxPages) const
+	{
+		// Elements with no area are never assigned a page, same as with the binary tree packer
+		Vector<UINT32> remaining;
+		for (UINT32 i = 0; i < (UINT32)elements.size(); i++)
+		{
+			const TexAtlasElementDesc& element = elements[i];
+			if (element.output.page != -1 || element.input.width * element.input.height == 0)
+				continue;
+
+			// If the texture is larger than the atlas size then it can never fit
+			if (width < element.input.width || height < element.input.height)
+				return -1;
+
+			remaining.push_back(i);
+		}
+
+		// Place largest elements first, as they're the hardest to fit
+		std::sort(remaining.begin(), remaining.end(), 
+			[&](UINT32 a, UINT32 b)
+		{
+			const TexAtlasElementDesc& elemA = elements[a];
+			const TexAtlasElementDesc& elemB = elements[b];
+
+			UINT32 areaA = elemA.input.width * elemA.input.height;
+			UINT32 areaB = elemB.input.width * elemB.input.height;
+
+			if (areaA != areaB)
+				return areaA > areaB;
+
+			return a < b;
+		});
+
+		UINT32 numPages = 0;
+		while (!remaining.empty())
+		{
+			if (numPages == maxPages)
+				return -1;
+
+			TexAtlasMaxRectsPage page(width, height);
+
+			UINT32 numRemaining = 0;
+			for (auto& elementIdx : remaining)
+			{
+				TexAtlasElementDesc& element = elements[elementIdx];
+
+				Rect2I area;
+				INT32 shortSideScore, longSideScore;
+				if (!page.findPosition(element.input.width, element.input.height, area, shortSideScore, longSideScore))
+				{
+					remaining[numRemaining++] = elementIdx;
+					continue;
+				}
+
+				page.place(area);
+
+				element.output.x = (UINT32)area.x;
+				element.output.y = (UINT32)area.y;
+				element.output.page = (INT32)(startPage + numPages);
+			}
+
+			remaining.resize(numRemaining);
+			numPages++;
+		}
+
+		return (int)numPages;
+	}
+
 	int TexAtlasGenerator::addLargestTextureWithoutPageThatFits(Vector<TexAtlasElementDesc>& elements, TexAtlasNode& node) const
 	{
 		UINT32 sizeLimit = std::numeric_limits<UINT32>::max();
@@ -329,4 +556,84 @@ namespace bs
 			}
 		}
 	}
+
+	DynamicTexAtlasLayout::DynamicTexAtlasLayout(UINT32 pageWidth, UINT32 pageHeight)
+		:mPageWidth(pageWidth), mPageHeight(pageHeight)
+	{ }
+
+	DynamicTexAtlasLayout::~DynamicTexAtlasLayout()
+	{
+		clear();
+	}
+
+	bool DynamicTexAtlasLayout::insert(TexAtlasElementDesc& element, bool allowNewPage)
+	{
+		if (element.input.width > mPageWidth || element.input.height > mPageHeight)
+			return false;
+
+		// Elements with no area don't need any space, and aren't assigned a page
+		if (element.input.width * element.input.height == 0)
+		{
+			element.output.x = 0;
+			element.output.y = 0;
+			element.output.page = -1;
+
+			return true;
+		}
+
+		// Pick the best fit over all pages, so elements fill in gaps in older pages before new pages are touched
+		Rect2I bestArea;
+		INT32 bestPage = -1;
+		INT32 bestShortSide = std::numeric_limits<INT32>::max();
+		INT32 bestLongSide = std::numeric_limits<INT32>::max();
+
+		for (UINT32 i = 0; i < (UINT32)mPages.size(); i++)
+		{
+			Rect2I area;
+			INT32 shortSideScore, longSideScore;
+			if (!mPages[i]->findPosition(element.input.width, element.input.height, area, shortSideScore, longSideScore))
+				continue;
+
+			if (shortSideScore < bestShortSide || (shortSideScore == bestShortSide && longSideScore < bestLongSide))
+			{
+				bestArea = area;
+				bestPage = (INT32)i;
+				bestShortSide = shortSideScore;
+				bestLongSide = longSideScore;
+			}
+		}
+
+		if (bestPage == -1)
+		{
+			if (!allowNewPage)
+				return false;
+
+			mPages.push_back(bs_new<TexAtlasMaxRectsPage>(mPageWidth, mPageHeight));
+			bestPage = (INT32)mPages.size() - 1;
+			bestArea = Rect2I(0, 0, (INT32)element.input.width, (INT32)element.input.height);
+		}
+
+		mPages[bestPage]->place(bestArea);
+
+		element.output.x = (UINT32)bestArea.x;
+		element.output.y = (UINT32)bestArea.y;
+		element.output.page = bestPage;
+
+		return true;
+	}
+
+	float DynamicTexAtlasLayout::getOccupancy(UINT32 page) const
+	{
+		const TexAtlasMaxRectsPage* atlasPage = mPages[page];
+
+		return atlasPage->usedArea / (float)((UINT64)atlasPage->width * atlasPage->height);
+	}
+
+	void DynamicTexAtlasLayout::clear()
+	{
+		for (auto& page : mPages)
+			bs_delete(page);
+
+		mPages.clear();
+	}
 }
\ No newline at end of file
@@ -1,10 +1,173 @@
 //********************************** Banshee Engine (www.banshee3d.com) **************************************************//
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsPrerequisitesUtil.h"
+#include "BsDataStream.h"
 #include "ThirdParty/md5.h"
 
 namespace bs
 {
+	static const UINT64 XXH_PRIME64_1 = 0x9E3779B185EBCA87ULL;
+	static const UINT64 XXH_PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+	static const UINT64 XXH_PRIME64_3 = 0x165667B19E3779F9ULL;
+	static const UINT64 XXH_PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+	static const UINT64 XXH_PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+	static inline UINT64 xxhRotl(UINT64 x, UINT32 r)
+	{
+		return (x << r) | (x >> (64 - r));
+	}
+
+	static inline UINT64 xxhRead64(const UINT8* data)
+	{
+		UINT64 value;
+		memcpy(&value, data, sizeof(value));
+		return value;
+	}
+
+	static inline UINT32 xxhRead32(const UINT8* data)
+	{
+		UINT32 value;
+		memcpy(&value, data, sizeof(value));
+		return value;
+	}
+
+	static inline UINT64 xxhRound(UINT64 acc, UINT64 input)
+	{
+		acc += input * XXH_PRIME64_2;
+		acc = xxhRotl(acc, 31);
+		return acc * XXH_PRIME64_1;
+	}
+
+	static inline UINT64 xxhMergeRound(UINT64 acc, UINT64 value)
+	{
+		acc ^= xxhRound(0, value);
+		return acc * XXH_PRIME64_1 + XXH_PRIME64_4;
+	}
+
+	XXHash64::XXHash64(UINT64 seed)
+		:mSeed(seed), mBufferSize(0), mTotalLength(0)
+	{
+		mAcc[0] = seed + XXH_PRIME64_1 + XXH_PRIME64_2;
+		mAcc[1] = seed + XXH_PRIME64_2;
+		mAcc[2] = seed;
+		mAcc[3] = seed - XXH_PRIME64_1;
+	}
+
+	void XXHash64::update(const void* data, size_t length)
+	{
+		const UINT8* input = (const UINT8*)data;
+		const UINT8* end = input + length;
+		mTotalLength += length;
+
+		// Not enough for a full stripe, just buffer the data
+		if(mBufferSize + length < 32)
+		{
+			memcpy(mBuffer + mBufferSize, input, length);
+			mBufferSize += (UINT32)length;
+			return;
+		}
+
+		// Complete the buffered stripe first
+		if(mBufferSize > 0)
+		{
+			UINT32 toCopy = 32 - mBufferSize;
+			memcpy(mBuffer + mBufferSize, input, toCopy);
+			input += toCopy;
+
+			for(UINT32 i = 0; i < 4; i++)
+				mAcc[i] = xxhRound(mAcc[i], xxhRead64(mBuffer + i * 8));
+
+			mBufferSize = 0;
+		}
+
+		while(input + 32 <= end)
+		{
+			for(UINT32 i = 0; i < 4; i++)
+				mAcc[i] = xxhRound(mAcc[i], xxhRead64(input + i * 8));
+
+			input += 32;
+		}
+
+		mBufferSize = (UINT32)(end - input);
+		if(mBufferSize > 0)
+			memcpy(mBuffer, input, mBufferSize);
+	}
+
+	UINT64 XXHash64::digest() const
+	{
+		UINT64 hash;
+		if(mTotalLength >= 32)
+		{
+			hash = xxhRotl(mAcc[0], 1) + xxhRotl(mAcc[1], 7) + xxhRotl(mAcc[2], 12) + xxhRotl(mAcc[3], 18);
+
+			for(UINT32 i = 0; i < 4; i++)
+				hash = xxhMergeRound(hash, mAcc[i]);
+		}
+		else
+			hash = mSeed + XXH_PRIME64_5;
+
+		hash += mTotalLength;
+
+		const UINT8* input = mBuffer;
+		const UINT8* end = mBuffer + mBufferSize;
+
+		while(input + 8 <= end)
+		{
+			hash ^= xxhRound(0, xxhRead64(input));
+			hash = xxhRotl(hash, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+			input += 8;
+		}
+
+		if(input + 4 <= end)
+		{
+			hash ^= (UINT64)xxhRead32(input) * XXH_PRIME64_1;
+			hash = xxhRotl(hash, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+			input += 4;
+		}
+
+		while(input < end)
+		{
+			hash ^= (*input) * XXH_PRIME64_5;
+			hash = xxhRotl(hash, 11) * XXH_PRIME64_1;
+			input++;
+		}
+
+		hash ^= hash >> 33;
+		hash *= XXH_PRIME64_2;
+		hash ^= hash >> 29;
+		hash *= XXH_PRIME64_3;
+		hash ^= hash >> 32;
+
+		return hash;
+	}
+
+	UINT64 xxHash64(const void* data, size_t length, UINT64 seed)
+	{
+		XXHash64 hasher(seed);
+		hasher.update(data, length);
+
+		return hasher.digest();
+	}
+
+	UINT64 xxHash64(const SPtr<DataStream>& stream, UINT64 seed)
+	{
+		static const UINT32 CHUNK_SIZE = 64 * 1024;
+		UINT8* buffer = (UINT8*)bs_alloc(CHUNK_SIZE);
+
+		XXHash64 hasher(seed);
+		while (!stream->eof())
+		{
+			size_t numRead = stream->read(buffer, CHUNK_SIZE);
+			if (numRead == 0)
+				break;
+
+			hasher.update(buffer, numRead);
+		}
+
+		bs_free(buffer);
+		return hasher.digest();
+	}
+
 	String md5(const WString& source)
 	{
 		MD5 md5;
@@ -106,6 +106,11 @@ namespace bs
 		destinationStream.close();
 	}
 
+	bool FileSystem::linkFile(const Path& source, const Path& destination)
+	{
+		return ::link(source.toString().c_str(), destination.toString().c_str()) == 0;
+	}
+
 	void FileSystem::moveFile(const Path& oldPath, const Path& newPath)
 	{
 		String oldPathStr = oldPath.toString();
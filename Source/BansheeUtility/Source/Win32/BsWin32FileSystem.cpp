@@ -257,6 +257,11 @@ namespace bs
 			win32_handleError(GetLastError(), from.toWString());
 	}
 
+	bool FileSystem::linkFile(const Path& from, const Path& to)
+	{
+		return CreateHardLinkW(to.toWString().c_str(), from.toWString().c_str(), nullptr) != FALSE;
+	}
+
 	void FileSystem::moveFile(const Path& oldPath, const Path& newPath)
 	{
 		WString oldPathStr = oldPath.toWString();
@@ -29,6 +29,7 @@ set(BS_BANSHEEVULKANRENDERAPI_INC_NOFILTER
 	"Include/BsVulkanDescriptorSet.h"
 	"Include/BsVulkanSamplerState.h"
 	"Include/BsVulkanGpuPipelineParamInfo.h"
+	"Include/BsVulkanTestSuite.h"
 )
 
 set(BS_BANSHEEVULKANRENDERAPI_INC_MANAGERS
@@ -75,6 +76,7 @@ set(BS_BANSHEEVULKANRENDERAPI_SRC_NOFILTER
 	"Source/BsVulkanDescriptorSet.cpp"
 	"Source/BsVulkanSamplerState.cpp"
 	"Source/BsVulkanGpuPipelineParamInfo.cpp"
+	"Source/BsVulkanTestSuite.cpp"
 )
 
 set(BS_BANSHEEVULKANRENDERAPI_SRC_MANAGERS
@@ -73,6 +73,25 @@ namespace bs
 		/** Returns a manager that can be used for allocating Vulkan objects wrapped as managed resources. */
 		VulkanResourceManager& getResourceManager() const { return *mResourceManager; }
 
+		/** Returns a cache that speeds up creation of pipeline objects on this device. Internally synchronized. */
+		VkPipelineCache getPipelineCache() const { return mPipelineCache; }
+
+		/** 
+		 * Populates the pipeline cache with data saved by savePipelineCache(). Data saved on a different device or driver
+		 * version is ignored. Must be called before any pipelines are created on the device.
+		 */
+		void loadPipelineCache(const Path& path);
+
+		/** Saves the contents of the pipeline cache to the specified file, so they can be reused by later runs. */
+		void savePipelineCache(const Path& path) const;
+
+		/** 
+		 * Checks if the provided pipeline cache data was created by a device with the provided properties, running the
+		 * same driver version. Only the cache header is inspected.
+		 */
+		static bool isPipelineCacheCompatible(const UINT8* data, UINT32 size, 
+			const VkPhysicalDeviceProperties& deviceProperties);
+
 		/** 
 		 * Allocates memory for the provided image, and binds it to the image. Returns null if it cannot find memory
 		 * with the specified flags.
@@ -112,6 +131,7 @@ namespace bs
 		VulkanQueryPool* mQueryPool;
 		VulkanDescriptorManager* mDescriptorManager;
 		VulkanResourceManager* mResourceManager;
+		VkPipelineCache mPipelineCache;
 
 		VkPhysicalDeviceProperties mDeviceProperties;
 		VkPhysicalDeviceFeatures mDeviceFeatures;
@@ -95,6 +95,9 @@ namespace bs
 		/** @copydoc RenderAPICore::executeCommands() */
 		void submitCommandBuffer(const SPtr<CommandBuffer>& commandBuffer, UINT32 syncMask = 0xFFFFFFFF) override;
 
+		/** @copydoc RenderAPICore::prewarmPipelines() */
+		void prewarmPipelines(const Vector<PIPELINE_PERMUTATION_DESC>& permutations) override;
+
 		/** @copydoc RenderAPICore::convertProjectionMatrix */
 		void convertProjectionMatrix(const Matrix4& matrix, Matrix4& dest) override;
 
@@ -143,6 +146,9 @@ namespace bs
 		/** Creates and populates a set of render system capabilities describing which functionality is available. */
 		void initCapabilites();
 
+		/** Returns the path of the file the pipeline cache of the provided device is saved to between runs. */
+		Path getPipelineCachePath(const VulkanDevice& device) const;
+
 		/** 
 		 * Returns a valid command buffer. Uses the provided buffer if not null. Otherwise returns the default command 
 		 * buffer. 
@@ -157,6 +163,7 @@ namespace bs
 		SPtr<VulkanCommandBuffer> mMainCommandBuffer;
 
 		VulkanGLSLProgramFactory* mGLSLFactory;
+		Vector<SPtr<Task>> mPrewarmTasks;
 
 #if BS_DEBUG_MODE
 		VkDebugReportCallbackEXT mDebugCallback;
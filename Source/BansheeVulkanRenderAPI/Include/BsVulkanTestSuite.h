@@ -0,0 +1,26 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsVulkanPrerequisites.h"
+#include "BsTestSuite.h"
+
+namespace bs
+{
+	/** @addtogroup Vulkan
+	 *  @{
+	 */
+
+	/** Contains a set of unit tests for the parts of the Vulkan render API that don't require a GPU. */
+	class BS_VULKAN_EXPORT VulkanTestSuite : public TestSuite
+	{
+	public:
+		VulkanTestSuite();
+
+	private:
+		/** Tests that pipeline cache data is only accepted by the device and driver it was created with. */
+		void testPipelineCacheCompatibility();
+	};
+
+	/** @} */
+}
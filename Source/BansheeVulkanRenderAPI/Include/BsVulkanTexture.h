@@ -197,8 +197,14 @@ namespace bs
 		void writeDataImpl(const PixelData& src, UINT32 mipLevel = 0, UINT32 face = 0, bool discardWholeBuffer = false,
 					   UINT32 queueIdx = 0) override;
 
+		/** @copydoc TextureCore::setAllocatedMipImpl */
+		void setAllocatedMipImpl(UINT32 prevMip) override;
+
 	private:
-		/** Creates a new image for the specified device, matching the current properties. */
+		/** 
+		 * Creates a new image for the specified device, matching the current properties. The image only contains the
+		 * allocated mip levels, so image mip level 0 corresponds to the texture's most detailed allocated mip level.
+		 */
 		VulkanImage* createImage(VulkanDevice& device);
 
 		/** 
@@ -212,12 +218,20 @@ namespace bs
 		VulkanBuffer* createStaging(VulkanDevice& device, const PixelData& pixelData, bool needsRead);
 
 		/** 
-		 * Copies all sub-resources from the source image to the destination image. Caller must ensure the images
-		 * are of the same size. The operation will be queued on the provided command buffer. The system assumes the 
-		 * provided image matches the current texture properties (i.e. num faces, mips, size).
+		 * Copies all sub-resources present in both the source and the destination image. The operation will be queued on
+		 * the provided command buffer. The system assumes the provided images match the current texture properties (i.e.
+		 * num faces, size), except for the allocated mip levels.
+		 *
+		 * @param[in]	cb				Command buffer to queue the copy on.
+		 * @param[in]	srcImage		Image to copy from.
+		 * @param[in]	dstImage		Image to copy to.
+		 * @param[in]	srcFinalLayout	Layout to transition the source image to once the copy is done.
+		 * @param[in]	dstFinalLayout	Layout to transition the destination image to once the copy is done.
+		 * @param[in]	srcFirstMip		Texture mip level stored in the source image's mip level 0.
+		 * @param[in]	dstFirstMip		Texture mip level stored in the destination image's mip level 0.
 		 */
 		void copyImage(VulkanTransferBuffer* cb, VulkanImage* srcImage, VulkanImage* dstImage, 
-			VkImageLayout srcFinalLayout, VkImageLayout dstFinalLayout);
+			VkImageLayout srcFinalLayout, VkImageLayout dstFinalLayout, UINT32 srcFirstMip, UINT32 dstFirstMip);
 
 		/** Returns the optimal layout this image should normally be in. */
 		VkImageLayout getOptimalLayout() const;
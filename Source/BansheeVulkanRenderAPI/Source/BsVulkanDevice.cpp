@@ -5,11 +5,14 @@
 #include "BsVulkanCommandBuffer.h"
 #include "BsVulkanDescriptorManager.h"
 #include "BsVulkanQueryManager.h"
+#include "BsFileSystem.h"
+#include "BsDataStream.h"
 
 namespace bs
 {
 	VulkanDevice::VulkanDevice(VkPhysicalDevice device, UINT32 deviceIdx)
-		:mPhysicalDevice(device), mLogicalDevice(nullptr), mIsPrimary(false), mDeviceIdx(deviceIdx), mQueueInfos()
+		:mPhysicalDevice(device), mLogicalDevice(nullptr), mIsPrimary(false), mDeviceIdx(deviceIdx)
+		, mPipelineCache(VK_NULL_HANDLE), mQueueInfos()
 	{
 		// Set to default
 		for (UINT32 i = 0; i < GQT_COUNT; i++)
@@ -114,6 +117,17 @@ namespace bs
 		mQueryPool = bs_new<VulkanQueryPool>(*this);
 		mDescriptorManager = bs_new<VulkanDescriptorManager>(*this);
 		mResourceManager = bs_new<VulkanResourceManager>(*this);
+
+		// Create an empty pipeline cache, populated from disk by loadPipelineCache()
+		VkPipelineCacheCreateInfo pipelineCacheCI;
+		pipelineCacheCI.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+		pipelineCacheCI.pNext = nullptr;
+		pipelineCacheCI.flags = 0;
+		pipelineCacheCI.initialDataSize = 0;
+		pipelineCacheCI.pInitialData = nullptr;
+
+		result = vkCreatePipelineCache(mLogicalDevice, &pipelineCacheCI, gVulkanAllocator, &mPipelineCache);
+		assert(result == VK_SUCCESS);
 	}
 
 	VulkanDevice::~VulkanDevice()
@@ -136,6 +150,8 @@ namespace bs
 
 		// Needs to happen after query pool & command buffer pool shutdown, to ensure their resources are destroyed
 		bs_delete(mResourceManager);
+
+		vkDestroyPipelineCache(mLogicalDevice, mPipelineCache, gVulkanAllocator);
 		
 		vkDestroyDevice(mLogicalDevice, gVulkanAllocator);
 	}
@@ -146,6 +162,89 @@ namespace bs
 		assert(result == VK_SUCCESS);
 	}
 
+	void VulkanDevice::loadPipelineCache(const Path& path)
+	{
+		if (!FileSystem::isFile(path))
+			return;
+
+		SPtr<DataStream> stream = FileSystem::openFile(path);
+		if (stream == nullptr)
+			return;
+
+		UINT32 size = (UINT32)stream->size();
+		UINT8* data = (UINT8*)bs_alloc(size);
+		stream->read(data, size);
+		stream->close();
+
+		// Drivers are supposed to reject incompatible data, but not all of them do so reliably, so check it ourselves
+		if (isPipelineCacheCompatible(data, size, mDeviceProperties))
+		{
+			VkPipelineCacheCreateInfo pipelineCacheCI;
+			pipelineCacheCI.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+			pipelineCacheCI.pNext = nullptr;
+			pipelineCacheCI.flags = 0;
+			pipelineCacheCI.initialDataSize = size;
+			pipelineCacheCI.pInitialData = data;
+
+			VkPipelineCache pipelineCache;
+			VkResult result = vkCreatePipelineCache(mLogicalDevice, &pipelineCacheCI, gVulkanAllocator, &pipelineCache);
+			if (result == VK_SUCCESS)
+			{
+				vkDestroyPipelineCache(mLogicalDevice, mPipelineCache, gVulkanAllocator);
+				mPipelineCache = pipelineCache;
+			}
+		}
+
+		bs_free(data);
+	}
+
+	void VulkanDevice::savePipelineCache(const Path& path) const
+	{
+		size_t size = 0;
+		VkResult result = vkGetPipelineCacheData(mLogicalDevice, mPipelineCache, &size, nullptr);
+		if (result != VK_SUCCESS || size == 0)
+			return;
+
+		UINT8* data = (UINT8*)bs_alloc((UINT32)size);
+		result = vkGetPipelineCacheData(mLogicalDevice, mPipelineCache, &size, data);
+
+		if (result == VK_SUCCESS)
+		{
+			Path parentDir = path.getDirectory();
+			if (!FileSystem::exists(parentDir))
+				FileSystem::createDir(parentDir);
+
+			SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+			if (stream != nullptr)
+			{
+				stream->write(data, size);
+				stream->close();
+			}
+		}
+
+		bs_free(data);
+	}
+
+	bool VulkanDevice::isPipelineCacheCompatible(const UINT8* data, UINT32 size, 
+		const VkPhysicalDeviceProperties& deviceProperties)
+	{
+		// Header as defined by VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+		const UINT32 headerSize = sizeof(UINT32) * 4 + VK_UUID_SIZE;
+		if (size < headerSize)
+			return false;
+
+		UINT32 header[4];
+		memcpy(header, data, sizeof(header));
+
+		if (header[0] < headerSize || header[1] != VK_PIPELINE_CACHE_HEADER_VERSION_ONE)
+			return false;
+
+		if (header[2] != deviceProperties.vendorID || header[3] != deviceProperties.deviceID)
+			return false;
+
+		return memcmp(data + sizeof(header), deviceProperties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+	}
+
 	UINT32 VulkanDevice::getQueueMask(GpuQueueType type, UINT32 queueIdx) const
 	{
 		UINT32 numQueues = getNumQueues(type);
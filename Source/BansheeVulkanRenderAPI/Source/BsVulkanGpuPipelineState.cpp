@@ -94,7 +94,7 @@ namespace bs
 
 	void VulkanGraphicsPipelineStateCore::initialize()
 	{
-		Lock(mMutex);
+		Lock lock(mMutex);
 
 		GraphicsPipelineStateCore::initialize();
 
@@ -319,7 +319,7 @@ namespace bs
 		UINT32 deviceIdx, VulkanFramebuffer* framebuffer, bool readOnlyDepth, DrawOperationType drawOp, 
 			const SPtr<VulkanVertexInput>& vertexInput)
 	{
-		Lock(mMutex);
+		Lock lock(mMutex);
 
 		if (mPerDeviceData[deviceIdx].device == nullptr)
 			return nullptr;
@@ -475,7 +475,8 @@ namespace bs
 		VkDevice vkDevice = mPerDeviceData[deviceIdx].device->getLogical();
 
 		VkPipeline pipeline;
-		VkResult result = vkCreateGraphicsPipelines(vkDevice, VK_NULL_HANDLE, 1, &mPipelineInfo, gVulkanAllocator, &pipeline);
+		VkResult result = vkCreateGraphicsPipelines(vkDevice, device->getPipelineCache(), 1, &mPipelineInfo, 
+			gVulkanAllocator, &pipeline);
 		assert(result == VK_SUCCESS);
 
 		// Restore previous stencil op states
@@ -568,8 +569,8 @@ namespace bs
 			pipelineCI.layout = descManager.getPipelineLayout(layouts, numLayouts);
 
 			VkPipeline pipeline;
-			VkResult result = vkCreateComputePipelines(devices[i]->getLogical(), VK_NULL_HANDLE, 1, &pipelineCI,
-														gVulkanAllocator, &pipeline);
+			VkResult result = vkCreateComputePipelines(devices[i]->getLogical(), devices[i]->getPipelineCache(), 1,
+														&pipelineCI, gVulkanAllocator, &pipeline);
 			assert(result == VK_SUCCESS);
 
 
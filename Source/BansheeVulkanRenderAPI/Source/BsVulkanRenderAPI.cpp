@@ -17,6 +17,10 @@
 #include "BsVulkanGpuParams.h"
 #include "BsVulkanVertexInputManager.h"
 #include "BsVulkanGpuParamBlockBuffer.h"
+#include "BsVulkanGpuPipelineState.h"
+#include "BsVulkanFramebuffer.h"
+#include "BsTaskScheduler.h"
+#include "BsFileSystem.h"
 
 #if BS_PLATFORM == BS_PLATFORM_WIN32
 	#include "Win32/BsWin32VideoModeInfo.h"
@@ -28,6 +32,9 @@
 
 namespace bs
 {
+	/** Folder, relative to the working directory, that pipeline caches are saved in between runs. */
+	static const char* PIPELINE_CACHE_FOLDER = "PipelineCache/";
+
 	VkAllocationCallbacks* gVulkanAllocator = nullptr;
 
 	PFN_vkCreateDebugReportCallbackEXT vkCreateDebugReportCallbackEXT = nullptr;
@@ -88,7 +95,7 @@ namespace bs
 
 	const StringID& VulkanRenderAPI::getName() const
 	{
-		static StringID strName("VulkanRenderAPI");
+		static StringID strName = "VulkanRenderAPI"_sid;
 		return strName;
 	}
 
@@ -191,7 +198,10 @@ namespace bs
 
 		mDevices.resize(mNumDevices);
 		for(uint32_t i = 0; i < mNumDevices; i++)
+		{
 			mDevices[i] = bs_shared_ptr_new<VulkanDevice>(physicalDevices[i], i);
+			mDevices[i]->loadPipelineCache(getPipelineCachePath(*mDevices[i]));
+		}
 
 		// Find primary device
 		// Note: MULTIGPU - Detect multiple similar devices here if supporting multi-GPU
@@ -269,6 +279,11 @@ namespace bs
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
+		for (auto& task : mPrewarmTasks)
+			task->wait();
+
+		mPrewarmTasks.clear();
+
 		if (mGLSLFactory != nullptr)
 		{
 			bs_delete(mGLSLFactory);
@@ -297,6 +312,9 @@ namespace bs
 
 		CommandBufferManager::shutDown();
 
+		for (auto& device : mDevices)
+			device->savePipelineCache(getPipelineCachePath(*device));
+
 		mPrimaryDevices.clear();
 		mDevices.clear();
 
@@ -534,6 +552,53 @@ namespace bs
 
 		cmdBuffer.submit(syncMask);
 	}
+
+	void VulkanRenderAPI::prewarmPipelines(const Vector<PIPELINE_PERMUTATION_DESC>& permutations)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		auto iterEnd = std::remove_if(mPrewarmTasks.begin(), mPrewarmTasks.end(), 
+			[](const SPtr<Task>& task) { return task->isComplete(); });
+		mPrewarmTasks.erase(iterEnd, mPrewarmTasks.end());
+
+		for (auto& entry : permutations)
+		{
+			if (entry.pipeline == nullptr || entry.target == nullptr || entry.vertexDeclaration == nullptr)
+				continue;
+
+			SPtr<VulkanGraphicsPipelineStateCore> pipeline = 
+				std::static_pointer_cast<VulkanGraphicsPipelineStateCore>(entry.pipeline);
+
+			SPtr<VertexDeclarationCore> inputDecl = pipeline->getInputDeclaration();
+			if (inputDecl == nullptr)
+				continue;
+
+			VulkanFramebuffer* framebuffer = nullptr;
+			entry.target->getCustomAttribute("FB", &framebuffer);
+
+			if (framebuffer == nullptr)
+				continue;
+
+			// Resolve the vertex input here, so the workers only touch the pipeline state, which is internally locked
+			SPtr<VulkanVertexInput> vertexInput = 
+				VulkanVertexInputManager::instance().getVertexInfo(entry.vertexDeclaration, inputDecl);
+
+			// Target is captured to keep the framebuffer alive until the pipeline is created
+			SPtr<RenderTargetCore> target = entry.target;
+			UINT32 deviceIdx = entry.deviceIdx;
+			bool readOnlyDepthStencil = entry.readOnlyDepthStencil;
+			DrawOperationType drawOp = entry.drawOp;
+
+			SPtr<Task> task = Task::create("PipelinePrewarm", 
+				[pipeline, target, framebuffer, vertexInput, deviceIdx, readOnlyDepthStencil, drawOp]()
+			{
+				pipeline->getPipeline(deviceIdx, framebuffer, readOnlyDepthStencil, drawOp, vertexInput);
+			});
+
+			TaskScheduler::instance().addTask(task);
+			mPrewarmTasks.push_back(task);
+		}
+	}
 	
 	void VulkanRenderAPI::convertProjectionMatrix(const Matrix4& matrix, Matrix4& dest)
 	{
@@ -728,6 +793,14 @@ namespace bs
 		}
 	}
 
+	Path VulkanRenderAPI::getPipelineCachePath(const VulkanDevice& device) const
+	{
+		const VkPhysicalDeviceProperties& deviceProps = device.getDeviceProperties();
+		String fileName = "Vulkan_" + toString(deviceProps.vendorID) + "_" + toString(deviceProps.deviceID) + ".cache";
+
+		return FileSystem::getWorkingDirectoryPath() + PIPELINE_CACHE_FOLDER + fileName;
+	}
+
 	VulkanCommandBuffer* VulkanRenderAPI::getCB(const SPtr<CommandBuffer>& buffer)
 	{
 		if (buffer != nullptr)
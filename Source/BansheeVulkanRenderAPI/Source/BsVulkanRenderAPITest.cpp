@@ -0,0 +1,15 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsVulkanTestSuite.h"
+#include "BsConsoleTestOutput.h"
+
+using namespace bs;
+
+int main()
+{
+	SPtr<TestSuite> tests = VulkanTestSuite::create<VulkanTestSuite>();
+	ConsoleTestOutput testOutput;
+	tests->run(testOutput);
+
+	return 0;
+}
@@ -0,0 +1,73 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsVulkanTestSuite.h"
+#include "BsVulkanDevice.h"
+
+namespace bs
+{
+	/** Writes a pipeline cache header for the provided device, followed by @p payloadSize bytes of data. */
+	Vector<UINT8> createPipelineCacheData(const VkPhysicalDeviceProperties& props, UINT32 payloadSize)
+	{
+		UINT32 header[4];
+		header[0] = sizeof(header) + VK_UUID_SIZE;
+		header[1] = VK_PIPELINE_CACHE_HEADER_VERSION_ONE;
+		header[2] = props.vendorID;
+		header[3] = props.deviceID;
+
+		Vector<UINT8> data(sizeof(header) + VK_UUID_SIZE + payloadSize, 0xAB);
+		memcpy(data.data(), header, sizeof(header));
+		memcpy(data.data() + sizeof(header), props.pipelineCacheUUID, VK_UUID_SIZE);
+
+		return data;
+	}
+
+	VulkanTestSuite::VulkanTestSuite()
+	{
+		BS_ADD_TEST(VulkanTestSuite::testPipelineCacheCompatibility);
+	}
+
+	void VulkanTestSuite::testPipelineCacheCompatibility()
+	{
+		VkPhysicalDeviceProperties props;
+		memset(&props, 0, sizeof(props));
+		props.vendorID = 0x10DE;
+		props.deviceID = 0x1B80;
+
+		for (UINT32 i = 0; i < VK_UUID_SIZE; i++)
+			props.pipelineCacheUUID[i] = (UINT8)i;
+
+		// Matching header, with and without cache contents following it
+		Vector<UINT8> data = createPipelineCacheData(props, 64);
+		BS_TEST_ASSERT(VulkanDevice::isPipelineCacheCompatible(data.data(), (UINT32)data.size(), props));
+
+		Vector<UINT8> headerOnly = createPipelineCacheData(props, 0);
+		BS_TEST_ASSERT(VulkanDevice::isPipelineCacheCompatible(headerOnly.data(), (UINT32)headerOnly.size(), props));
+
+		// Empty or truncated data
+		BS_TEST_ASSERT(!VulkanDevice::isPipelineCacheCompatible(nullptr, 0, props));
+		BS_TEST_ASSERT(!VulkanDevice::isPipelineCacheCompatible(data.data(), (UINT32)headerOnly.size() - 1, props));
+
+		// Header length smaller than the header itself
+		Vector<UINT8> badLength = data;
+		badLength[0] = 8;
+		BS_TEST_ASSERT(!VulkanDevice::isPipelineCacheCompatible(badLength.data(), (UINT32)badLength.size(), props));
+
+		// Unknown header version
+		Vector<UINT8> badVersion = data;
+		badVersion[sizeof(UINT32)] = 2;
+		BS_TEST_ASSERT(!VulkanDevice::isPipelineCacheCompatible(badVersion.data(), (UINT32)badVersion.size(), props));
+
+		// Data from another GPU vendor, another GPU, or another driver version
+		VkPhysicalDeviceProperties otherVendor = props;
+		otherVendor.vendorID = 0x1002;
+		BS_TEST_ASSERT(!VulkanDevice::isPipelineCacheCompatible(data.data(), (UINT32)data.size(), otherVendor));
+
+		VkPhysicalDeviceProperties otherDevice = props;
+		otherDevice.deviceID = 0x1B81;
+		BS_TEST_ASSERT(!VulkanDevice::isPipelineCacheCompatible(data.data(), (UINT32)data.size(), otherDevice));
+
+		VkPhysicalDeviceProperties otherDriver = props;
+		otherDriver.pipelineCacheUUID[VK_UUID_SIZE - 1] ^= 0xFF;
+		BS_TEST_ASSERT(!VulkanDevice::isPipelineCacheCompatible(data.data(), (UINT32)data.size(), otherDriver));
+	}
+}
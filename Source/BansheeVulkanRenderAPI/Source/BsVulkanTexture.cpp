@@ -426,9 +426,11 @@ namespace bs
 			}
 		}
 
+		// Only the allocated mip levels are part of the image
 		mImageCI.format = VulkanUtility::getPixelFormat(props.getFormat(), props.isHardwareGammaEnabled());
-		mImageCI.extent = { props.getWidth(), props.getHeight(), props.getDepth() };
-		mImageCI.mipLevels = props.getNumMipmaps() + 1;
+		PixelUtil::getSizeForMipLevel(props.getWidth(), props.getHeight(), props.getDepth(), mAllocatedMip,
+			mImageCI.extent.width, mImageCI.extent.height, mImageCI.extent.depth);
+		mImageCI.mipLevels = props.getNumMipmaps() + 1 - mAllocatedMip;
 		mImageCI.arrayLayers = props.getNumFaces();
 		mImageCI.samples = VulkanUtility::getSampleFlags(props.getNumSamples());
 		mImageCI.tiling = tiling;
@@ -474,7 +476,10 @@ namespace bs
 		result = vkBindImageMemory(vkDevice, image, memory, 0);
 		assert(result == VK_SUCCESS);
 
-		return device.getResourceManager().create<VulkanImage>(image, memory, mImageCI.initialLayout, getProperties());
+		VULKAN_IMAGE_DESC desc = createDesc(image, memory, mImageCI.initialLayout, getProperties());
+		desc.numMipLevels = mImageCI.mipLevels;
+
+		return device.getResourceManager().create<VulkanImage>(desc);
 	}
 
 	VulkanBuffer* VulkanTextureCore::createStaging(VulkanDevice& device, const PixelData& pixelData, bool readable)
@@ -514,14 +519,16 @@ namespace bs
 	}
 
 	void VulkanTextureCore::copyImage(VulkanTransferBuffer* cb, VulkanImage* srcImage, VulkanImage* dstImage, 
-									  VkImageLayout srcFinalLayout, VkImageLayout dstFinalLayout)
+									  VkImageLayout srcFinalLayout, VkImageLayout dstFinalLayout, UINT32 srcFirstMip,
+									  UINT32 dstFirstMip)
 	{
 		UINT32 numFaces = mProperties.getNumFaces();
-		UINT32 numMipmaps = mProperties.getNumMipmaps() + 1;
+		UINT32 firstMip = std::max(srcFirstMip, dstFirstMip);
+		UINT32 numMipmaps = mProperties.getNumMipmaps() + 1 - firstMip;
 
-		UINT32 mipWidth = mProperties.getWidth();
-		UINT32 mipHeight = mProperties.getHeight();
-		UINT32 mipDepth = mProperties.getDepth();
+		UINT32 mipWidth, mipHeight, mipDepth;
+		PixelUtil::getSizeForMipLevel(mProperties.getWidth(), mProperties.getHeight(), mProperties.getDepth(), firstMip,
+									  mipWidth, mipHeight, mipDepth);
 
 		VkImageCopy* imageRegions = bs_stack_alloc<VkImageCopy>(numMipmaps);
 
@@ -534,11 +541,11 @@ namespace bs
 			imageRegion.extent = { mipWidth, mipHeight, mipDepth };
 			imageRegion.srcSubresource.baseArrayLayer = 0;
 			imageRegion.srcSubresource.layerCount = numFaces;
-			imageRegion.srcSubresource.mipLevel = i;
+			imageRegion.srcSubresource.mipLevel = firstMip + i - srcFirstMip;
 			imageRegion.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
 			imageRegion.dstSubresource.baseArrayLayer = 0;
 			imageRegion.dstSubresource.layerCount = numFaces;
-			imageRegion.dstSubresource.mipLevel = i;
+			imageRegion.dstSubresource.mipLevel = firstMip + i - dstFirstMip;
 			imageRegion.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
 
 			if (mipWidth != 1) mipWidth /= 2;
@@ -546,12 +553,12 @@ namespace bs
 			if (mipDepth != 1) mipDepth /= 2;
 		}
 
-		VkImageSubresourceRange range;
-		range.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-		range.baseArrayLayer = 0;
-		range.layerCount = numFaces;
-		range.baseMipLevel = 0;
-		range.levelCount = numMipmaps;
+		// Layouts are transitioned for the entire images, which can contain different numbers of mip levels
+		VkImageSubresourceRange srcRange = srcImage->getRange();
+		srcRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+
+		VkImageSubresourceRange dstRange = dstImage->getRange();
+		dstRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
 
 		VkAccessFlags srcAccessMask = srcImage->getAccessFlags(srcImage->getLayout());
 		VkAccessFlags dstAccessMask = dstImage->getAccessFlags(dstImage->getLayout());
@@ -570,10 +577,10 @@ namespace bs
 
 		// Transfer textures to a valid layout
 		cb->setLayout(srcImage->getHandle(), srcAccessMask, VK_ACCESS_TRANSFER_READ_BIT, srcImage->getLayout(),
-							  transferSrcLayout, range);
+							  transferSrcLayout, srcRange);
 
 		cb->setLayout(dstImage->getHandle(), dstAccessMask, VK_ACCESS_TRANSFER_WRITE_BIT,
-							  dstImage->getLayout(), transferDstLayout, range);
+							  dstImage->getLayout(), transferDstLayout, dstRange);
 
 		vkCmdCopyImage(cb->getCB()->getHandle(), srcImage->getHandle(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
 						dstImage->getHandle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, numMipmaps, imageRegions);
@@ -581,11 +588,11 @@ namespace bs
 		// Transfer back to final layouts
 		srcAccessMask = srcImage->getAccessFlags(srcFinalLayout);
 		cb->setLayout(srcImage->getHandle(), VK_ACCESS_TRANSFER_READ_BIT, srcAccessMask,
-							  transferSrcLayout, srcFinalLayout, range);
+							  transferSrcLayout, srcFinalLayout, srcRange);
 
 		dstAccessMask = dstImage->getAccessFlags(dstFinalLayout);
 		cb->setLayout(dstImage->getHandle(), VK_ACCESS_TRANSFER_WRITE_BIT, dstAccessMask,
-							  transferDstLayout, dstFinalLayout, range);
+							  transferDstLayout, dstFinalLayout, dstRange);
 
 		bs_stack_free(imageRegions);
 	}
@@ -653,17 +660,21 @@ namespace bs
 		PixelUtil::getSizeForMipLevel(srcProps.getWidth(), srcProps.getHeight(), srcProps.getDepth(), srcMipLevel,
 									  mipWidth, mipHeight, mipDepth);
 
+		// Images only contain the allocated mip levels
+		UINT32 srcImageMip = srcMipLevel - mAllocatedMip;
+		UINT32 dstImageMip = destMipLevel - other->getAllocatedMip();
+
 		VkImageResolve resolveRegion;
 		resolveRegion.srcOffset = { 0, 0, 0 };
 		resolveRegion.dstOffset = { 0, 0, 0 };
 		resolveRegion.extent = { mipWidth, mipHeight, mipDepth };
 		resolveRegion.srcSubresource.baseArrayLayer = srcFace;
 		resolveRegion.srcSubresource.layerCount = 1;
-		resolveRegion.srcSubresource.mipLevel = srcMipLevel;
+		resolveRegion.srcSubresource.mipLevel = srcImageMip;
 		resolveRegion.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
 		resolveRegion.dstSubresource.baseArrayLayer = destFace;
 		resolveRegion.dstSubresource.layerCount = 1;
-		resolveRegion.dstSubresource.mipLevel = destMipLevel;
+		resolveRegion.dstSubresource.mipLevel = dstImageMip;
 		resolveRegion.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
 
 		VkImageCopy imageRegion;
@@ -672,25 +683,25 @@ namespace bs
 		imageRegion.extent = { mipWidth, mipHeight, mipDepth };
 		imageRegion.srcSubresource.baseArrayLayer = srcFace;
 		imageRegion.srcSubresource.layerCount = 1;
-		imageRegion.srcSubresource.mipLevel = srcMipLevel;
+		imageRegion.srcSubresource.mipLevel = srcImageMip;
 		imageRegion.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
 		imageRegion.dstSubresource.baseArrayLayer = destFace;
 		imageRegion.dstSubresource.layerCount = 1;
-		imageRegion.dstSubresource.mipLevel = destMipLevel;
+		imageRegion.dstSubresource.mipLevel = dstImageMip;
 		imageRegion.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
 
 		VkImageSubresourceRange srcRange;
 		srcRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
 		srcRange.baseArrayLayer = srcFace;
 		srcRange.layerCount = 1;
-		srcRange.baseMipLevel = srcMipLevel;
+		srcRange.baseMipLevel = srcImageMip;
 		srcRange.levelCount = 1;
 
 		VkImageSubresourceRange dstRange;
 		dstRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
 		dstRange.baseArrayLayer = destFace;
 		dstRange.layerCount = 1;
-		dstRange.baseMipLevel = destMipLevel;
+		dstRange.baseMipLevel = dstImageMip;
 		dstRange.levelCount = 1;
 
 		VulkanRenderAPI& rapi = static_cast<VulkanRenderAPI&>(RenderAPICore::instance());
@@ -728,7 +739,7 @@ namespace bs
 						oldDstLayout = getOptimalLayout();
 
 					dstLayout = getOptimalLayout();
-					copyImage(transferCB, dstImage, newImage, oldDstLayout, dstLayout);
+					copyImage(transferCB, dstImage, newImage, oldDstLayout, dstLayout, mAllocatedMip, mAllocatedMip);
 
 					VkAccessFlags accessMask = dstImage->getAccessFlags(oldDstLayout);
 					transferCB->getCB()->registerResource(dstImage, accessMask, oldDstLayout, oldDstLayout, oldDstLayout,
@@ -785,8 +796,8 @@ namespace bs
 			// Need to wait if subresource we're reading from is being written, or if the subresource we're writing to is
 			// being accessed in any way
 
-			VulkanImageSubresource* srcSubresource = srcImage->getSubresource(srcFace, srcMipLevel);
-			VulkanImageSubresource* dstSubresource = dstImage->getSubresource(srcFace, srcMipLevel);
+			VulkanImageSubresource* srcSubresource = srcImage->getSubresource(srcFace, srcImageMip);
+			VulkanImageSubresource* dstSubresource = dstImage->getSubresource(destFace, dstImageMip);
 
 			UINT32 srcUseFlags = srcSubresource->getUseInfo(VulkanUseFlag::Write);
 			UINT32 dstUseFlags = dstSubresource->getUseInfo(VulkanUseFlag::Read | VulkanUseFlag::Write);
@@ -843,7 +854,9 @@ namespace bs
 		GpuQueueType queueType;
 		UINT32 localQueueIdx = CommandSyncMask::getQueueIdxAndType(queueIdx, queueType);
 
-		VulkanImageSubresource* subresource = image->getSubresource(face, mipLevel);
+		// Image only contains the allocated mip levels
+		UINT32 imageMip = mipLevel - mAllocatedMip;
+		VulkanImageSubresource* subresource = image->getSubresource(face, imageMip);
 
 		// If memory is host visible try mapping it directly
 		if (mDirectlyMappable)
@@ -890,7 +903,7 @@ namespace bs
 					mImages[deviceIdx] = image;
 				}
 
-				image->map(face, mipLevel, lockedArea);
+				image->map(face, imageMip, lockedArea);
 				return lockedArea;
 			}
 
@@ -898,7 +911,7 @@ namespace bs
 			// subresource
 			if (options == GBL_WRITE_ONLY_NO_OVERWRITE)
 			{
-				image->map(face, mipLevel, lockedArea);
+				image->map(face, imageMip, lockedArea);
 				return lockedArea;
 			}
 
@@ -911,7 +924,7 @@ namespace bs
 				image = createImage(device);
 				mImages[deviceIdx] = image;
 
-				image->map(face, mipLevel, lockedArea);
+				image->map(face, imageMip, lockedArea);
 				return lockedArea;
 			}
 
@@ -954,7 +967,7 @@ namespace bs
 					mImages[deviceIdx] = image;
 				}
 
-				image->map(face, mipLevel, lockedArea);
+				image->map(face, imageMip, lockedArea);
 				return lockedArea;
 			}
 
@@ -996,7 +1009,7 @@ namespace bs
 
 			range.baseArrayLayer = face;
 			range.layerCount = 1;
-			range.baseMipLevel = mipLevel;
+			range.baseMipLevel = imageMip;
 			range.levelCount = 1;
 
 			VkImageSubresourceLayers rangeLayers;
@@ -1088,7 +1101,8 @@ namespace bs
 				VkImageLayout curLayout = image->getLayout();
 				VulkanTransferBuffer* transferCB = cbManager.getTransferBuffer(mMappedDeviceIdx, queueType, localQueueIdx);
 
-				VulkanImageSubresource* subresource = image->getSubresource(mMappedFace, mMappedMip);
+				UINT32 imageMip = mMappedMip - mAllocatedMip;
+				VulkanImageSubresource* subresource = image->getSubresource(mMappedFace, imageMip);
 
 				// If the subresource is used in any way on the GPU, we need to wait for that use to finish before
 				// we issue our copy
@@ -1112,7 +1126,7 @@ namespace bs
 						image = createImage(device);
 						mImages[mMappedDeviceIdx] = image;
 
-						subresource = image->getSubresource(mMappedFace, mMappedMip);
+						subresource = image->getSubresource(mMappedFace, imageMip);
 					}
 					else // Otherwise we have no choice but to issue a dependency between the queues
 					{
@@ -1147,7 +1161,7 @@ namespace bs
 								oldImgLayout = getOptimalLayout();
 
 							curLayout = getOptimalLayout();
-							copyImage(transferCB, image, newImage, oldImgLayout, curLayout);
+							copyImage(transferCB, image, newImage, oldImgLayout, curLayout, mAllocatedMip, mAllocatedMip);
 
 							VkAccessFlags accessMask = image->getAccessFlags(oldImgLayout);
 							transferCB->getCB()->registerResource(image, accessMask, oldImgLayout, oldImgLayout, 
@@ -1168,7 +1182,7 @@ namespace bs
 
 				range.baseArrayLayer = mMappedFace;
 				range.layerCount = 1;
-				range.baseMipLevel = mMappedMip;
+				range.baseMipLevel = imageMip;
 				range.levelCount = 1;
 
 				VkImageSubresourceLayers rangeLayers;
@@ -1279,4 +1293,47 @@ namespace bs
 
 		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_Texture);
 	}
+
+	void VulkanTextureCore::setAllocatedMipImpl(UINT32 prevMip)
+	{
+		const TextureProperties& props = getProperties();
+
+		PixelUtil::getSizeForMipLevel(props.getWidth(), props.getHeight(), props.getDepth(), mAllocatedMip,
+			mImageCI.extent.width, mImageCI.extent.height, mImageCI.extent.depth);
+		mImageCI.mipLevels = props.getNumMipmaps() + 1 - mAllocatedMip;
+
+		VulkanRenderAPI& rapi = static_cast<VulkanRenderAPI&>(RenderAPICore::instance());
+		VulkanCommandBufferManager& cbManager = gVulkanCBManager();
+
+		// Create images containing only the newly allocated mip levels, and copy over the levels both images share. 
+		// Old images are released once the GPU is done with them.
+		for (UINT32 i = 0; i < BS_MAX_DEVICES; i++)
+		{
+			VulkanImage* image = mImages[i];
+			if (image == nullptr)
+				continue;
+
+			VulkanDevice& device = *rapi._getDevice(i);
+			VulkanImage* newImage = createImage(device);
+			VulkanTransferBuffer* transferCB = cbManager.getTransferBuffer(i, GQT_GRAPHICS, 0);
+
+			VkImageLayout oldLayout = image->getLayout();
+			if (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED || oldLayout == VK_IMAGE_LAYOUT_PREINITIALIZED)
+				oldLayout = getOptimalLayout();
+
+			VkImageLayout newLayout = getOptimalLayout();
+			copyImage(transferCB, image, newImage, oldLayout, newLayout, prevMip, mAllocatedMip);
+
+			VkAccessFlags oldAccessMask = image->getAccessFlags(oldLayout);
+			transferCB->getCB()->registerResource(image, oldAccessMask, oldLayout, oldLayout, oldLayout, 
+				VulkanUseFlag::Read);
+
+			VkAccessFlags newAccessMask = newImage->getAccessFlags(newLayout);
+			transferCB->getCB()->registerResource(newImage, newAccessMask, newLayout, newLayout, newLayout, 
+				VulkanUseFlag::Write);
+
+			image->destroy();
+			mImages[i] = newImage;
+		}
+	}
 }
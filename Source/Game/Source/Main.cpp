@@ -8,6 +8,7 @@
 #include "BsFileSystem.h"
 #include "BsResources.h"
 #include "BsResourceManifest.h"
+#include "BsPackFile.h"
 #include "BsPrefab.h"
 #include "BsSceneObject.h"
 #include "BsSceneManager.h"
@@ -72,6 +73,7 @@ void runApplication()
 	startUpDesc.audio = BS_AUDIO_MODULE;
 	startUpDesc.physics = BS_PHYSICS_MODULE;
 	startUpDesc.input = BS_INPUT_MODULE;
+	startUpDesc.textureStreaming = true; // Ignored by render APIs that don't support it
 
 	startUpDesc.primaryWindowDesc.videoMode = VideoMode(resolutionWidth, resolutionHeight);
 	startUpDesc.primaryWindowDesc.title = toString(gameSettings->titleBarText);
@@ -139,6 +141,12 @@ void runApplication()
 		gResources().registerResourceManifest(manifest);
 	}
 
+	// If resources were packed into a single file, load them from it instead of from individual files
+	Path resourcePackPath = resourcesPath + GAME_RESOURCES_PACK_NAME;
+	SPtr<PackFile> resourcePack = PackFile::open(resourcePackPath);
+	if (resourcePack != nullptr)
+		gResources().registerPackFile(resourcePack);
+
 	{
 		HPrefab mainScene = static_resource_cast<Prefab>(gResources().loadFromUUID(gameSettings->mainSceneUUID, 
 			false, ResourceLoadFlag::LoadDependencies));
@@ -25,6 +25,9 @@ namespace BansheeEditor
         private GUIEnumField collisionMeshTypeField;
         private GUIToggleField keyFrameReductionField;
         private GUIToggleField rootMotionField;
+        private GUIIntField numLODsField;
+        private GUISliderField lodReductionField;
+        private GUIToggleField optimizeField;
         private GUIArrayField<AnimationSplitInfo, AnimSplitArrayRow> animSplitInfoField;
         private GUIButton reimportButton;
 
@@ -58,6 +61,9 @@ namespace BansheeEditor
             collisionMeshTypeField.Value = (ulong)newImportOptions.CollisionMeshType;
             keyFrameReductionField.Value = newImportOptions.KeyframeReduction;
             rootMotionField.Value = newImportOptions.ImportRootMotion;
+            numLODsField.Value = newImportOptions.NumLODs;
+            lodReductionField.Value = newImportOptions.LODReduction;
+            optimizeField.Value = newImportOptions.OptimizeMesh;
 
             importOptions = newImportOptions;
 
@@ -81,6 +87,9 @@ namespace BansheeEditor
             collisionMeshTypeField = new GUIEnumField(typeof(CollisionMeshType), new LocEdString("Collision mesh"));
             keyFrameReductionField = new GUIToggleField(new LocEdString("Keyframe Reduction"));
             rootMotionField = new GUIToggleField(new LocEdString("Import root motion"));
+            numLODsField = new GUIIntField(new LocEdString("Levels of detail"));
+            lodReductionField = new GUISliderField(0.05f, 0.95f, new LocEdString("LOD reduction"));
+            optimizeField = new GUIToggleField(new LocEdString("Optimize"));
             reimportButton = new GUIButton(new LocEdString("Reimport"));
 
             normalsField.OnChanged += x => importOptions.ImportNormals = x;
@@ -93,6 +102,9 @@ namespace BansheeEditor
             collisionMeshTypeField.OnSelectionChanged += x => importOptions.CollisionMeshType = (CollisionMeshType)x;
             keyFrameReductionField.OnChanged += x => importOptions.KeyframeReduction = x;
             rootMotionField.OnChanged += x => importOptions.ImportRootMotion = x;
+            numLODsField.OnChanged += x => importOptions.NumLODs = x;
+            lodReductionField.OnChanged += x => importOptions.LODReduction = x;
+            optimizeField.OnChanged += x => importOptions.OptimizeMesh = x;
 
             reimportButton.OnClick += TriggerReimport;
 
@@ -106,6 +118,9 @@ namespace BansheeEditor
             Layout.AddElement(collisionMeshTypeField);
             Layout.AddElement(keyFrameReductionField);
             Layout.AddElement(rootMotionField);
+            Layout.AddElement(numLODsField);
+            Layout.AddElement(lodReductionField);
+            Layout.AddElement(optimizeField);
 
             splitInfos = importOptions.AnimationClipSplits;
 
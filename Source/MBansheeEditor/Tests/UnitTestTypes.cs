@@ -137,5 +137,19 @@ namespace BansheeEditor
         }
     }
 
+    /// <summary>
+    /// Helper component used for unit tests. Counts how many times it was updated.
+    /// </summary>
+    [RunInEditor]
+    internal class UT5_UpdateCounter : Component
+    {
+        public int numUpdates;
+
+        private void OnUpdate()
+        {
+            numUpdates++;
+        }
+    }
+
     /** @} */
 }
@@ -776,6 +776,39 @@ namespace BansheeEditor
             */
         }
 
+        /// <summary>
+        /// Tests that managed components are updated exactly once per update with both per-component and batched update
+        /// dispatch, and logs the update cost per component for each.
+        /// </summary>
+        static void UnitTest5_ComponentUpdates()
+        {
+            const int numComponents = 5000;
+            const int numIterations = 10;
+
+            SceneObject root = new SceneObject("UT5_Root");
+            UT5_UpdateCounter[] components = new UT5_UpdateCounter[numComponents];
+            for (int i = 0; i < numComponents; i++)
+            {
+                SceneObject so = new SceneObject("UT5_SO");
+                so.Parent = root;
+
+                components[i] = so.AddComponent<UT5_UpdateCounter>();
+            }
+
+            float perComponentTime, batchedTime;
+            Internal_UT5_UpdateComponents(root, numIterations, out perComponentTime, out batchedTime);
+
+            for (int i = 0; i < numComponents; i++)
+                Assert(components[i].numUpdates == numIterations * 2);
+
+            float numUpdates = numComponents * numIterations;
+            Debug.Log("Managed component update (per component): " + (perComponentTime * 1000.0f / numUpdates) +
+                " us/component");
+            Debug.Log("Managed component update (batched): " + (batchedTime * 1000.0f / numUpdates) + " us/component");
+
+            root.Destroy(true);
+        }
+
         /// <summary>
         /// Runs all tests.
         /// </summary>
@@ -785,6 +818,7 @@ namespace BansheeEditor
             UnitTest2_SerializableProperties();
             UnitTest3_ManagedDiff();
             UnitTest4_Prefabs();
+            UnitTest5_ComponentUpdates();
         }
 
         [MethodImpl(MethodImplOptions.InternalCall)]
@@ -795,6 +829,10 @@ namespace BansheeEditor
 
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_UT3_ApplyDiff(UT_DiffObj obj);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_UT5_UpdateComponents(SceneObject root, int numIterations,
+            out float perComponentTime, out float batchedTime);
     }
 
     /** @} */
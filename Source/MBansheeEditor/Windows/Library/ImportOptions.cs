@@ -239,6 +239,38 @@ namespace BansheeEditor
             set { Internal_SetRootMotion(mCachedPtr, value); }
         }
 
+        /// <summary>
+        /// Number of levels of detail to generate for the mesh, including the full detail level. Lower levels are 
+        /// generated by simplifying the mesh, and are picked at runtime depending on the mesh's size on screen. Set to 1
+        /// to disable level of detail generation.
+        /// </summary>
+        public int NumLODs
+        {
+            get { return (int)Internal_GetNumLODs(mCachedPtr); }
+            set { Internal_SetNumLODs(mCachedPtr, (uint)MathEx.Max(value, 1)); }
+        }
+
+        /// <summary>
+        /// Fraction of triangles each level of detail keeps compared to the previous level, in range (0, 1). Only relevant
+        /// if more than one level of detail is generated.
+        /// </summary>
+        public float LODReduction
+        {
+            get { return Internal_GetLODReduction(mCachedPtr); }
+            set { Internal_SetLODReduction(mCachedPtr, value); }
+        }
+
+        /// <summary>
+        /// Determines if the mesh should be optimized for rendering. When enabled triangles are reordered for better vertex
+        /// cache utilization and reduced overdraw, and vertices are reordered for better fetch locality. Doesn't change the
+        /// look of the mesh.
+        /// </summary>
+        public bool OptimizeMesh
+        {
+            get { return Internal_GetOptimizeMesh(mCachedPtr); }
+            set { Internal_SetOptimizeMesh(mCachedPtr, value); }
+        }
+
         /// <summary>
         /// Controls what type (if any) of collision mesh should be imported.
         /// </summary>
@@ -319,6 +351,24 @@ namespace BansheeEditor
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_SetRootMotion(IntPtr thisPtr, bool value);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern uint Internal_GetNumLODs(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetNumLODs(IntPtr thisPtr, uint value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern float Internal_GetLODReduction(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetLODReduction(IntPtr thisPtr, float value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_GetOptimizeMesh(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetOptimizeMesh(IntPtr thisPtr, bool value);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern AnimationSplitInfo[] Internal_GetAnimationClipSplits(IntPtr thisPtr);
 
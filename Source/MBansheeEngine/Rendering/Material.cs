@@ -284,6 +284,235 @@ namespace BansheeEngine
             return Internal_GetTextureCube(mCachedPtr, name);
         }
 
+        /// <summary>
+        /// Returns a handle to the float shader parameter with the specified name. Handle can be used for setting and
+        /// getting the parameter value more efficiently than by name, as the name only needs to be looked up once.
+        /// </summary>
+        /// <param name="name">Name of the shader parameter.</param>
+        /// <returns>Handle to the parameter. Not valid if the material has no parameter with the name and type.</returns>
+        public MaterialParam<float> GetParamFloat(string name)
+        {
+            return new MaterialParam<float>(this, Internal_GetParamFloat(mCachedPtr, name));
+        }
+
+        /// <summary>
+        /// Returns a handle to the 2D vector shader parameter with the specified name. Handle can be used for setting and
+        /// getting the parameter value more efficiently than by name, as the name only needs to be looked up once.
+        /// </summary>
+        /// <param name="name">Name of the shader parameter.</param>
+        /// <returns>Handle to the parameter. Not valid if the material has no parameter with the name and type.</returns>
+        public MaterialParam<Vector2> GetParamVector2(string name)
+        {
+            return new MaterialParam<Vector2>(this, Internal_GetParamVector2(mCachedPtr, name));
+        }
+
+        /// <summary>
+        /// Returns a handle to the 3D vector shader parameter with the specified name. Handle can be used for setting and
+        /// getting the parameter value more efficiently than by name, as the name only needs to be looked up once.
+        /// </summary>
+        /// <param name="name">Name of the shader parameter.</param>
+        /// <returns>Handle to the parameter. Not valid if the material has no parameter with the name and type.</returns>
+        public MaterialParam<Vector3> GetParamVector3(string name)
+        {
+            return new MaterialParam<Vector3>(this, Internal_GetParamVector3(mCachedPtr, name));
+        }
+
+        /// <summary>
+        /// Returns a handle to the 4D vector shader parameter with the specified name. Handle can be used for setting and
+        /// getting the parameter value more efficiently than by name, as the name only needs to be looked up once.
+        /// </summary>
+        /// <param name="name">Name of the shader parameter.</param>
+        /// <returns>Handle to the parameter. Not valid if the material has no parameter with the name and type.</returns>
+        public MaterialParam<Vector4> GetParamVector4(string name)
+        {
+            return new MaterialParam<Vector4>(this, Internal_GetParamVector4(mCachedPtr, name));
+        }
+
+        /// <summary>
+        /// Returns a handle to the 3x3 matrix shader parameter with the specified name. Handle can be used for setting and
+        /// getting the parameter value more efficiently than by name, as the name only needs to be looked up once.
+        /// </summary>
+        /// <param name="name">Name of the shader parameter.</param>
+        /// <returns>Handle to the parameter. Not valid if the material has no parameter with the name and type.</returns>
+        public MaterialParam<Matrix3> GetParamMatrix3(string name)
+        {
+            return new MaterialParam<Matrix3>(this, Internal_GetParamMatrix3(mCachedPtr, name));
+        }
+
+        /// <summary>
+        /// Returns a handle to the 4x4 matrix shader parameter with the specified name. Handle can be used for setting and
+        /// getting the parameter value more efficiently than by name, as the name only needs to be looked up once.
+        /// </summary>
+        /// <param name="name">Name of the shader parameter.</param>
+        /// <returns>Handle to the parameter. Not valid if the material has no parameter with the name and type.</returns>
+        public MaterialParam<Matrix4> GetParamMatrix4(string name)
+        {
+            return new MaterialParam<Matrix4>(this, Internal_GetParamMatrix4(mCachedPtr, name));
+        }
+
+        /// <summary>
+        /// Returns a handle to the color shader parameter with the specified name. Handle can be used for setting and
+        /// getting the parameter value more efficiently than by name, as the name only needs to be looked up once.
+        /// </summary>
+        /// <param name="name">Name of the shader parameter.</param>
+        /// <returns>Handle to the parameter. Not valid if the material has no parameter with the name and type.</returns>
+        public MaterialParam<Color> GetParamColor(string name)
+        {
+            return new MaterialParam<Color>(this, Internal_GetParamColor(mCachedPtr, name));
+        }
+
+        /// <summary>
+        /// Assigns a float value to the shader parameter referenced by the handle.
+        /// </summary>
+        /// <param name="param">Handle to the parameter, as returned by <see cref="GetParamFloat"/>.</param>
+        /// <param name="value">Value of the parameter.</param>
+        public void SetFloat(MaterialParam<float> param, float value)
+        {
+            Internal_SetFloatParam(mCachedPtr, param.GetHandle(this), value);
+        }
+
+        /// <summary>
+        /// Assigns a 2D vector to the shader parameter referenced by the handle.
+        /// </summary>
+        /// <param name="param">Handle to the parameter, as returned by <see cref="GetParamVector2"/>.</param>
+        /// <param name="value">Value of the parameter.</param>
+        public void SetVector2(MaterialParam<Vector2> param, Vector2 value)
+        {
+            Internal_SetVector2Param(mCachedPtr, param.GetHandle(this), ref value);
+        }
+
+        /// <summary>
+        /// Assigns a 3D vector to the shader parameter referenced by the handle.
+        /// </summary>
+        /// <param name="param">Handle to the parameter, as returned by <see cref="GetParamVector3"/>.</param>
+        /// <param name="value">Value of the parameter.</param>
+        public void SetVector3(MaterialParam<Vector3> param, Vector3 value)
+        {
+            Internal_SetVector3Param(mCachedPtr, param.GetHandle(this), ref value);
+        }
+
+        /// <summary>
+        /// Assigns a 4D vector to the shader parameter referenced by the handle.
+        /// </summary>
+        /// <param name="param">Handle to the parameter, as returned by <see cref="GetParamVector4"/>.</param>
+        /// <param name="value">Value of the parameter.</param>
+        public void SetVector4(MaterialParam<Vector4> param, Vector4 value)
+        {
+            Internal_SetVector4Param(mCachedPtr, param.GetHandle(this), ref value);
+        }
+
+        /// <summary>
+        /// Assigns a 3x3 matrix to the shader parameter referenced by the handle.
+        /// </summary>
+        /// <param name="param">Handle to the parameter, as returned by <see cref="GetParamMatrix3"/>.</param>
+        /// <param name="value">Value of the parameter.</param>
+        public void SetMatrix3(MaterialParam<Matrix3> param, Matrix3 value)
+        {
+            Internal_SetMatrix3Param(mCachedPtr, param.GetHandle(this), ref value);
+        }
+
+        /// <summary>
+        /// Assigns a 4x4 matrix to the shader parameter referenced by the handle.
+        /// </summary>
+        /// <param name="param">Handle to the parameter, as returned by <see cref="GetParamMatrix4"/>.</param>
+        /// <param name="value">Value of the parameter.</param>
+        public void SetMatrix4(MaterialParam<Matrix4> param, Matrix4 value)
+        {
+            Internal_SetMatrix4Param(mCachedPtr, param.GetHandle(this), ref value);
+        }
+
+        /// <summary>
+        /// Assigns a color to the shader parameter referenced by the handle.
+        /// </summary>
+        /// <param name="param">Handle to the parameter, as returned by <see cref="GetParamColor"/>.</param>
+        /// <param name="value">Value of the parameter.</param>
+        public void SetColor(MaterialParam<Color> param, Color value)
+        {
+            Internal_SetColorParam(mCachedPtr, param.GetHandle(this), ref value);
+        }
+
+        /// <summary>
+        /// Returns a float value assigned to the shader parameter referenced by the handle.
+        /// </summary>
+        /// <param name="param">Handle to the parameter, as returned by <see cref="GetParamFloat"/>.</param>
+        /// <returns>Value of the parameter.</returns>
+        public float GetFloat(MaterialParam<float> param)
+        {
+            return Internal_GetFloatParam(mCachedPtr, param.GetHandle(this));
+        }
+
+        /// <summary>
+        /// Returns a 2D vector assigned to the shader parameter referenced by the handle.
+        /// </summary>
+        /// <param name="param">Handle to the parameter, as returned by <see cref="GetParamVector2"/>.</param>
+        /// <returns>Value of the parameter.</returns>
+        public Vector2 GetVector2(MaterialParam<Vector2> param)
+        {
+            Vector2 value;
+            Internal_GetVector2Param(mCachedPtr, param.GetHandle(this), out value);
+            return value;
+        }
+
+        /// <summary>
+        /// Returns a 3D vector assigned to the shader parameter referenced by the handle.
+        /// </summary>
+        /// <param name="param">Handle to the parameter, as returned by <see cref="GetParamVector3"/>.</param>
+        /// <returns>Value of the parameter.</returns>
+        public Vector3 GetVector3(MaterialParam<Vector3> param)
+        {
+            Vector3 value;
+            Internal_GetVector3Param(mCachedPtr, param.GetHandle(this), out value);
+            return value;
+        }
+
+        /// <summary>
+        /// Returns a 4D vector assigned to the shader parameter referenced by the handle.
+        /// </summary>
+        /// <param name="param">Handle to the parameter, as returned by <see cref="GetParamVector4"/>.</param>
+        /// <returns>Value of the parameter.</returns>
+        public Vector4 GetVector4(MaterialParam<Vector4> param)
+        {
+            Vector4 value;
+            Internal_GetVector4Param(mCachedPtr, param.GetHandle(this), out value);
+            return value;
+        }
+
+        /// <summary>
+        /// Returns a 3x3 matrix assigned to the shader parameter referenced by the handle.
+        /// </summary>
+        /// <param name="param">Handle to the parameter, as returned by <see cref="GetParamMatrix3"/>.</param>
+        /// <returns>Value of the parameter.</returns>
+        public Matrix3 GetMatrix3(MaterialParam<Matrix3> param)
+        {
+            Matrix3 value;
+            Internal_GetMatrix3Param(mCachedPtr, param.GetHandle(this), out value);
+            return value;
+        }
+
+        /// <summary>
+        /// Returns a 4x4 matrix assigned to the shader parameter referenced by the handle.
+        /// </summary>
+        /// <param name="param">Handle to the parameter, as returned by <see cref="GetParamMatrix4"/>.</param>
+        /// <returns>Value of the parameter.</returns>
+        public Matrix4 GetMatrix4(MaterialParam<Matrix4> param)
+        {
+            Matrix4 value;
+            Internal_GetMatrix4Param(mCachedPtr, param.GetHandle(this), out value);
+            return value;
+        }
+
+        /// <summary>
+        /// Returns a color assigned to the shader parameter referenced by the handle.
+        /// </summary>
+        /// <param name="param">Handle to the parameter, as returned by <see cref="GetParamColor"/>.</param>
+        /// <returns>Value of the parameter.</returns>
+        public Color GetColor(MaterialParam<Color> param)
+        {
+            Color value;
+            Internal_GetColorParam(mCachedPtr, param.GetHandle(this), out value);
+            return value;
+        }
+
         /// <summary>
         /// Creates a deep copy of the material.
         /// </summary>
@@ -362,6 +591,69 @@ namespace BansheeEngine
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern TextureCube Internal_GetTextureCube(IntPtr nativeInstance, string name);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern uint Internal_GetParamFloat(IntPtr nativeInstance, string name);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetFloatParam(IntPtr nativeInstance, uint handle, float value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern float Internal_GetFloatParam(IntPtr nativeInstance, uint handle);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern uint Internal_GetParamVector2(IntPtr nativeInstance, string name);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetVector2Param(IntPtr nativeInstance, uint handle, ref Vector2 value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_GetVector2Param(IntPtr nativeInstance, uint handle, out Vector2 value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern uint Internal_GetParamVector3(IntPtr nativeInstance, string name);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetVector3Param(IntPtr nativeInstance, uint handle, ref Vector3 value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_GetVector3Param(IntPtr nativeInstance, uint handle, out Vector3 value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern uint Internal_GetParamVector4(IntPtr nativeInstance, string name);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetVector4Param(IntPtr nativeInstance, uint handle, ref Vector4 value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_GetVector4Param(IntPtr nativeInstance, uint handle, out Vector4 value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern uint Internal_GetParamMatrix3(IntPtr nativeInstance, string name);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetMatrix3Param(IntPtr nativeInstance, uint handle, ref Matrix3 value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_GetMatrix3Param(IntPtr nativeInstance, uint handle, out Matrix3 value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern uint Internal_GetParamMatrix4(IntPtr nativeInstance, string name);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetMatrix4Param(IntPtr nativeInstance, uint handle, ref Matrix4 value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_GetMatrix4Param(IntPtr nativeInstance, uint handle, out Matrix4 value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern uint Internal_GetParamColor(IntPtr nativeInstance, string name);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetColorParam(IntPtr nativeInstance, uint handle, ref Color value);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_GetColorParam(IntPtr nativeInstance, uint handle, out Color value);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern Material Internal_Clone(IntPtr nativeInstance);
     }
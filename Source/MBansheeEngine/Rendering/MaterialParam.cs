@@ -0,0 +1,55 @@
+﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+
+namespace BansheeEngine
+{
+    /** @addtogroup Rendering
+     *  @{
+     */
+
+    /// <summary>
+    /// Handle to a parameter of a <see cref="Material"/>. Retrieve it once through one of the Material.GetParam* methods
+    /// and then use it for setting or getting the parameter value, avoiding the parameter name lookup on every access.
+    /// Handle can only be used with the material it was retrieved from, and is invalidated when the material's shader
+    /// changes.
+    /// </summary>
+    /// <typeparam name="T">Type of the value stored in the parameter.</typeparam>
+    public struct MaterialParam<T> where T : struct
+    {
+        private readonly Material owner;
+        private readonly uint handle;
+
+        /// <summary>
+        /// Creates a new handle from an identifier retrieved from the native material.
+        /// </summary>
+        /// <param name="owner">Material the handle was retrieved from.</param>
+        /// <param name="handle">Native identifier of the parameter handle.</param>
+        internal MaterialParam(Material owner, uint handle)
+        {
+            this.owner = owner;
+            this.handle = handle;
+        }
+
+        /// <summary>
+        /// Returns the native identifier of the parameter handle, or an invalid identifier if the handle was retrieved
+        /// from a different material. Native identifiers are only unique within a single material.
+        /// </summary>
+        /// <param name="material">Material the handle is being used with.</param>
+        /// <returns>Native identifier to pass to the material.</returns>
+        internal uint GetHandle(Material material)
+        {
+            return owner == material ? handle : uint.MaxValue;
+        }
+
+        /// <summary>
+        /// Checks if the handle references an existing parameter. Handle is not valid if the material had no parameter
+        /// with the requested name and type.
+        /// </summary>
+        public bool IsValid
+        {
+            get { return handle != uint.MaxValue; }
+        }
+    }
+
+    /** @} */
+}
@@ -1,6 +1,8 @@
 ﻿//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 using System;
+using System.Collections.Generic;
+using System.Reflection;
 using System.Runtime.CompilerServices;
 
 namespace BansheeEngine
@@ -91,6 +93,87 @@ namespace BansheeEngine
             Internal_Invoke(mCachedPtr, name);
         }
 
+        /// <summary>
+        /// Methods that call OnUpdate on an array of components, one for each component type that was updated so far.
+        /// </summary>
+        private static Dictionary<Type, Action<Component[]>> updateBatchMethods =
+            new Dictionary<Type, Action<Component[]>>();
+
+        /// <summary>
+        /// Triggered by the runtime once per frame for each component type that implements OnUpdate. Calls OnUpdate on
+        /// all the provided components, so the runtime doesn't need to call into managed code for each component
+        /// separately.
+        /// </summary>
+        /// <param name="type">Type of all the components in the array.</param>
+        /// <param name="components">Components to update. Entries of components that were disabled after the array was
+        ///                          created are null.</param>
+        private static void Internal_UpdateBatch(Type type, Component[] components)
+        {
+            Action<Component[]> updateBatch;
+            if (!updateBatchMethods.TryGetValue(type, out updateBatch))
+            {
+                updateBatch = CreateUpdateBatchMethod(type);
+                updateBatchMethods[type] = updateBatch;
+            }
+
+            updateBatch(components);
+        }
+
+        /// <summary>
+        /// Creates a method that calls OnUpdate on all components in an array, for components of the specified type.
+        /// OnUpdate is bound to a strongly typed delegate so the loop doesn't need to use reflection on each call.
+        /// </summary>
+        /// <param name="type">Type of the components the method will be called with.</param>
+        /// <returns>Method that updates an array of components of type <paramref name="type"/>.</returns>
+        private static Action<Component[]> CreateUpdateBatchMethod(Type type)
+        {
+            const BindingFlags flags = BindingFlags.Instance | BindingFlags.Public | BindingFlags.NonPublic |
+                BindingFlags.DeclaredOnly;
+
+            // Find the same method the runtime would, the first parameterless OnUpdate in the class hierarchy
+            MethodInfo onUpdate = null;
+            for (Type curType = type; curType != null && onUpdate == null; curType = curType.BaseType)
+                onUpdate = curType.GetMethod("OnUpdate", flags, null, Type.EmptyTypes, null);
+
+            if (onUpdate == null)
+                return x => { };
+
+            Delegate onUpdateDelegate = Delegate.CreateDelegate(typeof(Action<>).MakeGenericType(type), onUpdate);
+            MethodInfo updateBatch = typeof(Component).GetMethod("UpdateBatch", BindingFlags.Static |
+                BindingFlags.NonPublic).MakeGenericMethod(type);
+
+            return (Action<Component[]>)Delegate.CreateDelegate(typeof(Action<Component[]>), onUpdateDelegate,
+                updateBatch);
+        }
+
+        /// <summary>
+        /// Calls OnUpdate on all non-null components in the array. An exception thrown by one component is logged and
+        /// does not prevent the remaining components from updating.
+        /// </summary>
+        /// <typeparam name="T">Type of the components in the array.</typeparam>
+        /// <param name="onUpdate">Delegate that calls OnUpdate on a single component.</param>
+        /// <param name="components">Components to update.</param>
+        private static void UpdateBatch<T>(Action<T> onUpdate, Component[] components) where T : Component
+        {
+            for (int i = 0; i < components.Length; i++)
+            {
+                T component = (T)components[i];
+                if (ReferenceEquals(component, null))
+                    continue;
+
+                try
+                {
+                    onUpdate(component);
+                }
+                catch (Exception e)
+                {
+                    // Note: Keep the format in sync with exceptions reported by the runtime, see
+                    // Debug.ParseExceptionMessage
+                    Debug.LogMessage("Managed exception: " + e.Message + "\n" + e.StackTrace, DebugMessageType.Error);
+                }
+            }
+        }
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         internal static extern Component Internal_AddComponent(SceneObject parent, Type type);
 
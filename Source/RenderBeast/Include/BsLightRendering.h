@@ -19,6 +19,10 @@ namespace bs
 		BS_PARAM_BLOCK_ENTRY(Vector3, gLightDirection)
 		BS_PARAM_BLOCK_ENTRY(Vector4, gLightGeometry)
 		BS_PARAM_BLOCK_ENTRY(Matrix4, gMatConeTransform)
+		BS_PARAM_BLOCK_ENTRY_ARRAY(Matrix4, gMatShadow, 6)
+		BS_PARAM_BLOCK_ENTRY(Vector4, gShadowParams)
+		BS_PARAM_BLOCK_ENTRY(Vector4, gShadowCascadeSplits)
+		BS_PARAM_BLOCK_ENTRY(Vector4, gShadowNormalBias)
 	BS_PARAM_BLOCK_END
 
 	extern PerLightParamDef gPerLightParamDef;
@@ -33,8 +37,11 @@ namespace bs
 		void setStaticParameters(const SPtr<RenderTargets>& gbuffer,
 			const SPtr<GpuParamBlockBufferCore>& perCamera);
 
-		/** Updates data in the parameter buffer from the data in the provided light. */
-		void setParameters(const LightCore* light);
+		/**
+		 * Updates data in the parameter buffer from the data in the provided light, and binds the light's shadow map if
+		 * provided.
+		 */
+		void setParameters(const LightCore* light, const LightShadowInfo* shadow = nullptr);
 
 		/** Returns the internal parameter buffer that can be bound to the pipeline. */
 		const SPtr<GpuParamBlockBufferCore>& getBuffer() const;
@@ -45,6 +52,7 @@ namespace bs
 		GpuParamTextureCore mGBufferA;
 		GpuParamTextureCore mGBufferB;
 		GpuParamTextureCore mGBufferDepth;
+		GpuParamTextureCore mShadowMap;
 		SPtr<GpuParamBlockBufferCore> mParamBuffer;
 	};
 
@@ -59,8 +67,8 @@ namespace bs
 		/** Binds the material for rendering and sets up any global parameters. */
 		void bind(const SPtr<RenderTargets>& gbuffer, const SPtr<GpuParamBlockBufferCore>& perCamera);
 
-		/** Updates the per-light buffers used by the material. */
-		void setPerLightParams(const LightCore* light);
+		/** Updates the per-light buffers used by the material, including the light's shadow map if it has one. */
+		void setPerLightParams(const LightCore* light, const LightShadowInfo* shadow = nullptr);
 	private:
 		LightRenderingParams mParams;
 	};
@@ -79,8 +87,8 @@ namespace bs
 		/** Binds the material for rendering and sets up any global parameters. */
 		void bind(const SPtr<RenderTargets>& gbuffer, const SPtr<GpuParamBlockBufferCore>& perCamera);
 
-		/** Updates the per-light buffers used by the material. */
-		void setPerLightParams(const LightCore* light);
+		/** Updates the per-light buffers used by the material, including the light's shadow map if it has one. */
+		void setPerLightParams(const LightCore* light, const LightShadowInfo* shadow = nullptr);
 	private:
 		LightRenderingParams mParams;
 	};
@@ -99,8 +107,8 @@ namespace bs
 		/** Binds the material for rendering and sets up any global parameters. */
 		void bind(const SPtr<RenderTargets>& gbuffer, const SPtr<GpuParamBlockBufferCore>& perCamera);
 
-		/** Updates the per-light buffers used by the material. */
-		void setPerLightParams(const LightCore* light);
+		/** Updates the per-light buffers used by the material, including the light's shadow map if it has one. */
+		void setPerLightParams(const LightCore* light, const LightShadowInfo* shadow = nullptr);
 	private:
 		LightRenderingParams mParams;
 	};
@@ -7,6 +7,7 @@
 #include "BsParamBlocks.h"
 #include "BsRenderTexturePool.h"
 #include "BsStandardPostProcessSettings.h"
+#include "BsRenderGraph.h"
 
 namespace bs
 {
@@ -20,9 +21,6 @@ namespace bs
 		SPtr<StandardPostProcessSettings> settings;
 		bool settingDirty = true;
 
-		SPtr<PooledRenderTexture> downsampledSceneTex;
-		SPtr<PooledRenderTexture> histogramTex;
-		SPtr<PooledRenderTexture> histogramReduceTex;
 		SPtr<PooledRenderTexture> eyeAdaptationTex[2];
 		SPtr<PooledRenderTexture> colorLUT;
 		INT32 lastEyeAdaptationTex = 0;
@@ -43,19 +41,13 @@ namespace bs
 		DownsampleMat();
 
 		/** Renders the post-process effect with the provided parameters. */
-		void execute(const SPtr<RenderTextureCore>& target, PostProcessInfo& ppInfo);
+		void execute(const SPtr<TextureCore>& input, const SPtr<RenderTextureCore>& output);
 
-		/** Releases the output render target. */
-		void release(PostProcessInfo& ppInfo);
-
-		/** Returns the render texture where the output will be written. */
-		SPtr<RenderTextureCore> getOutput() const { return mOutput; }
+		/** Returns the description of the texture the output should be written to, for the provided input texture. */
+		static TEXTURE_DESC getOutputDesc(const SPtr<TextureCore>& input);
 	private:
 		SPtr<GpuParamBlockBufferCore> mParamBuffer;
 		GpuParamTextureCore mInputTexture;
-
-		POOLED_RENDER_TEXTURE_DESC mOutputDesc;
-		SPtr<RenderTextureCore> mOutput;
 	};
 
 	BS_PARAM_BLOCK_BEGIN(EyeAdaptHistogramParamDef)
@@ -75,16 +67,13 @@ namespace bs
 		EyeAdaptHistogramMat();
 
 		/** Executes the post-process effect with the provided parameters. */
-		void execute(PostProcessInfo& ppInfo);
-
-		/** Releases the output render target. */
-		void release(PostProcessInfo& ppInfo);
+		void execute(const SPtr<TextureCore>& input, const SPtr<TextureCore>& output, PostProcessInfo& ppInfo);
 
-		/** Returns the render texture where the output was written. */
-		SPtr<RenderTextureCore> getOutput() const { return mOutput; }
+		/** Returns the description of the texture the output should be written to, for the provided input size. */
+		static TEXTURE_DESC getOutputDesc(UINT32 inputWidth, UINT32 inputHeight);
 
-		/** Calculates the number of thread groups that need to execute to cover the provided render target. */
-		static Vector2I getThreadGroupCount(const SPtr<RenderTextureCore>& target);
+		/** Calculates the number of thread groups that need to execute to cover an input of the provided size. */
+		static Vector2I getThreadGroupCount(UINT32 inputWidth, UINT32 inputHeight);
 
 		/** 
 		 * Returns a vector containing scale and offset (in that order) that will be applied to luminance values
@@ -101,9 +90,6 @@ namespace bs
 		GpuParamTextureCore mSceneColor;
 		GpuParamLoadStoreTextureCore mOutputTex;
 
-		POOLED_RENDER_TEXTURE_DESC mOutputDesc;
-		SPtr<RenderTextureCore> mOutput;
-
 		static const UINT32 LOOP_COUNT_X = 8;
 		static const UINT32 LOOP_COUNT_Y = 8;
 	};
@@ -122,22 +108,23 @@ namespace bs
 	public:
 		EyeAdaptHistogramReduceMat();
 
-		/** Executes the post-process effect with the provided parameters. */
-		void execute(PostProcessInfo& ppInfo);
-
-		/** Releases the output render target. */
-		void release(PostProcessInfo& ppInfo);
+		/**
+		 * Executes the post-process effect with the provided parameters.
+		 *
+		 * @param[in]	histogram				Histograms output by EyeAdaptHistogramMat.
+		 * @param[in]	prevEyeAdaptation		Eye adaptation texture output by EyeAdaptationMat in the previous frame.
+		 * @param[in]	output					Render target to write the reduced histogram to.
+		 */
+		void execute(const SPtr<TextureCore>& histogram, const SPtr<TextureCore>& prevEyeAdaptation,
+			const SPtr<RenderTextureCore>& output);
 
-		/** Returns the render texture where the output was written. */
-		SPtr<RenderTextureCore> getOutput() const { return mOutput; }
+		/** Returns the description of the texture the output should be written to. */
+		static TEXTURE_DESC getOutputDesc();
 	private:
 		SPtr<GpuParamBlockBufferCore> mParamBuffer;
 
 		GpuParamTextureCore mHistogramTex;
 		GpuParamTextureCore mEyeAdaptationTex;
-
-		POOLED_RENDER_TEXTURE_DESC mOutputDesc;
-		SPtr<RenderTextureCore> mOutput;
 	};
 
 	BS_PARAM_BLOCK_BEGIN(EyeAdaptationParamDef)
@@ -154,8 +141,16 @@ namespace bs
 	public:
 		EyeAdaptationMat();
 
-		/** Executes the post-process effect with the provided parameters. */
-		void execute(PostProcessInfo& ppInfo, float frameDelta);
+		/**
+		 * Executes the post-process effect with the provided parameters.
+		 *
+		 * @param[in]	reducedHistogram	Histogram output by EyeAdaptHistogramReduceMat.
+		 * @param[in]	output				Render target to write the eye adaptation value to.
+		 * @param[in]	ppInfo				Post process information of the current camera.
+		 * @param[in]	frameDelta			Time elapsed since the last frame, in seconds.
+		 */
+		void execute(const SPtr<TextureCore>& reducedHistogram, const SPtr<RenderTextureCore>& output,
+			PostProcessInfo& ppInfo, float frameDelta);
 	private:
 		SPtr<GpuParamBlockBufferCore> mParamBuffer;
 		GpuParamTextureCore mReducedHistogramTex;
@@ -192,11 +187,14 @@ namespace bs
 		CreateTonemapLUTMat();
 
 		/** Executes the post-process effect with the provided parameters. */
-		void execute(PostProcessInfo& ppInfo);
+		void execute(const SPtr<RenderTextureCore>& output, PostProcessInfo& ppInfo);
 
 		/** Releases the output render target. */
 		void release(PostProcessInfo& ppInfo);
 
+		/** Returns the description of the texture the output should be written to. */
+		static POOLED_RENDER_TEXTURE_DESC getOutputDesc();
+
 		/** Size of the 3D color lookup table. */
 		static const UINT32 LUT_SIZE = 32;
 	private:
@@ -233,7 +231,8 @@ namespace bs
 	};
 
 	/**
-	 * Renders post-processing effects for the provided render target.
+	 * Renders post-processing effects for the provided render target. Effects are described as passes of a RenderGraph,
+	 * so intermediate textures are only kept alive while needed and share memory where their lifetimes don't overlap.
 	 *
 	 * @note	Core thread only.
 	 */
@@ -255,6 +254,8 @@ namespace bs
 		TonemappingMat<true, true> mTonemapping_AE_GO;
 		TonemappingMat<false, false> mTonemapping;
 		TonemappingMat<true, false> mTonemapping_GO;
+
+		RenderGraph mGraph;
 	};
 
 	/** @} */
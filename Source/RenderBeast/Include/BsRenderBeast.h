@@ -12,6 +12,8 @@
 #include "BsPostProcessing.h"
 #include "BsRendererCamera.h"
 #include "BsRendererObject.h"
+#include "BsShadowRendering.h"
+#include "BsOcclusionBuffer.h"
 
 namespace bs
 {
@@ -22,10 +24,10 @@ namespace bs
 	struct RendererAnimationData;
 
 	/** Semantics that may be used for signaling the renderer for what is a certain shader parameter used for. */
-	static StringID RPS_GBufferA = "GBufferA";
-	static StringID RPS_GBufferB = "GBufferB";
-	static StringID RPS_GBufferDepth = "GBufferDepth";
-	static StringID RPS_BoneMatrices = "BoneMatrices";
+	static StringID RPS_GBufferA = "GBufferA"_sid;
+	static StringID RPS_GBufferB = "GBufferB"_sid;
+	static StringID RPS_GBufferDepth = "GBufferDepth"_sid;
+	static StringID RPS_BoneMatrices = "BoneMatrices"_sid;
 
 	/**
 	 * Default renderer for Banshee. Performs frustum culling, sorting and renders objects in custom ways determine by
@@ -179,6 +181,25 @@ namespace bs
 		void renderElement(const BeastRenderableElement& element, UINT32 passIdx, bool bindPass, 
 			const RendererFrame& frameInfo, const Matrix4& viewProj);
 
+		/**
+		 * Starts creating the pipelines that elements of the provided renderables will be rendered with when rendered
+		 * through the provided camera, on worker threads. Pipelines are created for the render targets the camera was last
+		 * pre-warmed for, and nothing is done if the camera wasn't pre-warmed yet.
+		 *
+		 * @param[in]	camera		Camera whose render targets to create the pipelines for.
+		 * @param[in]	renderables	Renderables whose pipelines to create.
+		 */
+		void prewarmPipelines(const RendererCamera& camera, const Vector<RendererObject*>& renderables);
+
+		/**
+		 * Reports the texel density of streamed textures used by renderables visible from the provided camera, so their
+		 * required mip levels can be streamed in.
+		 *
+		 * @param[in]	camera		Camera the renderables are being rendered with.
+		 * @param[in]	visibility	Visibility of each renderable from the camera.
+		 */
+		void notifyTextureStreaming(const CameraCore& camera, const Vector<bool>& visibility);
+
 		/**	Creates data used by the renderer on the core thread. */
 		void initializeCore();
 
@@ -201,10 +222,15 @@ namespace bs
 		Vector<RendererObject*> mRenderables;
 		Vector<Bounds> mWorldBounds;
 		Vector<bool> mVisibility; // Transient
+		Vector<std::pair<UINT32, float>> mTexelDensities; // Transient
+		OcclusionBuffer mOcclusionBuffer;
 
 		Vector<RendererLight> mDirectionalLights;
 		Vector<RendererLight> mPointLights;
 		Vector<Sphere> mLightWorldBounds;
+		Vector<LightShadowInfo> mDirectionalShadows; // Transient
+
+		ShadowRenderer* mShadowRenderer;
 
 		SPtr<RenderBeastOptions> mCoreOptions;
 
@@ -39,6 +39,42 @@ namespace bs
 		 * changes. Sorting by material can reduce CPU usage but could increase overdraw.
 		 */
 		StateReduction stateReductionMode = StateReduction::Distance;
+
+		/**
+		 * Determines if objects hidden behind renderables marked as occluders should be culled. Occluders are rasterized
+		 * into a low resolution depth buffer on the CPU, against which the bounds of other objects are tested.
+		 */
+		bool occlusionCulling = true;
+
+		/** Determines if lights marked as shadow casters should render shadows. */
+		bool shadows = true;
+
+		/**
+		 * Width and height of the atlas texture in which spot and point light shadow maps are cached, in pixels. Lights
+		 * that don't fit in the atlas are rendered without shadows.
+		 */
+		UINT32 shadowAtlasSize = 4096;
+
+		/**
+		 * Width and height of a single spot light shadow map, in pixels. Point lights use six maps of half this size, one
+		 * per cube face.
+		 */
+		UINT32 shadowMapSize = 512;
+
+		/** Width and height of a single directional light shadow cascade, in pixels. */
+		UINT32 cascadeShadowMapSize = 1024;
+
+		/** Number of cascades used for directional light shadows, in range [1, 4]. */
+		UINT32 numShadowCascades = 4;
+
+		/** Distance from the camera up to which directional light shadows are rendered. */
+		float shadowDistance = 100.0f;
+
+		/**
+		 * Controls how are directional light shadow cascades distributed over the shadow distance, in range [0, 1]. Zero
+		 * splits the distance uniformly while one splits it logarithmically, giving more resolution to nearby cascades.
+		 */
+		float cascadeDistribution = 0.8f;
 	};
 
 	/** @} */
@@ -36,4 +36,6 @@ namespace bs
 	struct RenderBeastOptions;
 	struct PooledRenderTexture;
 	class RenderTargets;
+	class ShadowRenderer;
+	struct LightShadowInfo;
 }
\ No newline at end of file
@@ -50,6 +50,9 @@ namespace bs
 		/**	Binds the scene color render target for rendering. */
 		void bindSceneColor(bool readOnlyDepthStencil);
 
+		/** Returns the GBuffer render target, containing the scene color and GBuffer textures. */
+		SPtr<RenderTextureCore> getGBufferRT() const { return mGBufferRT; }
+
 		/** Returns the scene color render target. */
 		SPtr<RenderTextureCore> getSceneColorRT() const { return mSceneColorRT; }
 
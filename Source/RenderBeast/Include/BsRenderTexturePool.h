@@ -6,6 +6,7 @@
 #include "BsModule.h"
 #include "BsPixelUtil.h"
 #include "BsTexture.h"
+#include "BsRenderGraph.h"
 
 namespace bs
 {
@@ -32,8 +33,11 @@ namespace bs
 		bool mIsFree;
 	};
 
-	/** Contains a pool of render textures meant to accommodate reuse of render textures of the same size and format. */
-	class RenderTexturePool : public Module<RenderTexturePool>
+	/** 
+	 * Contains a pool of render textures meant to accommodate reuse of render textures of the same size and format. Also
+	 * provides the physical textures for transient textures of a RenderGraph.
+	 */
+	class RenderTexturePool : public Module<RenderTexturePool>, public RenderGraphAllocator
 	{
 	public:
 		~RenderTexturePool();
@@ -56,6 +60,13 @@ namespace bs
 		 */
 		void release(const SPtr<PooledRenderTexture>& texture);
 
+		/** @copydoc RenderGraphAllocator::allocate */
+		void allocate(const TEXTURE_DESC& desc, SPtr<TextureCore>& texture,
+			SPtr<RenderTextureCore>& renderTexture) override;
+
+		/** @copydoc RenderGraphAllocator::release */
+		void release(const SPtr<TextureCore>& texture) override;
+
 	private:
 		friend struct PooledRenderTexture;
 
@@ -74,6 +85,7 @@ namespace bs
 		static bool matches(const SPtr<TextureCore>& texture, const POOLED_RENDER_TEXTURE_DESC& desc);
 
 		Map<PooledRenderTexture*, std::weak_ptr<PooledRenderTexture>> mTextures;
+		UnorderedMap<TextureCore*, SPtr<PooledRenderTexture>> mGraphTextures;
 	};
 
 	/** Structure used for creating a new pooled render texture. */
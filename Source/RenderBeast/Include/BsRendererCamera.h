@@ -8,6 +8,7 @@
 #include "BsRenderQueue.h"
 #include "BsRendererObject.h"
 #include "BsBounds.h"
+#include "BsConvexVolume.h"
 
 namespace bs
 {
@@ -57,6 +58,25 @@ namespace bs
 		/** Returns the camera's renderTargets. Only valid if called in-between beginRendering() and endRendering() calls. */
 		SPtr<RenderTargets> getRenderTargets() const { return mRenderTargets; }
 
+		/** 
+		 * Returns the GBuffer render target that pipelines were last pre-warmed for. Null if pipelines were never 
+		 * pre-warmed for this camera.
+		 */
+		SPtr<RenderTextureCore> getPrewarmedGBufferRT() const { return mPrewarmedGBufferRT; }
+
+		/** 
+		 * Returns the scene color render target that pipelines were last pre-warmed for. Null if pipelines were never 
+		 * pre-warmed for this camera.
+		 */
+		SPtr<RenderTextureCore> getPrewarmedSceneColorRT() const { return mPrewarmedSceneColorRT; }
+
+		/** Records the render targets that pipelines were pre-warmed for. */
+		void setPrewarmedTargets(const SPtr<RenderTextureCore>& gbufferRT, const SPtr<RenderTextureCore>& sceneColorRT)
+		{
+			mPrewarmedGBufferRT = gbufferRT;
+			mPrewarmedSceneColorRT = sceneColorRT;
+		}
+
 		/** 
 		 * Returns a render queue containing all opaque objects. Make sure to call determineVisible() beforehand if camera 
 		 * or object transforms changed since the last time it was called.
@@ -82,9 +102,26 @@ namespace bs
 		 *									
 		 *									As a side-effect, per-camera visibility data is also calculated and can be
 		 *									retrieved by calling getVisibilityMask().
+		 * @param[in]	occlusionBuffer		Optional buffer to use for culling objects hidden behind occluders. Occluders
+		 *									in view of the camera are rasterized into it before testing other objects.
+		 *									If null, only frustum culling is performed.
 		 */
 		void determineVisible(const Vector<RendererObject*>& renderables, const Vector<Bounds>& renderableBounds, 
-			Vector<bool>& visibility);
+			Vector<bool>& visibility, OcclusionBuffer* occlusionBuffer = nullptr);
+
+		/**
+		 * Finds renderable objects whose bounds intersect the provided volume.
+		 *
+		 * @param[in]	volume				World space volume to test the object bounds against.
+		 * @param[in]	layers				Layer bitfield. Objects not on any of the layers are ignored.
+		 * @param[in]	renderables			A set of renderable objects to test.
+		 * @param[in]	renderableBounds	A set of world bounds for the provided renderable objects.
+		 * @param[out]	output				Indices (into @p renderables) of objects intersecting the volume are appended
+		 *									to this array.
+		 * @return							Number of objects on the provided layers that were outside of the volume.
+		 */
+		static UINT32 cullObjects(const ConvexVolume& volume, UINT64 layers, const Vector<RendererObject*>& renderables,
+			const Vector<Bounds>& renderableBounds, Vector<UINT32>& output);
 
 		/** Returns the visibility mask calculated with the last call to determineVisible(). */
 		const Vector<bool> getVisibilityMask() const { return mVisibility; }
@@ -101,6 +138,12 @@ namespace bs
 		/** Returns a buffer that stores per-camera parameters. */
 		SPtr<GpuParamBlockBufferCore> getPerCameraBuffer() const { return mParamBuffer; }
 
+		/**
+		 * Notifies the camera that a renderable was removed from the renderer, and that the last renderable was moved
+		 * into its slot. Keeps per-object state (e.g. the selected level of detail) with the object it belongs to.
+		 */
+		void notifyRenderableRemoved(UINT32 rendererId, UINT32 lastRendererId);
+
 	private:
 		/**
 		 * Extracts the necessary values from the projection matrix that allow you to transform device Z value into
@@ -112,16 +155,35 @@ namespace bs
 		 */
 		Vector2 getDeviceZTransform(const Matrix4& projMatrix) const;
 
+		/**
+		 * Selects a level of detail to render the object with, depending on the size of its bounds on screen. 
+		 *
+		 * @param[in]	object		Object to select the level of detail for.
+		 * @param[in]	bounds		World space bounds of the object.
+		 * @param[in]	prevLOD		Level of detail selected for the object during the last frame. Levels only change once
+		 *							the screen size moves sufficiently past a threshold, to avoid popping back and forth.
+		 * @return					Index of the level of detail to use.
+		 */
+		UINT32 selectLOD(const RendererObject& object, const Sphere& bounds, UINT32 prevLOD) const;
+
 		const CameraCore* mCamera;
 		SPtr<RenderQueue> mOpaqueQueue;
 		SPtr<RenderQueue> mTransparentQueue;
 
 		SPtr<RenderTargets> mRenderTargets;
+		SPtr<RenderTextureCore> mPrewarmedGBufferRT;
+		SPtr<RenderTextureCore> mPrewarmedSceneColorRT;
 		PostProcessInfo mPostProcessInfo;
 		bool mUsingRenderTargets;
 
 		SPtr<GpuParamBlockBufferCore> mParamBuffer;
 		Vector<bool> mVisibility;
+		Vector<UINT32> mLODs;
+
+		// Transient, used during visibility determination
+		Vector<UINT32> mCandidates;
+		Vector<AABox> mCandidateBounds;
+		Vector<bool> mCandidateVisibility;
 	};
 
 	/** @} */
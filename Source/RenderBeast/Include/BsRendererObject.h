@@ -61,7 +61,10 @@ namespace bs
 		/** Index of the technique in the material to render the element with. */
 		UINT32 techniqueIdx;
 
-		/** Index to which should the per-camera param block buffer be bound to. */
+		/** 
+		 * Index to which should the per-camera param block buffer be bound to, or -1 if the element's shader doesn't
+		 * use a per-camera param block.
+		 */
 		UINT32 perCameraBindingIdx;
 
 		/** GPU buffer containing element's bone matrices, if it requires any. */
@@ -96,6 +99,13 @@ namespace bs
 		RenderableCore* renderable;
 		Vector<BeastRenderableElement> elements;
 
+		/** 
+		 * Elements used for rendering lower levels of detail of the mesh, if it has any. Stored level by level, with each
+		 * level containing one entry per entry in @p elements. Entries share their GPU parameters and sampler overrides 
+		 * with the matching entry in @p elements, and only differ in the sub-mesh they render.
+		 */
+		Vector<BeastRenderableElement> lodElements;
+
 		SPtr<GpuParamBlockBufferCore> perObjectParamBuffer;
 		SPtr<GpuParamBlockBufferCore> perCallParamBuffer;
 	};
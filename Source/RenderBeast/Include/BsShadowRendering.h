@@ -0,0 +1,211 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsRenderBeastPrerequisites.h"
+#include "BsRendererMaterial.h"
+#include "BsParamBlocks.h"
+#include "BsRenderTexturePool.h"
+#include "BsRendererObject.h"
+#include "BsBounds.h"
+#include "BsConvexVolume.h"
+#include "BsRect2I.h"
+
+namespace bs
+{
+	/** @addtogroup RenderBeast
+	 *  @{
+	 */
+
+	BS_PARAM_BLOCK_BEGIN(ShadowParamsDef)
+		BS_PARAM_BLOCK_ENTRY(Matrix4, gMatViewProj)
+	BS_PARAM_BLOCK_END
+
+	extern ShadowParamsDef gShadowParamsDef;
+
+	/** Shader that renders depth of shadow casters into a shadow map. */
+	class ShadowDepthMat : public RendererMaterial<ShadowDepthMat>
+	{
+		RMAT_DEF("ShadowDepth.bsl");
+
+	public:
+		ShadowDepthMat();
+
+		/** Binds the material for rendering, using the provided view-projection matrix of the shadow map. */
+		void bind(const Matrix4& viewProj);
+
+		/** Binds the per-object parameters of the caster that is about to be drawn. */
+		void setPerObjectBuffer(const SPtr<GpuParamBlockBufferCore>& perObjectBuffer);
+	private:
+		SPtr<GpuParamBlockBufferCore> mParamBuffer;
+	};
+
+	/** Types of shadow maps. Values match the types expected by the light shaders. */
+	enum class ShadowMapType
+	{
+		None = 0, /**< Light doesn't have a shadow map. */
+		Spot = 1, /**< Single perspective shadow map. */
+		Point = 2, /**< Six perspective shadow maps, one for each cube face. */
+		Directional = 3 /**< Orthographic shadow maps, one for each cascade. */
+	};
+
+	/** Contains information required for sampling the shadow map of a single light. */
+	struct LightShadowInfo
+	{
+		ShadowMapType type = ShadowMapType::None;
+
+		/** Texture containing the shadow map depth. */
+		SPtr<TextureCore> shadowMap;
+
+		/** Size of the shadow map texture, in pixels. */
+		UINT32 shadowMapSize = 0;
+
+		/** Matrices transforming world space positions to shadow map UV and depth, per cube face or cascade. */
+		Matrix4 shadowMatrices[6];
+
+		/** Number of valid entries in @p shadowMatrices. */
+		UINT32 numMatrices = 0;
+
+		/** View distance at which each cascade ends. Only relevant for directional lights. */
+		Vector4 cascadeSplits = Vector4::ZERO;
+
+		/**
+		 * Distance to offset the receiver along its normal before looking it up in the shadow map, per cascade. For spot
+		 * and point lights only x is used, and it is relative to the distance from the light.
+		 */
+		Vector4 normalBias = Vector4::ZERO;
+
+		/** Bias applied to the receiver depth before comparing it with the shadow map depth. */
+		float depthBias = 0.0f;
+	};
+
+	/**
+	 * Allocates square areas of a shadow map atlas, by recursively splitting the atlas into quadrants. Area sizes are
+	 * always a power of two.
+	 */
+	class ShadowAtlasAllocator
+	{
+	public:
+		/** Creates a new allocator managing an atlas of the specified size. Size must be a power of two. */
+		ShadowAtlasAllocator(UINT32 size = 0);
+
+		/**
+		 * Attempts to allocate an area of the specified size. Size is rounded up to a power of two.
+		 *
+		 * @param[in]	size	Width and height of the area, in pixels.
+		 * @param[out]	area	Allocated area, in pixels.
+		 * @return				True if the area was allocated, false if there is no more space in the atlas.
+		 */
+		bool allocate(UINT32 size, Rect2I& area);
+
+		/** Releases an area previously returned by allocate(). */
+		void free(const Rect2I& area);
+
+		/** Releases all allocated areas and changes the size of the managed atlas. Size must be a power of two. */
+		void reset(UINT32 size);
+
+		/** Returns the width and height of the managed atlas, in pixels. */
+		UINT32 getSize() const { return mSize; }
+	private:
+		/** Returns the depth in the quadrant hierarchy at which areas of the specified size reside. */
+		UINT32 getLevel(UINT32 size) const;
+
+		UINT32 mSize;
+		Vector<Vector<Vector2I>> mFreeAreas; // Per level, level 0 being the entire atlas
+	};
+
+	/**
+	 * Renders shadow maps for lights. Spot and point light shadow maps are cached in an atlas and only re-rendered when
+	 * the light or one of the shadow casters in its range changes. Directional light shadows are rendered every frame
+	 * per camera, using cascaded shadow maps.
+	 */
+	class ShadowRenderer
+	{
+	public:
+		ShadowRenderer();
+		~ShadowRenderer();
+
+		/** Updates the options controlling shadow map resolution. Invalidates all cached shadows. */
+		void setOptions(const SPtr<RenderBeastOptions>& options);
+
+		/**
+		 * Invalidates cached shadow maps of lights whose range intersects the provided bounds. Should be called whenever
+		 * a shadow caster is added, removed or moved.
+		 */
+		void notifyCasterChanged(const Bounds& bounds);
+
+		/** Releases the cached shadow map of the light. Should be called whenever a light is modified or removed. */
+		void notifyLightChanged(const LightCore* light);
+
+		/**
+		 * Renders the shadow map of a spot or a point light into the shadow atlas, unless it already has a valid cached
+		 * shadow map.
+		 *
+		 * @param[in]	light				Light to render the shadow map for.
+		 * @param[in]	renderables			A set of renderable objects that can cast shadows.
+		 * @param[in]	renderableBounds	A set of world bounds for the provided renderable objects.
+		 */
+		void renderLightShadow(const LightCore* light, const Vector<RendererObject*>& renderables,
+			const Vector<Bounds>& renderableBounds);
+
+		/** Returns the shadow map of a spot or a point light rendered by renderLightShadow(), or null if it has none. */
+		const LightShadowInfo* getLightShadow(const LightCore* light) const;
+
+		/**
+		 * Renders cascaded shadow maps of a directional light, covering the view of the provided camera. Rendered
+		 * textures remain valid until releaseCascades() is called.
+		 *
+		 * @param[in]	camera				Camera whose view the cascades should cover.
+		 * @param[in]	light				Directional light to render the shadow map for.
+		 * @param[in]	renderables			A set of renderable objects that can cast shadows.
+		 * @param[in]	renderableBounds	A set of world bounds for the provided renderable objects.
+		 * @param[out]	output				Information required for sampling the rendered shadow map.
+		 */
+		void renderCascades(const CameraCore& camera, const LightCore* light, const Vector<RendererObject*>& renderables,
+			const Vector<Bounds>& renderableBounds, LightShadowInfo& output);
+
+		/** Returns textures allocated by renderCascades() back to the texture pool. */
+		void releaseCascades();
+
+	private:
+		/** Cached shadow map of a spot or a point light. */
+		struct CachedShadow
+		{
+			LightShadowInfo info;
+			Rect2I areas[6];
+			UINT32 numAreas = 0;
+			Sphere bounds;
+			bool dirty = true;
+		};
+
+		/**
+		 * Renders depth of all shadow casters intersecting the provided volume, into an area of the provided render
+		 * target.
+		 */
+		void renderShadowMap(const SPtr<RenderTextureCore>& target, UINT32 targetSize, const Rect2I& area,
+			const Matrix4& viewProj, const ConvexVolume& volume, const Vector<RendererObject*>& renderables,
+			const Vector<Bounds>& renderableBounds);
+
+		/**
+		 * Converts a shadow map view-projection matrix into a matrix that transforms world space positions into UV
+		 * coordinates and depth of a specific area of a shadow map texture.
+		 */
+		static Matrix4 createShadowMatrix(const Matrix4& viewProjRS, const Rect2I& area, UINT32 textureSize);
+
+		/** Releases the atlas areas used by a cached shadow map. */
+		void freeAreas(CachedShadow& shadow);
+
+		ShadowDepthMat* mDepthMat;
+		SPtr<RenderBeastOptions> mOptions;
+
+		SPtr<TextureCore> mAtlasTexture;
+		SPtr<RenderTextureCore> mAtlas;
+		ShadowAtlasAllocator mAllocator;
+		UnorderedMap<const LightCore*, CachedShadow> mCachedShadows;
+
+		Vector<SPtr<PooledRenderTexture>> mCascadeTextures;
+		Vector<UINT32> mCasters; // Transient
+	};
+
+	/** @} */
+}
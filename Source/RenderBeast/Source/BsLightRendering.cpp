@@ -9,6 +9,7 @@
 #include "BsGpuParamsSet.h"
 #include "BsLight.h"
 #include "BsRendererUtility.h"
+#include "BsShadowRendering.h"
 
 namespace bs
 {
@@ -30,6 +31,9 @@ namespace bs
 				params->getTextureParam(GPT_FRAGMENT_PROGRAM, entry.second.name, mGBufferDepth);
 		}
 
+		if (params->hasTexture(GPT_FRAGMENT_PROGRAM, "gShadowMapTex"))
+			params->getTextureParam(GPT_FRAGMENT_PROGRAM, "gShadowMapTex", mShadowMap);
+
 		mParamBuffer = gPerLightParamDef.createBuffer();
 		mParamsSet->setParamBlockBuffer("PerLight", mParamBuffer, true);
 	}
@@ -46,7 +50,7 @@ namespace bs
 		gRendererUtility().setPassParams(mParamsSet);
 	}
 
-	void LightRenderingParams::setParameters(const LightCore* light)
+	void LightRenderingParams::setParameters(const LightCore* light, const LightShadowInfo* shadow)
 	{
 		// Note: I could just copy the data directly to the parameter buffer if I ensured the parameter
 		// layout matches
@@ -102,7 +106,30 @@ namespace bs
 		Matrix4 transform = Matrix4::TRS(light->getPosition(), light->getRotation(), Vector3::ONE);
 		gPerLightParamDef.gMatConeTransform.set(mParamBuffer, transform);
 
+		if (shadow != nullptr && shadow->type != ShadowMapType::None)
+		{
+			for (UINT32 i = 0; i < shadow->numMatrices; i++)
+				gPerLightParamDef.gMatShadow.set(mParamBuffer, shadow->shadowMatrices[i], i);
+
+			Vector4 shadowParams((float)shadow->type, shadow->depthBias, (float)shadow->shadowMapSize,
+				(float)shadow->numMatrices);
+
+			gPerLightParamDef.gShadowParams.set(mParamBuffer, shadowParams);
+			gPerLightParamDef.gShadowCascadeSplits.set(mParamBuffer, shadow->cascadeSplits);
+			gPerLightParamDef.gShadowNormalBias.set(mParamBuffer, shadow->normalBias);
+
+			mShadowMap.set(shadow->shadowMap);
+		}
+		else
+		{
+			gPerLightParamDef.gShadowParams.set(mParamBuffer, Vector4::ZERO);
+			mShadowMap.set(nullptr);
+		}
+
 		mParamBuffer->flushToGPU();
+
+		// Shadow map texture can change per light
+		gRendererUtility().setPassParams(mParamsSet);
 	}
 
 	const SPtr<GpuParamBlockBufferCore>& LightRenderingParams::getBuffer() const
@@ -128,9 +155,9 @@ namespace bs
 		mParams.setStaticParameters(gbuffer, perCamera);
 	}
 
-	void DirectionalLightMat::setPerLightParams(const LightCore* light)
+	void DirectionalLightMat::setPerLightParams(const LightCore* light, const LightShadowInfo* shadow)
 	{
-		mParams.setParameters(light);
+		mParams.setParameters(light, shadow);
 	}
 
 	PointLightInMat::PointLightInMat()
@@ -151,9 +178,9 @@ namespace bs
 		mParams.setStaticParameters(gbuffer, perCamera);
 	}
 
-	void PointLightInMat::setPerLightParams(const LightCore* light)
+	void PointLightInMat::setPerLightParams(const LightCore* light, const LightShadowInfo* shadow)
 	{
-		mParams.setParameters(light);
+		mParams.setParameters(light, shadow);
 	}
 
 	PointLightOutMat::PointLightOutMat()
@@ -174,8 +201,8 @@ namespace bs
 		mParams.setStaticParameters(gbuffer, perCamera);
 	}
 
-	void PointLightOutMat::setPerLightParams(const LightCore* light)
+	void PointLightOutMat::setPerLightParams(const LightCore* light, const LightShadowInfo* shadow)
 	{
-		mParams.setParameters(light);
+		mParams.setParameters(light, shadow);
 	}
 }
\ No newline at end of file
@@ -23,11 +23,11 @@ namespace bs
 
 	void ObjectRenderer::initElement(RendererObject& owner, BeastRenderableElement& element)
 	{
+		element.perCameraBindingIdx = -1;
+
 		SPtr<ShaderCore> shader = element.material->getShader();
 		if (shader == nullptr)
 		{
-			element.perCameraBindingIdx = -1;
-
 			LOGWRN("Missing shader on material.");
 			return;
 		}
@@ -45,6 +45,8 @@ namespace bs
 				element.params->setParamBlockBuffer(paramBlockDesc.second.name,
 													owner.perObjectParamBuffer, true);
 			}
+			else if (paramBlockDesc.second.rendererSemantic == RBS_PerCamera)
+				element.perCameraBindingIdx = element.params->getParamBlockBufferIndex(paramBlockDesc.second.name);
 			else if (paramBlockDesc.second.rendererSemantic == RBS_PerCall)
 			{
 				element.params->setParamBlockBuffer(paramBlockDesc.second.name,
@@ -25,44 +25,38 @@ namespace bs
 		// Do nothing
 	}
 
-	void DownsampleMat::execute(const SPtr<RenderTextureCore>& target, PostProcessInfo& ppInfo)
+	void DownsampleMat::execute(const SPtr<TextureCore>& input, const SPtr<RenderTextureCore>& output)
 	{
 		// Set parameters
-		SPtr<TextureCore> colorTexture = target->getColorTexture(0);
-		mInputTexture.set(colorTexture);
+		mInputTexture.set(input);
 
-		const RenderTextureProperties& rtProps = target->getProperties();
-		Vector2 invTextureSize(1.0f / rtProps.getWidth(), 1.0f / rtProps.getHeight());
+		const TextureProperties& inputProps = input->getProperties();
+		Vector2 invTextureSize(1.0f / inputProps.getWidth(), 1.0f / inputProps.getHeight());
 
 		gDownsampleParamDef.gInvTexSize.set(mParamBuffer, invTextureSize);
 
-		// Set output
-		const TextureProperties& colorProps = colorTexture->getProperties();
-
-		UINT32 width = std::max(1, Math::ceilToInt(colorProps.getWidth() * 0.5f));
-		UINT32 height = std::max(1, Math::ceilToInt(colorProps.getHeight() * 0.5f));
-
-		mOutputDesc = POOLED_RENDER_TEXTURE_DESC::create2D(colorProps.getFormat(), width, height, TU_RENDERTARGET);
-
 		// Render
-		ppInfo.downsampledSceneTex = RenderTexturePool::instance().get(mOutputDesc);
-
 		RenderAPICore& rapi = RenderAPICore::instance();
-		rapi.setRenderTarget(ppInfo.downsampledSceneTex->renderTexture, true);
+		rapi.setRenderTarget(output, true);
 
 		gRendererUtility().setPass(mMaterial);
 		gRendererUtility().setPassParams(mParamsSet);
 		gRendererUtility().drawScreenQuad();
 
 		rapi.setRenderTarget(nullptr);
-
-		mOutput = ppInfo.downsampledSceneTex->renderTexture;
 	}
 
-	void DownsampleMat::release(PostProcessInfo& ppInfo)
+	TEXTURE_DESC DownsampleMat::getOutputDesc(const SPtr<TextureCore>& input)
 	{
-		RenderTexturePool::instance().release(ppInfo.downsampledSceneTex);
-		mOutput = nullptr;
+		const TextureProperties& inputProps = input->getProperties();
+
+		TEXTURE_DESC desc;
+		desc.format = inputProps.getFormat();
+		desc.width = std::max(1, Math::ceilToInt(inputProps.getWidth() * 0.5f));
+		desc.height = std::max(1, Math::ceilToInt(inputProps.getHeight() * 0.5f));
+		desc.usage = TU_RENDERTARGET;
+
+		return desc;
 	}
 
 	EyeAdaptHistogramParamDef gEyeAdaptHistogramParamDef;
@@ -85,56 +79,52 @@ namespace bs
 		defines.set("LOOP_COUNT_Y", LOOP_COUNT_Y);
 	}
 
-	void EyeAdaptHistogramMat::execute(PostProcessInfo& ppInfo)
+	void EyeAdaptHistogramMat::execute(const SPtr<TextureCore>& input, const SPtr<TextureCore>& output,
+		PostProcessInfo& ppInfo)
 	{
 		// Set parameters
-		SPtr<RenderTextureCore> target = ppInfo.downsampledSceneTex->renderTexture;
-		mSceneColor.set(ppInfo.downsampledSceneTex->texture);
+		mSceneColor.set(input);
 
-		const RenderTextureProperties& props = target->getProperties();
+		const TextureProperties& props = input->getProperties();
 		int offsetAndSize[4] = { 0, 0, (INT32)props.getWidth(), (INT32)props.getHeight() };
 
 		gEyeAdaptHistogramParamDef.gHistogramParams.set(mParamBuffer, getHistogramScaleOffset(ppInfo));
 		gEyeAdaptHistogramParamDef.gPixelOffsetAndSize.set(mParamBuffer, Vector4I(offsetAndSize));
 
-		Vector2I threadGroupCount = getThreadGroupCount(target);
+		Vector2I threadGroupCount = getThreadGroupCount(props.getWidth(), props.getHeight());
 		gEyeAdaptHistogramParamDef.gThreadGroupCount.set(mParamBuffer, threadGroupCount);
 
-		// Set output
-		UINT32 numHistograms = threadGroupCount.x * threadGroupCount.y;
-
-		mOutputDesc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_FLOAT16_RGBA, HISTOGRAM_NUM_TEXELS, numHistograms,
-			TU_LOADSTORE);
-
 		// Dispatch
-		ppInfo.histogramTex = RenderTexturePool::instance().get(mOutputDesc);
-
-		mOutputTex.set(ppInfo.histogramTex->texture);
+		mOutputTex.set(output);
 
 		RenderAPICore& rapi = RenderAPICore::instance();
 		gRendererUtility().setComputePass(mMaterial);
 		gRendererUtility().setPassParams(mParamsSet);
 		rapi.dispatchCompute(threadGroupCount.x, threadGroupCount.y);
-
-		mOutput = ppInfo.histogramTex->renderTexture;
 	}
 
-	void EyeAdaptHistogramMat::release(PostProcessInfo& ppInfo)
+	TEXTURE_DESC EyeAdaptHistogramMat::getOutputDesc(UINT32 inputWidth, UINT32 inputHeight)
 	{
-		RenderTexturePool::instance().release(ppInfo.histogramTex);
-		mOutput = nullptr;
+		Vector2I threadGroupCount = getThreadGroupCount(inputWidth, inputHeight);
+		UINT32 numHistograms = threadGroupCount.x * threadGroupCount.y;
+
+		TEXTURE_DESC desc;
+		desc.format = PF_FLOAT16_RGBA;
+		desc.width = HISTOGRAM_NUM_TEXELS;
+		desc.height = numHistograms;
+		desc.usage = TU_LOADSTORE;
+
+		return desc;
 	}
 
-	Vector2I EyeAdaptHistogramMat::getThreadGroupCount(const SPtr<RenderTextureCore>& target)
+	Vector2I EyeAdaptHistogramMat::getThreadGroupCount(UINT32 inputWidth, UINT32 inputHeight)
 	{
 		const UINT32 texelsPerThreadGroupX = THREAD_GROUP_SIZE_X * LOOP_COUNT_X;
 		const UINT32 texelsPerThreadGroupY = THREAD_GROUP_SIZE_Y * LOOP_COUNT_Y;
 
-		const RenderTextureProperties& props = target->getProperties();
-	
 		Vector2I threadGroupCount;
-		threadGroupCount.x = ((INT32)props.getWidth() + texelsPerThreadGroupX - 1) / texelsPerThreadGroupX;
-		threadGroupCount.y = ((INT32)props.getHeight() + texelsPerThreadGroupY - 1) / texelsPerThreadGroupY;
+		threadGroupCount.x = ((INT32)inputWidth + texelsPerThreadGroupX - 1) / texelsPerThreadGroupX;
+		threadGroupCount.y = ((INT32)inputHeight + texelsPerThreadGroupY - 1) / texelsPerThreadGroupY;
 
 		return threadGroupCount;
 	}
@@ -167,35 +157,20 @@ namespace bs
 		// Do nothing
 	}
 
-	void EyeAdaptHistogramReduceMat::execute(PostProcessInfo& ppInfo)
+	void EyeAdaptHistogramReduceMat::execute(const SPtr<TextureCore>& histogram,
+		const SPtr<TextureCore>& prevEyeAdaptation, const SPtr<RenderTextureCore>& output)
 	{
 		// Set parameters
-		mHistogramTex.set(ppInfo.histogramTex->texture);
-
-		SPtr<PooledRenderTexture> eyeAdaptationRT = ppInfo.eyeAdaptationTex[ppInfo.lastEyeAdaptationTex];
-		SPtr<TextureCore> eyeAdaptationTex;
-
-		if (eyeAdaptationRT != nullptr) // Could be that this is the first run
-			eyeAdaptationTex = eyeAdaptationRT->texture;
-		else
-			eyeAdaptationTex = TextureCore::WHITE;
-
-		mEyeAdaptationTex.set(eyeAdaptationTex);
-
-		Vector2I threadGroupCount = EyeAdaptHistogramMat::getThreadGroupCount(ppInfo.downsampledSceneTex->renderTexture);
-		UINT32 numHistograms = threadGroupCount.x * threadGroupCount.y;
+		mHistogramTex.set(histogram);
+		mEyeAdaptationTex.set(prevEyeAdaptation);
 
+		// Histogram texture contains one row per histogram
+		UINT32 numHistograms = histogram->getProperties().getHeight();
 		gEyeAdaptHistogramReduceParamDef.gThreadGroupCount.set(mParamBuffer, numHistograms);
 
-		// Set output
-		mOutputDesc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_FLOAT16_RGBA, EyeAdaptHistogramMat::HISTOGRAM_NUM_TEXELS, 2,
-			TU_RENDERTARGET);
-
 		// Render
-		ppInfo.histogramReduceTex = RenderTexturePool::instance().get(mOutputDesc);
-
 		RenderAPICore& rapi = RenderAPICore::instance();
-		rapi.setRenderTarget(ppInfo.histogramReduceTex->renderTexture, true);
+		rapi.setRenderTarget(output, true);
 
 		gRendererUtility().setPass(mMaterial);
 		gRendererUtility().setPassParams(mParamsSet);
@@ -204,14 +179,17 @@ namespace bs
 		gRendererUtility().drawScreenQuad(drawUV);
 
 		rapi.setRenderTarget(nullptr);
-
-		mOutput = ppInfo.histogramReduceTex->renderTexture;
 	}
 
-	void EyeAdaptHistogramReduceMat::release(PostProcessInfo& ppInfo)
+	TEXTURE_DESC EyeAdaptHistogramReduceMat::getOutputDesc()
 	{
-		RenderTexturePool::instance().release(ppInfo.histogramReduceTex);
-		mOutput = nullptr;
+		TEXTURE_DESC desc;
+		desc.format = PF_FLOAT16_RGBA;
+		desc.width = EyeAdaptHistogramMat::HISTOGRAM_NUM_TEXELS;
+		desc.height = 2;
+		desc.usage = TU_RENDERTARGET;
+
+		return desc;
 	}
 
 	EyeAdaptationParamDef gEyeAdaptationParamDef;
@@ -229,20 +207,11 @@ namespace bs
 		defines.set("THREADGROUP_SIZE_Y", EyeAdaptHistogramMat::THREAD_GROUP_SIZE_Y);
 	}
 
-	void EyeAdaptationMat::execute(PostProcessInfo& ppInfo, float frameDelta)
+	void EyeAdaptationMat::execute(const SPtr<TextureCore>& reducedHistogram, const SPtr<RenderTextureCore>& output,
+		PostProcessInfo& ppInfo, float frameDelta)
 	{
-		bool texturesInitialized = ppInfo.eyeAdaptationTex[0] != nullptr && ppInfo.eyeAdaptationTex[1] != nullptr;
-		if(!texturesInitialized)
-		{
-			POOLED_RENDER_TEXTURE_DESC outputDesc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_FLOAT32_R, 1, 1, TU_RENDERTARGET);
-			ppInfo.eyeAdaptationTex[0] = RenderTexturePool::instance().get(outputDesc);
-			ppInfo.eyeAdaptationTex[1] = RenderTexturePool::instance().get(outputDesc);
-		}
-
-		ppInfo.lastEyeAdaptationTex = (ppInfo.lastEyeAdaptationTex + 1) % 2; // TODO - Do I really need two targets?
-
 		// Set parameters
-		mReducedHistogramTex.set(ppInfo.histogramReduceTex->texture);
+		mReducedHistogramTex.set(reducedHistogram);
 
 		Vector2 histogramScaleAndOffset = EyeAdaptHistogramMat::getHistogramScaleOffset(ppInfo);
 
@@ -274,10 +243,8 @@ namespace bs
 		gEyeAdaptationParamDef.gEyeAdaptationParams.set(mParamBuffer, eyeAdaptationParams[2], 2);
 
 		// Render
-		SPtr<PooledRenderTexture> eyeAdaptationRT = ppInfo.eyeAdaptationTex[ppInfo.lastEyeAdaptationTex];
-
 		RenderAPICore& rapi = RenderAPICore::instance();
-		rapi.setRenderTarget(eyeAdaptationRT->renderTexture, true);
+		rapi.setRenderTarget(output, true);
 
 		gRendererUtility().setPass(mMaterial);
 		gRendererUtility().setPassParams(mParamsSet);
@@ -303,7 +270,7 @@ namespace bs
 		defines.set("LUT_SIZE", LUT_SIZE);
 	}
 
-	void CreateTonemapLUTMat::execute(PostProcessInfo& ppInfo)
+	void CreateTonemapLUTMat::execute(const SPtr<RenderTextureCore>& output, PostProcessInfo& ppInfo)
 	{
 		const StandardPostProcessSettings& settings = *ppInfo.settings;
 
@@ -338,15 +305,9 @@ namespace bs
 		gWhiteBalanceParamDef.gWhiteTemp.set(mWhiteBalanceParamBuffer, settings.whiteBalance.temperature);
 		gWhiteBalanceParamDef.gWhiteOffset.set(mWhiteBalanceParamBuffer, settings.whiteBalance.tint);
 
-		// Set output
-		POOLED_RENDER_TEXTURE_DESC outputDesc = POOLED_RENDER_TEXTURE_DESC::create3D(PF_B8G8R8X8, 
-			LUT_SIZE, LUT_SIZE, LUT_SIZE, TU_RENDERTARGET);
-
 		// Render
-		ppInfo.colorLUT = RenderTexturePool::instance().get(outputDesc);
-
 		RenderAPICore& rapi = RenderAPICore::instance();
-		rapi.setRenderTarget(ppInfo.colorLUT->renderTexture);
+		rapi.setRenderTarget(output);
 
 		gRendererUtility().setPass(mMaterial);
 		gRendererUtility().setPassParams(mParamsSet);
@@ -358,6 +319,11 @@ namespace bs
 		RenderTexturePool::instance().release(ppInfo.colorLUT);
 	}
 
+	POOLED_RENDER_TEXTURE_DESC CreateTonemapLUTMat::getOutputDesc()
+	{
+		return POOLED_RENDER_TEXTURE_DESC::create3D(PF_B8G8R8X8, LUT_SIZE, LUT_SIZE, LUT_SIZE, TU_RENDERTARGET);
+	}
+
 	TonemappingParamDef gTonemappingParamDef;
 
 	template<bool GammaOnly, bool AutoExposure>
@@ -433,37 +399,136 @@ namespace bs
 
 		SPtr<ViewportCore> outputViewport = camera->getViewport();
 		bool hdr = camera->getFlags().isSet(CameraFlag::HDR);
+		bool autoExposure = hdr && settings.enableAutoExposure;
+		bool tonemapping = hdr && settings.enableTonemapping;
 
-		if(hdr && settings.enableAutoExposure)
-		{
-			mDownsample.execute(sceneColor, ppInfo);
-			mEyeAdaptHistogram.execute(ppInfo);
-			mDownsample.release(ppInfo);
+		mGraph.clear();
 
-			mEyeAdaptHistogramReduce.execute(ppInfo);
-			mEyeAdaptHistogram.release(ppInfo);
+		SPtr<TextureCore> sceneColorTexture = sceneColor->getColorTexture(0);
+		UINT32 sceneColorTex = mGraph.importTexture("SceneColor", sceneColorTexture, sceneColor);
 
-			mEyeAdaptation.execute(ppInfo, frameDelta);
-			mEyeAdaptHistogramReduce.release(ppInfo);
+		// Auto exposure reads the eye adaptation value from the previous frame, and writes the new value into the other
+		// texture. Intermediate textures are transient and only live while the passes using them execute.
+		UINT32 eyeAdaptationTex = (UINT32)-1;
+		if(autoExposure)
+		{
+			SPtr<TextureCore> prevEyeAdaptation = TextureCore::WHITE; // In case this is the first run
+			if (ppInfo.eyeAdaptationTex[ppInfo.lastEyeAdaptationTex] != nullptr)
+				prevEyeAdaptation = ppInfo.eyeAdaptationTex[ppInfo.lastEyeAdaptationTex]->texture;
+
+			bool texturesInitialized = ppInfo.eyeAdaptationTex[0] != nullptr && ppInfo.eyeAdaptationTex[1] != nullptr;
+			if(!texturesInitialized)
+			{
+				POOLED_RENDER_TEXTURE_DESC outputDesc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_FLOAT32_R, 1, 1, 
+					TU_RENDERTARGET);
+				ppInfo.eyeAdaptationTex[0] = RenderTexturePool::instance().get(outputDesc);
+				ppInfo.eyeAdaptationTex[1] = RenderTexturePool::instance().get(outputDesc);
+			}
+
+			ppInfo.lastEyeAdaptationTex = (ppInfo.lastEyeAdaptationTex + 1) % 2; // TODO - Do I really need two targets?
+			SPtr<PooledRenderTexture> eyeAdaptationRT = ppInfo.eyeAdaptationTex[ppInfo.lastEyeAdaptationTex];
+
+			TEXTURE_DESC downsampledDesc = DownsampleMat::getOutputDesc(sceneColorTexture);
+			TEXTURE_DESC histogramDesc = EyeAdaptHistogramMat::getOutputDesc(downsampledDesc.width, 
+				downsampledDesc.height);
+
+			UINT32 downsampledTex = mGraph.createTexture("DownsampledSceneColor", downsampledDesc);
+			UINT32 histogramTex = mGraph.createTexture("Histogram", histogramDesc);
+			UINT32 histogramReduceTex = mGraph.createTexture("HistogramReduce", 
+				EyeAdaptHistogramReduceMat::getOutputDesc());
+			UINT32 prevEyeAdaptationTex = mGraph.importTexture("PrevEyeAdaptation", prevEyeAdaptation);
+			eyeAdaptationTex = mGraph.importTexture("EyeAdaptation", eyeAdaptationRT->texture,
+				eyeAdaptationRT->renderTexture);
+
+			UINT32 downsamplePass = mGraph.addPass("Downsample", [=](const RenderGraph& graph)
+			{
+				mDownsample.execute(graph.getTexture(sceneColorTex), graph.getRenderTexture(downsampledTex));
+			});
+
+			mGraph.read(downsamplePass, sceneColorTex);
+			mGraph.write(downsamplePass, downsampledTex);
+
+			UINT32 histogramPass = mGraph.addPass("EyeAdaptHistogram", [=, &ppInfo](const RenderGraph& graph)
+			{
+				mEyeAdaptHistogram.execute(graph.getTexture(downsampledTex), graph.getTexture(histogramTex), ppInfo);
+			});
+
+			mGraph.read(histogramPass, downsampledTex);
+			mGraph.write(histogramPass, histogramTex);
+
+			UINT32 reducePass = mGraph.addPass("EyeAdaptHistogramReduce", [=](const RenderGraph& graph)
+			{
+				mEyeAdaptHistogramReduce.execute(graph.getTexture(histogramTex), graph.getTexture(prevEyeAdaptationTex),
+					graph.getRenderTexture(histogramReduceTex));
+			});
+
+			mGraph.read(reducePass, histogramTex);
+			mGraph.read(reducePass, prevEyeAdaptationTex);
+			mGraph.write(reducePass, histogramReduceTex);
+
+			UINT32 eyeAdaptationPass = mGraph.addPass("EyeAdaptation", [=, &ppInfo](const RenderGraph& graph)
+			{
+				mEyeAdaptation.execute(graph.getTexture(histogramReduceTex), graph.getRenderTexture(eyeAdaptationTex),
+					ppInfo, frameDelta);
+			});
+
+			mGraph.read(eyeAdaptationPass, histogramReduceTex);
+			mGraph.write(eyeAdaptationPass, eyeAdaptationTex);
 		}
 
-		if (hdr && settings.enableTonemapping)
+		UINT32 colorLUTTex = (UINT32)-1;
+		if(tonemapping)
 		{
-			if (ppInfo.settingDirty) // Rebuild LUT if PP settings changed
-				mCreateLUT.execute(ppInfo);
-
-			if (settings.enableAutoExposure)
-				mTonemapping_AE.execute(sceneColor, outputViewport, ppInfo);
-			else
-				mTonemapping.execute(sceneColor, outputViewport, ppInfo);
+			bool rebuildLUT = ppInfo.settingDirty; // Rebuild LUT if PP settings changed
+			if (ppInfo.colorLUT == nullptr)
+			{
+				ppInfo.colorLUT = RenderTexturePool::instance().get(CreateTonemapLUTMat::getOutputDesc());
+				rebuildLUT = true;
+			}
+
+			colorLUTTex = mGraph.importTexture("ColorLUT", ppInfo.colorLUT->texture, ppInfo.colorLUT->renderTexture);
+
+			if (rebuildLUT)
+			{
+				UINT32 createLUTPass = mGraph.addPass("CreateTonemapLUT", [=, &ppInfo](const RenderGraph& graph)
+				{
+					mCreateLUT.execute(graph.getRenderTexture(colorLUTTex), ppInfo);
+				});
+
+				mGraph.write(createLUTPass, colorLUTTex);
+			}
 		}
-		else
+
+		UINT32 tonemapPass = mGraph.addPass("Tonemapping", [=, &ppInfo](const RenderGraph& graph)
 		{
-			if (hdr && settings.enableAutoExposure)
-				mTonemapping_AE_GO.execute(sceneColor, outputViewport, ppInfo);
+			if (tonemapping)
+			{
+				if (autoExposure)
+					mTonemapping_AE.execute(sceneColor, outputViewport, ppInfo);
+				else
+					mTonemapping.execute(sceneColor, outputViewport, ppInfo);
+			}
 			else
-				mTonemapping_GO.execute(sceneColor, outputViewport, ppInfo);
-		}
+			{
+				if (autoExposure)
+					mTonemapping_AE_GO.execute(sceneColor, outputViewport, ppInfo);
+				else
+					mTonemapping_GO.execute(sceneColor, outputViewport, ppInfo);
+			}
+		});
+
+		// Writes to the viewport target, which is not tracked by the graph
+		mGraph.setHasSideEffects(tonemapPass);
+		mGraph.read(tonemapPass, sceneColorTex);
+
+		if (eyeAdaptationTex != (UINT32)-1)
+			mGraph.read(tonemapPass, eyeAdaptationTex);
+
+		if (colorLUTTex != (UINT32)-1)
+			mGraph.read(tonemapPass, colorLUTTex);
+
+		if (mGraph.compile())
+			mGraph.execute(RenderTexturePool::instance());
 
 		if (ppInfo.settingDirty)
 			ppInfo.settingDirty = false;
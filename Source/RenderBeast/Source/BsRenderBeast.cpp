@@ -32,6 +32,8 @@
 #include "BsGpuParamsSet.h"
 #include "BsRendererExtension.h"
 #include "BsMeshData.h"
+#include "BsMaterialParams.h"
+#include "BsTextureStreamingManager.h"
 
 using namespace std::placeholders;
 
@@ -43,12 +45,12 @@ namespace bs
 
 	RenderBeast::RenderBeast()
 		: mDefaultMaterial(nullptr), mPointLightInMat(nullptr), mPointLightOutMat(nullptr), mDirLightMat(nullptr)
-		, mObjectRenderer(nullptr), mOptions(bs_shared_ptr_new<RenderBeastOptions>()), mOptionsDirty(true)
+		, mObjectRenderer(nullptr), mShadowRenderer(nullptr), mOptions(bs_shared_ptr_new<RenderBeastOptions>()), mOptionsDirty(true)
 	{ }
 
 	const StringID& RenderBeast::getName() const
 	{
-		static StringID name = "RenderBeast";
+		static StringID name = "RenderBeast"_sid;
 		return name;
 	}
 
@@ -81,6 +83,9 @@ namespace bs
 
 		RenderTexturePool::startUp();
 		PostProcessing::startUp();
+
+		mShadowRenderer = bs_new<ShadowRenderer>();
+		mShadowRenderer->setOptions(mCoreOptions);
 	}
 
 	void RenderBeast::destroyCore()
@@ -99,6 +104,8 @@ namespace bs
 		mRenderables.clear();
 		mVisibility.clear();
 
+		bs_delete(mShadowRenderer);
+
 		PostProcessing::shutDown();
 		RenderTexturePool::shutDown();
 
@@ -238,7 +245,30 @@ namespace bs
 
 				mObjectRenderer->initElement(*rendererObject, renElement);
 			}
+
+			// Elements for lower levels of detail only differ in the index range they render, so they can share the
+			// parameters of the full detail elements
+			UINT32 numSubMeshes = meshProps.getNumSubMeshes();
+			UINT32 numLODs = meshProps.getNumLODs();
+			rendererObject->lodElements.reserve((numLODs - 1) * numSubMeshes);
+
+			for (UINT32 i = 1; i < numLODs; i++)
+			{
+				for (UINT32 j = 0; j < numSubMeshes; j++)
+				{
+					rendererObject->lodElements.push_back(rendererObject->elements[j]);
+					rendererObject->lodElements.back().subMesh = meshProps.getLODSubMesh(i, j);
+				}
+			}
+
+			// Start creating pipelines for cameras that are already rendering, so when the renderable first becomes
+			// visible (e.g. after a scene load) its pipelines don't need to be created while recording the frame
+			Vector<RendererObject*> addedRenderables = { rendererObject };
+			for (auto& entry : mCameras)
+				prewarmPipelines(*entry.second, addedRenderables);
 		}
+
+		mShadowRenderer->notifyCasterChanged(mWorldBounds[renderableId]);
 	}
 
 	void RenderBeast::notifyRenderableRemoved(RenderableCore* renderable)
@@ -248,6 +278,8 @@ namespace bs
 		UINT32 lastRenderableId = lastRenerable->getRendererId();
 
 		RendererObject* rendererObject = mRenderables[renderableId];
+		mShadowRenderer->notifyCasterChanged(mWorldBounds[renderableId]);
+
 		Vector<BeastRenderableElement>& elements = rendererObject->elements;
 		for (auto& element : elements)
 		{
@@ -277,6 +309,9 @@ namespace bs
 
 			for (auto& element : elements)
 				element.renderableId = renderableId;
+
+			for (auto& element : rendererObject->lodElements)
+				element.renderableId = renderableId;
 		}
 
 		// Last element is the one we want to erase
@@ -284,6 +319,9 @@ namespace bs
 		mWorldBounds.erase(mWorldBounds.end() - 1);
 		mVisibility.erase(mVisibility.end() - 1);
 
+		for (auto& entry : mCameras)
+			entry.second->notifyRenderableRemoved(renderableId, lastRenderableId);
+
 		bs_delete(rendererObject);
 	}
 
@@ -292,7 +330,11 @@ namespace bs
 		UINT32 renderableId = renderable->getRendererId();
 
 		mRenderables[renderableId]->updatePerObjectBuffer();
+
+		// Both the old and the new location of the caster might be in a cached shadow map
+		mShadowRenderer->notifyCasterChanged(mWorldBounds[renderableId]);
 		mWorldBounds[renderableId] = renderable->getBounds();
+		mShadowRenderer->notifyCasterChanged(mWorldBounds[renderableId]);
 	}
 
 	void RenderBeast::notifyLightAdded(LightCore* light)
@@ -327,10 +369,14 @@ namespace bs
 
 		if (light->getType() != LightType::Directional)
 			mLightWorldBounds[lightId] = light->getBounds();
+
+		mShadowRenderer->notifyLightChanged(light);
 	}
 
 	void RenderBeast::notifyLightRemoved(LightCore* light)
 	{
+		mShadowRenderer->notifyLightChanged(light);
+
 		UINT32 lightId = light->getRendererId();
 		if (light->getType() == LightType::Directional)
 		{
@@ -519,6 +565,7 @@ namespace bs
 			refreshSamplerOverrides(true);
 
 		*mCoreOptions = options;
+		mShadowRenderer->setOptions(mCoreOptions);
 
 		for (auto& entry : mCameras)
 		{
@@ -559,8 +606,9 @@ namespace bs
 		// Generate render queues per camera
 		mVisibility.assign(mVisibility.size(), false);
 
+		OcclusionBuffer* occlusionBuffer = mCoreOptions->occlusionCulling ? &mOcclusionBuffer : nullptr;
 		for (auto& entry : mCameras)
-			entry.second->determineVisible(mRenderables, mWorldBounds, mVisibility);
+			entry.second->determineVisible(mRenderables, mWorldBounds, mVisibility, occlusionBuffer);
 
 		// Retrieve animation data
 		AnimationManager::instance().waitUntilComplete();
@@ -585,6 +633,22 @@ namespace bs
 			mRenderables[i]->perObjectParamBuffer->flushToGPU();
 		}
 
+		// Render spot and point light shadow maps (only those whose cached shadow maps are out of date)
+		if (mCoreOptions->shadows)
+		{
+			gProfilerGPU().beginSample("ShadowMaps");
+
+			for (auto& light : mPointLights)
+			{
+				if (!light.internal->getIsActive())
+					continue;
+
+				mShadowRenderer->renderLightShadow(light.internal, mRenderables, mWorldBounds);
+			}
+
+			gProfilerGPU().endSample("ShadowMaps");
+		}
+
 		// Render everything, target by target
 		for (auto& rtInfo : mRenderTargets)
 		{
@@ -644,9 +708,45 @@ namespace bs
 			}
 		}
 
+		if (TextureStreamingManager::isStarted())
+			notifyTextureStreaming(*camera, visibility);
+
+		// Render directional light shadow cascades covering this camera's view
+		mDirectionalShadows.resize(mDirectionalLights.size());
+		if (mCoreOptions->shadows)
+		{
+			gProfilerGPU().beginSample("CascadedShadowMaps");
+
+			for (UINT32 i = 0; i < (UINT32)mDirectionalLights.size(); i++)
+			{
+				const LightCore* light = mDirectionalLights[i].internal;
+				if (!light->getIsActive())
+					continue;
+
+				mShadowRenderer->renderCascades(*camera, light, mRenderables, mWorldBounds, mDirectionalShadows[i]);
+			}
+
+			gProfilerGPU().endSample("CascadedShadowMaps");
+		}
+		else
+		{
+			for (auto& entry : mDirectionalShadows)
+				entry = LightShadowInfo();
+		}
+
 		rendererCam->beginRendering(true);
 
 		SPtr<RenderTargets> renderTargets = rendererCam->getRenderTargets();
+
+		// Pipelines are created per render target, so when the camera renders for the first time or its targets get
+		// re-created (e.g. on resize), start creating pipelines for all renderables in the scene
+		SPtr<RenderTextureCore> gbufferRT = renderTargets->getGBufferRT();
+		if (gbufferRT != rendererCam->getPrewarmedGBufferRT())
+		{
+			rendererCam->setPrewarmedTargets(gbufferRT, renderTargets->getSceneColorRT());
+			prewarmPipelines(*rendererCam, mRenderables);
+		}
+
 		renderTargets->bindGBuffer();
 
 		//// Trigger pre-base-pass callbacks
@@ -689,12 +789,13 @@ namespace bs
 		//// Render light pass
 		{
 			mDirLightMat->bind(renderTargets, perCameraBuffer);
-			for (auto& light : mDirectionalLights)
+			for (UINT32 i = 0; i < (UINT32)mDirectionalLights.size(); i++)
 			{
-				if (!light.internal->getIsActive())
+				const LightCore* light = mDirectionalLights[i].internal;
+				if (!light->getIsActive())
 					continue;
 
-				mDirLightMat->setPerLightParams(light.internal);
+				mDirLightMat->setPerLightParams(light, &mDirectionalShadows[i]);
 				gRendererUtility().drawScreenQuad();
 			}
 
@@ -715,7 +816,7 @@ namespace bs
 				if (!cameraInLightGeometry)
 					continue;
 
-				mPointLightInMat->setPerLightParams(light.internal);
+				mPointLightInMat->setPerLightParams(light.internal, mShadowRenderer->getLightShadow(light.internal));
 
 				SPtr<MeshCore> mesh = light.internal->getMesh();
 				gRendererUtility().draw(mesh, mesh->getProperties().getSubMesh(0));
@@ -736,7 +837,7 @@ namespace bs
 				if (cameraInLightGeometry)
 					continue;
 
-				mPointLightOutMat->setPerLightParams(light.internal);
+				mPointLightOutMat->setPerLightParams(light.internal, mShadowRenderer->getLightShadow(light.internal));
 
 				SPtr<MeshCore> mesh = light.internal->getMesh();
 				gRendererUtility().draw(mesh, mesh->getProperties().getSubMesh(0));
@@ -744,6 +845,7 @@ namespace bs
 		}
 
 		renderTargets->bindSceneColor(false);
+		mShadowRenderer->releaseCascades();
 		
 		// Render transparent objects (TODO - No lighting yet)
 		const Vector<RenderQueueElement>& transparentElements = rendererCam->getTransparentQueue()->getSortedElements();
@@ -788,6 +890,68 @@ namespace bs
 		gProfilerCPU().endSample("Render");
 	}
 
+	void RenderBeast::notifyTextureStreaming(const CameraCore& camera, const Vector<bool>& visibility)
+	{
+		SPtr<ViewportCore> viewport = camera.getViewport();
+		float viewportHeight = (float)viewport->getHeight();
+		Vector3 cameraPos = camera.getPosition();
+		bool isOrtho = camera.getProjectionType() == PT_ORTHOGRAPHIC;
+		float projScale = camera.getProjectionMatrixRS()[1][1];
+
+		// Densities are gathered locally and submitted all at once, so the manager's lock is only taken once per camera
+		mTexelDensities.clear();
+
+		UINT32 numRenderables = (UINT32)mRenderables.size();
+		for (UINT32 i = 0; i < numRenderables; i++)
+		{
+			if (!visibility[i])
+				continue;
+
+			// Approximate the size of the object on the screen using its bounding sphere
+			const Sphere& sphere = mWorldBounds[i].getSphere();
+			float radius = sphere.getRadius();
+
+			float screenDiameter;
+			if (isOrtho)
+				screenDiameter = 2.0f * radius / camera.getOrthoWindowHeight() * viewportHeight;
+			else
+			{
+				float distance = std::max(cameraPos.distance(sphere.getCenter()) - radius, camera.getNearClipDistance());
+				screenDiameter = radius * projScale * viewportHeight / distance;
+			}
+
+			screenDiameter = std::max(screenDiameter, 1.0f);
+
+			for (auto& element : mRenderables[i]->elements)
+			{
+				SPtr<MaterialParamsCore> params = element.material->_getInternalParams();
+
+				UINT32 numParams = params->getNumParams();
+				for (UINT32 j = 0; j < numParams; j++)
+				{
+					const MaterialParamsBase::ParamData* paramData = params->getParamData(j);
+					if (paramData->type != MaterialParamsBase::ParamType::Texture)
+						continue;
+
+					SPtr<TextureCore> texture;
+					params->getTexture(*paramData, texture);
+
+					if (texture == nullptr || texture->_getStreamingId() == (UINT32)-1)
+						continue;
+
+					// Assumes the texture is mapped over the object once, which is true for most regular meshes
+					const TextureProperties& texProps = texture->getProperties();
+					float textureSize = (float)std::max(texProps.getWidth(), texProps.getHeight());
+
+					mTexelDensities.push_back(std::make_pair(texture->_getStreamingId(), textureSize / screenDiameter));
+				}
+			}
+		}
+
+		if (!mTexelDensities.empty())
+			TextureStreamingManager::instance()._notifyTexelDensities(mTexelDensities);
+	}
+
 	void RenderBeast::renderOverlay(const RendererFrame& frameInfo, RendererRenderTarget& rtData, UINT32 camIdx)
 	{
 		gProfilerCPU().beginSample("RenderOverlay");
@@ -868,6 +1032,61 @@ namespace bs
 				element.morphVertexDeclaration);
 	}
 
+	void RenderBeast::prewarmPipelines(const RendererCamera& camera, const Vector<RendererObject*>& renderables)
+	{
+		SPtr<RenderTextureCore> gbufferRT = camera.getPrewarmedGBufferRT();
+		SPtr<RenderTextureCore> sceneColorRT = camera.getPrewarmedSceneColorRT();
+		if (gbufferRT == nullptr || sceneColorRT == nullptr)
+			return;
+
+		// Record the permutations the elements are drawn with by render(): opaque elements into the GBuffer, and
+		// transparent ones into scene color
+		Vector<PIPELINE_PERMUTATION_DESC> permutations;
+		for (auto& renderable : renderables)
+		{
+			for (auto& element : renderable->elements)
+			{
+				bool isTransparent = (element.material->getShader()->getFlags() & (UINT32)ShaderFlags::Transparent) != 0;
+
+				PIPELINE_PERMUTATION_DESC desc;
+				desc.target = isTransparent ? sceneColorRT : gbufferRT;
+				desc.drawOp = element.subMesh.drawOp;
+
+				if (element.morphVertexDeclaration != nullptr)
+					desc.vertexDeclaration = element.morphVertexDeclaration;
+				else
+					desc.vertexDeclaration = element.mesh->getVertexData()->vertexDeclaration;
+
+				UINT32 numPasses = element.material->getNumPasses(element.techniqueIdx);
+				for (UINT32 i = 0; i < numPasses; i++)
+				{
+					desc.pipeline = element.material->getPass(i, element.techniqueIdx)->getGraphicsPipelineState();
+					if (desc.pipeline != nullptr)
+						permutations.push_back(desc);
+				}
+			}
+		}
+
+		// Many renderables share materials and vertex layouts, so only request each unique permutation once
+		auto lessThan = [](const PIPELINE_PERMUTATION_DESC& a, const PIPELINE_PERMUTATION_DESC& b)
+		{
+			return std::tie(a.pipeline, a.target, a.vertexDeclaration, a.drawOp) < 
+				std::tie(b.pipeline, b.target, b.vertexDeclaration, b.drawOp);
+		};
+
+		auto equal = [](const PIPELINE_PERMUTATION_DESC& a, const PIPELINE_PERMUTATION_DESC& b)
+		{
+			return a.pipeline == b.pipeline && a.target == b.target && a.vertexDeclaration == b.vertexDeclaration &&
+				a.drawOp == b.drawOp;
+		};
+
+		std::sort(permutations.begin(), permutations.end(), lessThan);
+		permutations.erase(std::unique(permutations.begin(), permutations.end(), equal), permutations.end());
+
+		if (!permutations.empty())
+			RenderAPICore::instance().prewarmPipelines(permutations);
+	}
+
 	void RenderBeast::refreshSamplerOverrides(bool force)
 	{
 		bool anyDirty = false;
@@ -89,6 +89,36 @@ namespace bs
 		iterFind->second.lock()->mIsFree = true;
 	}
 
+	void RenderTexturePool::allocate(const TEXTURE_DESC& desc, SPtr<TextureCore>& texture,
+		SPtr<RenderTextureCore>& renderTexture)
+	{
+		POOLED_RENDER_TEXTURE_DESC pooledDesc;
+		pooledDesc.width = desc.width;
+		pooledDesc.height = desc.height;
+		pooledDesc.depth = desc.depth;
+		pooledDesc.format = desc.format;
+		pooledDesc.numSamples = desc.numSamples;
+		pooledDesc.flag = (TextureUsage)desc.usage;
+		pooledDesc.hwGamma = desc.hwGamma;
+		pooledDesc.type = desc.type;
+
+		SPtr<PooledRenderTexture> pooledTexture = get(pooledDesc);
+		mGraphTextures[pooledTexture->texture.get()] = pooledTexture;
+
+		texture = pooledTexture->texture;
+		renderTexture = pooledTexture->renderTexture;
+	}
+
+	void RenderTexturePool::release(const SPtr<TextureCore>& texture)
+	{
+		auto iterFind = mGraphTextures.find(texture.get());
+		if (iterFind == mGraphTextures.end())
+			return;
+
+		release(iterFind->second);
+		mGraphTextures.erase(iterFind);
+	}
+
 	bool RenderTexturePool::matches(const SPtr<TextureCore>& texture, const POOLED_RENDER_TEXTURE_DESC& desc)
 	{
 		const TextureProperties& texProps = texture->getProperties();
@@ -6,6 +6,9 @@
 #include "BsMaterial.h"
 #include "BsShader.h"
 #include "BsRenderTargets.h"
+#include "BsMesh.h"
+#include "BsOcclusionBuffer.h"
+#include "BsRenderStats.h"
 
 namespace bs
 {
@@ -84,10 +87,11 @@ namespace bs
 	}
 
 	void RendererCamera::determineVisible(const Vector<RendererObject*>& renderables, const Vector<Bounds>& renderableBounds,
-		Vector<bool>& visibility)
+		Vector<bool>& visibility, OcclusionBuffer* occlusionBuffer)
 	{
 		mVisibility.clear();
 		mVisibility.resize(renderables.size(), false);
+		mLODs.resize(renderables.size(), 0);
 
 		bool isOverlayCamera = mCamera->getFlags().isSet(CameraFlag::Overlay);
 		if (isOverlayCamera)
@@ -96,47 +100,164 @@ namespace bs
 		UINT64 cameraLayers = mCamera->getLayers();
 		ConvexVolume worldFrustum = mCamera->getWorldFrustum();
 
-		// Update per-object param buffers and queue render elements
-		for(UINT32 i = 0; i < (UINT32)renderables.size(); i++)
+		// Find objects within the frustum
+		mCandidates.clear();
+
+		UINT32 numFrustumCulled = cullObjects(worldFrustum, cameraLayers, renderables, renderableBounds, mCandidates);
+		BS_ADD_RENDER_STAT(NumFrustumCulled, numFrustumCulled);
+
+		// Cull objects hidden behind occluders
+		UINT32 numCandidates = (UINT32)mCandidates.size();
+
+		bool anyOccluders = false;
+		for (UINT32 i = 0; i < numCandidates && !anyOccluders; i++)
+			anyOccluders = renderables[mCandidates[i]]->renderable->getOccluderGeometry() != nullptr;
+
+		bool occlusionCull = occlusionBuffer != nullptr && anyOccluders;
+
+		if (occlusionCull)
+		{
+			occlusionBuffer->clear(mCamera->getProjectionMatrix() * mCamera->getViewMatrix());
+
+			mCandidateBounds.resize(numCandidates);
+			for (UINT32 i = 0; i < numCandidates; i++)
+			{
+				RenderableCore* renderable = renderables[mCandidates[i]]->renderable;
+				mCandidateBounds[i] = renderableBounds[renderable->getRendererId()].getBox();
+
+				const SPtr<OccluderGeometry>& occluder = renderable->getOccluderGeometry();
+				if (occluder != nullptr)
+					occlusionBuffer->addOccluder(*occluder, renderable->getTransform());
+			}
+
+			occlusionBuffer->rasterize();
+			occlusionBuffer->isVisible(mCandidateBounds, mCandidateVisibility);
+		}
+
+		// Queue render elements of visible objects
+		UINT32 numOcclusionCulled = 0;
+		for (UINT32 i = 0; i < numCandidates; i++)
+		{
+			if (occlusionCull && !mCandidateVisibility[i])
+			{
+				numOcclusionCulled++;
+				continue;
+			}
+
+			UINT32 idx = mCandidates[i];
+			RendererObject* object = renderables[idx];
+			UINT32 rendererId = object->renderable->getRendererId();
+
+			visibility[idx] = true;
+			mVisibility[idx] = true;
+
+			const Bounds& bounds = renderableBounds[rendererId];
+			float distanceToCamera = (mCamera->getPosition() - bounds.getBox().getCenter()).length();
+
+			UINT32 lod = selectLOD(*object, bounds.getSphere(), mLODs[idx]);
+			mLODs[idx] = lod;
+
+			UINT32 numElements = (UINT32)object->elements.size();
+			BeastRenderableElement* elements;
+			if (lod == 0)
+				elements = object->elements.data();
+			else
+				elements = &object->lodElements[(lod - 1) * numElements];
+
+			for (UINT32 j = 0; j < numElements; j++)
+			{
+				BeastRenderableElement& renderElem = elements[j];
+				bool isTransparent = (renderElem.material->getShader()->getFlags() & (UINT32)ShaderFlags::Transparent) != 0;
+
+				if (isTransparent)
+					mTransparentQueue->add(&renderElem, distanceToCamera);
+				else
+					mOpaqueQueue->add(&renderElem, distanceToCamera);
+			}
+		}
+
+		BS_ADD_RENDER_STAT(NumOcclusionCulled, numOcclusionCulled);
+
+		mOpaqueQueue->sort();
+		mTransparentQueue->sort();
+	}
+
+	UINT32 RendererCamera::cullObjects(const ConvexVolume& volume, UINT64 layers,
+		const Vector<RendererObject*>& renderables, const Vector<Bounds>& renderableBounds, Vector<UINT32>& output)
+	{
+		UINT32 numCulled = 0;
+		for (UINT32 i = 0; i < (UINT32)renderables.size(); i++)
 		{
 			RenderableCore* renderable = renderables[i]->renderable;
 			UINT32 rendererId = renderable->getRendererId();
 
-			if ((renderable->getLayer() & cameraLayers) == 0)
+			if ((renderable->getLayer() & layers) == 0)
 				continue;
 
-			// Do frustum culling
 			// Note: This is bound to be a bottleneck at some point. When it is ensure that intersect methods use vector
 			// operations, as it is trivial to update them. Also consider spatial partitioning.
 			const Sphere& boundingSphere = renderableBounds[rendererId].getSphere();
-			if (worldFrustum.intersects(boundingSphere))
+			if (volume.intersects(boundingSphere))
 			{
 				// More precise with the box
 				const AABox& boundingBox = renderableBounds[rendererId].getBox();
 
-				if (worldFrustum.intersects(boundingBox))
+				if (volume.intersects(boundingBox))
 				{
-					visibility[i] = true;
-					mVisibility[i] = true;
+					output.push_back(i);
+					continue;
+				}
+			}
+
+			numCulled++;
+		}
+
+		return numCulled;
+	}
 
-					float distanceToCamera = (mCamera->getPosition() - boundingBox.getCenter()).length();
+	UINT32 RendererCamera::selectLOD(const RendererObject& object, const Sphere& bounds, UINT32 prevLOD) const
+	{
+		// Fraction by which the screen size must move past a level's threshold before switching to it
+		static const float LOD_HYSTERESIS = 0.1f;
 
-					for (auto& renderElem : renderables[i]->elements)
-					{
-						bool isTransparent = (renderElem.material->getShader()->getFlags() & (UINT32)ShaderFlags::Transparent) != 0;
+		if (object.lodElements.empty() || object.elements.empty())
+			return 0;
 
-						if (isTransparent)
-							mTransparentQueue->add(&renderElem, distanceToCamera);
-						else
-							mOpaqueQueue->add(&renderElem, distanceToCamera);
-					}
+		SPtr<MeshCore> mesh = object.renderable->getMesh();
+		if (mesh == nullptr)
+			return 0;
 
-				}
-			}
+		// Determine the size of the bounds relative to viewport height
+		float screenSize;
+		if (mCamera->getProjectionType() == PT_PERSPECTIVE)
+		{
+			float distance = (mCamera->getPosition() - bounds.getCenter()).length();
+			if (distance <= bounds.getRadius())
+				return 0;
+
+			float tanHalfFOV = Math::tan(mCamera->getHorzFOV() * 0.5f) / mCamera->getAspectRatio();
+			screenSize = bounds.getRadius() / (distance * tanHalfFOV);
 		}
+		else
+			screenSize = (bounds.getRadius() * 2.0f) / mCamera->getOrthoWindowHeight();
 
-		mOpaqueQueue->sort();
-		mTransparentQueue->sort();
+		const MeshProperties& meshProps = mesh->getProperties();
+		UINT32 numLODs = std::min(meshProps.getNumLODs(), 
+			(UINT32)(object.lodElements.size() / object.elements.size()) + 1);
+
+		return std::min(meshProps.getLOD(screenSize, prevLOD, LOD_HYSTERESIS), numLODs - 1);
+	}
+
+	void RendererCamera::notifyRenderableRemoved(UINT32 rendererId, UINT32 lastRendererId)
+	{
+		// Renderer moves the last object into the slot of the removed one, so do the same with per-object state. State
+		// might not exist for objects added since visibility was last determined.
+		UINT32 numLODs = (UINT32)mLODs.size();
+		if (rendererId < numLODs)
+			mLODs[rendererId] = lastRendererId < numLODs ? mLODs[lastRendererId] : 0;
+
+		if (lastRendererId < numLODs)
+			mLODs.resize(lastRendererId);
 	}
 
 	Vector2 RendererCamera::getDeviceZTransform(const Matrix4& projMatrix) const
@@ -0,0 +1,619 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsShadowRendering.h"
+#include "BsRendererCamera.h"
+#include "BsRenderBeastOptions.h"
+#include "BsRendererUtility.h"
+#include "BsGpuParamsSet.h"
+#include "BsMaterial.h"
+#include "BsShader.h"
+#include "BsMesh.h"
+#include "BsLight.h"
+#include "BsCamera.h"
+#include "BsRenderAPI.h"
+#include "BsRenderTexture.h"
+#include "BsTextureManager.h"
+#include "BsBitwise.h"
+
+namespace bs
+{
+	/** Smallest area the shadow atlas can be split into, in pixels. */
+	static const UINT32 MIN_SHADOW_ATLAS_AREA = 32;
+
+	/** Distance of the near plane of spot and point light shadow maps, relative to light range. */
+	static const float SHADOW_NEAR_PLANE_SCALE = 0.005f;
+
+	/** Depth bias applied to all shadow map lookups, in device depth units. */
+	static const float SHADOW_DEPTH_BIAS = 0.0001f;
+
+	/** Offset along the normal applied to receivers before shadow map lookups, in shadow map texels. */
+	static const float SHADOW_NORMAL_BIAS_TEXELS = 1.5f;
+
+	/** Creates a view matrix for a viewer at @p position looking towards @p forward. */
+	static Matrix4 createView(const Vector3& position, const Vector3& forward, const Vector3& up)
+	{
+		Vector3 z = -forward;
+		Vector3 x = Vector3::normalize(up.cross(z));
+		Vector3 y = z.cross(x);
+
+		return Matrix4(
+			x.x, x.y, x.z, -x.dot(position),
+			y.x, y.y, y.z, -y.dot(position),
+			z.x, z.y, z.z, -z.dot(position),
+			0.0f, 0.0f, 0.0f, 1.0f);
+	}
+
+	/** Creates a perspective projection matrix with a square aspect ratio. */
+	static Matrix4 createPerspective(const Radian& fov, float near, float far)
+	{
+		float t = 1.0f / Math::tan(fov * 0.5f);
+		float q = -(far + near) / (far - near);
+		float qn = -2.0f * (far * near) / (far - near);
+
+		return Matrix4(
+			t, 0.0f, 0.0f, 0.0f,
+			0.0f, t, 0.0f, 0.0f,
+			0.0f, 0.0f, q, qn,
+			0.0f, 0.0f, -1.0f, 0.0f);
+	}
+
+	/** Extracts world space frustum planes from a view-projection matrix. */
+	static ConvexVolume createFrustum(const Matrix4& viewProj)
+	{
+		Vector<Plane> planes(6);
+		for (UINT32 i = 0; i < 3; i++)
+		{
+			Plane& negPlane = planes[i * 2 + 0];
+			negPlane.normal = Vector3(viewProj[3][0] + viewProj[i][0], viewProj[3][1] + viewProj[i][1],
+				viewProj[3][2] + viewProj[i][2]);
+			negPlane.d = viewProj[3][3] + viewProj[i][3];
+
+			Plane& posPlane = planes[i * 2 + 1];
+			posPlane.normal = Vector3(viewProj[3][0] - viewProj[i][0], viewProj[3][1] - viewProj[i][1],
+				viewProj[3][2] - viewProj[i][2]);
+			posPlane.d = viewProj[3][3] - viewProj[i][3];
+		}
+
+		for (auto& plane : planes)
+		{
+			float length = plane.normal.normalize();
+			plane.d /= -length;
+		}
+
+		return ConvexVolume(planes);
+	}
+
+	/** Returns the bounding sphere of a slice of the camera's frustum, in world space. */
+	static Sphere getFrustumSliceBounds(const CameraCore& camera, float near, float far)
+	{
+		float halfWidthNear, halfHeightNear, halfWidthFar, halfHeightFar;
+		if (camera.getProjectionType() == PT_PERSPECTIVE)
+		{
+			float tanHalfWidth = Math::tan(camera.getHorzFOV() * 0.5f);
+			float tanHalfHeight = tanHalfWidth / camera.getAspectRatio();
+
+			halfWidthNear = tanHalfWidth * near;
+			halfHeightNear = tanHalfHeight * near;
+			halfWidthFar = tanHalfWidth * far;
+			halfHeightFar = tanHalfHeight * far;
+		}
+		else
+		{
+			halfWidthNear = halfWidthFar = camera.getOrthoWindowWidth() * 0.5f;
+			halfHeightNear = halfHeightFar = camera.getOrthoWindowHeight() * 0.5f;
+		}
+
+		Vector3 corners[8] =
+		{
+			Vector3(-halfWidthNear, -halfHeightNear, -near), Vector3(halfWidthNear, -halfHeightNear, -near),
+			Vector3(-halfWidthNear, halfHeightNear, -near), Vector3(halfWidthNear, halfHeightNear, -near),
+			Vector3(-halfWidthFar, -halfHeightFar, -far), Vector3(halfWidthFar, -halfHeightFar, -far),
+			Vector3(-halfWidthFar, halfHeightFar, -far), Vector3(halfWidthFar, halfHeightFar, -far)
+		};
+
+		Vector3 center(BsZero);
+		for (auto& corner : corners)
+		{
+			corner = camera.getPosition() + camera.getRotation().rotate(corner);
+			center += corner;
+		}
+
+		center /= 8.0f;
+
+		float radius = 0.0f;
+		for (auto& corner : corners)
+			radius = std::max(radius, center.distance(corner));
+
+		return Sphere(center, radius);
+	}
+
+	ShadowParamsDef gShadowParamsDef;
+
+	ShadowDepthMat::ShadowDepthMat()
+	{
+		mParamBuffer = gShadowParamsDef.createBuffer();
+		mParamsSet->setParamBlockBuffer("ShadowParams", mParamBuffer, true);
+	}
+
+	void ShadowDepthMat::_initDefines(ShaderDefines& defines)
+	{
+		// Do nothing
+	}
+
+	void ShadowDepthMat::bind(const Matrix4& viewProj)
+	{
+		gShadowParamsDef.gMatViewProj.set(mParamBuffer, viewProj);
+		mParamBuffer->flushToGPU();
+
+		gRendererUtility().setPass(mMaterial);
+	}
+
+	void ShadowDepthMat::setPerObjectBuffer(const SPtr<GpuParamBlockBufferCore>& perObjectBuffer)
+	{
+		mParamsSet->setParamBlockBuffer("PerObject", perObjectBuffer, true);
+		gRendererUtility().setPassParams(mParamsSet);
+	}
+
+	ShadowAtlasAllocator::ShadowAtlasAllocator(UINT32 size)
+		:mSize(0)
+	{
+		reset(size);
+	}
+
+	bool ShadowAtlasAllocator::allocate(UINT32 size, Rect2I& area)
+	{
+		if (mSize == 0)
+			return false;
+
+		size = Bitwise::firstPO2From(std::max(size, MIN_SHADOW_ATLAS_AREA));
+		if (size > mSize)
+			return false;
+
+		UINT32 targetLevel = getLevel(size);
+
+		// Find the smallest free area that can fit the requested size
+		INT32 level = (INT32)targetLevel;
+		while (level >= 0 && mFreeAreas[level].empty())
+			level--;
+
+		if (level < 0)
+			return false;
+
+		Vector2I position = mFreeAreas[level].back();
+		mFreeAreas[level].pop_back();
+
+		// Split it until it matches the requested size, keeping the top left quadrant
+		while ((UINT32)level < targetLevel)
+		{
+			level++;
+			INT32 quadrantSize = (INT32)(mSize >> level);
+
+			mFreeAreas[level].push_back(Vector2I(position.x + quadrantSize, position.y));
+			mFreeAreas[level].push_back(Vector2I(position.x, position.y + quadrantSize));
+			mFreeAreas[level].push_back(Vector2I(position.x + quadrantSize, position.y + quadrantSize));
+		}
+
+		area = Rect2I(position.x, position.y, size, size);
+		return true;
+	}
+
+	void ShadowAtlasAllocator::free(const Rect2I& area)
+	{
+		Vector2I position(area.x, area.y);
+		UINT32 level = getLevel(area.width);
+
+		// Merge with sibling quadrants while all of them are free
+		while (level > 0)
+		{
+			INT32 size = (INT32)(mSize >> level);
+			Vector2I parent(position.x & ~(size * 2 - 1), position.y & ~(size * 2 - 1));
+
+			Vector<Vector2I>& freeAreas = mFreeAreas[level];
+			UINT32 numFreeSiblings = 0;
+			for (auto& entry : freeAreas)
+			{
+				bool isSibling = entry != position && entry.x >= parent.x && entry.x < parent.x + size * 2 &&
+					entry.y >= parent.y && entry.y < parent.y + size * 2;
+
+				if (isSibling)
+					numFreeSiblings++;
+			}
+
+			if (numFreeSiblings < 3)
+				break;
+
+			auto iterEnd = std::remove_if(freeAreas.begin(), freeAreas.end(),
+				[&](const Vector2I& entry)
+			{
+				return entry.x >= parent.x && entry.x < parent.x + size * 2 &&
+					entry.y >= parent.y && entry.y < parent.y + size * 2;
+			});
+
+			freeAreas.erase(iterEnd, freeAreas.end());
+
+			position = parent;
+			level--;
+		}
+
+		mFreeAreas[level].push_back(position);
+	}
+
+	void ShadowAtlasAllocator::reset(UINT32 size)
+	{
+		mSize = size;
+		mFreeAreas.clear();
+
+		if (mSize == 0)
+			return;
+
+		mFreeAreas.resize(getLevel(MIN_SHADOW_ATLAS_AREA) + 1);
+		mFreeAreas[0].push_back(Vector2I(0, 0));
+	}
+
+	UINT32 ShadowAtlasAllocator::getLevel(UINT32 size) const
+	{
+		UINT32 level = 0;
+		while ((mSize >> level) > size)
+			level++;
+
+		return level;
+	}
+
+	ShadowRenderer::ShadowRenderer()
+	{
+		mDepthMat = bs_new<ShadowDepthMat>();
+	}
+
+	ShadowRenderer::~ShadowRenderer()
+	{
+		releaseCascades();
+
+		bs_delete(mDepthMat);
+	}
+
+	void ShadowRenderer::setOptions(const SPtr<RenderBeastOptions>& options)
+	{
+		mOptions = options;
+		mCachedShadows.clear();
+
+		UINT32 atlasSize = mOptions->shadows ? Bitwise::firstPO2From(mOptions->shadowAtlasSize) : 0;
+		if (atlasSize != mAllocator.getSize())
+		{
+			mAtlas = nullptr;
+			mAtlasTexture = nullptr;
+		}
+
+		mAllocator.reset(atlasSize);
+	}
+
+	void ShadowRenderer::notifyCasterChanged(const Bounds& bounds)
+	{
+		for (auto& entry : mCachedShadows)
+		{
+			if (entry.second.bounds.intersects(bounds.getSphere()))
+				entry.second.dirty = true;
+		}
+	}
+
+	void ShadowRenderer::notifyLightChanged(const LightCore* light)
+	{
+		auto iterFind = mCachedShadows.find(light);
+		if (iterFind == mCachedShadows.end())
+			return;
+
+		freeAreas(iterFind->second);
+		mCachedShadows.erase(iterFind);
+	}
+
+	void ShadowRenderer::renderLightShadow(const LightCore* light, const Vector<RendererObject*>& renderables,
+		const Vector<Bounds>& renderableBounds)
+	{
+		if (!mOptions->shadows || !light->getCastsShadow() || light->getType() == LightType::Directional)
+			return;
+
+		auto iterFind = mCachedShadows.find(light);
+		if (iterFind != mCachedShadows.end() && !iterFind->second.dirty)
+			return;
+
+		CachedShadow& shadow = mCachedShadows[light];
+		shadow.bounds = light->getBounds();
+		shadow.dirty = false;
+
+		bool isPoint = light->getType() == LightType::Point;
+
+		// Allocate space in the atlas
+		if (shadow.numAreas == 0)
+		{
+			UINT32 numAreas = isPoint ? 6 : 1;
+			UINT32 areaSize = isPoint ? mOptions->shadowMapSize / 2 : mOptions->shadowMapSize;
+
+			for (UINT32 i = 0; i < numAreas; i++)
+			{
+				if (!mAllocator.allocate(areaSize, shadow.areas[i]))
+				{
+					// Out of space, light remains without a shadow until it gets modified
+					freeAreas(shadow);
+					shadow.info = LightShadowInfo();
+					return;
+				}
+
+				shadow.numAreas++;
+			}
+		}
+
+		if (mAtlas == nullptr)
+		{
+			TEXTURE_DESC atlasDesc;
+			atlasDesc.type = TEX_TYPE_2D;
+			atlasDesc.format = PF_D32;
+			atlasDesc.width = mAllocator.getSize();
+			atlasDesc.height = mAllocator.getSize();
+			atlasDesc.usage = TU_DEPTHSTENCIL;
+
+			mAtlasTexture = TextureCoreManager::instance().createTexture(atlasDesc);
+
+			RENDER_TEXTURE_DESC_CORE rtDesc;
+			rtDesc.depthStencilSurface.texture = mAtlasTexture;
+			rtDesc.depthStencilSurface.face = 0;
+			rtDesc.depthStencilSurface.numFaces = 1;
+			rtDesc.depthStencilSurface.mipLevel = 0;
+
+			mAtlas = TextureCoreManager::instance().createRenderTexture(rtDesc);
+		}
+
+		// Render all faces. A slightly wider field of view ensures filtering near face edges doesn't sample outside of
+		// the area.
+		UINT32 areaSize = (UINT32)shadow.areas[0].width;
+		float far = light->getRange();
+		float near = far * SHADOW_NEAR_PLANE_SCALE;
+
+		Radian fov;
+		if (isPoint)
+			fov = Math::atan(1.0f + 3.0f / areaSize) * 2.0f;
+		else
+			fov = Math::clamp(light->getSpotAngle(), Degree(1), Degree(179));
+
+		Matrix4 proj = createPerspective(fov, near, far);
+
+		Matrix4 projRS;
+		RenderAPICore::instance().convertProjectionMatrix(proj, projRS);
+
+		static const Vector3 CUBE_FORWARD[6] =
+			{ Vector3::UNIT_X, -Vector3::UNIT_X, Vector3::UNIT_Y, -Vector3::UNIT_Y, Vector3::UNIT_Z, -Vector3::UNIT_Z };
+		static const Vector3 CUBE_UP[6] =
+			{ Vector3::UNIT_Y, Vector3::UNIT_Y, Vector3::UNIT_Z, Vector3::UNIT_Z, Vector3::UNIT_Y, Vector3::UNIT_Y };
+
+		for (UINT32 i = 0; i < shadow.numAreas; i++)
+		{
+			Matrix4 view;
+			if (isPoint)
+				view = createView(light->getPosition(), CUBE_FORWARD[i], CUBE_UP[i]);
+			else
+			{
+				const Quaternion& rotation = light->getRotation();
+				view = createView(light->getPosition(), -rotation.zAxis(), rotation.yAxis());
+			}
+
+			Matrix4 viewProjRS = projRS * view;
+			ConvexVolume frustum = createFrustum(proj * view);
+
+			renderShadowMap(mAtlas, mAllocator.getSize(), shadow.areas[i], viewProjRS, frustum, renderables,
+				renderableBounds);
+
+			shadow.info.shadowMatrices[i] = createShadowMatrix(viewProjRS, shadow.areas[i], mAllocator.getSize());
+		}
+
+		// Size of a shadow map texel at unit distance from the light
+		float texelSize = 2.0f * Math::tan(fov * 0.5f) / areaSize;
+
+		shadow.info.type = isPoint ? ShadowMapType::Point : ShadowMapType::Spot;
+		shadow.info.shadowMap = mAtlasTexture;
+		shadow.info.shadowMapSize = mAllocator.getSize();
+		shadow.info.numMatrices = shadow.numAreas;
+		shadow.info.normalBias = Vector4(texelSize * SHADOW_NORMAL_BIAS_TEXELS, 0.0f, 0.0f, 0.0f);
+		shadow.info.depthBias = SHADOW_DEPTH_BIAS;
+	}
+
+	const LightShadowInfo* ShadowRenderer::getLightShadow(const LightCore* light) const
+	{
+		if (!mOptions->shadows || !light->getCastsShadow())
+			return nullptr;
+
+		auto iterFind = mCachedShadows.find(light);
+		if (iterFind == mCachedShadows.end() || iterFind->second.info.type == ShadowMapType::None)
+			return nullptr;
+
+		return &iterFind->second.info;
+	}
+
+	void ShadowRenderer::renderCascades(const CameraCore& camera, const LightCore* light,
+		const Vector<RendererObject*>& renderables, const Vector<Bounds>& renderableBounds, LightShadowInfo& output)
+	{
+		output = LightShadowInfo();
+
+		if (!mOptions->shadows || !light->getCastsShadow())
+			return;
+
+		UINT32 numCascades = Math::clamp(mOptions->numShadowCascades, 1U, 4U);
+		UINT32 cascadeSize = mOptions->cascadeShadowMapSize;
+
+		// Cascades are laid out in a 2x2 grid
+		UINT32 textureSize = numCascades > 1 ? cascadeSize * 2 : cascadeSize;
+
+		SPtr<PooledRenderTexture> shadowMap = RenderTexturePool::instance().get(
+			POOLED_RENDER_TEXTURE_DESC::create2D(PF_D32, textureSize, textureSize, TU_DEPTHSTENCIL));
+		mCascadeTextures.push_back(shadowMap);
+
+		float near = camera.getNearClipDistance();
+		float far = std::max(near, std::min(camera.getFarClipDistance(), mOptions->shadowDistance));
+		float distribution = Math::clamp01(mOptions->cascadeDistribution);
+
+		const Quaternion& lightRotation = light->getRotation();
+		Vector3 lightDir = -lightRotation.zAxis();
+		Vector3 lightUp = lightRotation.yAxis();
+		Vector3 lightRight = lightRotation.xAxis();
+
+		float splitNear = near;
+		for (UINT32 i = 0; i < numCascades; i++)
+		{
+			// Blend between uniform and logarithmic split distribution
+			float t = (i + 1) / (float)numCascades;
+			float uniformSplit = near + (far - near) * t;
+			float logSplit = near * std::pow(far / near, t);
+			float splitFar = uniformSplit + (logSplit - uniformSplit) * distribution;
+
+			Sphere sliceBounds = getFrustumSliceBounds(camera, splitNear, splitFar);
+			float radius = sliceBounds.getRadius();
+			float texelSize = (radius * 2.0f) / cascadeSize;
+
+			// Snap the center to shadow map texels, so the shadow doesn't shimmer as the camera moves
+			Vector3 center = sliceBounds.getCenter();
+			float centerX = Math::floor(center.dot(lightRight) / texelSize) * texelSize;
+			float centerY = Math::floor(center.dot(lightUp) / texelSize) * texelSize;
+			float centerZ = center.dot(lightDir);
+			center = lightRight * centerX + lightUp * centerY + lightDir * centerZ;
+
+			// Find casters within the cascade. Casters between the light and the cascade are included by leaving
+			// out the near plane.
+			Vector<Plane> planes =
+			{
+				Plane(lightRight, centerX - radius),
+				Plane(-lightRight, -centerX - radius),
+				Plane(lightUp, centerY - radius),
+				Plane(-lightUp, -centerY - radius),
+				Plane(-lightDir, -centerZ - radius)
+			};
+
+			ConvexVolume volume(planes);
+
+			mCasters.clear();
+			RendererCamera::cullObjects(volume, (UINT64)-1, renderables, renderableBounds, mCasters);
+
+			// Fit the depth range to the casters
+			float minDepth = centerZ - radius;
+			for (auto& casterIdx : mCasters)
+			{
+				const Sphere& casterBounds = renderableBounds[renderables[casterIdx]->renderable->getRendererId()].getSphere();
+				minDepth = std::min(minDepth, casterBounds.getCenter().dot(lightDir) - casterBounds.getRadius());
+			}
+
+			Vector3 viewOrigin = center + lightDir * (minDepth - centerZ);
+
+			Matrix4 view = createView(viewOrigin, lightDir, lightUp);
+			Matrix4 proj;
+			proj.makeProjectionOrtho(-radius, radius, radius, -radius, 0.0f, centerZ + radius - minDepth);
+
+			Matrix4 projRS;
+			RenderAPICore::instance().convertProjectionMatrix(proj, projRS);
+
+			Matrix4 viewProjRS = projRS * view;
+
+			Rect2I area((i % 2) * cascadeSize, (i / 2) * cascadeSize, cascadeSize, cascadeSize);
+			renderShadowMap(shadowMap->renderTexture, textureSize, area, viewProjRS, volume, renderables,
+				renderableBounds);
+
+			output.shadowMatrices[i] = createShadowMatrix(viewProjRS, area, textureSize);
+			output.cascadeSplits[i] = splitFar;
+			output.normalBias[i] = texelSize * SHADOW_NORMAL_BIAS_TEXELS;
+
+			splitNear = splitFar;
+		}
+
+		output.type = ShadowMapType::Directional;
+		output.shadowMap = shadowMap->texture;
+		output.shadowMapSize = textureSize;
+		output.numMatrices = numCascades;
+		output.depthBias = SHADOW_DEPTH_BIAS;
+	}
+
+	void ShadowRenderer::releaseCascades()
+	{
+		for (auto& entry : mCascadeTextures)
+			RenderTexturePool::instance().release(entry);
+
+		mCascadeTextures.clear();
+	}
+
+	void ShadowRenderer::renderShadowMap(const SPtr<RenderTextureCore>& target, UINT32 targetSize, const Rect2I& area,
+		const Matrix4& viewProj, const ConvexVolume& volume, const Vector<RendererObject*>& renderables,
+		const Vector<Bounds>& renderableBounds)
+	{
+		RenderAPICore& rapi = RenderAPICore::instance();
+		rapi.setRenderTarget(target);
+
+		float invTargetSize = 1.0f / targetSize;
+		rapi.setViewport(Rect2(area.x * invTargetSize, area.y * invTargetSize, area.width * invTargetSize,
+			area.height * invTargetSize));
+		rapi.clearViewport(FBT_DEPTH);
+
+		mDepthMat->bind(viewProj);
+
+		mCasters.clear();
+		RendererCamera::cullObjects(volume, (UINT64)-1, renderables, renderableBounds, mCasters);
+
+		for (auto& casterIdx : mCasters)
+		{
+			RendererObject* caster = renderables[casterIdx];
+
+			// Per-object buffers are only flushed for objects visible to a camera
+			caster->perObjectParamBuffer->flushToGPU();
+			mDepthMat->setPerObjectBuffer(caster->perObjectParamBuffer);
+
+			for (auto& element : caster->elements)
+			{
+				bool isTransparent = (element.material->getShader()->getFlags() & (UINT32)ShaderFlags::Transparent) != 0;
+				if (isTransparent)
+					continue;
+
+				gRendererUtility().draw(element.mesh, element.subMesh);
+			}
+		}
+	}
+
+	Matrix4 ShadowRenderer::createShadowMatrix(const Matrix4& viewProjRS, const Rect2I& area, UINT32 textureSize)
+	{
+		const RenderAPIInfo& rapiInfo = RenderAPICore::instance().getAPIInfo();
+
+		float invTextureSize = 1.0f / textureSize;
+		float areaLeft = area.x * invTextureSize;
+		float areaTop = area.y * invTextureSize;
+		float areaWidth = area.width * invTextureSize;
+		float areaHeight = area.height * invTextureSize;
+
+		// Maps clip space to [0, 1] range within the area, with (0, 0) at the area's top left corner
+		float scaleX = areaWidth * 0.5f;
+		float offsetX = areaLeft + scaleX;
+
+		float scaleY = areaHeight * (rapiInfo.getNDCYAxisDown() ? 0.5f : -0.5f);
+		float offsetY = areaTop + areaHeight * 0.5f;
+
+		// Flip if UV origin is at the bottom
+		if (rapiInfo.getUVYAxisUp())
+		{
+			scaleY = -scaleY;
+			offsetY = 1.0f - offsetY;
+		}
+
+		// Maps clip space depth to [0, 1] range stored in the depth buffer
+		float minDepth = rapiInfo.getMinimumDepthInputValue();
+		float maxDepth = rapiInfo.getMaximumDepthInputValue();
+		float depthScale = 1.0f / (maxDepth - minDepth);
+		float depthOffset = -minDepth * depthScale;
+
+		Matrix4 clipToTexture(
+			scaleX, 0.0f, 0.0f, offsetX,
+			0.0f, scaleY, 0.0f, offsetY,
+			0.0f, 0.0f, depthScale, depthOffset,
+			0.0f, 0.0f, 0.0f, 1.0f);
+
+		return clipToTexture * viewProjRS;
+	}
+
+	void ShadowRenderer::freeAreas(CachedShadow& shadow)
+	{
+		for (UINT32 i = 0; i < shadow.numAreas; i++)
+			mAllocator.free(shadow.areas[i]);
+
+		shadow.numAreas = 0;
+	}
+}
@@ -116,6 +116,12 @@ namespace bs
 		static void internal_SetKeyFrameReduction(ScriptMeshImportOptions* thisPtr, bool value);
 		static bool internal_GetRootMotion(ScriptMeshImportOptions* thisPtr);
 		static void internal_SetRootMotion(ScriptMeshImportOptions* thisPtr, bool value);
+		static UINT32 internal_GetNumLODs(ScriptMeshImportOptions* thisPtr);
+		static void internal_SetNumLODs(ScriptMeshImportOptions* thisPtr, UINT32 value);
+		static float internal_GetLODReduction(ScriptMeshImportOptions* thisPtr);
+		static void internal_SetLODReduction(ScriptMeshImportOptions* thisPtr, float value);
+		static bool internal_GetOptimizeMesh(ScriptMeshImportOptions* thisPtr);
+		static void internal_SetOptimizeMesh(ScriptMeshImportOptions* thisPtr, bool value);
 		static float internal_GetScale(ScriptMeshImportOptions* thisPtr);
 		static void internal_SetScale(ScriptMeshImportOptions* thisPtr, float value);
 		static int internal_GetCollisionMeshType(ScriptMeshImportOptions* thisPtr);
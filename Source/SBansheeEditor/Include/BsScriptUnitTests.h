@@ -31,6 +31,8 @@ namespace bs
 		static void internal_UT1_GameObjectClone(MonoObject* instance);
 		static void internal_UT3_GenerateDiff(MonoObject* oldObj, MonoObject* newObj);
 		static void internal_UT3_ApplyDiff(MonoObject* obj);
+		static void internal_UT5_UpdateComponents(MonoObject* root, int numIterations, float* perComponentTime,
+			float* batchedTime);
 	};
 
 	/** @} */
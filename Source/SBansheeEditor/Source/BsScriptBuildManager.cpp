@@ -21,6 +21,9 @@
 #include "BsSceneObject.h"
 #include "BsDebug.h"
 #include "BsGameResourceManager.h"
+#include "BsBuildCache.h"
+#include "BsTimer.h"
+#include "BsPackFile.h"
 
 namespace bs
 {
@@ -225,7 +228,11 @@ namespace bs
 
 	void ScriptBuildManager::internal_PackageResources(MonoString* buildFolder, ScriptPlatformInfo* info)
 	{
+		Timer timer;
+		UINT64 startTime = timer.getMilliseconds();
+
 		UnorderedSet<Path> usedResources;
+		UnorderedMap<Path, Vector<Path>> resourceDependencies;
 		SPtr<ResourceMapping> resourceMap = ResourceMapping::create();
 
 		// Get all resources manually included in build
@@ -274,12 +281,16 @@ namespace bs
 			Vector<Path> allDependencies;
 			for (auto& entry : newResources)
 			{
+				Vector<Path>& dependencyPaths = resourceDependencies[entry];
+
 				Vector<String> curDependencies = gResources().getDependencies(entry);
 				for (auto& entry : curDependencies)
 				{
 					Path resourcePath;
 					if (gResources().getFilePathFromUUID(entry, resourcePath))
 					{
+						dependencyPaths.push_back(resourcePath);
+
 						if (usedResources.find(resourcePath) == usedResources.end())
 						{
 							allDependencies.push_back(resourcePath);
@@ -300,9 +311,31 @@ namespace bs
 
 		FileSystem::createDir(outputPath);
 
+		// Processed resources are stored in a content addressed cache, so only resources that changed since the last build
+		// need to be processed, while the rest are just linked into the build
+		SPtr<BuildCache> buildCache = BuildCache::load(BuildManager::instance().getBuildCacheFolder(platformInfo->type));
+
+		Vector<Path> resourcePaths(usedResources.begin(), usedResources.end());
+		Vector<UINT64> resourceHashes;
+		buildCache->calculateHashes(resourcePaths, resourceHashes);
+
+		UnorderedMap<Path, UINT64> pathToHash;
+		for (UINT32 i = 0; i < (UINT32)resourcePaths.size(); i++)
+			pathToHash[resourcePaths[i]] = resourceHashes[i];
+
+		Vector<UINT64> outputKeys;
+		Vector<Path> outputPaths;
+		Vector<String> outputUUIDs;
+		UnorderedSet<UINT64> pendingKeys;
+
+		Vector<Path> filesToCache;
+		Vector<UINT64> fileKeys;
+
 		Path libraryDir = gProjectLibrary().getResourcesFolder();
-		for (auto& entry : usedResources)
+		for (UINT32 i = 0; i < (UINT32)resourcePaths.size(); i++)
 		{
+			const Path& entry = resourcePaths[i];
+
 			String uuid;
 			bool foundUUID = gResources().getUUIDFromFilePath(entry, uuid);
 			BS_ASSERT(foundUUID);
@@ -311,6 +344,12 @@ namespace bs
 			if (sourcePath.isEmpty()) // Resource not part of library, meaning its built-in and we don't need to copy those here
 				continue;
 
+			if (resourceHashes[i] == 0)
+			{
+				LOGWRN("Cannot include resource in build, unable to read imported asset for: " + sourcePath.toString());
+				continue;
+			}
+
 			SPtr<ProjectResourceMeta> resMeta = gProjectLibrary().findResourceMeta(sourcePath);
 			assert(resMeta != nullptr);
 
@@ -327,46 +366,125 @@ namespace bs
 
 			resourceMap->add(relSourcePath, relDestPath);
 
-			// If resource is prefab make sure to update it in case any of the prefabs it is referencing changed
-			if (resMeta->getTypeID() == TID_Prefab)
-			{
-				bool reload = gResources().isLoaded(uuid);
+			// Packaged prefabs depend on the prefabs they reference, so they need to be processed again if any of the
+			// resources they depend on change. Other resources are packaged as is, and depend only on their own contents.
+			bool isPrefab = resMeta->getTypeID() == TID_Prefab;
 
-				HPrefab prefab = static_resource_cast<Prefab>(gProjectLibrary().load(sourcePath));
-				prefab->_updateChildInstances();
+			Vector<UINT64> keyHashes;
+			if (isPrefab)
+			{
+				keyHashes.push_back(TID_Prefab);
+				keyHashes.push_back(resourceHashes[i]);
 
-				// Clear prefab diffs as they're not used in standalone
-				Stack<HSceneObject> todo;
-				todo.push(prefab->_getRoot());
+				Vector<UINT64> dependencyHashes;
+				UnorderedSet<Path> visited = { entry };
+				Stack<Path> todo;
+				todo.push(entry);
 
 				while (!todo.empty())
 				{
-					HSceneObject current = todo.top();
+					Path current = todo.top();
 					todo.pop();
 
-					current->_clearPrefabDiff();
-
-					UINT32 numChildren = current->getNumChildren();
-					for (UINT32 i = 0; i < numChildren; i++)
+					for (auto& dependency : resourceDependencies[current])
 					{
-						HSceneObject child = current->getChild(i);
-						todo.push(child);
+						if (!visited.insert(dependency).second)
+							continue;
+
+						dependencyHashes.push_back(pathToHash[dependency]);
+						todo.push(dependency);
 					}
 				}
 
-				gResources().save(prefab, destPath, false);
+				std::sort(dependencyHashes.begin(), dependencyHashes.end());
+				keyHashes.insert(keyHashes.end(), dependencyHashes.begin(), dependencyHashes.end());
+			}
+			else
+				keyHashes.push_back(resourceHashes[i]);
+
+			UINT64 key = BuildCache::calculateKey(keyHashes);
+			outputKeys.push_back(key);
+			outputPaths.push_back(destPath);
+			outputUUIDs.push_back(uuid);
+
+			if (buildCache->hasOutput(key) || !pendingKeys.insert(key).second)
+				continue;
 
-				// Need to unload this one as we modified it in memory, and we don't want to persist those changes past
-				// this point
-				gResources().release(prefab);
+			if (!isPrefab)
+			{
+				filesToCache.push_back(entry);
+				fileKeys.push_back(key);
 
-				if (reload)
-					gProjectLibrary().load(sourcePath);
+				continue;
 			}
-			else
-				FileSystem::copy(entry, destPath);
+
+			// If resource is prefab make sure to update it in case any of the prefabs it is referencing changed
+			bool reload = gResources().isLoaded(uuid);
+
+			HPrefab prefab = static_resource_cast<Prefab>(gProjectLibrary().load(sourcePath));
+			prefab->_updateChildInstances();
+
+			// Clear prefab diffs as they're not used in standalone
+			Stack<HSceneObject> todo;
+			todo.push(prefab->_getRoot());
+
+			while (!todo.empty())
+			{
+				HSceneObject current = todo.top();
+				todo.pop();
+
+				current->_clearPrefabDiff();
+
+				UINT32 numChildren = current->getNumChildren();
+				for (UINT32 j = 0; j < numChildren; j++)
+				{
+					HSceneObject child = current->getChild(j);
+					todo.push(child);
+				}
+			}
+
+			gResources().save(prefab, buildCache->getOutputPath(key), true);
+
+			// Need to unload this one as we modified it in memory, and we don't want to persist those changes past
+			// this point
+			gResources().release(prefab);
+
+			if (reload)
+				gProjectLibrary().load(sourcePath);
+		}
+
+		// Copy changed resources into the cache, and then pack everything into a single file the game loads resources
+		// from, so it doesn't need to open every resource separately. Resources are stored uncompressed, so they can be
+		// streamed directly from the pack.
+		buildCache->addOutputs(filesToCache, fileKeys);
+
+		PackFileWriter packWriter;
+		for (UINT32 i = 0; i < (UINT32)outputKeys.size(); i++)
+			packWriter.add(outputUUIDs[i], buildCache->getOutputPath(outputKeys[i]));
+
+		Path packPath = outputPath;
+		packPath.setFilename(GAME_RESOURCES_PACK_NAME);
+
+		if (!packWriter.write(packPath))
+		{
+			LOGWRN("Unable to pack resources into \"" + packPath.toString() + "\". Resources will be placed into the "
+				"build as individual files.");
+
+			FileSystem::remove(packPath);
+			buildCache->placeOutputs(outputKeys, outputPaths);
 		}
 
+		buildCache->prune(outputKeys);
+		buildCache->save();
+
+		UINT32 numResources = (UINT32)outputKeys.size();
+		UINT32 numCached = numResources - (UINT32)pendingKeys.size();
+		float cacheHitRate = numResources > 0 ? numCached / (float)numResources * 100.0f : 100.0f;
+
+		UINT64 elapsedMs = timer.getMilliseconds() - startTime;
+		LOGDBG("Packaged " + toString(numResources) + " resources in " + toString(elapsedMs) + " ms. " +
+			toString(numCached) + " (" + toString(cacheHitRate, 4) + "%) were taken from the build cache.");
+
 		// Save icon
 		Path iconFolder = BuiltinResources::getIconFolder();
 
@@ -182,6 +182,12 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_SetKeyFrameReduction", &ScriptMeshImportOptions::internal_SetKeyFrameReduction);
 		metaData.scriptClass->addInternalCall("Internal_GetRootMotion", &ScriptMeshImportOptions::internal_GetRootMotion);
 		metaData.scriptClass->addInternalCall("Internal_SetRootMotion", &ScriptMeshImportOptions::internal_SetRootMotion);
+		metaData.scriptClass->addInternalCall("Internal_GetNumLODs", &ScriptMeshImportOptions::internal_GetNumLODs);
+		metaData.scriptClass->addInternalCall("Internal_SetNumLODs", &ScriptMeshImportOptions::internal_SetNumLODs);
+		metaData.scriptClass->addInternalCall("Internal_GetLODReduction", &ScriptMeshImportOptions::internal_GetLODReduction);
+		metaData.scriptClass->addInternalCall("Internal_SetLODReduction", &ScriptMeshImportOptions::internal_SetLODReduction);
+		metaData.scriptClass->addInternalCall("Internal_GetOptimizeMesh", &ScriptMeshImportOptions::internal_GetOptimizeMesh);
+		metaData.scriptClass->addInternalCall("Internal_SetOptimizeMesh", &ScriptMeshImportOptions::internal_SetOptimizeMesh);
 		metaData.scriptClass->addInternalCall("Internal_GetScale", &ScriptMeshImportOptions::internal_GetScale);
 		metaData.scriptClass->addInternalCall("Internal_SetScale", &ScriptMeshImportOptions::internal_SetScale);
 		metaData.scriptClass->addInternalCall("Internal_GetCollisionMeshType", &ScriptMeshImportOptions::internal_GetCollisionMeshType);
@@ -296,6 +302,36 @@ namespace bs
 		thisPtr->getMeshImportOptions()->setImportRootMotion(value);
 	}
 
+	UINT32 ScriptMeshImportOptions::internal_GetNumLODs(ScriptMeshImportOptions* thisPtr)
+	{
+		return thisPtr->getMeshImportOptions()->getNumLODs();
+	}
+
+	void ScriptMeshImportOptions::internal_SetNumLODs(ScriptMeshImportOptions* thisPtr, UINT32 value)
+	{
+		thisPtr->getMeshImportOptions()->setNumLODs(value);
+	}
+
+	float ScriptMeshImportOptions::internal_GetLODReduction(ScriptMeshImportOptions* thisPtr)
+	{
+		return thisPtr->getMeshImportOptions()->getLODReduction();
+	}
+
+	void ScriptMeshImportOptions::internal_SetLODReduction(ScriptMeshImportOptions* thisPtr, float value)
+	{
+		thisPtr->getMeshImportOptions()->setLODReduction(value);
+	}
+
+	bool ScriptMeshImportOptions::internal_GetOptimizeMesh(ScriptMeshImportOptions* thisPtr)
+	{
+		return thisPtr->getMeshImportOptions()->getOptimizeMesh();
+	}
+
+	void ScriptMeshImportOptions::internal_SetOptimizeMesh(ScriptMeshImportOptions* thisPtr, bool value)
+	{
+		thisPtr->getMeshImportOptions()->setOptimizeMesh(value);
+	}
+
 	float ScriptMeshImportOptions::internal_GetScale(ScriptMeshImportOptions* thisPtr)
 	{
 		return thisPtr->getMeshImportOptions()->getImportScale();
@@ -64,32 +64,39 @@ namespace bs
 			}
 		}
 
-		HSceneObject pickedObject = ScenePicking::instance().pickClosestObject(thisPtr->mCamera, *inputPos, Vector2I(1, 1), ignoredSceneObjects);
-		if (pickedObject)
+		auto onPicked = [additive](const Vector<HSceneObject>& pickedObjects)
 		{
-			if (additive) // Append to existing selection
+			if (pickedObjects.size() > 0)
 			{
-				Vector<HSceneObject> selectedSOs = Selection::instance().getSceneObjects();
+				HSceneObject pickedObject = pickedObjects[0];
+				if (additive) // Append to existing selection
+				{
+					Vector<HSceneObject> selectedSOs = Selection::instance().getSceneObjects();
 
-				auto iterFind = std::find_if(selectedSOs.begin(), selectedSOs.end(),
-					[&](const HSceneObject& obj) { return obj == pickedObject; }
-				);
+					auto iterFind = std::find_if(selectedSOs.begin(), selectedSOs.end(),
+						[&](const HSceneObject& obj) { return obj == pickedObject; }
+					);
 
-				if (iterFind == selectedSOs.end())
-					selectedSOs.push_back(pickedObject);
+					if (iterFind == selectedSOs.end())
+						selectedSOs.push_back(pickedObject);
 
-				Selection::instance().setSceneObjects(selectedSOs);
+					Selection::instance().setSceneObjects(selectedSOs);
+				}
+				else
+				{
+					Vector<HSceneObject> selectedSOs = { pickedObject };
+					Selection::instance().setSceneObjects(selectedSOs);
+				}
 			}
-			else
+			else if (!additive)
 			{
-				Vector<HSceneObject> selectedSOs = { pickedObject };
-				Selection::instance().setSceneObjects(selectedSOs);
+				Selection::instance().clearSceneSelection();
 			}
-		}
-		else if (!additive)
-		{
-			Selection::instance().clearSceneSelection();
-		}
+		};
+
+		// Selection is applied once the GPU is done rendering the picking pass, so the editor doesn't stall on a click
+		ScenePicking::instance().pickObjectsAsync(thisPtr->mCamera, *inputPos, Vector2I(1, 1), ignoredSceneObjects,
+			onPicked);
 	}
 
 	void ScriptSceneSelection::internal_PickObjects(ScriptSceneSelection* thisPtr, Vector2I* inputPos, Vector2I* area, 
@@ -115,40 +122,42 @@ namespace bs
 			}
 		}
 
-		Vector<HSceneObject> pickedObjects = ScenePicking::instance().pickObjects(thisPtr->mCamera, *inputPos, 
-			*area, ignoredSceneObjects);
-
-		if (pickedObjects.size() != 0)
+		auto onPicked = [additive](const Vector<HSceneObject>& pickedObjects)
 		{
-			if (additive) // Append to existing selection
+			if (pickedObjects.size() != 0)
 			{
-				Vector<HSceneObject> selectedSOs = Selection::instance().getSceneObjects();
-
-				for (int i = 0; i < pickedObjects.size(); i++) 
+				if (additive) // Append to existing selection
 				{
-					bool found = false;
-					for (int j = 0; j < selectedSOs.size(); j++)
+					Vector<HSceneObject> selectedSOs = Selection::instance().getSceneObjects();
+
+					for (int i = 0; i < pickedObjects.size(); i++)
 					{
-						if (selectedSOs[j] == pickedObjects[i])
+						bool found = false;
+						for (int j = 0; j < selectedSOs.size(); j++)
 						{
-							found = true;
-							break;
+							if (selectedSOs[j] == pickedObjects[i])
+							{
+								found = true;
+								break;
+							}
 						}
+
+						if (!found)
+							selectedSOs.push_back(pickedObjects[i]);
 					}
 
-					if (!found)
-						selectedSOs.push_back(pickedObjects[i]);
+					Selection::instance().setSceneObjects(selectedSOs);
 				}
-
-				Selection::instance().setSceneObjects(selectedSOs);
+				else
+					Selection::instance().setSceneObjects(pickedObjects);
 			}
-			else
-				Selection::instance().setSceneObjects(pickedObjects);
-		}
-		else if (!additive)
-		{
-			Selection::instance().clearSceneSelection();
-		}
+			else if (!additive)
+			{
+				Selection::instance().clearSceneSelection();
+			}
+		};
+
+		ScenePicking::instance().pickObjectsAsync(thisPtr->mCamera, *inputPos, *area, ignoredSceneObjects, onPicked);
 	}
 
 	MonoObject* ScriptSceneSelection::internal_Snap(ScriptSceneSelection* thisPtr, Vector2I* inputPos, SnapData* data, 
@@ -8,6 +8,8 @@
 #include "BsScriptSceneObject.h"
 #include "BsManagedSerializableObject.h"
 #include "BsManagedSerializableDiff.h"
+#include "BsManagedComponent.h"
+#include "BsTimer.h"
 
 namespace bs
 {
@@ -19,6 +21,7 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_UT1_GameObjectClone", &ScriptUnitTests::internal_UT1_GameObjectClone);
 		metaData.scriptClass->addInternalCall("Internal_UT3_GenerateDiff", &ScriptUnitTests::internal_UT3_GenerateDiff);
 		metaData.scriptClass->addInternalCall("Internal_UT3_ApplyDiff", &ScriptUnitTests::internal_UT3_ApplyDiff);
+		metaData.scriptClass->addInternalCall("Internal_UT5_UpdateComponents", &ScriptUnitTests::internal_UT5_UpdateComponents);
 
 		RunTestsMethod = metaData.scriptClass->getMethod("RunTests");
 	}
@@ -53,4 +56,39 @@ namespace bs
 
 		tempDiff = nullptr;
 	}
+
+	void ScriptUnitTests::internal_UT5_UpdateComponents(MonoObject* root, int numIterations, float* perComponentTime,
+		float* batchedTime)
+	{
+		ScriptSceneObject* nativeInstance = ScriptSceneObject::toNative(root);
+		HSceneObject rootSO = static_object_cast<SceneObject>(nativeInstance->getNativeHandle());
+
+		Vector<Component*> components;
+		for (UINT32 i = 0; i < rootSO->getNumChildren(); i++)
+		{
+			HSceneObject child = rootSO->getChild(i);
+			for (auto& component : child->getComponents())
+			{
+				if (component->getTypeId() == TID_ManagedComponent)
+					components.push_back(component.get());
+			}
+		}
+
+		Timer timer;
+		UINT64 startTime = timer.getMicroseconds();
+
+		for (int i = 0; i < numIterations; i++)
+		{
+			for (auto& component : components)
+				component->update();
+		}
+
+		*perComponentTime = (timer.getMicroseconds() - startTime) / 1000.0f;
+		startTime = timer.getMicroseconds();
+
+		for (int i = 0; i < numIterations; i++)
+			ManagedComponent::updateBatch(components.data(), (UINT32)components.size());
+
+		*batchedTime = (timer.getMicroseconds() - startTime) / 1000.0f;
+	}
 }
\ No newline at end of file
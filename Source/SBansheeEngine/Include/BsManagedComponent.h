@@ -76,6 +76,16 @@ namespace bs
 		/**	Triggers the managed OnEnable callback. */
 		void triggerOnEnable();
 
+		/**
+		 * Triggers the managed OnUpdate callback on all provided components. Components are grouped by their managed type
+		 * and each group is updated with a single managed call, avoiding a native to managed transition per component.
+		 * Null entries are ignored.
+		 *
+		 * @param[in]	components		List of managed components to update.
+		 * @param[in]	numComponents	Number of entries in @p components.
+		 */
+		static void updateBatch(Component** components, UINT32 numComponents);
+
 	private:
 		/**
 		 * Finalizes construction of the object. Must be called before use or when the managed component instance changes.
@@ -116,6 +126,9 @@ namespace bs
 		OnTransformChangedThunkDef mOnTransformChangedThunk;
 		MonoMethod* mCalculateBoundsMethod;
 
+		UINT32 mUpdateBatchIdx;
+		static MonoArray* sActiveUpdateBatch;
+
 		/************************************************************************/
 		/* 							COMPONENT OVERRIDES                    		*/
 		/************************************************************************/
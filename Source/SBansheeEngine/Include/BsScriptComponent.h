@@ -28,6 +28,14 @@ namespace bs
 		/** Returns the managed component this object wraps. */
 		HManagedComponent getHandle() const { return mManagedComponent; }
 
+		/**
+		 * Calls OnUpdate on all components in the provided array, using a single managed call.
+		 *
+		 * @param[in]	type		Managed type of all the components in the array.
+		 * @param[in]	components	Array of managed Component objects. Null entries are skipped.
+		 */
+		static void invokeUpdateBatch(MonoReflectionType* type, MonoArray* components);
+
 	private:
 		friend class ScriptGameObjectManager;
 
@@ -53,6 +61,9 @@ namespace bs
 		String mType;
 		bool mTypeMissing;
 
+		typedef void(__stdcall *UpdateBatchThunkDef) (MonoReflectionType*, MonoArray*, MonoException**);
+		static UpdateBatchThunkDef UpdateBatchThunk;
+
 		/************************************************************************/
 		/* 								CLR HOOKS						   		*/
 		/************************************************************************/
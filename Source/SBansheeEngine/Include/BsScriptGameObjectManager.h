@@ -91,6 +91,16 @@ namespace bs
 		 */
 		void wakeRuntimeComponents();
 
+		/**
+		 * Determines how are managed components updated every frame. When enabled (default), components are grouped by
+		 * type and each type is updated with a single call into managed code. When disabled, a separate managed call is
+		 * made for each component.
+		 */
+		void setBatchedComponentUpdates(bool enabled);
+
+		/** @copydoc setBatchedComponentUpdates */
+		bool getBatchedComponentUpdates() const { return mBatchedComponentUpdates; }
+
 	private:
 		/**
 		 * Triggers OnReset methods on all registered managed components.
@@ -107,6 +117,7 @@ namespace bs
 
 		HEvent mOnAssemblyReloadDoneConn;
 		HEvent onGameObjectDestroyedConn;
+		bool mBatchedComponentUpdates;
 	};
 
 	/** @} */
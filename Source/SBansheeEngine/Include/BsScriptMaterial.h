@@ -30,11 +30,51 @@ namespace bs
 	private:
 		friend class ScriptResourceManager;
 
+		/** Material parameter handle cached for use by managed code, along with the name it was retrieved with. */
+		template<class T>
+		struct CachedParam
+		{
+			StringID name;
+			TMaterialDataParam<T, false> param;
+		};
+
 		ScriptMaterial(MonoObject* instance, const HMaterial& material);
 
 		/** @copydoc ScriptObjectBase::_createManagedInstance */
 		MonoObject* _createManagedInstance(bool construct) override;
 
+		/**
+		 * Clears all cached parameter handles if the material's parameters changed since they were created (for example
+		 * due to a shader change). This invalidates all handles previously returned to managed code.
+		 */
+		void validateParamHandles();
+
+		/** Returns a list of cached parameter handles for the specified parameter type. */
+		template<class T>
+		Vector<CachedParam<T>>& getParamHandles();
+
+		/**
+		 * Retrieves a handle to a data parameter with the specified name, creating and caching it if needed. Returns an
+		 * identifier managed code can use for accessing the parameter, or -1 if the parameter doesn't exist.
+		 */
+		template<class T>
+		UINT32 createParamHandle(MonoString* name);
+
+		/** Returns the parameter handle referenced by an identifier returned from createParamHandle(), or null if invalid. */
+		template<class T>
+		const TMaterialDataParam<T, false>* findParamHandle(UINT32 handle);
+
+		SPtr<MaterialParams> mCachedParams;
+		UINT32 mParamHandleVersion = 1;
+
+		Vector<CachedParam<float>> mFloatParams;
+		Vector<CachedParam<Vector2>> mVec2Params;
+		Vector<CachedParam<Vector3>> mVec3Params;
+		Vector<CachedParam<Vector4>> mVec4Params;
+		Vector<CachedParam<Matrix3>> mMat3Params;
+		Vector<CachedParam<Matrix4>> mMat4Params;
+		Vector<CachedParam<Color>> mColorParams;
+
 		/************************************************************************/
 		/* 								CLR HOOKS						   		*/
 		/************************************************************************/
@@ -65,6 +105,30 @@ namespace bs
 		static MonoObject* internal_GetTexture2D(ScriptMaterial* nativeInstance, MonoString* name);
 		static MonoObject* internal_GetTexture3D(ScriptMaterial* nativeInstance, MonoString* name);
 		static MonoObject* internal_GetTextureCube(ScriptMaterial* nativeInstance, MonoString* name);
+
+		static UINT32 internal_GetParamFloat(ScriptMaterial* nativeInstance, MonoString* name);
+		static UINT32 internal_GetParamVector2(ScriptMaterial* nativeInstance, MonoString* name);
+		static UINT32 internal_GetParamVector3(ScriptMaterial* nativeInstance, MonoString* name);
+		static UINT32 internal_GetParamVector4(ScriptMaterial* nativeInstance, MonoString* name);
+		static UINT32 internal_GetParamMatrix3(ScriptMaterial* nativeInstance, MonoString* name);
+		static UINT32 internal_GetParamMatrix4(ScriptMaterial* nativeInstance, MonoString* name);
+		static UINT32 internal_GetParamColor(ScriptMaterial* nativeInstance, MonoString* name);
+
+		static void internal_SetFloatParam(ScriptMaterial* nativeInstance, UINT32 handle, float value);
+		static void internal_SetVector2Param(ScriptMaterial* nativeInstance, UINT32 handle, Vector2* value);
+		static void internal_SetVector3Param(ScriptMaterial* nativeInstance, UINT32 handle, Vector3* value);
+		static void internal_SetVector4Param(ScriptMaterial* nativeInstance, UINT32 handle, Vector4* value);
+		static void internal_SetMatrix3Param(ScriptMaterial* nativeInstance, UINT32 handle, Matrix3* value);
+		static void internal_SetMatrix4Param(ScriptMaterial* nativeInstance, UINT32 handle, Matrix4* value);
+		static void internal_SetColorParam(ScriptMaterial* nativeInstance, UINT32 handle, Color* value);
+
+		static float internal_GetFloatParam(ScriptMaterial* nativeInstance, UINT32 handle);
+		static void internal_GetVector2Param(ScriptMaterial* nativeInstance, UINT32 handle, Vector2* value);
+		static void internal_GetVector3Param(ScriptMaterial* nativeInstance, UINT32 handle, Vector3* value);
+		static void internal_GetVector4Param(ScriptMaterial* nativeInstance, UINT32 handle, Vector4* value);
+		static void internal_GetMatrix3Param(ScriptMaterial* nativeInstance, UINT32 handle, Matrix3* value);
+		static void internal_GetMatrix4Param(ScriptMaterial* nativeInstance, UINT32 handle, Matrix4* value);
+		static void internal_GetColorParam(ScriptMaterial* nativeInstance, UINT32 handle, Color* value);
 	};
 
 	/** @} */
@@ -12,14 +12,18 @@
 #include "BsScriptAssemblyManager.h"
 #include "BsMonoAssembly.h"
 #include "BsPlayInEditorManager.h"
+#include "BsScriptComponent.h"
+#include "BsMonoArray.h"
 
 namespace bs
 {
+	MonoArray* ManagedComponent::sActiveUpdateBatch = nullptr;
+
 	ManagedComponent::ManagedComponent()
 		: mManagedInstance(nullptr), mManagedClass(nullptr), mRuntimeType(nullptr), mManagedHandle(0), mRunInEditor(false)
 		, mRequiresReset(true), mMissingType(false), mOnInitializedThunk(nullptr), mOnUpdateThunk(nullptr)
 		, mOnResetThunk(nullptr), mOnDestroyThunk(nullptr), mOnDisabledThunk(nullptr), mOnEnabledThunk(nullptr)
-		, mOnTransformChangedThunk(nullptr), mCalculateBoundsMethod(nullptr)
+		, mOnTransformChangedThunk(nullptr), mCalculateBoundsMethod(nullptr), mUpdateBatchIdx((UINT32)-1)
 	{ }
 
 	ManagedComponent::ManagedComponent(const HSceneObject& parent, MonoReflectionType* runtimeType)
@@ -27,6 +31,7 @@ namespace bs
 		, mManagedHandle(0), mRunInEditor(false), mRequiresReset(true), mMissingType(false), mOnInitializedThunk(nullptr)
 		, mOnUpdateThunk(nullptr), mOnResetThunk(nullptr), mOnDestroyThunk(nullptr), mOnDisabledThunk(nullptr)
 		, mOnEnabledThunk(nullptr), mOnTransformChangedThunk(nullptr), mCalculateBoundsMethod(nullptr)
+		, mUpdateBatchIdx((UINT32)-1)
 	{
 		MonoUtil::getClassName(mRuntimeType, mNamespace, mTypeName);
 		setName(mTypeName);
@@ -282,6 +287,74 @@ namespace bs
 		}
 	}
 
+	void ManagedComponent::updateBatch(Component** components, UINT32 numComponents)
+	{
+		bool isPlaying = PlayInEditorManager::instance().getState() == PlayInEditorState::Playing;
+
+		bs_frame_mark();
+		{
+			// Group by managed type, keeping the indices rather than the components themselves, as updating one group
+			// might disable or destroy components in another
+			FrameUnorderedMap<MonoReflectionType*, UINT32> groupLookup;
+			FrameVector<MonoReflectionType*> groupTypes;
+			FrameVector<FrameVector<UINT32>> groups;
+
+			for (UINT32 i = 0; i < numComponents; i++)
+			{
+				ManagedComponent* component = static_cast<ManagedComponent*>(components[i]);
+				if (component == nullptr || component->mOnUpdateThunk == nullptr)
+					continue;
+
+				if (!isPlaying && !component->mRunInEditor)
+					continue;
+
+				UINT32 groupIdx;
+				auto iterFind = groupLookup.find(component->mRuntimeType);
+				if (iterFind == groupLookup.end())
+				{
+					groupIdx = (UINT32)groups.size();
+					groupLookup[component->mRuntimeType] = groupIdx;
+
+					groupTypes.push_back(component->mRuntimeType);
+					groups.push_back(FrameVector<UINT32>());
+				}
+				else
+					groupIdx = iterFind->second;
+
+				groups[groupIdx].push_back(i);
+			}
+
+			for (UINT32 i = 0; i < (UINT32)groups.size(); i++)
+			{
+				const FrameVector<UINT32>& group = groups[i];
+
+				ScriptArray batch(ScriptComponent::getMetaData()->scriptClass->_getInternalClass(), (UINT32)group.size());
+				for (UINT32 j = 0; j < (UINT32)group.size(); j++)
+				{
+					ManagedComponent* component = static_cast<ManagedComponent*>(components[group[j]]);
+					if (component == nullptr)
+						continue;
+
+					batch.set(j, component->mManagedInstance);
+					component->mUpdateBatchIdx = j;
+				}
+
+				// Components disabled during the batch clear their own entries, see onDisabled()
+				sActiveUpdateBatch = batch.getInternal();
+				ScriptComponent::invokeUpdateBatch(groupTypes[i], batch.getInternal());
+				sActiveUpdateBatch = nullptr;
+
+				for (UINT32 j = 0; j < (UINT32)group.size(); j++)
+				{
+					ManagedComponent* component = static_cast<ManagedComponent*>(components[group[j]]);
+					if (component != nullptr)
+						component->mUpdateBatchIdx = (UINT32)-1;
+				}
+			}
+		}
+		bs_frame_clear();
+	}
+
 	void ManagedComponent::triggerOnInitialize()
 	{
 		if (PlayInEditorManager::instance().getState() == PlayInEditorState::Stopped && !mRunInEditor)
@@ -397,6 +470,14 @@ namespace bs
 
 	void ManagedComponent::onDisabled()
 	{
+		if (mUpdateBatchIdx != (UINT32)-1)
+		{
+			ScriptArray activeBatch(sActiveUpdateBatch);
+			activeBatch.set(mUpdateBatchIdx, (MonoObject*)nullptr);
+
+			mUpdateBatchIdx = (UINT32)-1;
+		}
+
 		if (PlayInEditorManager::instance().getState() == PlayInEditorState::Stopped && !mRunInEditor)
 			return;
 
@@ -17,6 +17,8 @@
 
 namespace bs
 {
+	ScriptComponent::UpdateBatchThunkDef ScriptComponent::UpdateBatchThunk = nullptr;
+
 	ScriptComponent::ScriptComponent(MonoObject* instance)
 		:ScriptObject(instance), mTypeMissing(false)
 	{ 
@@ -37,6 +39,13 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_SetNotifyFlags", &ScriptComponent::internal_setNotifyFlags);
 		metaData.scriptClass->addInternalCall("Internal_Invoke", &ScriptComponent::internal_invoke);
 		metaData.scriptClass->addInternalCall("Internal_Destroy", &ScriptComponent::internal_destroy);
+
+		UpdateBatchThunk = (UpdateBatchThunkDef)metaData.scriptClass->getMethod("Internal_UpdateBatch", 2)->getThunk();
+	}
+
+	void ScriptComponent::invokeUpdateBatch(MonoReflectionType* type, MonoArray* components)
+	{
+		MonoUtil::invokeThunk(UpdateBatchThunk, type, components);
 	}
 
 	MonoObject* ScriptComponent::internal_addComponent(MonoObject* parentSceneObject, MonoReflectionType* type)
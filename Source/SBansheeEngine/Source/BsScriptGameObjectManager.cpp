@@ -14,6 +14,7 @@
 #include "BsMonoClass.h"
 #include "BsScriptAssemblyManager.h"
 #include "BsScriptObjectManager.h"
+#include "BsCoreSceneManager.h"
 
 using namespace std::placeholders;
 
@@ -28,6 +29,7 @@ namespace bs
 	{ }
 
 	ScriptGameObjectManager::ScriptGameObjectManager()
+		:mBatchedComponentUpdates(false)
 	{
 		// Calls OnReset on all components after assembly reload happens
 		mOnAssemblyReloadDoneConn = ScriptObjectManager::instance().onRefreshComplete.connect(
@@ -35,12 +37,27 @@ namespace bs
 
 		onGameObjectDestroyedConn = GameObjectManager::instance().onDestroyed.connect(
 			std::bind(&ScriptGameObjectManager::onGameObjectDestroyed, this, _1));
+
+		setBatchedComponentUpdates(true);
 	}
 
 	ScriptGameObjectManager::~ScriptGameObjectManager()
 	{
 		mOnAssemblyReloadDoneConn.disconnect();
 		onGameObjectDestroyedConn.disconnect();
+
+		if (CoreSceneManager::isStarted())
+			gCoreSceneManager()._setBatchUpdateCallback(TID_ManagedComponent, nullptr);
+	}
+
+	void ScriptGameObjectManager::setBatchedComponentUpdates(bool enabled)
+	{
+		if (enabled)
+			gCoreSceneManager()._setBatchUpdateCallback(TID_ManagedComponent, &ManagedComponent::updateBatch);
+		else
+			gCoreSceneManager()._setBatchUpdateCallback(TID_ManagedComponent, nullptr);
+
+		mBatchedComponentUpdates = enabled;
 	}
 
 	ScriptSceneObject* ScriptGameObjectManager::getOrCreateScriptSceneObject(const HSceneObject& sceneObject)
@@ -50,6 +50,30 @@ namespace bs
 		metaData.scriptClass->addInternalCall("Internal_GetTexture2D", &ScriptMaterial::internal_GetTexture2D);
 		metaData.scriptClass->addInternalCall("Internal_GetTexture3D", &ScriptMaterial::internal_GetTexture3D);
 		metaData.scriptClass->addInternalCall("Internal_GetTextureCube", &ScriptMaterial::internal_GetTextureCube);
+
+		metaData.scriptClass->addInternalCall("Internal_GetParamFloat", &ScriptMaterial::internal_GetParamFloat);
+		metaData.scriptClass->addInternalCall("Internal_GetParamVector2", &ScriptMaterial::internal_GetParamVector2);
+		metaData.scriptClass->addInternalCall("Internal_GetParamVector3", &ScriptMaterial::internal_GetParamVector3);
+		metaData.scriptClass->addInternalCall("Internal_GetParamVector4", &ScriptMaterial::internal_GetParamVector4);
+		metaData.scriptClass->addInternalCall("Internal_GetParamMatrix3", &ScriptMaterial::internal_GetParamMatrix3);
+		metaData.scriptClass->addInternalCall("Internal_GetParamMatrix4", &ScriptMaterial::internal_GetParamMatrix4);
+		metaData.scriptClass->addInternalCall("Internal_GetParamColor", &ScriptMaterial::internal_GetParamColor);
+
+		metaData.scriptClass->addInternalCall("Internal_SetFloatParam", &ScriptMaterial::internal_SetFloatParam);
+		metaData.scriptClass->addInternalCall("Internal_SetVector2Param", &ScriptMaterial::internal_SetVector2Param);
+		metaData.scriptClass->addInternalCall("Internal_SetVector3Param", &ScriptMaterial::internal_SetVector3Param);
+		metaData.scriptClass->addInternalCall("Internal_SetVector4Param", &ScriptMaterial::internal_SetVector4Param);
+		metaData.scriptClass->addInternalCall("Internal_SetMatrix3Param", &ScriptMaterial::internal_SetMatrix3Param);
+		metaData.scriptClass->addInternalCall("Internal_SetMatrix4Param", &ScriptMaterial::internal_SetMatrix4Param);
+		metaData.scriptClass->addInternalCall("Internal_SetColorParam", &ScriptMaterial::internal_SetColorParam);
+
+		metaData.scriptClass->addInternalCall("Internal_GetFloatParam", &ScriptMaterial::internal_GetFloatParam);
+		metaData.scriptClass->addInternalCall("Internal_GetVector2Param", &ScriptMaterial::internal_GetVector2Param);
+		metaData.scriptClass->addInternalCall("Internal_GetVector3Param", &ScriptMaterial::internal_GetVector3Param);
+		metaData.scriptClass->addInternalCall("Internal_GetVector4Param", &ScriptMaterial::internal_GetVector4Param);
+		metaData.scriptClass->addInternalCall("Internal_GetMatrix3Param", &ScriptMaterial::internal_GetMatrix3Param);
+		metaData.scriptClass->addInternalCall("Internal_GetMatrix4Param", &ScriptMaterial::internal_GetMatrix4Param);
+		metaData.scriptClass->addInternalCall("Internal_GetColorParam", &ScriptMaterial::internal_GetColorParam);
 	}
 
 	void ScriptMaterial::internal_CreateInstance(MonoObject* instance, ScriptShader* shader)
@@ -278,6 +302,216 @@ namespace bs
 		return scriptTexture->getManagedInstance();
 	}
 
+	void ScriptMaterial::validateParamHandles()
+	{
+		SPtr<MaterialParams> params = getHandle()->_getInternalParams();
+		if (params == mCachedParams)
+			return;
+
+		mFloatParams.clear();
+		mVec2Params.clear();
+		mVec3Params.clear();
+		mVec4Params.clear();
+		mMat3Params.clear();
+		mMat4Params.clear();
+		mColorParams.clear();
+
+		mCachedParams = params;
+		mParamHandleVersion = (mParamHandleVersion + 1) & 0x7FFF;
+	}
+
+	template<> Vector<ScriptMaterial::CachedParam<float>>& ScriptMaterial::getParamHandles() { return mFloatParams; }
+	template<> Vector<ScriptMaterial::CachedParam<Vector2>>& ScriptMaterial::getParamHandles() { return mVec2Params; }
+	template<> Vector<ScriptMaterial::CachedParam<Vector3>>& ScriptMaterial::getParamHandles() { return mVec3Params; }
+	template<> Vector<ScriptMaterial::CachedParam<Vector4>>& ScriptMaterial::getParamHandles() { return mVec4Params; }
+	template<> Vector<ScriptMaterial::CachedParam<Matrix3>>& ScriptMaterial::getParamHandles() { return mMat3Params; }
+	template<> Vector<ScriptMaterial::CachedParam<Matrix4>>& ScriptMaterial::getParamHandles() { return mMat4Params; }
+	template<> Vector<ScriptMaterial::CachedParam<Color>>& ScriptMaterial::getParamHandles() { return mColorParams; }
+
+	template<class T>
+	UINT32 ScriptMaterial::createParamHandle(MonoString* name)
+	{
+		validateParamHandles();
+
+		StringID paramName = MonoUtil::monoToString(name);
+		Vector<CachedParam<T>>& handles = getParamHandles<T>();
+
+		UINT32 index = 0;
+		for (; index < (UINT32)handles.size(); index++)
+		{
+			if (handles[index].name == paramName)
+				break;
+		}
+
+		if (index == (UINT32)handles.size())
+		{
+			TMaterialDataParam<T, false> param;
+			getHandle()->getParam(paramName, param);
+
+			if (param == nullptr)
+				return (UINT32)-1;
+
+			handles.push_back({ paramName, param });
+		}
+
+		// Encode the version so handles created before the cache was cleared can be detected
+		return (mParamHandleVersion << 16) | index;
+	}
+
+	template<class T>
+	const TMaterialDataParam<T, false>* ScriptMaterial::findParamHandle(UINT32 handle)
+	{
+		validateParamHandles();
+
+		UINT32 version = handle >> 16;
+		UINT32 index = handle & 0xFFFF;
+
+		Vector<CachedParam<T>>& handles = getParamHandles<T>();
+		if (version != mParamHandleVersion || index >= (UINT32)handles.size())
+		{
+			LOGWRN("Invalid material parameter handle. Parameter handles can only be used with the material they were " \
+				"retrieved from, and need to be retrieved again after the material's shader changes.");
+			return nullptr;
+		}
+
+		return &handles[index].param;
+	}
+
+	UINT32 ScriptMaterial::internal_GetParamFloat(ScriptMaterial* nativeInstance, MonoString* name)
+	{
+		return nativeInstance->createParamHandle<float>(name);
+	}
+
+	UINT32 ScriptMaterial::internal_GetParamVector2(ScriptMaterial* nativeInstance, MonoString* name)
+	{
+		return nativeInstance->createParamHandle<Vector2>(name);
+	}
+
+	UINT32 ScriptMaterial::internal_GetParamVector3(ScriptMaterial* nativeInstance, MonoString* name)
+	{
+		return nativeInstance->createParamHandle<Vector3>(name);
+	}
+
+	UINT32 ScriptMaterial::internal_GetParamVector4(ScriptMaterial* nativeInstance, MonoString* name)
+	{
+		return nativeInstance->createParamHandle<Vector4>(name);
+	}
+
+	UINT32 ScriptMaterial::internal_GetParamMatrix3(ScriptMaterial* nativeInstance, MonoString* name)
+	{
+		return nativeInstance->createParamHandle<Matrix3>(name);
+	}
+
+	UINT32 ScriptMaterial::internal_GetParamMatrix4(ScriptMaterial* nativeInstance, MonoString* name)
+	{
+		return nativeInstance->createParamHandle<Matrix4>(name);
+	}
+
+	UINT32 ScriptMaterial::internal_GetParamColor(ScriptMaterial* nativeInstance, MonoString* name)
+	{
+		return nativeInstance->createParamHandle<Color>(name);
+	}
+
+	void ScriptMaterial::internal_SetFloatParam(ScriptMaterial* nativeInstance, UINT32 handle, float value)
+	{
+		const TMaterialDataParam<float, false>* param = nativeInstance->findParamHandle<float>(handle);
+		if (param != nullptr)
+			param->set(value);
+	}
+
+	void ScriptMaterial::internal_SetVector2Param(ScriptMaterial* nativeInstance, UINT32 handle, Vector2* value)
+	{
+		const TMaterialDataParam<Vector2, false>* param = nativeInstance->findParamHandle<Vector2>(handle);
+		if (param != nullptr)
+			param->set(*value);
+	}
+
+	void ScriptMaterial::internal_SetVector3Param(ScriptMaterial* nativeInstance, UINT32 handle, Vector3* value)
+	{
+		const TMaterialDataParam<Vector3, false>* param = nativeInstance->findParamHandle<Vector3>(handle);
+		if (param != nullptr)
+			param->set(*value);
+	}
+
+	void ScriptMaterial::internal_SetVector4Param(ScriptMaterial* nativeInstance, UINT32 handle, Vector4* value)
+	{
+		const TMaterialDataParam<Vector4, false>* param = nativeInstance->findParamHandle<Vector4>(handle);
+		if (param != nullptr)
+			param->set(*value);
+	}
+
+	void ScriptMaterial::internal_SetMatrix3Param(ScriptMaterial* nativeInstance, UINT32 handle, Matrix3* value)
+	{
+		const TMaterialDataParam<Matrix3, false>* param = nativeInstance->findParamHandle<Matrix3>(handle);
+		if (param != nullptr)
+			param->set(*value);
+	}
+
+	void ScriptMaterial::internal_SetMatrix4Param(ScriptMaterial* nativeInstance, UINT32 handle, Matrix4* value)
+	{
+		const TMaterialDataParam<Matrix4, false>* param = nativeInstance->findParamHandle<Matrix4>(handle);
+		if (param != nullptr)
+			param->set(*value);
+	}
+
+	void ScriptMaterial::internal_SetColorParam(ScriptMaterial* nativeInstance, UINT32 handle, Color* value)
+	{
+		const TMaterialDataParam<Color, false>* param = nativeInstance->findParamHandle<Color>(handle);
+		if (param != nullptr)
+			param->set(*value);
+	}
+
+	float ScriptMaterial::internal_GetFloatParam(ScriptMaterial* nativeInstance, UINT32 handle)
+	{
+		const TMaterialDataParam<float, false>* param = nativeInstance->findParamHandle<float>(handle);
+		if (param == nullptr)
+			return 0.0f;
+
+		return param->get();
+	}
+
+	void ScriptMaterial::internal_GetVector2Param(ScriptMaterial* nativeInstance, UINT32 handle, Vector2* value)
+	{
+		const TMaterialDataParam<Vector2, false>* param = nativeInstance->findParamHandle<Vector2>(handle);
+		if (param != nullptr)
+			*value = param->get();
+	}
+
+	void ScriptMaterial::internal_GetVector3Param(ScriptMaterial* nativeInstance, UINT32 handle, Vector3* value)
+	{
+		const TMaterialDataParam<Vector3, false>* param = nativeInstance->findParamHandle<Vector3>(handle);
+		if (param != nullptr)
+			*value = param->get();
+	}
+
+	void ScriptMaterial::internal_GetVector4Param(ScriptMaterial* nativeInstance, UINT32 handle, Vector4* value)
+	{
+		const TMaterialDataParam<Vector4, false>* param = nativeInstance->findParamHandle<Vector4>(handle);
+		if (param != nullptr)
+			*value = param->get();
+	}
+
+	void ScriptMaterial::internal_GetMatrix3Param(ScriptMaterial* nativeInstance, UINT32 handle, Matrix3* value)
+	{
+		const TMaterialDataParam<Matrix3, false>* param = nativeInstance->findParamHandle<Matrix3>(handle);
+		if (param != nullptr)
+			*value = param->get();
+	}
+
+	void ScriptMaterial::internal_GetMatrix4Param(ScriptMaterial* nativeInstance, UINT32 handle, Matrix4* value)
+	{
+		const TMaterialDataParam<Matrix4, false>* param = nativeInstance->findParamHandle<Matrix4>(handle);
+		if (param != nullptr)
+			*value = param->get();
+	}
+
+	void ScriptMaterial::internal_GetColorParam(ScriptMaterial* nativeInstance, UINT32 handle, Color* value)
+	{
+		const TMaterialDataParam<Color, false>* param = nativeInstance->findParamHandle<Color>(handle);
+		if (param != nullptr)
+			*value = param->get();
+	}
+
 	MonoObject* ScriptMaterial::createInstance()
 	{
 		bool dummy = false;